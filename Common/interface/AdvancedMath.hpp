@@ -620,6 +620,69 @@ inline BoxVisibility GetBoxVisibility(const ViewFrustumExt&      ViewFrustumExt,
     return BoxVisibility::Intersecting;
 }
 
+
+/// Axis-aligned bounding boxes in structure-of-arrays layout.
+
+/// Every member points to an array that contains the corresponding coordinate of all boxes.
+struct BoundBoxSoA
+{
+    const float* MinX = nullptr;
+    const float* MinY = nullptr;
+    const float* MinZ = nullptr;
+    const float* MaxX = nullptr;
+    const float* MaxY = nullptr;
+    const float* MaxZ = nullptr;
+};
+
+/// Oriented bounding boxes in structure-of-arrays layout.
+
+/// Every member points to an array that contains the corresponding component of all boxes.
+struct OrientedBoundingBoxSoA
+{
+    const float* CenterX = nullptr;
+    const float* CenterY = nullptr;
+    const float* CenterZ = nullptr;
+
+    /// Axes[i][c] is the c-th component (x, y, z) of the i-th normalized axis.
+    const float* Axes[3][3] = {};
+
+    /// HalfExtents[i] is the half extent along the i-th axis.
+    const float* HalfExtents[3] = {};
+};
+
+/// Tests the visibility of multiple bounding boxes against the view frustum.
+
+/// \param [in]  Frustum           - View frustum.
+/// \param [in]  Boxes             - Bounding boxes in structure-of-arrays layout.
+/// \param [in]  NumBoxes          - The number of boxes.
+/// \param [out] pVisibleMask      - Array of (NumBoxes + 31) / 32 elements that receives the visibility mask.
+///                                  Bit i % 32 of element i / 32 is set if the i-th box is visible or
+///                                  intersects the frustum.
+/// \param [out] pFullyVisibleMask - Optional array of (NumBoxes + 31) / 32 elements that receives the mask
+///                                  of fully visible boxes.
+/// \param [in]  PlaneFlags        - Frustum planes to test the boxes against.
+/// \return      The number of boxes that are visible or intersect the frustum.
+///
+/// \remarks The results are the same as the results of GetBoxVisibility(const ViewFrustum&, const BoundBox&)
+///          for every box. The boxes are processed with AVX2, SSE2 or NEON instructions when available.
+Uint32 GetBoxVisibilityBatch(const ViewFrustum&  Frustum,
+                             const BoundBoxSoA&  Boxes,
+                             Uint32              NumBoxes,
+                             Uint32*             pVisibleMask,
+                             Uint32*             pFullyVisibleMask = nullptr,
+                             FRUSTUM_PLANE_FLAGS PlaneFlags        = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM);
+
+/// Tests the visibility of multiple oriented bounding boxes against the view frustum.
+
+/// \remarks The results are the same as the results of GetBoxVisibility(const ViewFrustum&, const OrientedBoundingBox&)
+///          for every box. See GetBoxVisibilityBatch(const ViewFrustum&, const BoundBoxSoA&, ...) for details.
+Uint32 GetBoxVisibilityBatch(const ViewFrustum&            Frustum,
+                             const OrientedBoundingBoxSoA& Boxes,
+                             Uint32                        NumBoxes,
+                             Uint32*                       pVisibleMask,
+                             Uint32*                       pFullyVisibleMask = nullptr,
+                             FRUSTUM_PLANE_FLAGS           PlaneFlags        = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM);
+
 inline float GetPointToBoxDistanceSqr(const BoundBox& BB, const float3& Pos)
 {
     VERIFY_EXPR(BB.Max.x >= BB.Min.x &&
@@ -0,0 +1,487 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Bounding volume hierarchy for CPU ray and box queries.
+
+#include <vector>
+
+#include "AdvancedMath.hpp"
+#include "ThreadPool.h"
+
+namespace Diligent
+{
+
+/// Bounding volume hierarchy built over a set of primitives given by their bounding boxes.
+
+/// The hierarchy is built with the binned surface area heuristic (SAH). Nodes are 32 bytes,
+/// and the two children of every interior node are stored next to each other.
+/// Primitives of every leaf occupy a contiguous range of the primitive index array.
+///
+/// All query methods are const and may be called from multiple threads simultaneously.
+class BVH
+{
+public:
+    /// The maximum depth of the hierarchy. Deeper subtrees are collapsed into leaves.
+    static constexpr Uint32 MaxDepth = 64;
+
+    struct CreateInfo
+    {
+        /// Primitive bounding boxes.
+        const BoundBox* pPrimitiveBounds = nullptr;
+
+        /// The number of primitives.
+        Uint32 NumPrimitives = 0;
+
+        /// The maximum number of primitives in a leaf node.
+        Uint32 MaxLeafSize = 4;
+
+        /// The number of bins used to evaluate the SAH.
+        Uint32 NumBins = 16;
+
+        /// An optional thread pool used to build independent subtrees in parallel.
+        IThreadPool* pThreadPool = nullptr;
+
+        /// Subtrees with fewer primitives are built by a single thread.
+        Uint32 MinPrimitivesPerTask = 16384;
+    };
+
+    struct Node
+    {
+        float3 Min;
+
+        /// For an interior node, the index of the first child. The second child immediately follows it.
+        /// For a leaf node, the index of the first primitive in the primitive index array.
+        Uint32 FirstChildOrPrimitive = 0;
+
+        float3 Max;
+
+        /// The number of primitives in a leaf node, or zero for an interior node.
+        Uint32 NumPrimitives = 0;
+
+        bool IsLeaf() const
+        {
+            return NumPrimitives != 0;
+        }
+    };
+    static_assert(sizeof(Node) == 32, "Unexpected node size");
+
+    BVH() noexcept {}
+    explicit BVH(const CreateInfo& CI);
+
+    // clang-format off
+    BVH           (const BVH&) = default;
+    BVH           (BVH&&)      = default;
+    BVH& operator=(const BVH&) = default;
+    BVH& operator=(BVH&&)      = default;
+    // clang-format on
+
+    bool IsEmpty() const
+    {
+        return m_Nodes.empty();
+    }
+
+    /// Returns the bounding box of all primitives.
+    BoundBox GetBounds() const
+    {
+        return !m_Nodes.empty() ? BoundBox{m_Nodes[0].Min, m_Nodes[0].Max} : BoundBox::Invalid();
+    }
+
+    const std::vector<Node>& GetNodes() const
+    {
+        return m_Nodes;
+    }
+
+    /// Returns the primitive indices in the order they are referenced by the leaves.
+    const std::vector<Uint32>& GetPrimitiveIndices() const
+    {
+        return m_PrimitiveIndices;
+    }
+
+    /// Ray data prepared for the traversal
+    struct TraversalRay
+    {
+        float3 Origin;
+        float3 Direction;
+        float3 InvDirection;
+
+        TraversalRay(const float3& _Origin, const float3& _Direction) :
+            Origin{_Origin},
+            Direction{_Direction}
+        {
+            static constexpr float Epsilon = 1e-20f;
+            for (size_t c = 0; c < 3; ++c)
+            {
+                // Replace zero components to avoid NaNs when the ray origin lies on the node boundary.
+                // The resulting box test is conservative.
+                const float d   = Direction[c];
+                InvDirection[c] = 1.f / (std::abs(d) > Epsilon ? d : (d >= 0 ? Epsilon : -Epsilon));
+            }
+        }
+    };
+
+    /// Relative tolerance applied to the ray/box intersection distances
+    static constexpr float DistanceTolerance = 1.f + 4.f * FLT_EPSILON;
+
+    /// Intersects the ray with the node bounding box and returns the distance
+    /// to the entry point, or +FLT_MAX if the ray misses the box or enters it farther than MaxDistance.
+    static float IntersectNode(const Node& N, const TraversalRay& Ray, float MaxDistance)
+    {
+        const float3 t0 = (N.Min - Ray.Origin) * Ray.InvDirection;
+        const float3 t1 = (N.Max - Ray.Origin) * Ray.InvDirection;
+
+        const float3 tNear = (std::min)(t0, t1);
+        const float3 tFar  = (std::max)(t0, t1);
+
+        const float EnterDist = (max)(tNear.x, tNear.y, tNear.z, 0.f);
+        const float ExitDist  = (min)(tFar.x, tFar.y, tFar.z);
+
+        // Slightly expand the interval to account for rounding errors so that the primitives
+        // exactly on the box boundary are not missed.
+        return (EnterDist <= ExitDist * DistanceTolerance && EnterDist <= MaxDistance * DistanceTolerance) ? EnterDist : +FLT_MAX;
+    }
+
+    /// Traverses the hierarchy along the ray, visiting the nodes closest to the ray origin first.
+
+    /// \param [in]     Ray         - The ray.
+    /// \param [in,out] MaxDistance - The maximum hit distance. The value is updated with the distance
+    ///                               returned by the IntersectLeaf function.
+    /// \param [in]     IntersectLeaf - The function that intersects the ray with the leaf primitives. It must
+    ///                               have the signature bool(Uint32 FirstPrimitive, Uint32 NumPrimitives, float& MaxDistance),
+    ///                               where FirstPrimitive is the index in the primitive index array. The function
+    ///                               updates MaxDistance with the closest hit distance and returns true to stop the traversal.
+    template <typename IntersectLeafType>
+    void TraverseRay(const TraversalRay& Ray, float& MaxDistance, IntersectLeafType&& IntersectLeaf) const
+    {
+        if (m_Nodes.empty() || IntersectNode(m_Nodes[0], Ray, MaxDistance) == +FLT_MAX)
+            return;
+
+        Uint32 Stack[MaxDepth];
+        Uint32 StackSize = 0;
+        Uint32 NodeIdx   = 0;
+        while (true)
+        {
+            const Node& N = m_Nodes[NodeIdx];
+            if (N.IsLeaf())
+            {
+                if (IntersectLeaf(N.FirstChildOrPrimitive, N.NumPrimitives, MaxDistance))
+                    return;
+            }
+            else
+            {
+                const Uint32 Child0 = N.FirstChildOrPrimitive;
+                const float  Dist0  = IntersectNode(m_Nodes[Child0], Ray, MaxDistance);
+                const float  Dist1  = IntersectNode(m_Nodes[Child0 + 1], Ray, MaxDistance);
+                if (Dist0 != +FLT_MAX && Dist1 != +FLT_MAX)
+                {
+                    // Visit the nearest child first
+                    const bool Child0First = Dist0 <= Dist1;
+                    VERIFY_EXPR(StackSize < MaxDepth);
+                    Stack[StackSize++] = Child0First ? Child0 + 1 : Child0;
+                    NodeIdx            = Child0First ? Child0 : Child0 + 1;
+                    continue;
+                }
+                else if (Dist0 != +FLT_MAX)
+                {
+                    NodeIdx = Child0;
+                    continue;
+                }
+                else if (Dist1 != +FLT_MAX)
+                {
+                    NodeIdx = Child0 + 1;
+                    continue;
+                }
+            }
+
+            // Pop the next node that may still contain a closer hit
+            do
+            {
+                if (StackSize == 0)
+                    return;
+                NodeIdx = Stack[--StackSize];
+            } while (IntersectNode(m_Nodes[NodeIdx], Ray, MaxDistance) == +FLT_MAX);
+        }
+    }
+
+    /// Finds the closest intersection of the ray with the primitives.
+
+    /// \param [in] RayOrigin          - Ray origin.
+    /// \param [in] RayDirection       - Ray direction.
+    /// \param [in] MaxDistance        - The maximum hit distance.
+    /// \param [in] IntersectPrimitive - The function that intersects the ray with the primitive. It must have
+    ///                                  the signature float(Uint32 PrimitiveIndex) and return the distance to
+    ///                                  the intersection, or +FLT_MAX if there is no intersection.
+    /// \param [out] pHitPrimitive     - Optional pointer to the variable that receives the index of the
+    ///                                  closest hit primitive.
+    /// \return     The distance to the closest hit, or +FLT_MAX if the ray does not hit any primitive
+    ///             within [0, MaxDistance].
+    template <typename IntersectPrimitiveType>
+    float CastRay(const float3&            RayOrigin,
+                  const float3&            RayDirection,
+                  float                    MaxDistance,
+                  IntersectPrimitiveType&& IntersectPrimitive,
+                  Uint32*                  pHitPrimitive = nullptr) const
+    {
+        float  ClosestDist  = +FLT_MAX;
+        Uint32 HitPrimitive = ~0u;
+        TraverseRay(TraversalRay{RayOrigin, RayDirection}, MaxDistance,
+                    [&](Uint32 FirstPrimitive, Uint32 NumPrimitives, float& MaxDist) {
+                        for (Uint32 i = FirstPrimitive; i < FirstPrimitive + NumPrimitives; ++i)
+                        {
+                            const Uint32 PrimIdx = m_PrimitiveIndices[i];
+                            const float  Dist    = IntersectPrimitive(PrimIdx);
+                            if (Dist != +FLT_MAX && Dist >= 0 && Dist <= MaxDist)
+                            {
+                                MaxDist      = Dist;
+                                ClosestDist  = Dist;
+                                HitPrimitive = PrimIdx;
+                            }
+                        }
+                        return false;
+                    });
+        if (pHitPrimitive != nullptr)
+            *pHitPrimitive = HitPrimitive;
+        return ClosestDist;
+    }
+
+    /// Checks if the ray hits any primitive within [0, MaxDistance].
+    /// See CastRay() for the description of the parameters.
+    template <typename IntersectPrimitiveType>
+    bool AnyHit(const float3&            RayOrigin,
+                const float3&            RayDirection,
+                float                    MaxDistance,
+                IntersectPrimitiveType&& IntersectPrimitive) const
+    {
+        bool Hit = false;
+        TraverseRay(TraversalRay{RayOrigin, RayDirection}, MaxDistance,
+                    [&](Uint32 FirstPrimitive, Uint32 NumPrimitives, float& MaxDist) {
+                        for (Uint32 i = FirstPrimitive; i < FirstPrimitive + NumPrimitives && !Hit; ++i)
+                        {
+                            const float Dist = IntersectPrimitive(m_PrimitiveIndices[i]);
+                            Hit              = Dist != +FLT_MAX && Dist >= 0 && Dist <= MaxDist;
+                        }
+                        return Hit;
+                    });
+        return Hit;
+    }
+
+    /// Visits all leaves whose bounding boxes overlap the box.
+
+    /// \param [in] Box       - The box.
+    /// \param [in] VisitLeaf - The function that must have the signature bool(Uint32 FirstPrimitive, Uint32 NumPrimitives),
+    ///                         where FirstPrimitive is the index in the primitive index array.
+    ///                         The function returns false to stop the traversal.
+    template <typename VisitLeafType>
+    void TraverseBox(const BoundBox& Box, VisitLeafType&& VisitLeaf) const
+    {
+        if (m_Nodes.empty())
+            return;
+
+        Uint32 Stack[MaxDepth + 1];
+        Uint32 StackSize   = 0;
+        Stack[StackSize++] = 0;
+        while (StackSize > 0)
+        {
+            const Node& N = m_Nodes[Stack[--StackSize]];
+            // clang-format off
+            if (N.Min.x > Box.Max.x || N.Max.x < Box.Min.x ||
+                N.Min.y > Box.Max.y || N.Max.y < Box.Min.y ||
+                N.Min.z > Box.Max.z || N.Max.z < Box.Min.z)
+                continue;
+            // clang-format on
+
+            if (N.IsLeaf())
+            {
+                if (!VisitLeaf(N.FirstChildOrPrimitive, N.NumPrimitives))
+                    return;
+            }
+            else
+            {
+                VERIFY_EXPR(StackSize + 2 <= MaxDepth + 1);
+                Stack[StackSize++] = N.FirstChildOrPrimitive + 1;
+                Stack[StackSize++] = N.FirstChildOrPrimitive;
+            }
+        }
+    }
+
+    /// Calls Callback(Uint32 PrimitiveIndex) for every primitive in the leaves that overlap the box.
+    /// The callback is responsible for testing the primitive itself and returns false to stop the query.
+    template <typename CallbackType>
+    void QueryBox(const BoundBox& Box, CallbackType&& Callback) const
+    {
+        TraverseBox(Box,
+                    [&](Uint32 FirstPrimitive, Uint32 NumPrimitives) {
+                        for (Uint32 i = FirstPrimitive; i < FirstPrimitive + NumPrimitives; ++i)
+                        {
+                            if (!Callback(m_PrimitiveIndices[i]))
+                                return false;
+                        }
+                        return true;
+                    });
+    }
+
+private:
+    std::vector<Node>   m_Nodes;
+    std::vector<Uint32> m_PrimitiveIndices;
+};
+
+
+/// Bounding volume hierarchy over a triangle mesh.
+
+/// The triangles are copied into the leaf order, so that the triangles of every
+/// leaf are stored contiguously in memory.
+class TriangleMeshBVH
+{
+public:
+    struct CreateInfo
+    {
+        /// Vertex positions.
+        const float3* pVertices = nullptr;
+
+        /// The number of vertices.
+        Uint32 NumVertices = 0;
+
+        /// Triangle list indices, three per triangle.
+        /// If null, every three consecutive vertices form a triangle.
+        const Uint32* pIndices = nullptr;
+
+        /// The number of triangles.
+        Uint32 NumTriangles = 0;
+
+        /// The maximum number of triangles in a leaf node.
+        Uint32 MaxLeafSize = 4;
+
+        /// The number of bins used to evaluate the SAH.
+        Uint32 NumBins = 16;
+
+        /// An optional thread pool used to build the hierarchy in parallel.
+        IThreadPool* pThreadPool = nullptr;
+    };
+
+    static constexpr Uint32 InvalidTriangleIndex = ~0u;
+
+    struct Ray
+    {
+        float3 Origin;
+        float3 Direction;
+
+        /// The maximum hit distance, in units of the direction length.
+        float MaxDistance = +FLT_MAX;
+    };
+
+    struct Hit
+    {
+        /// The distance to the hit point, in units of the ray direction length.
+        float Distance = +FLT_MAX;
+
+        /// The index of the hit triangle in the source mesh.
+        Uint32 TriangleIndex = InvalidTriangleIndex;
+
+        explicit operator bool() const
+        {
+            return TriangleIndex != InvalidTriangleIndex;
+        }
+    };
+
+    /// The number of rays that are traversed together by CastRays() and AnyHits().
+    static constexpr Uint32 PacketSize = 8;
+
+    TriangleMeshBVH() noexcept {}
+    explicit TriangleMeshBVH(const CreateInfo& CI);
+
+    /// Finds the closest intersection of the ray with the mesh.
+    Hit CastRay(const Ray& R, bool CullBackFace = false) const;
+
+    /// Checks if the ray hits any triangle within [0, R.MaxDistance].
+    bool AnyHit(const Ray& R, bool CullBackFace = false) const;
+
+    /// Finds the closest intersections of multiple rays with the mesh.
+
+    /// \remarks    The rays are traversed in packets of PacketSize rays, which is most efficient
+    ///             when the consecutive rays are coherent (e.g. primary rays of adjacent pixels).
+    ///             The results are the same as the results of CastRay() for every ray.
+    void CastRays(const Ray* pRays, Uint32 NumRays, Hit* pHits, bool CullBackFace = false) const;
+
+    /// Checks if the rays hit any triangle. Sets pResults[i] to true if the i-th ray hits the mesh.
+    /// See CastRays() for details.
+    void AnyHits(const Ray* pRays, Uint32 NumRays, bool* pResults, bool CullBackFace = false) const;
+
+    /// Calls Callback(Uint32 TriangleIndex) for every triangle whose bounding box overlaps the box.
+    /// If the callback returns false, the query stops.
+    template <typename CallbackType>
+    void QueryBox(const BoundBox& Box, CallbackType&& Callback) const
+    {
+        const std::vector<Uint32>& TriangleIndices = m_BVH.GetPrimitiveIndices();
+        m_BVH.TraverseBox(Box,
+                          [&](Uint32 FirstTriangle, Uint32 NumTriangles) {
+                              for (Uint32 i = FirstTriangle; i < FirstTriangle + NumTriangles; ++i)
+                              {
+                                  const Triangle& Tri    = m_Triangles[i];
+                                  const float3    TriMin = (std::min)((std::min)(Tri.V0, Tri.V1), Tri.V2);
+                                  const float3    TriMax = (std::max)((std::max)(Tri.V0, Tri.V1), Tri.V2);
+                                  // clang-format off
+                                  if (TriMin.x > Box.Max.x || TriMax.x < Box.Min.x ||
+                                      TriMin.y > Box.Max.y || TriMax.y < Box.Min.y ||
+                                      TriMin.z > Box.Max.z || TriMax.z < Box.Min.z)
+                                      continue;
+                                  // clang-format on
+                                  if (!Callback(TriangleIndices[i]))
+                                      return false;
+                              }
+                              return true;
+                          });
+    }
+
+    const BVH& GetBVH() const
+    {
+        return m_BVH;
+    }
+
+    Uint32 GetNumTriangles() const
+    {
+        return static_cast<Uint32>(m_Triangles.size());
+    }
+
+private:
+    template <bool AnyHitQuery>
+    void TraversePacket(const Ray* pRays, Uint32 NumRays, Hit* pHits, bool CullBackFace) const;
+
+    struct Triangle
+    {
+        float3 V0;
+        float3 V1;
+        float3 V2;
+    };
+
+    BVH m_BVH;
+
+    // Triangles in the leaf order
+    std::vector<Triangle> m_Triangles;
+};
+
+} // namespace Diligent
@@ -3036,3 +3036,7 @@ constexpr T(min)(const T& x, const T& y, const T& z, const RestArgsType&... Rest
 #ifdef _MSC_VER
 #    pragma warning(pop)
 #endif
+
+#if DILIGENT_USE_SIMD_MATH
+#    include "BasicMathSIMD.hpp"
+#endif
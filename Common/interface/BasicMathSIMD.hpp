@@ -0,0 +1,379 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// SIMD implementations of the most frequently used single-precision matrix and quaternion operations.
+///
+/// The functions in the SIMDMath namespace produce the same results as the corresponding
+/// BasicMath.hpp functions up to floating-point rounding and fall back to the scalar
+/// implementation when no SIMD instruction set is available.
+///
+/// The batch functions (MultiplyMatrices, TransformPoints, etc.) process arrays of values
+/// and are implemented in BasicMathSIMD.cpp. Source and destination arrays may be the same,
+/// but must not partially overlap.
+///
+/// If DILIGENT_USE_SIMD_MATH is defined to 1 for all translation units, float4x4::Mul
+/// (and thus float4x4 * float4x4) is redirected to SIMDMath::Mul. Other operators are constexpr
+/// and always use the scalar implementation.
+
+#include "BasicMath.hpp"
+#include "../../Platforms/interface/Intrinsics.hpp"
+
+#if DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+#    define DILIGENT_SIMD_MATH_SUPPORTED 1
+#endif
+
+namespace Diligent
+{
+
+namespace SIMDMath
+{
+
+#if DILIGENT_SSE2_ENABLED
+
+inline __m128 LoadRow(const float4x4& m, int row)
+{
+    return _mm_loadu_ps(m.m[row]);
+}
+
+inline void StoreRow(float4x4& m, int row, __m128 r)
+{
+    _mm_storeu_ps(m.m[row], r);
+}
+
+/// Computes v * m, where v is given by its components broadcast to all lanes.
+inline __m128 TransformRow(__m128 x, __m128 y, __m128 z, __m128 w, __m128 r0, __m128 r1, __m128 r2, __m128 r3)
+{
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, r0), _mm_mul_ps(y, r1)),
+                      _mm_add_ps(_mm_mul_ps(z, r2), _mm_mul_ps(w, r3)));
+}
+
+#elif DILIGENT_NEON_ENABLED
+
+inline float32x4_t LoadRow(const float4x4& m, int row)
+{
+    return vld1q_f32(m.m[row]);
+}
+
+inline void StoreRow(float4x4& m, int row, float32x4_t r)
+{
+    vst1q_f32(m.m[row], r);
+}
+
+#endif
+
+/// Returns m1 * m2.
+inline float4x4 Mul(const float4x4& m1, const float4x4& m2)
+{
+#if DILIGENT_SSE2_ENABLED
+    const __m128 r0 = LoadRow(m2, 0);
+    const __m128 r1 = LoadRow(m2, 1);
+    const __m128 r2 = LoadRow(m2, 2);
+    const __m128 r3 = LoadRow(m2, 3);
+
+    float4x4 Res;
+    for (int i = 0; i < 4; ++i)
+    {
+        const __m128 a = LoadRow(m1, i);
+        StoreRow(Res, i,
+                 TransformRow(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0)),
+                              _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1)),
+                              _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 2, 2)),
+                              _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 3)),
+                              r0, r1, r2, r3));
+    }
+    return Res;
+#elif DILIGENT_NEON_ENABLED
+    const float32x4_t r0 = LoadRow(m2, 0);
+    const float32x4_t r1 = LoadRow(m2, 1);
+    const float32x4_t r2 = LoadRow(m2, 2);
+    const float32x4_t r3 = LoadRow(m2, 3);
+
+    float4x4 Res;
+    for (int i = 0; i < 4; ++i)
+    {
+        float32x4_t r = vmulq_n_f32(r0, m1.m[i][0]);
+        r             = vmlaq_n_f32(r, r1, m1.m[i][1]);
+        r             = vmlaq_n_f32(r, r2, m1.m[i][2]);
+        r             = vmlaq_n_f32(r, r3, m1.m[i][3]);
+        StoreRow(Res, i, r);
+    }
+    return Res;
+#else
+    float4x4 Res;
+    for (int i = 0; i < 4; i++)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            for (int k = 0; k < 4; k++)
+            {
+                Res.m[i][j] += m1.m[i][k] * m2.m[k][j];
+            }
+        }
+    }
+    return Res;
+#endif
+}
+
+/// Returns v * m.
+inline float4 Transform(const float4& v, const float4x4& m)
+{
+#if DILIGENT_SSE2_ENABLED
+    float4 Res;
+    _mm_storeu_ps(&Res.x,
+                  TransformRow(_mm_set1_ps(v.x), _mm_set1_ps(v.y), _mm_set1_ps(v.z), _mm_set1_ps(v.w),
+                               LoadRow(m, 0), LoadRow(m, 1), LoadRow(m, 2), LoadRow(m, 3)));
+    return Res;
+#elif DILIGENT_NEON_ENABLED
+    float32x4_t r = vmulq_n_f32(LoadRow(m, 0), v.x);
+    r             = vmlaq_n_f32(r, LoadRow(m, 1), v.y);
+    r             = vmlaq_n_f32(r, LoadRow(m, 2), v.z);
+    r             = vmlaq_n_f32(r, LoadRow(m, 3), v.w);
+
+    float4 Res;
+    vst1q_f32(&Res.x, r);
+    return Res;
+#else
+    return v * m;
+#endif
+}
+
+/// Returns the transpose of m.
+inline float4x4 Transpose(const float4x4& m)
+{
+#if DILIGENT_SSE2_ENABLED
+    __m128 r0 = LoadRow(m, 0);
+    __m128 r1 = LoadRow(m, 1);
+    __m128 r2 = LoadRow(m, 2);
+    __m128 r3 = LoadRow(m, 3);
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+    float4x4 Res;
+    StoreRow(Res, 0, r0);
+    StoreRow(Res, 1, r1);
+    StoreRow(Res, 2, r2);
+    StoreRow(Res, 3, r3);
+    return Res;
+#elif DILIGENT_NEON_ENABLED
+    // De-interleaving load returns matrix columns
+    const float32x4x4_t Cols = vld4q_f32(&m.m[0][0]);
+
+    float4x4 Res;
+    StoreRow(Res, 0, Cols.val[0]);
+    StoreRow(Res, 1, Cols.val[1]);
+    StoreRow(Res, 2, Cols.val[2]);
+    StoreRow(Res, 3, Cols.val[3]);
+    return Res;
+#else
+    return m.Transpose();
+#endif
+}
+
+#if DILIGENT_SSE2_ENABLED
+// 2x2 matrices are packed into a single register as (m00, m01, m10, m11)
+
+// A * B
+inline __m128 Mat2Mul(__m128 A, __m128 B)
+{
+    return _mm_add_ps(_mm_mul_ps(A, _mm_shuffle_ps(B, B, _MM_SHUFFLE(3, 0, 3, 0))),
+                      _mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 2, 1, 2))));
+}
+
+// adj(A) * B
+inline __m128 Mat2AdjMul(__m128 A, __m128 B)
+{
+    return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(0, 0, 3, 3)), B),
+                      _mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 0, 3, 2))));
+}
+
+// A * adj(B)
+inline __m128 Mat2MulAdj(__m128 A, __m128 B)
+{
+    return _mm_sub_ps(_mm_mul_ps(A, _mm_shuffle_ps(B, B, _MM_SHUFFLE(0, 3, 0, 3))),
+                      _mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 2, 1, 2))));
+}
+#endif
+
+/// Returns the inverse of m.
+///
+/// \remarks    Like float4x4::Inverse(), the function does not check if the matrix is singular.
+inline float4x4 Inverse(const float4x4& m)
+{
+#if DILIGENT_SSE2_ENABLED
+    // Block-wise inversion:
+    //
+    //      M = | A  B |
+    //          | C  D |
+    //
+    // where A, B, C, D are 2x2 matrices, which allows computing all 2x2 adjugates
+    // and determinants in parallel.
+    const __m128 r0 = LoadRow(m, 0);
+    const __m128 r1 = LoadRow(m, 1);
+    const __m128 r2 = LoadRow(m, 2);
+    const __m128 r3 = LoadRow(m, 3);
+
+    const __m128 A = _mm_movelh_ps(r0, r1);
+    const __m128 B = _mm_movehl_ps(r1, r0);
+    const __m128 C = _mm_movelh_ps(r2, r3);
+    const __m128 D = _mm_movehl_ps(r3, r2);
+
+    // (|A|, |B|, |C|, |D|)
+    const __m128 DetSub = _mm_sub_ps(
+        _mm_mul_ps(_mm_shuffle_ps(r0, r2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(3, 1, 3, 1))),
+        _mm_mul_ps(_mm_shuffle_ps(r0, r2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(2, 0, 2, 0))));
+
+    const __m128 DetA = _mm_shuffle_ps(DetSub, DetSub, _MM_SHUFFLE(0, 0, 0, 0));
+    const __m128 DetB = _mm_shuffle_ps(DetSub, DetSub, _MM_SHUFFLE(1, 1, 1, 1));
+    const __m128 DetC = _mm_shuffle_ps(DetSub, DetSub, _MM_SHUFFLE(2, 2, 2, 2));
+    const __m128 DetD = _mm_shuffle_ps(DetSub, DetSub, _MM_SHUFFLE(3, 3, 3, 3));
+
+    const __m128 D_C = Mat2AdjMul(D, C);
+    const __m128 A_B = Mat2AdjMul(A, B);
+
+    // Adjugates of the inverse blocks, scaled by |M|
+    __m128 X = _mm_sub_ps(_mm_mul_ps(DetD, A), Mat2Mul(B, D_C));
+    __m128 W = _mm_sub_ps(_mm_mul_ps(DetA, D), Mat2Mul(C, A_B));
+    __m128 Y = _mm_sub_ps(_mm_mul_ps(DetB, C), Mat2MulAdj(D, A_B));
+    __m128 Z = _mm_sub_ps(_mm_mul_ps(DetC, B), Mat2MulAdj(A, D_C));
+
+    // |M| = |A|*|D| + |B|*|C| - tr(adj(A)*B*adj(D)*C)
+    __m128 Tr = _mm_mul_ps(A_B, _mm_shuffle_ps(D_C, D_C, _MM_SHUFFLE(3, 1, 2, 0)));
+    Tr        = _mm_add_ps(Tr, _mm_movehl_ps(Tr, Tr));
+    Tr        = _mm_add_ss(Tr, _mm_shuffle_ps(Tr, Tr, _MM_SHUFFLE(1, 1, 1, 1)));
+    Tr        = _mm_shuffle_ps(Tr, Tr, _MM_SHUFFLE(0, 0, 0, 0));
+
+    const __m128 DetM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(DetA, DetD), _mm_mul_ps(DetB, DetC)), Tr);
+
+    // (1/|M|, -1/|M|, -1/|M|, 1/|M|)
+    const __m128 RcpDetM = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), DetM);
+
+    X = _mm_mul_ps(X, RcpDetM);
+    Y = _mm_mul_ps(Y, RcpDetM);
+    Z = _mm_mul_ps(Z, RcpDetM);
+    W = _mm_mul_ps(W, RcpDetM);
+
+    // Apply the adjugate swizzle and re-assemble the rows
+    float4x4 Res;
+    StoreRow(Res, 0, _mm_shuffle_ps(X, Y, _MM_SHUFFLE(1, 3, 1, 3)));
+    StoreRow(Res, 1, _mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 2, 0, 2)));
+    StoreRow(Res, 2, _mm_shuffle_ps(Z, W, _MM_SHUFFLE(1, 3, 1, 3)));
+    StoreRow(Res, 3, _mm_shuffle_ps(Z, W, _MM_SHUFFLE(0, 2, 0, 2)));
+    return Res;
+#else
+    return m.Inverse();
+#endif
+}
+
+/// Returns q1 * q2.
+inline QuaternionF Mul(const QuaternionF& q1, const QuaternionF& q2)
+{
+    // q1 * q2 = w1 * ( x2,  y2,  z2,  w2) +
+    //           x1 * ( w2, -z2,  y2, -x2) +
+    //           y1 * ( z2,  w2, -x2, -y2) +
+    //           z1 * (-y2,  x2,  w2, -z2)
+#if DILIGENT_SSE2_ENABLED
+    const __m128 b  = _mm_loadu_ps(&q2.q.x);
+    const __m128 bx = _mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 1, 2, 3)), _mm_setr_ps(+1.f, -1.f, +1.f, -1.f));
+    const __m128 by = _mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2)), _mm_setr_ps(+1.f, +1.f, -1.f, -1.f));
+    const __m128 bz = _mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1)), _mm_setr_ps(-1.f, +1.f, +1.f, -1.f));
+
+    QuaternionF Res;
+    _mm_storeu_ps(&Res.q.x,
+                  TransformRow(_mm_set1_ps(q1.q.w), _mm_set1_ps(q1.q.x), _mm_set1_ps(q1.q.y), _mm_set1_ps(q1.q.z),
+                               b, bx, by, bz));
+    return Res;
+#elif DILIGENT_NEON_ENABLED
+    static constexpr float SignX[] = {+1.f, -1.f, +1.f, -1.f};
+    static constexpr float SignY[] = {+1.f, +1.f, -1.f, -1.f};
+    static constexpr float SignZ[] = {-1.f, +1.f, +1.f, -1.f};
+
+    const float32x4_t b    = vld1q_f32(&q2.q.x);
+    const float32x4_t b_yx = vrev64q_f32(b); // (y, x, w, z)
+    const float32x4_t bx   = vmulq_f32(vcombine_f32(vget_high_f32(b_yx), vget_low_f32(b_yx)), vld1q_f32(SignX));
+    const float32x4_t by   = vmulq_f32(vextq_f32(b, b, 2), vld1q_f32(SignY));
+    const float32x4_t bz   = vmulq_f32(b_yx, vld1q_f32(SignZ));
+
+    float32x4_t r = vmulq_n_f32(b, q1.q.w);
+    r             = vmlaq_n_f32(r, bx, q1.q.x);
+    r             = vmlaq_n_f32(r, by, q1.q.y);
+    r             = vmlaq_n_f32(r, bz, q1.q.z);
+
+    QuaternionF Res;
+    vst1q_f32(&Res.q.x, r);
+    return Res;
+#else
+    return QuaternionF::Mul(q1, q2);
+#endif
+}
+
+} // namespace SIMDMath
+
+
+/// Computes pDst[i] = pLeft[i] * pRight[i] for every i in [0, Count).
+void MultiplyMatrices(const float4x4* pLeft, const float4x4* pRight, float4x4* pDst, Uint32 Count);
+
+/// Computes pDst[i] = pLeft[i] * Right for every i in [0, Count).
+///
+/// \remarks   This is the typical operation when propagating transforms in a scene graph (Local * ParentWorld).
+void MultiplyMatrices(const float4x4* pLeft, const float4x4& Right, float4x4* pDst, Uint32 Count);
+
+/// Computes pDst[i] = Left * pRight[i] for every i in [0, Count).
+void MultiplyMatrices(const float4x4& Left, const float4x4* pRight, float4x4* pDst, Uint32 Count);
+
+/// Computes pDst[i] = pSrc[i].Transpose() for every i in [0, Count).
+void TransposeMatrices(const float4x4* pSrc, float4x4* pDst, Uint32 Count);
+
+/// Computes pDst[i] = pSrc[i].Inverse() for every i in [0, Count).
+void InvertMatrices(const float4x4* pSrc, float4x4* pDst, Uint32 Count);
+
+/// Computes pDst[i] = pSrc[i] * Mat for every i in [0, Count).
+void TransformPoints(const float4* pSrc, const float4x4& Mat, float4* pDst, Uint32 Count);
+
+/// Computes pDst[i] = pSrc[i] * Mat for every i in [0, Count).
+///
+/// \remarks   Same as float3 * float4x4, the points are extended with w = 1, and the
+///             result is divided by the w component.
+void TransformPoints(const float3* pSrc, const float4x4& Mat, float3* pDst, Uint32 Count);
+
+/// Transforms direction vectors: pDst[i] = (float4{pSrc[i], 0} * Mat).xyz for every i in [0, Count).
+///
+/// \remarks   The translation part of the matrix is ignored, and no division by w is performed.
+void TransformVectors(const float3* pSrc, const float4x4& Mat, float3* pDst, Uint32 Count);
+
+/// Computes pDst[i] = pLeft[i] * pRight[i] for every i in [0, Count).
+void MultiplyQuaternions(const QuaternionF* pLeft, const QuaternionF* pRight, QuaternionF* pDst, Uint32 Count);
+
+#if DILIGENT_USE_SIMD_MATH
+template <>
+inline float4x4 float4x4::Mul(const float4x4& m1, const float4x4& m2)
+{
+    return SIMDMath::Mul(m1, m2);
+}
+#endif
+
+} // namespace Diligent
@@ -92,6 +92,11 @@ public:
 
     static bool ReadWholeFile(const char* FilePath, std::vector<Uint8>& Data, bool Silent = false);
     static bool ReadWholeFile(const char* FilePath, IDataBlob** ppData, bool Silent = false);
+
+    /// Maps the whole file into memory, see FileSystem::MapFile(). If the file can't be mapped,
+    /// e.g. because it is empty or the platform does not support memory-mapped files, reads it
+    /// with ReadWholeFile(). Either way, the returned data blob is the only owner of the data.
+    static bool MapWholeFile(const char* FilePath, IDataBlob** ppData, EMappedFileAccessHint Hint = EMappedFileAccessHint::Normal, bool Silent = false);
     static bool WriteFile(const char* FilePath, const void* Data, size_t Size, bool Silent = false);
 
 private:
@@ -35,19 +35,36 @@
 #include <unordered_set>
 #include <vector>
 #include <cstring>
+#include <cstddef>
 #include <memory>
 #include "../../Primitives/interface/Errors.hpp"
 #include "../../Primitives/interface/MemoryAllocator.h"
 #include "STDAllocator.hpp"
+#include "SpinLock.hpp"
 
 namespace Diligent
 {
 
 /// Memory allocator that allocates memory in a fixed-size chunks
+
+/// Memory pages are aligned by their size, and every page starts with a header that identifies the page.
+/// This allows finding the page that owns the block in constant time.
+///
+/// If the thread cache size is not zero, the allocator keeps a number of caches (magazines) of free blocks.
+/// Every thread uses one of the caches, so that most allocations and deallocations only lock the cache
+/// and not the shared page pool. When the cache is empty, it is refilled with ThreadCacheSize blocks from
+/// the pool under a single lock; when it is full, ThreadCacheSize blocks are returned to the pool.
 class FixedBlockMemoryAllocator final : public IMemoryAllocator
 {
 public:
-    FixedBlockMemoryAllocator(IMemoryAllocator& RawMemoryAllocator, size_t BlockSize, Uint32 NumBlocksInPage);
+    /// \param [in] RawMemoryAllocator - Raw memory allocator that is used to allocate pages.
+    /// \param [in] BlockSize          - Block size.
+    /// \param [in] NumBlocksInPage    - The minimum number of blocks in one page. The actual number may be greater
+    ///                                  as the page size is rounded up to the power of two.
+    /// \param [in] ThreadCacheSize    - The number of blocks that a thread cache exchanges with the page pool at once.
+    ///                                  Every cache holds up to 2 * ThreadCacheSize free blocks.
+    ///                                  If zero, thread caches are disabled.
+    FixedBlockMemoryAllocator(IMemoryAllocator& RawMemoryAllocator, size_t BlockSize, Uint32 NumBlocksInPage, Uint32 ThreadCacheSize = 0);
     ~FixedBlockMemoryAllocator();
 
     /// Allocates block of memory
@@ -72,6 +89,17 @@ private:
 
     void CreateNewPage();
 
+    static size_t GetPageSize(size_t BlockSize, Uint32 NumBlocksInPage);
+    static Uint32 GetNumBlocksInPage(size_t BlockSize, size_t PageSize);
+
+    // Allocates the block from the page pool. m_Mutex must be locked.
+    void* AllocateFromPages();
+    // Returns the block to the page pool. m_Mutex must be locked.
+    void FreeToPages(void* Ptr);
+
+    struct ThreadCache;
+    ThreadCache& GetThreadCache();
+
     // Memory page class is based on the fixed-size memory pool described in "Fast Efficient Fixed-Size Memory Pool"
     // by Ben Kenwright
     class MemoryPage
@@ -82,13 +110,16 @@ private:
         static constexpr Uint8 DeallocatedBlockMemPattern = 0xDE;
         static constexpr Uint8 InitializedBlockMemPattern = 0xCF;
 
-        MemoryPage(FixedBlockMemoryAllocator& OwnerAllocator);
+        MemoryPage(FixedBlockMemoryAllocator& OwnerAllocator, size_t PageId);
         MemoryPage(MemoryPage&& Page) noexcept;
 
         ~MemoryPage();
 
         void* GetBlockStartAddress(Uint32 BlockIndex) const;
 
+        // Returns the index of the page that owns the block
+        static size_t GetPageId(const void* pBlockAddr, const FixedBlockMemoryAllocator& OwnerAllocator);
+
 #ifdef DILIGENT_DEBUG
         void dbgVerifyAddress(const void* pBlockAddr) const;
 #endif
@@ -104,6 +135,18 @@ private:
         MemoryPage& operator=(const MemoryPage) = delete;
         MemoryPage& operator=(MemoryPage&&) = delete;
 
+        // Page header that is located at the beginning of every page
+        struct PageHeader
+        {
+            const FixedBlockMemoryAllocator* pOwner = nullptr;
+            size_t                           PageId = 0;
+        };
+
+    public:
+        // Keep the default alignment of the blocks
+        static constexpr size_t HeaderSize = (sizeof(PageHeader) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+    private:
         Uint32                     m_NumFreeBlocks        = 0;       // Num of remaining blocks
         Uint32                     m_NumInitializedBlocks = 0;       // Num of initialized blocks
         void*                      m_pPageStart           = nullptr; // Beginning of memory pool
@@ -114,14 +157,25 @@ private:
     std::vector<MemoryPage, STDAllocatorRawMem<MemoryPage>>                                          m_PagePool;
     std::unordered_set<size_t, std::hash<size_t>, std::equal_to<size_t>, STDAllocatorRawMem<size_t>> m_AvailablePages;
 
-    using AddrToPageIdMapElem = std::pair<void* const, size_t>;
-    std::unordered_map<void*, size_t, std::hash<void*>, std::equal_to<void*>, STDAllocatorRawMem<AddrToPageIdMapElem>> m_AddrToPageId;
-
     std::mutex m_Mutex;
 
     IMemoryAllocator& m_RawMemoryAllocator;
     const size_t      m_BlockSize;
-    const Uint32      m_NumBlocksInPage;
+    // The page size is a power of two, and pages are aligned by their size
+    const size_t m_PageSize;
+    const Uint32 m_NumBlocksInPage;
+
+    struct alignas(64) ThreadCache
+    {
+        Threading::SpinLock Lock;
+
+        // Free blocks, the last one is allocated first
+        void** ppBlocks  = nullptr;
+        Uint32 NumBlocks = 0;
+    };
+    const Uint32 m_ThreadCacheSize;
+    Uint32       m_NumThreadCaches = 0;
+    ThreadCache* m_ThreadCaches    = nullptr;
 };
 
 IMemoryAllocator& GetRawAllocator();
@@ -184,6 +184,38 @@ inline std::size_t ComputeHashRaw(const void* pData, size_t Size) noexcept
     return Hash;
 }
 
+/// Computes the 64-bit XXH3 hash of the data.
+/// The result is the same on all platforms and can be stored persistently.
+Uint64 ComputeXXH3Hash(const void* pData, size_t Size, Uint64 Seed = 0) noexcept;
+
+/// Raw data hashing method.
+enum class RawHashMethod : Uint8
+{
+    /// Combines the hashes of 32-bit words of the data, see ComputeHashRaw(const void*, size_t).
+    /// Works well for small data, but is slow for large blobs as every word
+    /// depends on the previous one.
+    Combine = 0,
+
+    /// Uses the SIMD-accelerated XXH3 hash. Much faster for data larger than a few hundred bytes.
+    XXH3
+};
+
+/// Computes the hash of the raw data using the specified method.
+inline std::size_t ComputeHashRaw(const void* pData, size_t Size, RawHashMethod Method) noexcept
+{
+    if (Method == RawHashMethod::XXH3)
+    {
+        const Uint64 Hash = ComputeXXH3Hash(pData, Size);
+#if defined(DILIGENT_PLATFORM_64)
+        return static_cast<size_t>(Hash);
+#else
+        return static_cast<size_t>((Hash & ~Uint32{0}) ^ (Hash >> Uint64{32}));
+#endif
+    }
+
+    return ComputeHashRaw(pData, Size);
+}
+
 template <typename CharType>
 struct CStringHash
 {
@@ -19,6 +19,9 @@
 
 #include <unordered_map>
 #include <deque>
+#include <list>
+#include <functional>
+#include <array>
 #include <mutex>
 #include <memory>
 #include <algorithm>
@@ -30,6 +33,79 @@
 namespace Diligent
 {
 
+/// Wraps the data stored in LRUCache and ShardedLRUCache and implements atomic data initialization.
+template <typename DataType>
+class LRUCacheDataWrapper
+{
+public:
+    enum class DataState
+    {
+        InitFailure = -1,
+        Default,
+        InitializedUnaccounted,
+        InitializedAccounted
+    };
+
+    template <typename InitDataType>
+    const DataType& GetData(InitDataType&& InitData, bool& IsNewObject) noexcept(false)
+    {
+        std::lock_guard<std::mutex> Lock{m_InitDataMtx};
+        if (m_DataSize == 0)
+        {
+            VERIFY_EXPR(m_State == DataState::Default || m_State == DataState::InitFailure);
+            m_State.store(DataState::Default); /* <F2D> */
+            try
+            {
+                size_t DataSize = 0;
+                InitData(m_Data, DataSize); // May throw
+                VERIFY_EXPR(DataSize > 0);
+                m_DataSize.store((std::max)(DataSize, size_t{1}));
+                m_State.store(DataState::InitializedUnaccounted); /* <D2U> */
+                IsNewObject = true;                               /* <NewObj> */
+            }
+            catch (...)
+            {
+                m_Data = {};
+                m_State.store(DataState::InitFailure); /* <D2F> */
+                throw;
+            }
+        }
+        else
+        {
+            VERIFY_EXPR(m_State == DataState::InitializedUnaccounted || m_State == DataState::InitializedAccounted);
+            VERIFY_EXPR(m_DataSize != 0);
+        }
+        return m_Data;
+    }
+
+    void SetAccounted()
+    {
+        VERIFY(m_State == DataState::InitializedUnaccounted, "Initializing accounted size for an object that is not initialized.");
+        VERIFY(m_AccountedSize == 0, "Accounted size has already been initialized.");
+        VERIFY(m_DataSize != 0, "Data size has not been initialized.");
+        m_AccountedSize.store(m_DataSize.load());
+        m_State.store(DataState::InitializedAccounted); /* <U2A> */
+    }
+
+    size_t GetAccountedSize() const
+    {
+        VERIFY_EXPR((m_State == DataState::InitializedAccounted && m_AccountedSize != 0) || (m_AccountedSize == 0));
+        return m_AccountedSize.load();
+    }
+
+    DataState GetState() const { return m_State; }
+
+private:
+    std::mutex m_InitDataMtx;
+    DataType   m_Data;
+
+    std::atomic<DataState> m_State{DataState::Default};
+
+    std::atomic<size_t> m_DataSize{0};
+    // The size that was accounted in the cache
+    std::atomic<size_t> m_AccountedSize{0};
+};
+
 /// A thread-safe and exception-safe LRU cache.
 ///
 /// Usage example:
@@ -242,76 +318,7 @@ public:
     }
 
 private:
-    class DataWrapper
-    {
-    public:
-        enum class DataState
-        {
-            InitFailure = -1,
-            Default,
-            InitializedUnaccounted,
-            InitializedAccounted
-        };
-
-        template <typename InitDataType>
-        const DataType& GetData(InitDataType&& InitData, bool& IsNewObject) noexcept(false)
-        {
-            std::lock_guard<std::mutex> Lock{m_InitDataMtx};
-            if (m_DataSize == 0)
-            {
-                VERIFY_EXPR(m_State == DataState::Default || m_State == DataState::InitFailure);
-                m_State.store(DataState::Default); /* <F2D> */
-                try
-                {
-                    size_t DataSize = 0;
-                    InitData(m_Data, DataSize); // May throw
-                    VERIFY_EXPR(DataSize > 0);
-                    m_DataSize.store((std::max)(DataSize, size_t{1}));
-                    m_State.store(DataState::InitializedUnaccounted); /* <D2U> */
-                    IsNewObject = true;                               /* <NewObj> */
-                }
-                catch (...)
-                {
-                    m_Data = {};
-                    m_State.store(DataState::InitFailure); /* <D2F> */
-                    throw;
-                }
-            }
-            else
-            {
-                VERIFY_EXPR(m_State == DataState::InitializedUnaccounted || m_State == DataState::InitializedAccounted);
-                VERIFY_EXPR(m_DataSize != 0);
-            }
-            return m_Data;
-        }
-
-        void SetAccounted()
-        {
-            VERIFY(m_State == DataState::InitializedUnaccounted, "Initializing accounted size for an object that is not initialized.");
-            VERIFY(m_AccountedSize == 0, "Accounted size has already been initialized.");
-            VERIFY(m_DataSize != 0, "Data size has not been initialized.");
-            m_AccountedSize.store(m_DataSize.load());
-            m_State.store(DataState::InitializedAccounted); /* <U2A> */
-        }
-
-        size_t GetAccountedSize() const
-        {
-            VERIFY_EXPR((m_State == DataState::InitializedAccounted && m_AccountedSize != 0) || (m_AccountedSize == 0));
-            return m_AccountedSize.load();
-        }
-
-        DataState GetState() const { return m_State; }
-
-    private:
-        std::mutex m_InitDataMtx;
-        DataType   m_Data;
-
-        std::atomic<DataState> m_State{DataState::Default};
-
-        std::atomic<size_t> m_DataSize{0};
-        // The size that was accounted in the cache
-        std::atomic<size_t> m_AccountedSize{0};
-    };
+    using DataWrapper = LRUCacheDataWrapper<DataType>;
 
     std::shared_ptr<DataWrapper> GetDataWrapper(const KeyType& Key)
     {
@@ -349,4 +356,297 @@ private:
     std::atomic<size_t> m_MaxSize{0};
 };
 
+
+/// A thread-safe and exception-safe LRU cache that is split into multiple shards to reduce lock contention.
+///
+/// The interface and the data initialization semantics are the same as in LRUCache.
+/// The keys are distributed between NumShards shards by their hash. Every shard is protected by its own
+/// mutex and keeps its own LRU list, so that lookups of different keys from multiple threads rarely
+/// contend for the same lock. Moving the entry to the front of the list on a hit is O(1).
+///
+/// The maximum size is a single budget for the entire cache. When the total size exceeds the budget,
+/// the least recently used entries are evicted starting with the largest shard.
+/// Note that the LRU order is only maintained within a shard, so the eviction order is approximate.
+template <typename KeyType, typename DataType, typename KeyHasher = std::hash<KeyType>, size_t NumShards = 16>
+class ShardedLRUCache
+{
+public:
+    static_assert(NumShards > 0, "The number of shards must not be zero");
+
+    ShardedLRUCache() noexcept
+    {}
+
+    explicit ShardedLRUCache(size_t MaxSize) noexcept :
+        m_MaxSize{MaxSize}
+    {}
+
+    // clang-format off
+    ShardedLRUCache           (const ShardedLRUCache&)  = delete;
+    ShardedLRUCache           (      ShardedLRUCache&&) = delete;
+    ShardedLRUCache& operator=(const ShardedLRUCache&)  = delete;
+    ShardedLRUCache& operator=(      ShardedLRUCache&&) = delete;
+    // clang-format on
+
+    /// Finds the data in the cache and returns it. If the data is not found, it is atomically created
+    /// using the provided initializer. See LRUCache::Get().
+    template <typename InitDataType>
+    DataType Get(const KeyType& Key,
+                 InitDataType&& InitData // May throw
+                 ) noexcept(false)
+    {
+        if (m_MaxSize.load() == 0 && m_CurrSize.load() == 0)
+        {
+            DataType Data;
+            size_t   DataSize = 0;
+            InitData(Data, DataSize); // May throw
+            return Data;
+        }
+
+        Shard& CacheShard = m_Shards[GetShardIndex(Key)];
+
+        // Get the data wrapper. Since this is a shared pointer, it may not be destroyed
+        // while we keep one, even if it is evicted from the cache by another thread.
+        auto pDataWrpr = CacheShard.GetDataWrapper(Key);
+        VERIFY_EXPR(pDataWrpr);
+
+        // Get data by value. It will be atomically initialized if necessary,
+        // while the shard mutex is not locked.
+        bool IsNewObject = false;
+        // InitData may throw, which will leave the wrapper in the cache in the 'InitFailure' state.
+        // It will be removed from the cache when the entry is evicted.
+        auto Data = pDataWrpr->GetData(std::forward<InitDataType>(InitData), IsNewObject);
+
+        if (IsNewObject)
+        {
+            // See the comments in LRUCache::Get() for the details of the wrapper state handling.
+            std::lock_guard<std::mutex> Lock{CacheShard.Mtx};
+
+            // NB: since we released the shard mutex, the wrapper may have been evicted or
+            //     replaced with a new one by another thread.
+            auto it = CacheShard.Map.find(Key);
+            if (it != CacheShard.Map.end() && it->second->pDataWrpr == pDataWrpr)
+            {
+                pDataWrpr->SetAccounted();
+
+                const size_t AccountedSize = pDataWrpr->GetAccountedSize();
+                CacheShard.Size.fetch_add(AccountedSize);
+                m_CurrSize.fetch_add(AccountedSize);
+            }
+        }
+
+        // Cache hits that do not change the size never touch other shards
+        if (m_CurrSize.load() > m_MaxSize.load())
+            Evict();
+
+        return Data;
+    }
+
+    /// Removes the data with the specified key from the cache.
+    ///
+    /// \return     true if the key was found in the cache, and false otherwise.
+    ///
+    /// \remarks    If the data is being initialized by another thread, that thread will still
+    ///             return it from Get(), but the data will not be added to the cache.
+    bool Erase(const KeyType& Key)
+    {
+        Shard& CacheShard = m_Shards[GetShardIndex(Key)];
+
+        std::shared_ptr<DataWrapper> pDataWrpr;
+        {
+            std::lock_guard<std::mutex> Lock{CacheShard.Mtx};
+
+            auto it = CacheShard.Map.find(Key);
+            if (it == CacheShard.Map.end())
+                return false;
+
+            pDataWrpr = CacheShard.EraseEntry(it->second, m_CurrSize);
+        }
+        // The data is released after the shard mutex is unlocked
+        return true;
+    }
+
+    /// Removes all data from the cache. See Erase().
+    void Clear()
+    {
+        std::vector<std::shared_ptr<DataWrapper>> DeleteList;
+        for (Shard& CacheShard : m_Shards)
+        {
+            std::lock_guard<std::mutex> Lock{CacheShard.Mtx};
+            while (!CacheShard.LRUList.empty())
+                DeleteList.emplace_back(CacheShard.EraseEntry(CacheShard.LRUList.begin(), m_CurrSize));
+        }
+
+        // Delete the objects after releasing the shard mutexes
+        DeleteList.clear();
+    }
+
+    /// Sets the maximum cache size.
+    void SetMaxSize(size_t MaxSize)
+    {
+        m_MaxSize = MaxSize;
+    }
+
+    /// Returns the current cache size.
+    size_t GetCurrSize() const
+    {
+        return m_CurrSize;
+    }
+
+    ~ShardedLRUCache()
+    {
+#ifdef DILIGENT_DEBUG
+        size_t DbgSize = 0;
+        for (Shard& CacheShard : m_Shards)
+        {
+            VERIFY_EXPR(CacheShard.Map.size() == CacheShard.LRUList.size());
+            size_t DbgShardSize = 0;
+            for (const auto& Entry : CacheShard.LRUList)
+                DbgShardSize += Entry.pDataWrpr->GetAccountedSize();
+            VERIFY_EXPR(DbgShardSize == CacheShard.Size);
+            DbgSize += DbgShardSize;
+        }
+        VERIFY_EXPR(DbgSize == m_CurrSize);
+#endif
+    }
+
+private:
+    using DataWrapper = LRUCacheDataWrapper<DataType>;
+
+    struct alignas(64) Shard
+    {
+        struct Entry
+        {
+            // Points to the key in the map. Unlike iterators, pointers to unordered_map
+            // elements are not invalidated by rehashing.
+            const KeyType* pKey = nullptr;
+
+            std::shared_ptr<DataWrapper> pDataWrpr;
+        };
+        // The most recently used entry is at the front
+        using LRUListType = std::list<Entry>;
+        using MapType     = std::unordered_map<KeyType, typename LRUListType::iterator, KeyHasher>;
+
+        std::mutex  Mtx;
+        MapType     Map;
+        LRUListType LRUList;
+
+        // The total accounted size of the entries in this shard
+        std::atomic<size_t> Size{0};
+
+        std::shared_ptr<DataWrapper> GetDataWrapper(const KeyType& Key)
+        {
+            std::lock_guard<std::mutex> Lock{Mtx};
+
+            auto it = Map.find(Key);
+            if (it == Map.end())
+            {
+                LRUList.emplace_front();
+                auto list_it       = LRUList.begin();
+                list_it->pDataWrpr = std::make_shared<DataWrapper>();
+
+                it            = Map.emplace(Key, list_it).first;
+                list_it->pKey = &it->first;
+            }
+            else
+            {
+                // Move the entry to the front of the list
+                LRUList.splice(LRUList.begin(), LRUList, it->second);
+            }
+            VERIFY_EXPR(Map.size() == LRUList.size());
+
+            return it->second->pDataWrpr;
+        }
+
+        // Removes the entry from the shard and returns its data wrapper. The mutex must be locked.
+        // The wrapper may be in any state: if it is not accounted yet, its accounted size is zero
+        // and it will not be accounted since it is not in the map anymore.
+        std::shared_ptr<DataWrapper> EraseEntry(typename LRUListType::iterator list_it, std::atomic<size_t>& CurrSize)
+        {
+            const size_t AccountedSize = list_it->pDataWrpr->GetAccountedSize();
+
+            std::shared_ptr<DataWrapper> pDataWrpr = std::move(list_it->pDataWrpr);
+
+            auto map_it = Map.find(*list_it->pKey);
+            VERIFY_EXPR(map_it != Map.end() && map_it->second == list_it);
+            Map.erase(map_it);
+            LRUList.erase(list_it);
+
+            VERIFY_EXPR(Size >= AccountedSize && CurrSize >= AccountedSize);
+            Size.fetch_sub(AccountedSize);
+            CurrSize.fetch_sub(AccountedSize);
+
+            VERIFY_EXPR(Map.size() == LRUList.size());
+            return pDataWrpr;
+        }
+
+        // Evicts the least recently used entries from the shard until the total cache size
+        // is within the budget.
+        void Evict(std::atomic<size_t>&                       CurrSize,
+                   size_t                                     MaxSize,
+                   std::vector<std::shared_ptr<DataWrapper>>& DeleteList)
+        {
+            std::lock_guard<std::mutex> Lock{Mtx};
+
+            auto list_it = LRUList.end();
+            while (list_it != LRUList.begin() && CurrSize.load() > MaxSize)
+            {
+                --list_it;
+
+                // See the comments in LRUCache::Get() for the details of the state handling.
+                const auto State = list_it->pDataWrpr->GetState();
+                if (State == DataWrapper::DataState::Default ||
+                    State == DataWrapper::DataState::InitializedUnaccounted)
+                {
+                    // The object is being initialized by another thread
+                    continue;
+                }
+
+                // The entry after the erased one has already been processed
+                const auto next_it = std::next(list_it);
+                DeleteList.emplace_back(EraseEntry(list_it, CurrSize));
+                list_it = next_it;
+            }
+            VERIFY_EXPR(Map.size() == LRUList.size());
+        }
+    };
+
+    size_t GetShardIndex(const KeyType& Key) const
+    {
+        size_t Hash = KeyHasher{}(Key);
+        // Mix the high bits in as std::hash is the identity function for integer types in some implementations
+        Hash ^= Hash >> 17;
+        Hash *= size_t{0x9E3779B97F4A7C15ull & ~size_t{0}};
+        Hash ^= Hash >> 31;
+        return Hash % NumShards;
+    }
+
+    void Evict()
+    {
+        // Evict the entries from the largest shards first
+        std::array<std::pair<size_t, size_t>, NumShards> ShardSizes;
+        for (size_t i = 0; i < NumShards; ++i)
+            ShardSizes[i] = {m_Shards[i].Size.load(), i};
+        std::sort(ShardSizes.begin(), ShardSizes.end(), std::greater<std::pair<size_t, size_t>>{});
+
+        std::vector<std::shared_ptr<DataWrapper>> DeleteList;
+        for (const auto& ShardSize : ShardSizes)
+        {
+            const size_t MaxSize = m_MaxSize.load();
+            if (m_CurrSize.load() <= MaxSize)
+                break;
+
+            m_Shards[ShardSize.second].Evict(m_CurrSize, MaxSize, DeleteList);
+        }
+
+        // Delete the objects after releasing the shard mutexes
+        DeleteList.clear();
+    }
+
+private:
+    std::array<Shard, NumShards> m_Shards;
+
+    std::atomic<size_t> m_CurrSize{0};
+    std::atomic<size_t> m_MaxSize{0};
+};
+
 } // namespace Diligent
@@ -0,0 +1,103 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Implementation of the IDataBlob interface that owns a memory-mapped file
+
+#include <memory>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Primitives/interface/DataBlob.h"
+#include "../../Platforms/interface/FileSystem.hpp"
+#include "ObjectBase.hpp"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Data blob that exposes the content of a memory-mapped file without copying it.
+
+/// \remarks    The blob keeps the file mapped until it is destroyed, so it can be passed to
+///             APIs that reference the data instead of copying it, such as
+///             IDearchiver::LoadArchive() or IRenderStateCache::Load() with MakeCopy set to false.
+///
+///             See Diligent::BasicMappedFile for the restrictions on modifying the mapped file.
+class MappedFileDataBlob final : public ObjectBase<IDataBlob>
+{
+public:
+    using TBase = ObjectBase<IDataBlob>;
+
+    /// Maps the file and creates the data blob that owns the mapping.
+
+    /// \param [in] FilePath - Path to the file.
+    /// \param [in] Hint     - Expected access pattern, see Diligent::EMappedFileAccessHint.
+    ///
+    /// \return     The data blob, or null if the file can't be mapped or memory-mapped
+    ///             files are not supported on this platform.
+    static RefCntAutoPtr<MappedFileDataBlob> Create(const Char* FilePath, EMappedFileAccessHint Hint = EMappedFileAccessHint::Normal);
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_DataBlob, TBase)
+
+    /// Resizing is not supported as the size of the blob is the size of the file.
+    virtual void DILIGENT_CALL_TYPE Resize(size_t NewSize) override;
+
+    /// Returns the size of the mapped file
+    virtual size_t DILIGENT_CALL_TYPE GetSize() const override;
+
+    /// Returns pointer to the mapped data.
+
+    /// \remarks    The data is mapped copy-on-write: modified pages are copied into
+    ///             the process memory and the changes are never written to the file.
+    virtual void* DILIGENT_CALL_TYPE GetDataPtr(size_t Offset = 0) override;
+
+    /// Returns const pointer to the mapped data
+    virtual const void* DILIGENT_CALL_TYPE GetConstDataPtr(size_t Offset = 0) const override;
+
+    /// Changes the expected access pattern of the given range of the data.
+    void Advise(EMappedFileAccessHint Hint, size_t Offset = 0, size_t Size = ~size_t{0});
+
+private:
+    template <typename AllocatorType, typename ObjectType>
+    friend class MakeNewRCObj;
+
+    struct MappedFileDeleter
+    {
+        void operator()(BasicMappedFile* pFile) const
+        {
+            FileSystem::ReleaseMappedFile(pFile);
+        }
+    };
+    using MappedFilePtr = std::unique_ptr<BasicMappedFile, MappedFileDeleter>;
+
+    MappedFileDataBlob(IReferenceCounters* pRefCounters, MappedFilePtr pFile) noexcept;
+
+private:
+    const MappedFilePtr m_pFile;
+};
+
+} // namespace Diligent
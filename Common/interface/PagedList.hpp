@@ -0,0 +1,431 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Defines Diligent::PagedList class
+
+#include <iterator>
+#include <vector>
+#include <utility>
+#include <type_traits>
+#include <new>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Primitives/interface/MemoryAllocator.h"
+#include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+namespace Diligent
+{
+
+/// Doubly-linked list that allocates its nodes from memory pages.
+
+/// The list provides a subset of the std::list interface. Unlike std::list, it does not
+/// allocate memory for every element: nodes are placed in pages of NodesPerPage elements,
+/// and nodes of erased elements are reused. Pages are only released when the list is destroyed.
+///
+/// As with std::list, insertion and removal of elements do not invalidate iterators and references
+/// to other elements, and moving or swapping the list invalidates only the end() iterator.
+template <typename T, size_t NodesPerPage = 256>
+class PagedList
+{
+    struct NodeBase
+    {
+        NodeBase* pPrev = nullptr;
+        NodeBase* pNext = nullptr;
+    };
+
+    struct Node : NodeBase
+    {
+        template <typename... ArgsType>
+        explicit Node(ArgsType&&... Args) :
+            Value(std::forward<ArgsType>(Args)...)
+        {}
+
+        T Value;
+    };
+
+    // Erased nodes are kept in a singly-linked list
+    struct FreeNode
+    {
+        FreeNode* pNext = nullptr;
+    };
+
+    template <bool IsConst>
+    class IteratorBase
+    {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = typename std::conditional<IsConst, const T*, T*>::type;
+        using reference         = typename std::conditional<IsConst, const T&, T&>::type;
+
+        IteratorBase() noexcept {}
+
+        // iterator -> const_iterator conversion
+        template <bool _IsConst = IsConst, typename = typename std::enable_if<_IsConst>::type>
+        IteratorBase(const IteratorBase<false>& Other) noexcept :
+            m_pNode{Other.m_pNode}
+        {}
+
+        reference operator*() const
+        {
+            return static_cast<Node*>(m_pNode)->Value;
+        }
+
+        pointer operator->() const
+        {
+            return &static_cast<Node*>(m_pNode)->Value;
+        }
+
+        IteratorBase& operator++() noexcept
+        {
+            m_pNode = m_pNode->pNext;
+            return *this;
+        }
+
+        IteratorBase operator++(int) noexcept
+        {
+            IteratorBase Tmp{*this};
+            m_pNode = m_pNode->pNext;
+            return Tmp;
+        }
+
+        IteratorBase& operator--() noexcept
+        {
+            m_pNode = m_pNode->pPrev;
+            return *this;
+        }
+
+        IteratorBase operator--(int) noexcept
+        {
+            IteratorBase Tmp{*this};
+            m_pNode = m_pNode->pPrev;
+            return Tmp;
+        }
+
+        friend bool operator==(const IteratorBase& Lhs, const IteratorBase& Rhs) noexcept
+        {
+            return Lhs.m_pNode == Rhs.m_pNode;
+        }
+
+        friend bool operator!=(const IteratorBase& Lhs, const IteratorBase& Rhs) noexcept
+        {
+            return Lhs.m_pNode != Rhs.m_pNode;
+        }
+
+    private:
+        friend class PagedList;
+        template <bool>
+        friend class IteratorBase;
+
+        explicit IteratorBase(NodeBase* pNode) noexcept :
+            m_pNode{pNode}
+        {}
+
+        NodeBase* m_pNode = nullptr;
+    };
+
+public:
+    using value_type      = T;
+    using size_type       = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference       = T&;
+    using const_reference = const T&;
+    using iterator        = IteratorBase<false>;
+    using const_iterator  = IteratorBase<true>;
+
+    PagedList() noexcept :
+        PagedList{DefaultRawMemoryAllocator::GetAllocator()}
+    {}
+
+    explicit PagedList(IMemoryAllocator& Allocator) noexcept :
+        m_pAllocator{&Allocator}
+    {
+        m_Head.pPrev = &m_Head;
+        m_Head.pNext = &m_Head;
+    }
+
+    PagedList(const PagedList& Other) :
+        PagedList{*Other.m_pAllocator}
+    {
+        for (const T& Value : Other)
+            emplace_back(Value);
+    }
+
+    PagedList(PagedList&& Other) noexcept :
+        PagedList{*Other.m_pAllocator}
+    {
+        Steal(Other);
+    }
+
+    PagedList& operator=(const PagedList& Other)
+    {
+        if (this != &Other)
+        {
+            clear();
+            for (const T& Value : Other)
+                emplace_back(Value);
+        }
+        return *this;
+    }
+
+    PagedList& operator=(PagedList&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Release();
+            m_pAllocator = Other.m_pAllocator;
+            Steal(Other);
+        }
+        return *this;
+    }
+
+    ~PagedList()
+    {
+        Release();
+    }
+
+    void swap(PagedList& Other) noexcept
+    {
+        PagedList Tmp{std::move(Other)};
+        Other = std::move(*this);
+        *this = std::move(Tmp);
+    }
+
+    // clang-format off
+    iterator       begin()        noexcept { return iterator{m_Head.pNext}; }
+    const_iterator begin()  const noexcept { return const_iterator{m_Head.pNext}; }
+    const_iterator cbegin() const noexcept { return begin(); }
+    iterator       end()          noexcept { return iterator{&m_Head}; }
+    const_iterator end()    const noexcept { return const_iterator{const_cast<NodeBase*>(&m_Head)}; }
+    const_iterator cend()   const noexcept { return end(); }
+
+    bool      empty() const noexcept { return m_Size == 0; }
+    size_type size()  const noexcept { return m_Size; }
+
+    reference       front()       { VERIFY_EXPR(!empty()); return *begin(); }
+    const_reference front() const { VERIFY_EXPR(!empty()); return *begin(); }
+    reference       back()        { VERIFY_EXPR(!empty()); return *iterator{m_Head.pPrev}; }
+    const_reference back()  const { VERIFY_EXPR(!empty()); return *const_iterator{m_Head.pPrev}; }
+    // clang-format on
+
+    template <typename... ArgsType>
+    iterator emplace(const_iterator Pos, ArgsType&&... Args)
+    {
+        Node* pNode = CreateNode(std::forward<ArgsType>(Args)...);
+
+        NodeBase* pNext     = Pos.m_pNode;
+        pNode->pNext        = pNext;
+        pNode->pPrev        = pNext->pPrev;
+        pNext->pPrev->pNext = pNode;
+        pNext->pPrev        = pNode;
+        ++m_Size;
+
+        return iterator{pNode};
+    }
+
+    iterator insert(const_iterator Pos, const T& Value)
+    {
+        return emplace(Pos, Value);
+    }
+
+    iterator insert(const_iterator Pos, T&& Value)
+    {
+        return emplace(Pos, std::move(Value));
+    }
+
+    template <typename... ArgsType>
+    reference emplace_back(ArgsType&&... Args)
+    {
+        return *emplace(end(), std::forward<ArgsType>(Args)...);
+    }
+
+    void push_back(const T& Value)
+    {
+        emplace(end(), Value);
+    }
+
+    void push_back(T&& Value)
+    {
+        emplace(end(), std::move(Value));
+    }
+
+    template <typename... ArgsType>
+    reference emplace_front(ArgsType&&... Args)
+    {
+        return *emplace(begin(), std::forward<ArgsType>(Args)...);
+    }
+
+    void push_front(const T& Value)
+    {
+        emplace(begin(), Value);
+    }
+
+    void push_front(T&& Value)
+    {
+        emplace(begin(), std::move(Value));
+    }
+
+    iterator erase(const_iterator Pos)
+    {
+        NodeBase* pNode = Pos.m_pNode;
+        VERIFY(pNode != &m_Head, "Attempting to erase the end() iterator");
+
+        NodeBase* pNext     = pNode->pNext;
+        pNode->pPrev->pNext = pNext;
+        pNext->pPrev        = pNode->pPrev;
+        DestroyNode(static_cast<Node*>(pNode));
+        --m_Size;
+
+        return iterator{pNext};
+    }
+
+    iterator erase(const_iterator First, const_iterator Last)
+    {
+        while (First != Last)
+            First = erase(First);
+        return iterator{Last.m_pNode};
+    }
+
+    void pop_back()
+    {
+        erase(const_iterator{m_Head.pPrev});
+    }
+
+    void pop_front()
+    {
+        erase(begin());
+    }
+
+    /// Destroys all elements, but keeps the memory pages for reuse.
+    void clear() noexcept
+    {
+        for (NodeBase* pNode = m_Head.pNext; pNode != &m_Head;)
+        {
+            NodeBase* pNext = pNode->pNext;
+            static_cast<Node*>(pNode)->~Node();
+            pNode = pNext;
+        }
+        m_Head.pPrev   = &m_Head;
+        m_Head.pNext   = &m_Head;
+        m_Size         = 0;
+        m_NumUsedNodes = 0;
+        m_pFreeNodes   = nullptr;
+    }
+
+    size_t GetPageCount() const noexcept
+    {
+        return m_Pages.size();
+    }
+
+private:
+    template <typename... ArgsType>
+    Node* CreateNode(ArgsType&&... Args)
+    {
+        void* pMem = nullptr;
+        if (m_pFreeNodes != nullptr)
+        {
+            pMem         = m_pFreeNodes;
+            m_pFreeNodes = m_pFreeNodes->pNext;
+        }
+        else
+        {
+            const size_t PageIdx = m_NumUsedNodes / NodesPerPage;
+            if (PageIdx == m_Pages.size())
+            {
+                m_Pages.push_back(m_pAllocator->AllocateAligned(sizeof(Node) * NodesPerPage, alignof(Node), "Paged list page", __FILE__, __LINE__));
+            }
+            pMem = static_cast<Uint8*>(m_Pages[PageIdx]) + sizeof(Node) * (m_NumUsedNodes % NodesPerPage);
+            ++m_NumUsedNodes;
+        }
+
+        try
+        {
+            return new (pMem) Node(std::forward<ArgsType>(Args)...);
+        }
+        catch (...)
+        {
+            m_pFreeNodes = new (pMem) FreeNode{m_pFreeNodes};
+            throw;
+        }
+    }
+
+    void DestroyNode(Node* pNode) noexcept
+    {
+        pNode->~Node();
+        m_pFreeNodes = new (pNode) FreeNode{m_pFreeNodes};
+    }
+
+    void Release() noexcept
+    {
+        clear();
+        for (void* pPage : m_Pages)
+            m_pAllocator->FreeAligned(pPage);
+        m_Pages.clear();
+    }
+
+    // Takes the elements and the pages of the other list
+    void Steal(PagedList& Other) noexcept
+    {
+        VERIFY_EXPR(m_Size == 0 && m_Pages.empty());
+
+        if (Other.m_Size != 0)
+        {
+            m_Head.pNext        = Other.m_Head.pNext;
+            m_Head.pPrev        = Other.m_Head.pPrev;
+            m_Head.pNext->pPrev = &m_Head;
+            m_Head.pPrev->pNext = &m_Head;
+        }
+        m_Size         = Other.m_Size;
+        m_Pages        = std::move(Other.m_Pages);
+        m_NumUsedNodes = Other.m_NumUsedNodes;
+        m_pFreeNodes   = Other.m_pFreeNodes;
+
+        Other.m_Head.pPrev = &Other.m_Head;
+        Other.m_Head.pNext = &Other.m_Head;
+        Other.m_Size       = 0;
+        Other.m_Pages.clear();
+        Other.m_NumUsedNodes = 0;
+        Other.m_pFreeNodes   = nullptr;
+    }
+
+    IMemoryAllocator* m_pAllocator = nullptr;
+
+    // Sentinel node: m_Head.pNext is the first element, m_Head.pPrev is the last one
+    NodeBase  m_Head;
+    size_type m_Size = 0;
+
+    std::vector<void*> m_Pages;
+    // The number of nodes allocated from the pages, including the free ones
+    size_t    m_NumUsedNodes = 0;
+    FreeNode* m_pFreeNodes   = nullptr;
+};
+
+} // namespace Diligent
@@ -30,16 +30,41 @@
 
 #include <atomic>
 #include <functional>
+#include <memory>
 #include <thread>
+#include <vector>
 
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
 
 #include "ObjectBase.hpp"
 #include "RefCntAutoPtr.hpp"
+#include "SpinLock.hpp"
 
 namespace Diligent
 {
 
+/// Thread pool scheduler type
+enum THREAD_POOL_SCHEDULER : Uint8
+{
+    /// All tasks are kept in a single priority queue protected by a mutex.
+    /// Tasks are strictly executed in the order of their priorities.
+    THREAD_POOL_SCHEDULER_PRIORITY_QUEUE = 0,
+
+    /// Every worker thread owns a set of lock-free work-stealing deques, one per
+    /// priority bucket. Idle workers steal tasks from other workers.
+    ///
+    /// \remarks   Task priorities are approximate: priorities are quantized to integer buckets
+    ///             in the range [0, NumPriorityBuckets - 1] (values outside of the range are clamped),
+    ///             and tasks from higher buckets are preferred. There is no ordering guarantee
+    ///             for tasks within the same bucket.
+    ///
+    ///             Tasks enqueued by the worker threads of the pool go to the worker's local deque.
+    ///             Tasks enqueued by other threads go to shared per-bucket injection queues.
+    ///             Application threads that call IThreadPool::ProcessTask() only take tasks from
+    ///             the injection queues and steal from the worker threads.
+    THREAD_POOL_SCHEDULER_WORK_STEALING
+};
+
 /// Thread pool create information
 struct ThreadPoolCreateInfo
 {
@@ -58,6 +83,13 @@ struct ThreadPoolCreateInfo
     /// An optional function that will be called by the thread pool from
     /// the worker thread before the worker thread exits.
     std::function<void(Uint32)> OnThreadExiting = nullptr;
+
+    /// Task scheduler type, see Diligent::THREAD_POOL_SCHEDULER.
+    THREAD_POOL_SCHEDULER Scheduler = THREAD_POOL_SCHEDULER_PRIORITY_QUEUE;
+
+    /// The number of priority buckets used by the work-stealing scheduler.
+    /// This member is ignored by other schedulers.
+    Uint32 NumPriorityBuckets = 4;
 };
 
 RefCntAutoPtr<IThreadPool> CreateThreadPool(const ThreadPoolCreateInfo& ThreadPoolCI);
@@ -133,6 +165,8 @@ public:
         }
 #endif
         m_TaskStatus.store(TaskStatus);
+        if (TaskStatus >= ASYNC_TASK_STATUS_CANCELLED && m_HasCompletionCallbacks.load())
+            InvokeCompletionCallbacks();
     }
 
     virtual ASYNC_TASK_STATUS DILIGENT_CALL_TYPE GetStatus() const override final
@@ -169,12 +203,29 @@ public:
             std::this_thread::yield();
     }
 
+    /// Registers a function that is called once when the task is finished or destroyed.
+
+    /// \remarks   Thread pools use completion callbacks to get notified about prerequisites
+    ///             that are run outside of the pool.
+    ///             The function is called by the thread that sets the final task status
+    ///             or releases the last reference to the task, and must not block.
+    ///             If the task is already finished, the function is not registered and
+    ///             the method returns false.
+    bool AddCompletionCallback(std::function<void()> Callback);
+
 protected:
     std::atomic<bool> m_bSafelyCancel{false};
 
+private:
+    void InvokeCompletionCallbacks();
+
 private:
     std::atomic<float>             m_fPriority{0};
     std::atomic<ASYNC_TASK_STATUS> m_TaskStatus{ASYNC_TASK_STATUS_NOT_STARTED};
+
+    Threading::SpinLock                m_CompletionCallbacksLock;
+    std::vector<std::function<void()>> m_CompletionCallbacks;
+    std::atomic<bool>                  m_HasCompletionCallbacks{false};
 };
 
 
@@ -223,4 +274,96 @@ RefCntAutoPtr<IAsyncTask> EnqueueAsyncWork(IThreadPool* pThreadPool,
     return EnqueueAsyncWork(pThreadPool, nullptr, 0, std::move(Handler), fPriority);
 }
 
+
+/// A group of tasks that can be waited for independently of other tasks in the thread pool.
+
+/// \remarks   Every task added to the group is executed either by a worker thread of the pool,
+///             or by the thread that calls the Wait() method: instead of blocking, the waiting
+///             thread executes the tasks of the group that have not been started yet, and only
+///             waits for the tasks that are already running. This makes it safe to wait for a group
+///             from a task that is itself executed by the pool, as well as to use the group with
+///             a pool that has no worker threads.
+///
+///             Tasks may be added to the group from any thread, including the tasks of the group.
+///             The destructor waits for all tasks in the group.
+class TaskGroup
+{
+public:
+    /// \param [in] pThreadPool - The thread pool that will execute the tasks. If null, all tasks
+    ///                           are executed by the thread that calls the Wait() method.
+    /// \param [in] fPriority   - The priority of the thread pool tasks.
+    explicit TaskGroup(IThreadPool* pThreadPool, float fPriority = 0);
+    ~TaskGroup();
+
+    // clang-format off
+    TaskGroup           (const TaskGroup&)  = delete;
+    TaskGroup           (      TaskGroup&&) = delete;
+    TaskGroup& operator=(const TaskGroup&)  = delete;
+    TaskGroup& operator=(      TaskGroup&&) = delete;
+    // clang-format on
+
+    /// Adds a task to the group.
+    void Run(std::function<void()> Task);
+
+    /// Waits until all tasks in the group are complete.
+    /// The calling thread executes the tasks that have not been started by the pool.
+    void Wait();
+
+private:
+    struct State;
+
+    RefCntAutoPtr<IThreadPool> m_pThreadPool;
+    const float                m_fPriority;
+    std::shared_ptr<State>     m_pState;
+};
+
+
+/// Executes the handler for sub-ranges of [Begin, End) in parallel.
+
+/// \param [in] pThreadPool  - The thread pool to use. If null, the range is processed by the calling thread.
+/// \param [in] Begin        - The first index of the range.
+/// \param [in] End          - The index past the last index of the range.
+/// \param [in] Handler      - The function that processes the range [RangeBegin, RangeEnd).
+/// \param [in] MinChunkSize - The minimum number of indices processed by one handler call.
+/// \param [in] fPriority    - The priority of the thread pool tasks.
+/// \param [in] NumThreads   - The maximum number of threads, including the calling thread, that
+///                            process the range. If zero, the number of hardware threads is used.
+///
+/// \remarks   The range is split into chunks adaptively: chunks start large and shrink as the
+///             remaining range gets smaller, so that the threads that finish early can pick up the
+///             remaining work with little scheduling overhead.
+///
+///             The calling thread processes the chunks along with the worker threads and only waits
+///             for the chunks that are being processed by other threads, so the function never waits
+///             for unrelated tasks in the pool and can be called from a task executed by the same pool.
+///             The pool tasks that start after the whole range has been processed exit immediately.
+void ParallelForRange(IThreadPool*                               pThreadPool,
+                      Uint32                                     Begin,
+                      Uint32                                     End,
+                      const std::function<void(Uint32, Uint32)>& Handler,
+                      Uint32                                     MinChunkSize = 1,
+                      float                                      fPriority    = 0,
+                      Uint32                                     NumThreads   = 0);
+
+/// Executes the handler for every index in the range [Begin, End) in parallel.
+/// The handler must have the signature void(Uint32 Index).
+/// See ParallelForRange() for details.
+template <typename HandlerType>
+void ParallelFor(IThreadPool* pThreadPool,
+                 Uint32       Begin,
+                 Uint32       End,
+                 HandlerType  Handler,
+                 Uint32       MinChunkSize = 1,
+                 float        fPriority    = 0,
+                 Uint32       NumThreads   = 0)
+{
+    ParallelForRange(
+        pThreadPool, Begin, End,
+        [&Handler](Uint32 RangeBegin, Uint32 RangeEnd) {
+            for (Uint32 i = RangeBegin; i < RangeEnd; ++i)
+                Handler(i);
+        },
+        MinChunkSize, fPriority, NumThreads);
+}
+
 } // namespace Diligent
@@ -0,0 +1,212 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <type_traits>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+/// Lock-free work-stealing deque.
+
+/// The deque implements the Chase-Lev algorithm with the memory orderings from
+/// "Correct and Efficient Work-Stealing for Weak Memory Models" (N. M. Le et al., 2013).
+/// The owner thread pushes and pops items at the bottom end (LIFO order), while
+/// any other thread may steal items from the top end (FIFO order).
+///
+/// \tparam T - Item type. Must be trivially copyable and lock-free atomic, e.g. a pointer.
+///
+/// \remarks    Push() and Pop() must only be called by the thread that owns the deque.
+///             Steal() and Size() may be called by any thread.
+///
+///             When the deque grows, the previous buffers are kept alive until the deque
+///             is destroyed since concurrent thieves may still be reading from them.
+template <typename T>
+class WorkStealingQueue
+{
+public:
+    static_assert(std::is_trivially_copyable<T>::value, "Work-stealing queue items must be trivially copyable");
+
+    explicit WorkStealingQueue(size_t InitialCapacity = 256)
+    {
+        size_t Capacity = 2;
+        while (Capacity < InitialCapacity)
+            Capacity *= 2;
+        m_Buffers.emplace_back(std::make_unique<Buffer>(Capacity));
+        m_pBuffer.store(m_Buffers.back().get(), std::memory_order_relaxed);
+    }
+
+    // clang-format off
+    WorkStealingQueue           (const WorkStealingQueue&)  = delete;
+    WorkStealingQueue           (      WorkStealingQueue&&) = delete;
+    WorkStealingQueue& operator=(const WorkStealingQueue&)  = delete;
+    WorkStealingQueue& operator=(      WorkStealingQueue&&) = delete;
+    // clang-format on
+
+    /// Pushes the item to the bottom of the deque. Must only be called by the owner thread.
+    void Push(T Item)
+    {
+        const Int64 b    = m_Bottom.load(std::memory_order_relaxed);
+        const Int64 t    = m_Top.load(std::memory_order_acquire);
+        Buffer*     pBuf = m_pBuffer.load(std::memory_order_relaxed);
+        if (b - t > static_cast<Int64>(pBuf->Capacity()) - 1)
+        {
+            // The deque is full - grow the buffer
+            m_Buffers.emplace_back(pBuf->Grow(b, t));
+            pBuf = m_Buffers.back().get();
+            m_pBuffer.store(pBuf, std::memory_order_release);
+        }
+        pBuf->Store(b, Item);
+        // NB: release store is equivalent to the release fence followed by the relaxed store
+        //     used in the original algorithm, but is understood by thread sanitizers.
+        m_Bottom.store(b + 1, std::memory_order_release);
+    }
+
+    /// Pops the item from the bottom of the deque. Must only be called by the owner thread.
+
+    /// \return     true if the item was popped, and false if the deque is empty.
+    bool Pop(T& Item)
+    {
+        const Int64 b    = m_Bottom.load(std::memory_order_relaxed) - 1;
+        Buffer*     pBuf = m_pBuffer.load(std::memory_order_relaxed);
+        m_Bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        Int64 t = m_Top.load(std::memory_order_relaxed);
+
+        if (t > b)
+        {
+            // The deque is empty
+            m_Bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        Item = pBuf->Load(b);
+        if (t == b)
+        {
+            // This is the last item - compete with the thieves
+            const bool Won = m_Top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            m_Bottom.store(b + 1, std::memory_order_relaxed);
+            return Won;
+        }
+
+        return true;
+    }
+
+    /// Steals the item from the top of the deque. May be called by any thread.
+
+    /// \return     true if the item was stolen, and false if the deque is empty.
+    bool Steal(T& Item)
+    {
+        while (true)
+        {
+            Int64 t = m_Top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const Int64 b = m_Bottom.load(std::memory_order_acquire);
+            if (t >= b)
+                return false;
+
+            // NB: memory_order_consume is not properly supported by compilers and is promoted to acquire anyway.
+            const Buffer* pBuf = m_pBuffer.load(std::memory_order_acquire);
+            T             Val  = pBuf->Load(t);
+            if (m_Top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                Item = Val;
+                return true;
+            }
+            // Lost the race with another thief or the owner - try again
+        }
+    }
+
+    /// Returns the approximate number of items in the deque.
+    size_t Size() const
+    {
+        const Int64 b = m_Bottom.load(std::memory_order_relaxed);
+        const Int64 t = m_Top.load(std::memory_order_relaxed);
+        return b > t ? static_cast<size_t>(b - t) : 0;
+    }
+
+    bool IsEmpty() const
+    {
+        return Size() == 0;
+    }
+
+private:
+    class Buffer
+    {
+    public:
+        explicit Buffer(size_t Capacity) :
+            m_Mask{Capacity - 1},
+            m_Items{new std::atomic<T>[Capacity]}
+        {
+            VERIFY((Capacity & m_Mask) == 0, "Capacity must be a power of two");
+        }
+
+        size_t Capacity() const
+        {
+            return m_Mask + 1;
+        }
+
+        T Load(Int64 Idx) const
+        {
+            return m_Items[static_cast<size_t>(Idx) & m_Mask].load(std::memory_order_relaxed);
+        }
+
+        void Store(Int64 Idx, T Item)
+        {
+            m_Items[static_cast<size_t>(Idx) & m_Mask].store(Item, std::memory_order_relaxed);
+        }
+
+        std::unique_ptr<Buffer> Grow(Int64 Bottom, Int64 Top) const
+        {
+            auto pNewBuffer = std::make_unique<Buffer>(Capacity() * 2);
+            for (Int64 i = Top; i < Bottom; ++i)
+                pNewBuffer->Store(i, Load(i));
+            return pNewBuffer;
+        }
+
+    private:
+        const size_t                      m_Mask;
+        std::unique_ptr<std::atomic<T>[]> m_Items;
+    };
+
+    // Keep top and bottom indices on separate cache lines to avoid false sharing
+    // between the owner and the thieves.
+    alignas(64) std::atomic<Int64> m_Top{0};
+    alignas(64) std::atomic<Int64> m_Bottom{0};
+    alignas(64) std::atomic<Buffer*> m_pBuffer{nullptr};
+
+    // All buffers ever allocated by the deque. Only accessed by the owner thread.
+    std::vector<std::unique_ptr<Buffer>> m_Buffers;
+};
+
+} // namespace Diligent
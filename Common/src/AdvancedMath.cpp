@@ -0,0 +1,422 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "AdvancedMath.hpp"
+
+#include <cstring>
+
+#include "Intrinsics.hpp"
+#include "PlatformMisc.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+#if DILIGENT_AVX2_ENABLED
+struct SIMD_AVX
+{
+    using Float = __m256;
+    using Mask  = __m256;
+
+    static constexpr Uint32 Width   = 8;
+    static constexpr Uint32 AllBits = 0xFFu;
+
+    // clang-format off
+    static Float Load(const float* p)       { return _mm256_loadu_ps(p); }
+    static Float Set(float f)               { return _mm256_set1_ps(f); }
+    static Float Add(Float a, Float b)      { return _mm256_add_ps(a, b); }
+    static Float Sub(Float a, Float b)      { return _mm256_sub_ps(a, b); }
+    static Float Mul(Float a, Float b)      { return _mm256_mul_ps(a, b); }
+    static Float Neg(Float a)               { return _mm256_xor_ps(a, _mm256_set1_ps(-0.f)); }
+    static Float Abs(Float a)               { return _mm256_andnot_ps(_mm256_set1_ps(-0.f), a); }
+    static Mask  Less(Float a, Float b)     { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static Mask  Or(Mask a, Mask b)         { return _mm256_or_ps(a, b); }
+    static Mask  And(Mask a, Mask b)        { return _mm256_and_ps(a, b); }
+    static Mask  False()                    { return _mm256_setzero_ps(); }
+    static Mask  True()                     { return _mm256_castsi256_ps(_mm256_set1_epi32(-1)); }
+    static Uint32 MoveMask(Mask m)          { return static_cast<Uint32>(_mm256_movemask_ps(m)); }
+    // clang-format on
+};
+using SIMD = SIMD_AVX;
+#    define BATCH_CULLING_SIMD_ENABLED 1
+#elif DILIGENT_SSE2_ENABLED
+struct SIMD_SSE
+{
+    using Float = __m128;
+    using Mask  = __m128;
+
+    static constexpr Uint32 Width   = 4;
+    static constexpr Uint32 AllBits = 0xFu;
+
+    // clang-format off
+    static Float Load(const float* p)       { return _mm_loadu_ps(p); }
+    static Float Set(float f)               { return _mm_set1_ps(f); }
+    static Float Add(Float a, Float b)      { return _mm_add_ps(a, b); }
+    static Float Sub(Float a, Float b)      { return _mm_sub_ps(a, b); }
+    static Float Mul(Float a, Float b)      { return _mm_mul_ps(a, b); }
+    static Float Neg(Float a)               { return _mm_xor_ps(a, _mm_set1_ps(-0.f)); }
+    static Float Abs(Float a)               { return _mm_andnot_ps(_mm_set1_ps(-0.f), a); }
+    static Mask  Less(Float a, Float b)     { return _mm_cmplt_ps(a, b); }
+    static Mask  Or(Mask a, Mask b)         { return _mm_or_ps(a, b); }
+    static Mask  And(Mask a, Mask b)        { return _mm_and_ps(a, b); }
+    static Mask  False()                    { return _mm_setzero_ps(); }
+    static Mask  True()                     { return _mm_castsi128_ps(_mm_set1_epi32(-1)); }
+    static Uint32 MoveMask(Mask m)          { return static_cast<Uint32>(_mm_movemask_ps(m)); }
+    // clang-format on
+};
+using SIMD = SIMD_SSE;
+#    define BATCH_CULLING_SIMD_ENABLED 1
+#elif DILIGENT_NEON_ENABLED
+struct SIMD_NEON
+{
+    using Float = float32x4_t;
+    using Mask  = uint32x4_t;
+
+    static constexpr Uint32 Width   = 4;
+    static constexpr Uint32 AllBits = 0xFu;
+
+    // clang-format off
+    static Float Load(const float* p)       { return vld1q_f32(p); }
+    static Float Set(float f)               { return vdupq_n_f32(f); }
+    static Float Add(Float a, Float b)      { return vaddq_f32(a, b); }
+    static Float Sub(Float a, Float b)      { return vsubq_f32(a, b); }
+    static Float Mul(Float a, Float b)      { return vmulq_f32(a, b); }
+    static Float Neg(Float a)               { return vnegq_f32(a); }
+    static Float Abs(Float a)               { return vabsq_f32(a); }
+    static Mask  Less(Float a, Float b)     { return vcltq_f32(a, b); }
+    static Mask  Or(Mask a, Mask b)         { return vorrq_u32(a, b); }
+    static Mask  And(Mask a, Mask b)        { return vandq_u32(a, b); }
+    static Mask  False()                    { return vdupq_n_u32(0); }
+    static Mask  True()                     { return vdupq_n_u32(~0u); }
+    // clang-format on
+
+    static Uint32 MoveMask(Mask m)
+    {
+        static const uint32_t LaneBits[4] = {1, 2, 4, 8};
+
+        const uint32x4_t Bits = vandq_u32(m, vld1q_u32(LaneBits));
+#    if defined(__aarch64__) || defined(_M_ARM64)
+        return vaddvq_u32(Bits);
+#    else
+        uint32x2_t Sum = vadd_u32(vget_low_u32(Bits), vget_high_u32(Bits));
+        Sum            = vpadd_u32(Sum, Sum);
+        return vget_lane_u32(Sum, 0);
+#    endif
+    }
+};
+using SIMD = SIMD_NEON;
+#    define BATCH_CULLING_SIMD_ENABLED 1
+#endif
+
+#if BATCH_CULLING_SIMD_ENABLED
+
+struct PlaneData
+{
+    float Nx;
+    float Ny;
+    float Nz;
+    float AbsNx;
+    float AbsNy;
+    float AbsNz;
+    float D;
+};
+
+Uint32 GetPlaneData(const ViewFrustum& Frustum, FRUSTUM_PLANE_FLAGS PlaneFlags, PlaneData Planes[])
+{
+    Uint32 NumPlanes = 0;
+    for (Uint32 plane_idx = 0; plane_idx < ViewFrustum::NUM_PLANES; ++plane_idx)
+    {
+        if ((PlaneFlags & (1 << plane_idx)) == 0)
+            continue;
+
+        const Plane3D& Plane = Frustum.GetPlane(static_cast<ViewFrustum::PLANE_IDX>(plane_idx));
+        const float3   AbsN  = abs(Plane.Normal);
+        Planes[NumPlanes++]  = {Plane.Normal.x, Plane.Normal.y, Plane.Normal.z, AbsN.x, AbsN.y, AbsN.z, Plane.Distance};
+    }
+    return NumPlanes;
+}
+
+// Kernels process a group of SIMD::Width boxes at a time and return the bit masks of
+// invisible and fully visible boxes in the group.
+// All arithmetic operations are performed in the same order as in GetBoxVisibilityAgainstPlane()
+// so that the results are identical to the results of the scalar functions.
+
+template <typename SIMD>
+void GetAABBGroupVisibility(const PlaneData* Planes, Uint32 NumPlanes, const BoundBoxSoA& Boxes, Uint32 i, Uint32& InvisibleBits, Uint32& FullyVisibleBits)
+{
+    using Float = typename SIMD::Float;
+    using Mask  = typename SIMD::Mask;
+
+    const Float MinX = SIMD::Load(Boxes.MinX + i);
+    const Float MinY = SIMD::Load(Boxes.MinY + i);
+    const Float MinZ = SIMD::Load(Boxes.MinZ + i);
+    const Float MaxX = SIMD::Load(Boxes.MaxX + i);
+    const Float MaxY = SIMD::Load(Boxes.MaxY + i);
+    const Float MaxZ = SIMD::Load(Boxes.MaxZ + i);
+
+    // Max + Min
+    const Float SumX = SIMD::Add(MaxX, MinX);
+    const Float SumY = SIMD::Add(MaxY, MinY);
+    const Float SumZ = SIMD::Add(MaxZ, MinZ);
+    // Max - Min
+    const Float ExtX = SIMD::Sub(MaxX, MinX);
+    const Float ExtY = SIMD::Sub(MaxY, MinY);
+    const Float ExtZ = SIMD::Sub(MaxZ, MinZ);
+
+    const Float Half = SIMD::Set(0.5f);
+
+    Mask Invisible    = SIMD::False();
+    Mask FullyVisible = SIMD::True();
+    for (Uint32 p = 0; p < NumPlanes; ++p)
+    {
+        const PlaneData& Plane = Planes[p];
+
+        // DistanceToCenter = dot(Box.Max + Box.Min, Plane.Normal) * 0.5f + Plane.Distance
+        Float Dist = SIMD::Mul(SumX, SIMD::Set(Plane.Nx));
+        Dist       = SIMD::Add(Dist, SIMD::Mul(SumY, SIMD::Set(Plane.Ny)));
+        Dist       = SIMD::Add(Dist, SIMD::Mul(SumZ, SIMD::Set(Plane.Nz)));
+        Dist       = SIMD::Add(SIMD::Mul(Dist, Half), SIMD::Set(Plane.D));
+
+        // ProjHalfLen = dot(Box.Max - Box.Min, abs(Plane.Normal)) * 0.5f
+        Float Proj = SIMD::Mul(ExtX, SIMD::Set(Plane.AbsNx));
+        Proj       = SIMD::Add(Proj, SIMD::Mul(ExtY, SIMD::Set(Plane.AbsNy)));
+        Proj       = SIMD::Add(Proj, SIMD::Mul(ExtZ, SIMD::Set(Plane.AbsNz)));
+        Proj       = SIMD::Mul(Proj, Half);
+
+        Invisible    = SIMD::Or(Invisible, SIMD::Less(Dist, SIMD::Neg(Proj)));
+        FullyVisible = SIMD::And(FullyVisible, SIMD::Less(Proj, Dist));
+        if (SIMD::MoveMask(Invisible) == SIMD::AllBits)
+            break;
+    }
+
+    InvisibleBits    = SIMD::MoveMask(Invisible);
+    FullyVisibleBits = SIMD::MoveMask(FullyVisible);
+}
+
+template <typename SIMD>
+void GetOBBGroupVisibility(const PlaneData* Planes, Uint32 NumPlanes, const OrientedBoundingBoxSoA& Boxes, Uint32 i, Uint32& InvisibleBits, Uint32& FullyVisibleBits)
+{
+    using Float = typename SIMD::Float;
+    using Mask  = typename SIMD::Mask;
+
+    const Float CenterX = SIMD::Load(Boxes.CenterX + i);
+    const Float CenterY = SIMD::Load(Boxes.CenterY + i);
+    const Float CenterZ = SIMD::Load(Boxes.CenterZ + i);
+
+    Float Axes[3][3];
+    Float HalfExtents[3];
+    for (size_t a = 0; a < 3; ++a)
+    {
+        for (size_t c = 0; c < 3; ++c)
+            Axes[a][c] = SIMD::Load(Boxes.Axes[a][c] + i);
+        HalfExtents[a] = SIMD::Load(Boxes.HalfExtents[a] + i);
+    }
+
+    Mask Invisible    = SIMD::False();
+    Mask FullyVisible = SIMD::True();
+    for (Uint32 p = 0; p < NumPlanes; ++p)
+    {
+        const PlaneData& Plane = Planes[p];
+
+        const Float Nx = SIMD::Set(Plane.Nx);
+        const Float Ny = SIMD::Set(Plane.Ny);
+        const Float Nz = SIMD::Set(Plane.Nz);
+
+        // Distance = dot(Box.Center, Plane.Normal) + Plane.Distance
+        Float Dist = SIMD::Mul(CenterX, Nx);
+        Dist       = SIMD::Add(Dist, SIMD::Mul(CenterY, Ny));
+        Dist       = SIMD::Add(Dist, SIMD::Mul(CenterZ, Nz));
+        Dist       = SIMD::Add(Dist, SIMD::Set(Plane.D));
+
+        // ProjHalfExtents = sum(abs(dot(Box.Axes[a], Plane.Normal)) * Box.HalfExtents[a])
+        Float AxisProj[3];
+        for (size_t a = 0; a < 3; ++a)
+        {
+            AxisProj[a] = SIMD::Mul(Axes[a][0], Nx);
+            AxisProj[a] = SIMD::Add(AxisProj[a], SIMD::Mul(Axes[a][1], Ny));
+            AxisProj[a] = SIMD::Add(AxisProj[a], SIMD::Mul(Axes[a][2], Nz));
+            AxisProj[a] = SIMD::Mul(SIMD::Abs(AxisProj[a]), HalfExtents[a]);
+        }
+        const Float Proj = SIMD::Add(SIMD::Add(AxisProj[0], AxisProj[1]), AxisProj[2]);
+
+        Invisible    = SIMD::Or(Invisible, SIMD::Less(Dist, SIMD::Neg(Proj)));
+        FullyVisible = SIMD::And(FullyVisible, SIMD::Less(Proj, Dist));
+        if (SIMD::MoveMask(Invisible) == SIMD::AllBits)
+            break;
+    }
+
+    InvisibleBits    = SIMD::MoveMask(Invisible);
+    FullyVisibleBits = SIMD::MoveMask(FullyVisible);
+}
+
+#endif
+
+template <typename BoxSoAType>
+struct BoxTraits;
+
+template <>
+struct BoxTraits<BoundBoxSoA>
+{
+    static BoundBox GetBox(const BoundBoxSoA& Boxes, Uint32 i)
+    {
+        return BoundBox{
+            float3{Boxes.MinX[i], Boxes.MinY[i], Boxes.MinZ[i]},
+            float3{Boxes.MaxX[i], Boxes.MaxY[i], Boxes.MaxZ[i]},
+        };
+    }
+
+    static bool IsValid(const BoundBoxSoA& Boxes)
+    {
+        return Boxes.MinX != nullptr && Boxes.MinY != nullptr && Boxes.MinZ != nullptr &&
+            Boxes.MaxX != nullptr && Boxes.MaxY != nullptr && Boxes.MaxZ != nullptr;
+    }
+
+#if BATCH_CULLING_SIMD_ENABLED
+    static void GetGroupVisibility(const PlaneData* Planes, Uint32 NumPlanes, const BoundBoxSoA& Boxes, Uint32 i, Uint32& InvisibleBits, Uint32& FullyVisibleBits)
+    {
+        GetAABBGroupVisibility<SIMD>(Planes, NumPlanes, Boxes, i, InvisibleBits, FullyVisibleBits);
+    }
+#endif
+};
+
+template <>
+struct BoxTraits<OrientedBoundingBoxSoA>
+{
+    static OrientedBoundingBox GetBox(const OrientedBoundingBoxSoA& Boxes, Uint32 i)
+    {
+        OrientedBoundingBox Box;
+        Box.Center = float3{Boxes.CenterX[i], Boxes.CenterY[i], Boxes.CenterZ[i]};
+        for (size_t a = 0; a < 3; ++a)
+        {
+            Box.Axes[a]        = float3{Boxes.Axes[a][0][i], Boxes.Axes[a][1][i], Boxes.Axes[a][2][i]};
+            Box.HalfExtents[a] = Boxes.HalfExtents[a][i];
+        }
+        return Box;
+    }
+
+    static bool IsValid(const OrientedBoundingBoxSoA& Boxes)
+    {
+        if (Boxes.CenterX == nullptr || Boxes.CenterY == nullptr || Boxes.CenterZ == nullptr)
+            return false;
+        for (size_t a = 0; a < 3; ++a)
+        {
+            if (Boxes.Axes[a][0] == nullptr || Boxes.Axes[a][1] == nullptr || Boxes.Axes[a][2] == nullptr || Boxes.HalfExtents[a] == nullptr)
+                return false;
+        }
+        return true;
+    }
+
+#if BATCH_CULLING_SIMD_ENABLED
+    static void GetGroupVisibility(const PlaneData* Planes, Uint32 NumPlanes, const OrientedBoundingBoxSoA& Boxes, Uint32 i, Uint32& InvisibleBits, Uint32& FullyVisibleBits)
+    {
+        GetOBBGroupVisibility<SIMD>(Planes, NumPlanes, Boxes, i, InvisibleBits, FullyVisibleBits);
+    }
+#endif
+};
+
+template <typename BoxSoAType>
+Uint32 GetBoxVisibilityBatchImpl(const ViewFrustum&  Frustum,
+                                 const BoxSoAType&   Boxes,
+                                 Uint32              NumBoxes,
+                                 Uint32*             pVisibleMask,
+                                 Uint32*             pFullyVisibleMask,
+                                 FRUSTUM_PLANE_FLAGS PlaneFlags)
+{
+    if (NumBoxes == 0)
+        return 0;
+
+    DEV_CHECK_ERR(BoxTraits<BoxSoAType>::IsValid(Boxes), "All box component arrays must not be null");
+    DEV_CHECK_ERR(pVisibleMask != nullptr, "pVisibleMask must not be null");
+
+    const Uint32 NumMaskWords = (NumBoxes + 31) / 32;
+    memset(pVisibleMask, 0, NumMaskWords * sizeof(Uint32));
+    if (pFullyVisibleMask != nullptr)
+        memset(pFullyVisibleMask, 0, NumMaskWords * sizeof(Uint32));
+
+    Uint32 NumVisible = 0;
+    Uint32 i          = 0;
+
+#if BATCH_CULLING_SIMD_ENABLED
+    static_assert(32 % SIMD::Width == 0, "Group bits must not straddle mask words");
+
+    PlaneData    Planes[ViewFrustum::NUM_PLANES];
+    const Uint32 NumPlanes = GetPlaneData(Frustum, PlaneFlags, Planes);
+    for (; i + SIMD::Width <= NumBoxes; i += SIMD::Width)
+    {
+        Uint32 InvisibleBits    = 0;
+        Uint32 FullyVisibleBits = 0;
+        BoxTraits<BoxSoAType>::GetGroupVisibility(Planes, NumPlanes, Boxes, i, InvisibleBits, FullyVisibleBits);
+
+        const Uint32 VisibleBits = ~InvisibleBits & SIMD::AllBits;
+        pVisibleMask[i / 32] |= VisibleBits << (i % 32);
+        if (pFullyVisibleMask != nullptr)
+            pFullyVisibleMask[i / 32] |= (FullyVisibleBits & VisibleBits) << (i % 32);
+        NumVisible += PlatformMisc::CountOneBits(VisibleBits);
+    }
+#endif
+
+    // Process remaining boxes
+    for (; i < NumBoxes; ++i)
+    {
+        const BoxVisibility Visibility = GetBoxVisibility(Frustum, BoxTraits<BoxSoAType>::GetBox(Boxes, i), PlaneFlags);
+        if (Visibility == BoxVisibility::Invisible)
+            continue;
+
+        pVisibleMask[i / 32] |= 1u << (i % 32);
+        if (pFullyVisibleMask != nullptr && Visibility == BoxVisibility::FullyVisible)
+            pFullyVisibleMask[i / 32] |= 1u << (i % 32);
+        ++NumVisible;
+    }
+
+    return NumVisible;
+}
+
+} // namespace
+
+Uint32 GetBoxVisibilityBatch(const ViewFrustum&  Frustum,
+                             const BoundBoxSoA&  Boxes,
+                             Uint32              NumBoxes,
+                             Uint32*             pVisibleMask,
+                             Uint32*             pFullyVisibleMask,
+                             FRUSTUM_PLANE_FLAGS PlaneFlags)
+{
+    return GetBoxVisibilityBatchImpl(Frustum, Boxes, NumBoxes, pVisibleMask, pFullyVisibleMask, PlaneFlags);
+}
+
+Uint32 GetBoxVisibilityBatch(const ViewFrustum&            Frustum,
+                             const OrientedBoundingBoxSoA& Boxes,
+                             Uint32                        NumBoxes,
+                             Uint32*                       pVisibleMask,
+                             Uint32*                       pFullyVisibleMask,
+                             FRUSTUM_PLANE_FLAGS           PlaneFlags)
+{
+    return GetBoxVisibilityBatchImpl(Frustum, Boxes, NumBoxes, pVisibleMask, pFullyVisibleMask, PlaneFlags);
+}
+
+} // namespace Diligent
@@ -0,0 +1,582 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "BVH.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <numeric>
+
+#include "ThreadPool.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+class BVHBuilder
+{
+public:
+    BVHBuilder(const BVH::CreateInfo& CI, std::vector<BVH::Node>& Nodes, std::vector<Uint32>& PrimitiveIndices) :
+        m_CI{CI},
+        m_NumBins{std::min(std::max(CI.NumBins, 2u), MaxBins)},
+        m_MaxLeafSize{std::max(CI.MaxLeafSize, 1u)},
+        m_Nodes{Nodes},
+        m_PrimitiveIndices{PrimitiveIndices}
+    {
+    }
+
+    void Build()
+    {
+        const Uint32 NumPrimitives = m_CI.NumPrimitives;
+
+        m_Centroids.resize(NumPrimitives);
+        for (Uint32 i = 0; i < NumPrimitives; ++i)
+        {
+            const BoundBox& Bounds = m_CI.pPrimitiveBounds[i];
+            m_Centroids[i]         = (Bounds.Min + Bounds.Max) * 0.5f;
+        }
+
+        m_PrimitiveIndices.resize(NumPrimitives);
+        std::iota(m_PrimitiveIndices.begin(), m_PrimitiveIndices.end(), 0u);
+
+        // A binary tree with N leaves has 2 * N - 1 nodes
+        m_Nodes.resize(size_t{NumPrimitives} * 2 - 1);
+
+        if (m_CI.pThreadPool != nullptr && NumPrimitives >= m_CI.MinPrimitivesPerTask)
+        {
+            TaskGroup Group{m_CI.pThreadPool};
+            BuildNode(0, 0, NumPrimitives, 0, &Group);
+            Group.Wait();
+        }
+        else
+        {
+            BuildNode(0, 0, NumPrimitives, 0, nullptr);
+        }
+
+        m_Nodes.resize(m_NumNodes.load());
+        m_Nodes.shrink_to_fit();
+    }
+
+private:
+    static constexpr Uint32 MaxBins = 64;
+
+    struct Bin
+    {
+        BoundBox Bounds = BoundBox::Invalid();
+        Uint32   Count  = 0;
+    };
+
+    static float GetHalfArea(const BoundBox& Box)
+    {
+        const float3 Size = Box.Max - Box.Min;
+        return Size.x * Size.y + Size.y * Size.z + Size.z * Size.x;
+    }
+
+    Uint32 GetBinIndex(float Centroid, float Min, float Scale) const
+    {
+        return std::min(static_cast<Uint32>((Centroid - Min) * Scale), m_NumBins - 1);
+    }
+
+    void BuildNode(Uint32 NodeIdx, Uint32 Begin, Uint32 End, Uint32 Depth, TaskGroup* pGroup)
+    {
+        BoundBox Bounds         = BoundBox::Invalid();
+        BoundBox CentroidBounds = BoundBox::Invalid();
+        for (Uint32 i = Begin; i < End; ++i)
+        {
+            const Uint32 PrimIdx = m_PrimitiveIndices[i];
+            Bounds               = Bounds.Combine(m_CI.pPrimitiveBounds[PrimIdx]);
+            CentroidBounds       = CentroidBounds.Enclose(m_Centroids[PrimIdx]);
+        }
+
+        BVH::Node& N = m_Nodes[NodeIdx];
+        N.Min        = Bounds.Min;
+        N.Max        = Bounds.Max;
+
+        const Uint32 Count = End - Begin;
+        // The traversal stack holds at most one node per level
+        if (Count <= 1 || Depth + 1 >= BVH::MaxDepth)
+        {
+            N.FirstChildOrPrimitive = Begin;
+            N.NumPrimitives         = Count;
+            return;
+        }
+
+        // Find the split with the lowest SAH cost:
+        //      Cost = TraversalCost * Area + IntersectionCost * (LeftArea * LeftCount + RightArea * RightCount)
+        // Both costs are set to one and areas are not normalized.
+        int    BestAxis  = -1;
+        Uint32 BestSplit = 0;
+        float  BestCost  = +FLT_MAX;
+        for (int Axis = 0; Axis < 3; ++Axis)
+        {
+            const float Extent = CentroidBounds.Max[Axis] - CentroidBounds.Min[Axis];
+            if (!(Extent > 0))
+                continue;
+
+            const float Scale = static_cast<float>(m_NumBins) / Extent;
+
+            std::array<Bin, MaxBins> Bins;
+            for (Uint32 i = Begin; i < End; ++i)
+            {
+                const Uint32 PrimIdx = m_PrimitiveIndices[i];
+                Bin&         B       = Bins[GetBinIndex(m_Centroids[PrimIdx][Axis], CentroidBounds.Min[Axis], Scale)];
+                B.Bounds             = B.Bounds.Combine(m_CI.pPrimitiveBounds[PrimIdx]);
+                ++B.Count;
+            }
+
+            // RightCost[s] is the cost of the bins [s, NumBins)
+            std::array<float, MaxBins> RightCost;
+            BoundBox                   RightBounds = BoundBox::Invalid();
+            Uint32                     RightCount  = 0;
+            for (Uint32 s = m_NumBins - 1; s > 0; --s)
+            {
+                RightBounds  = RightBounds.Combine(Bins[s].Bounds);
+                RightCount  += Bins[s].Count;
+                RightCost[s] = RightCount > 0 ? GetHalfArea(RightBounds) * static_cast<float>(RightCount) : 0;
+            }
+
+            BoundBox LeftBounds = BoundBox::Invalid();
+            Uint32   LeftCount  = 0;
+            for (Uint32 s = 1; s < m_NumBins; ++s)
+            {
+                LeftBounds = LeftBounds.Combine(Bins[s - 1].Bounds);
+                LeftCount += Bins[s - 1].Count;
+                if (LeftCount == 0 || LeftCount == Count)
+                    continue;
+
+                const float Cost = GetHalfArea(LeftBounds) * static_cast<float>(LeftCount) + RightCost[s];
+                if (Cost < BestCost)
+                {
+                    BestCost  = Cost;
+                    BestAxis  = Axis;
+                    BestSplit = s;
+                }
+            }
+        }
+
+        const float Area = GetHalfArea(Bounds);
+        if (Count <= m_MaxLeafSize && (BestAxis < 0 || Area + BestCost >= Area * static_cast<float>(Count)))
+        {
+            N.FirstChildOrPrimitive = Begin;
+            N.NumPrimitives         = Count;
+            return;
+        }
+
+        Uint32 Mid = Begin + Count / 2;
+        if (BestAxis >= 0)
+        {
+            const float Min   = CentroidBounds.Min[BestAxis];
+            const float Scale = static_cast<float>(m_NumBins) / (CentroidBounds.Max[BestAxis] - Min);
+
+            auto MidIt = std::partition(m_PrimitiveIndices.begin() + Begin, m_PrimitiveIndices.begin() + End,
+                                        [&](Uint32 PrimIdx) {
+                                            return GetBinIndex(m_Centroids[PrimIdx][BestAxis], Min, Scale) < BestSplit;
+                                        });
+            Mid = static_cast<Uint32>(MidIt - m_PrimitiveIndices.begin());
+            VERIFY_EXPR(Mid > Begin && Mid < End);
+        }
+        // Otherwise all centroids are the same, and the primitives are split in the middle
+
+        const Uint32 FirstChild = m_NumNodes.fetch_add(2);
+        VERIFY_EXPR(FirstChild + 1 < m_Nodes.size());
+        N.FirstChildOrPrimitive = FirstChild;
+        N.NumPrimitives         = 0;
+
+        if (pGroup != nullptr && Mid - Begin >= m_CI.MinPrimitivesPerTask)
+        {
+            pGroup->Run([this, FirstChild, Begin, Mid, Depth, pGroup]() {
+                BuildNode(FirstChild, Begin, Mid, Depth + 1, pGroup);
+            });
+        }
+        else
+        {
+            BuildNode(FirstChild, Begin, Mid, Depth + 1, pGroup);
+        }
+        BuildNode(FirstChild + 1, Mid, End, Depth + 1, pGroup);
+    }
+
+private:
+    const BVH::CreateInfo& m_CI;
+
+    const Uint32 m_NumBins;
+    const Uint32 m_MaxLeafSize;
+
+    std::vector<float3>      m_Centroids;
+    std::vector<BVH::Node>&  m_Nodes;
+    std::vector<Uint32>&     m_PrimitiveIndices;
+    std::atomic<Uint32>      m_NumNodes{1};
+};
+
+} // namespace
+
+BVH::BVH(const CreateInfo& CI)
+{
+    if (CI.NumPrimitives == 0)
+        return;
+
+    DEV_CHECK_ERR(CI.pPrimitiveBounds != nullptr, "Primitive bounds must not be null");
+
+    BVHBuilder Builder{CI, m_Nodes, m_PrimitiveIndices};
+    Builder.Build();
+}
+
+
+namespace
+{
+
+// Returns true if the hit with the distance t on the triangle TriIdx is closer than
+// the current hit. Equidistant hits are resolved by the triangle index so that the result
+// does not depend on the traversal order.
+inline bool IsCloserHit(float t, Uint32 TriIdx, float HitDist, Uint32 HitTri)
+{
+    return t < HitDist || (t == HitDist && TriIdx < HitTri);
+}
+
+struct RayPacket
+{
+    static constexpr Uint32 Size = TriangleMeshBVH::PacketSize;
+
+    float Org[3][Size];
+    float Dir[3][Size];
+    float InvDir[3][Size];
+
+    // The maximum hit distance. Negative for inactive rays.
+    float  MaxDist[Size];
+    Uint32 HitTri[Size];
+
+    // The direction used to order the children
+    float3 OrderDir;
+
+    RayPacket(const TriangleMeshBVH::Ray* pRays, Uint32 NumRays)
+    {
+        VERIFY_EXPR(NumRays > 0 && NumRays <= Size);
+        for (Uint32 r = 0; r < Size; ++r)
+        {
+            if (r < NumRays)
+            {
+                const BVH::TraversalRay Ray{pRays[r].Origin, pRays[r].Direction};
+                for (int c = 0; c < 3; ++c)
+                {
+                    Org[c][r]    = Ray.Origin[c];
+                    Dir[c][r]    = Ray.Direction[c];
+                    InvDir[c][r] = Ray.InvDirection[c];
+                }
+                MaxDist[r] = pRays[r].MaxDistance;
+            }
+            else
+            {
+                for (int c = 0; c < 3; ++c)
+                {
+                    Org[c][r]    = 0;
+                    Dir[c][r]    = 1;
+                    InvDir[c][r] = 1;
+                }
+                MaxDist[r] = -1;
+            }
+            HitTri[r] = TriangleMeshBVH::InvalidTriangleIndex;
+        }
+
+        OrderDir = float3{};
+        for (Uint32 r = 0; r < NumRays; ++r)
+            OrderDir += pRays[r].Direction;
+    }
+
+    // Returns true if any active ray intersects the node.
+    // The math is the same as in BVH::IntersectNode().
+    bool IntersectNode(const BVH::Node& N) const
+    {
+        int AnyHit = 0;
+        for (Uint32 r = 0; r < Size; ++r)
+        {
+            const float t0x = (N.Min.x - Org[0][r]) * InvDir[0][r];
+            const float t1x = (N.Max.x - Org[0][r]) * InvDir[0][r];
+            const float t0y = (N.Min.y - Org[1][r]) * InvDir[1][r];
+            const float t1y = (N.Max.y - Org[1][r]) * InvDir[1][r];
+            const float t0z = (N.Min.z - Org[2][r]) * InvDir[2][r];
+            const float t1z = (N.Max.z - Org[2][r]) * InvDir[2][r];
+
+            const float NearX = t1x < t0x ? t1x : t0x;
+            const float NearY = t1y < t0y ? t1y : t0y;
+            const float NearZ = t1z < t0z ? t1z : t0z;
+            const float FarX  = t0x < t1x ? t1x : t0x;
+            const float FarY  = t0y < t1y ? t1y : t0y;
+            const float FarZ  = t0z < t1z ? t1z : t0z;
+
+            float EnterDist = NearX > NearY ? NearX : NearY;
+            EnterDist       = EnterDist > NearZ ? EnterDist : NearZ;
+            EnterDist       = EnterDist > 0.f ? EnterDist : 0.f;
+
+            float ExitDist = FarX < FarY ? FarX : FarY;
+            ExitDist       = ExitDist < FarZ ? ExitDist : FarZ;
+
+            AnyHit |= (EnterDist <= ExitDist * BVH::DistanceTolerance && EnterDist <= MaxDist[r] * BVH::DistanceTolerance) ? 1 : 0;
+        }
+        return AnyHit != 0;
+    }
+
+    // Intersects all active rays with the triangle.
+    // The math is the same as in IntersectRayTriangle().
+    template <bool AnyHitQuery>
+    void IntersectTriangle(const float3& V0, const float3& V1, const float3& V2, Uint32 TriIdx, bool CullBackFace)
+    {
+        const float3 V0_V1 = V1 - V0;
+        const float3 V0_V2 = V2 - V0;
+
+        static constexpr float Epsilon = 1e-10f;
+        for (Uint32 r = 0; r < Size; ++r)
+        {
+            const float Dx = Dir[0][r];
+            const float Dy = Dir[1][r];
+            const float Dz = Dir[2][r];
+
+            // PVec = cross(RayDirection, V0_V2)
+            const float Px = (Dy * V0_V2.z) - (Dz * V0_V2.y);
+            const float Py = (Dz * V0_V2.x) - (Dx * V0_V2.z);
+            const float Pz = (Dx * V0_V2.y) - (Dy * V0_V2.x);
+
+            const float Det = V0_V1.x * Px + V0_V1.y * Py + V0_V1.z * Pz;
+
+            // V0_RO = RayOrigin - V0
+            const float Tx = Org[0][r] - V0.x;
+            const float Ty = Org[1][r] - V0.y;
+            const float Tz = Org[2][r] - V0.z;
+
+            const float u = (Tx * Px + Ty * Py + Tz * Pz) / Det;
+
+            // QVec = cross(V0_RO, V0_V1)
+            const float Qx = (Ty * V0_V1.z) - (Tz * V0_V1.y);
+            const float Qy = (Tz * V0_V1.x) - (Tx * V0_V1.z);
+            const float Qz = (Tx * V0_V1.y) - (Ty * V0_V1.x);
+
+            const float v = (Dx * Qx + Dy * Qy + Dz * Qz) / Det;
+            const float t = (V0_V2.x * Qx + V0_V2.y * Qy + V0_V2.z * Qz) / Det;
+
+            const bool IsHit = (Det > Epsilon || (!CullBackFace && Det < -Epsilon)) &&
+                u >= 0 && u <= 1 && v >= 0 && u + v <= 1 &&
+                t >= 0 && t <= MaxDist[r] && IsCloserHit(t, TriIdx, MaxDist[r], HitTri[r]);
+
+            if (AnyHitQuery)
+            {
+                // Deactivate the ray
+                MaxDist[r] = IsHit ? -1.f : MaxDist[r];
+                HitTri[r]  = IsHit ? TriIdx : HitTri[r];
+            }
+            else
+            {
+                MaxDist[r] = IsHit ? t : MaxDist[r];
+                HitTri[r]  = IsHit ? TriIdx : HitTri[r];
+            }
+        }
+    }
+
+    bool IsActive() const
+    {
+        int Active = 0;
+        for (Uint32 r = 0; r < Size; ++r)
+            Active |= MaxDist[r] >= 0 ? 1 : 0;
+        return Active != 0;
+    }
+};
+
+} // namespace
+
+TriangleMeshBVH::TriangleMeshBVH(const CreateInfo& CI)
+{
+    if (CI.NumTriangles == 0)
+        return;
+
+    DEV_CHECK_ERR(CI.pVertices != nullptr, "Vertices must not be null");
+
+    auto GetVertex = [&CI](Uint32 Tri, Uint32 Vert) {
+        const Uint32 Idx = CI.pIndices != nullptr ? CI.pIndices[Tri * 3 + Vert] : Tri * 3 + Vert;
+        DEV_CHECK_ERR(Idx < CI.NumVertices, "Vertex index ", Idx, " is out of range [0, ", CI.NumVertices, ")");
+        return CI.pVertices[Idx];
+    };
+
+    std::vector<BoundBox> Bounds(CI.NumTriangles);
+    for (Uint32 i = 0; i < CI.NumTriangles; ++i)
+    {
+        const float3 V0 = GetVertex(i, 0);
+        const float3 V1 = GetVertex(i, 1);
+        const float3 V2 = GetVertex(i, 2);
+
+        const float3 Min = (std::min)((std::min)(V0, V1), V2);
+        const float3 Max = (std::max)((std::max)(V0, V1), V2);
+
+        // Slightly inflate the bounds so that the rays that graze the triangle edges or vertices
+        // lying exactly on the box faces are not rejected by the ray/box test (this in particular
+        // happens for axis-aligned rays whose zero direction components make the slab test degenerate).
+        const float3 Eps = ((std::max)(abs(Min), abs(Max)) + float3{1, 1, 1}) * (4.f * FLT_EPSILON);
+
+        Bounds[i] = BoundBox{Min - Eps, Max + Eps};
+    }
+
+    BVH::CreateInfo BVHCI;
+    BVHCI.pPrimitiveBounds = Bounds.data();
+    BVHCI.NumPrimitives    = CI.NumTriangles;
+    BVHCI.MaxLeafSize      = CI.MaxLeafSize;
+    BVHCI.NumBins          = CI.NumBins;
+    BVHCI.pThreadPool      = CI.pThreadPool;
+    m_BVH                  = BVH{BVHCI};
+
+    const std::vector<Uint32>& TriangleIndices = m_BVH.GetPrimitiveIndices();
+
+    m_Triangles.resize(CI.NumTriangles);
+    for (Uint32 i = 0; i < CI.NumTriangles; ++i)
+    {
+        const Uint32 Tri = TriangleIndices[i];
+        m_Triangles[i]   = Triangle{GetVertex(Tri, 0), GetVertex(Tri, 1), GetVertex(Tri, 2)};
+    }
+}
+
+TriangleMeshBVH::Hit TriangleMeshBVH::CastRay(const Ray& R, bool CullBackFace) const
+{
+    const std::vector<Uint32>& TriangleIndices = m_BVH.GetPrimitiveIndices();
+
+    Hit   Res;
+    float MaxDistance = R.MaxDistance;
+    m_BVH.TraverseRay(BVH::TraversalRay{R.Origin, R.Direction}, MaxDistance,
+                      [&](Uint32 FirstTriangle, Uint32 NumTriangles, float& MaxDist) {
+                          for (Uint32 i = FirstTriangle; i < FirstTriangle + NumTriangles; ++i)
+                          {
+                              const Triangle& Tri = m_Triangles[i];
+
+                              const float t = IntersectRayTriangle(Tri.V0, Tri.V1, Tri.V2, R.Origin, R.Direction, CullBackFace);
+                              if (t != +FLT_MAX && t >= 0 && t <= MaxDist && IsCloserHit(t, TriangleIndices[i], MaxDist, Res.TriangleIndex))
+                              {
+                                  MaxDist           = t;
+                                  Res.Distance      = t;
+                                  Res.TriangleIndex = TriangleIndices[i];
+                              }
+                          }
+                          return false;
+                      });
+    return Res;
+}
+
+bool TriangleMeshBVH::AnyHit(const Ray& R, bool CullBackFace) const
+{
+    bool  IsHit       = false;
+    float MaxDistance = R.MaxDistance;
+    m_BVH.TraverseRay(BVH::TraversalRay{R.Origin, R.Direction}, MaxDistance,
+                      [&](Uint32 FirstTriangle, Uint32 NumTriangles, float& MaxDist) {
+                          for (Uint32 i = FirstTriangle; i < FirstTriangle + NumTriangles && !IsHit; ++i)
+                          {
+                              const Triangle& Tri = m_Triangles[i];
+
+                              const float t = IntersectRayTriangle(Tri.V0, Tri.V1, Tri.V2, R.Origin, R.Direction, CullBackFace);
+                              IsHit         = t != +FLT_MAX && t >= 0 && t <= MaxDist;
+                          }
+                          return IsHit;
+                      });
+    return IsHit;
+}
+
+template <bool AnyHitQuery>
+void TriangleMeshBVH::TraversePacket(const Ray* pRays, Uint32 NumRays, Hit* pHits, bool CullBackFace) const
+{
+    const std::vector<BVH::Node>& Nodes           = m_BVH.GetNodes();
+    const std::vector<Uint32>&    TriangleIndices = m_BVH.GetPrimitiveIndices();
+
+    RayPacket Packet{pRays, NumRays};
+
+    Uint32 Stack[BVH::MaxDepth + 1];
+    Uint32 StackSize   = 0;
+    Stack[StackSize++] = 0;
+    while (StackSize > 0)
+    {
+        const BVH::Node& N = Nodes[Stack[--StackSize]];
+        if (!Packet.IntersectNode(N))
+            continue;
+
+        if (N.IsLeaf())
+        {
+            for (Uint32 i = N.FirstChildOrPrimitive; i < N.FirstChildOrPrimitive + N.NumPrimitives; ++i)
+            {
+                const Triangle& Tri = m_Triangles[i];
+                Packet.IntersectTriangle<AnyHitQuery>(Tri.V0, Tri.V1, Tri.V2, TriangleIndices[i], CullBackFace);
+            }
+            if (AnyHitQuery && !Packet.IsActive())
+                break;
+        }
+        else
+        {
+            // Push the far child first so that the near child is visited first.
+            // The children are ordered by the projection of their centers onto the average packet direction.
+            const BVH::Node& Child0 = Nodes[N.FirstChildOrPrimitive];
+            const BVH::Node& Child1 = Nodes[N.FirstChildOrPrimitive + 1];
+
+            const bool Child0First = dot((Child1.Min + Child1.Max) - (Child0.Min + Child0.Max), Packet.OrderDir) >= 0;
+
+            VERIFY_EXPR(StackSize + 2 <= BVH::MaxDepth + 1);
+            Stack[StackSize++] = N.FirstChildOrPrimitive + (Child0First ? 1 : 0);
+            Stack[StackSize++] = N.FirstChildOrPrimitive + (Child0First ? 0 : 1);
+        }
+    }
+
+    for (Uint32 r = 0; r < NumRays; ++r)
+    {
+        pHits[r].TriangleIndex = Packet.HitTri[r];
+        pHits[r].Distance      = (!AnyHitQuery && Packet.HitTri[r] != InvalidTriangleIndex) ? Packet.MaxDist[r] : +FLT_MAX;
+    }
+}
+
+void TriangleMeshBVH::CastRays(const Ray* pRays, Uint32 NumRays, Hit* pHits, bool CullBackFace) const
+{
+    DEV_CHECK_ERR(NumRays == 0 || (pRays != nullptr && pHits != nullptr), "Ray and hit arrays must not be null");
+
+    if (m_Triangles.empty())
+    {
+        for (Uint32 r = 0; r < NumRays; ++r)
+            pHits[r] = Hit{};
+        return;
+    }
+
+    for (Uint32 r = 0; r < NumRays; r += PacketSize)
+        TraversePacket<false>(pRays + r, std::min(NumRays - r, PacketSize), pHits + r, CullBackFace);
+}
+
+void TriangleMeshBVH::AnyHits(const Ray* pRays, Uint32 NumRays, bool* pResults, bool CullBackFace) const
+{
+    DEV_CHECK_ERR(NumRays == 0 || (pRays != nullptr && pResults != nullptr), "Ray and result arrays must not be null");
+
+    for (Uint32 r = 0; r < NumRays; r += PacketSize)
+    {
+        const Uint32 PacketRays = std::min(NumRays - r, PacketSize);
+
+        Hit Hits[PacketSize];
+        if (!m_Triangles.empty())
+            TraversePacket<true>(pRays + r, PacketRays, Hits, CullBackFace);
+        for (Uint32 i = 0; i < PacketRays; ++i)
+            pResults[r + i] = static_cast<bool>(Hits[i]);
+    }
+}
+
+} // namespace Diligent
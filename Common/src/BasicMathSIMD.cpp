@@ -0,0 +1,230 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "BasicMathSIMD.hpp"
+
+#include "DebugUtilities.hpp"
+
+#define CHECK_BATCH_ARGS(pSrc, pDst, Count) \
+    DEV_CHECK_ERR(Count == 0 || (pSrc != nullptr && pDst != nullptr), "Source and destination arrays must not be null")
+
+namespace Diligent
+{
+
+namespace
+{
+
+#if DILIGENT_AVX2_ENABLED
+// Multiplies two rows of m1 at a time using 256-bit registers
+inline float4x4 MulAVX2(const float4x4& m1, const __m256 r0, const __m256 r1, const __m256 r2, const __m256 r3)
+{
+    float4x4 Res;
+    for (int i = 0; i < 4; i += 2)
+    {
+        const __m256 a = _mm256_loadu_ps(m1.m[i]);
+
+        const __m256 r = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0)), r0),
+                                                     _mm256_mul_ps(_mm256_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1)), r1)),
+                                       _mm256_add_ps(_mm256_mul_ps(_mm256_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 2, 2)), r2),
+                                                     _mm256_mul_ps(_mm256_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 3)), r3)));
+        _mm256_storeu_ps(Res.m[i], r);
+    }
+    return Res;
+}
+
+inline __m256 BroadcastRow(const float4x4& m, int row)
+{
+    return _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m.m[row]));
+}
+#endif
+
+#if DILIGENT_SSE2_ENABLED
+inline void StoreFloat3(float3& Dst, __m128 v)
+{
+    _mm_storel_pi(reinterpret_cast<__m64*>(&Dst.x), v);
+    _mm_store_ss(&Dst.z, _mm_movehl_ps(v, v));
+}
+#endif
+
+} // namespace
+
+
+void MultiplyMatrices(const float4x4* pLeft, const float4x4* pRight, float4x4* pDst, Uint32 Count)
+{
+    CHECK_BATCH_ARGS(pLeft, pDst, Count);
+    CHECK_BATCH_ARGS(pRight, pDst, Count);
+
+    for (Uint32 i = 0; i < Count; ++i)
+    {
+#if DILIGENT_AVX2_ENABLED
+        const float4x4& m2 = pRight[i];
+        pDst[i]            = MulAVX2(pLeft[i], BroadcastRow(m2, 0), BroadcastRow(m2, 1), BroadcastRow(m2, 2), BroadcastRow(m2, 3));
+#else
+        pDst[i] = SIMDMath::Mul(pLeft[i], pRight[i]);
+#endif
+    }
+}
+
+void MultiplyMatrices(const float4x4* pLeft, const float4x4& Right, float4x4* pDst, Uint32 Count)
+{
+    CHECK_BATCH_ARGS(pLeft, pDst, Count);
+
+#if DILIGENT_AVX2_ENABLED
+    const __m256 r0 = BroadcastRow(Right, 0);
+    const __m256 r1 = BroadcastRow(Right, 1);
+    const __m256 r2 = BroadcastRow(Right, 2);
+    const __m256 r3 = BroadcastRow(Right, 3);
+    for (Uint32 i = 0; i < Count; ++i)
+        pDst[i] = MulAVX2(pLeft[i], r0, r1, r2, r3);
+#else
+    // Copy the matrix so that the compiler does not have to reload it
+    // after every store to the destination array
+    const float4x4 m2 = Right;
+    for (Uint32 i = 0; i < Count; ++i)
+        pDst[i] = SIMDMath::Mul(pLeft[i], m2);
+#endif
+}
+
+void MultiplyMatrices(const float4x4& Left, const float4x4* pRight, float4x4* pDst, Uint32 Count)
+{
+    CHECK_BATCH_ARGS(pRight, pDst, Count);
+
+    const float4x4 m1 = Left;
+    for (Uint32 i = 0; i < Count; ++i)
+    {
+#if DILIGENT_AVX2_ENABLED
+        const float4x4& m2 = pRight[i];
+        pDst[i]            = MulAVX2(m1, BroadcastRow(m2, 0), BroadcastRow(m2, 1), BroadcastRow(m2, 2), BroadcastRow(m2, 3));
+#else
+        pDst[i] = SIMDMath::Mul(m1, pRight[i]);
+#endif
+    }
+}
+
+void TransposeMatrices(const float4x4* pSrc, float4x4* pDst, Uint32 Count)
+{
+    CHECK_BATCH_ARGS(pSrc, pDst, Count);
+
+    for (Uint32 i = 0; i < Count; ++i)
+        pDst[i] = SIMDMath::Transpose(pSrc[i]);
+}
+
+void InvertMatrices(const float4x4* pSrc, float4x4* pDst, Uint32 Count)
+{
+    CHECK_BATCH_ARGS(pSrc, pDst, Count);
+
+    for (Uint32 i = 0; i < Count; ++i)
+        pDst[i] = SIMDMath::Inverse(pSrc[i]);
+}
+
+void TransformPoints(const float4* pSrc, const float4x4& Mat, float4* pDst, Uint32 Count)
+{
+    CHECK_BATCH_ARGS(pSrc, pDst, Count);
+
+#if DILIGENT_SSE2_ENABLED
+    const __m128 r0 = SIMDMath::LoadRow(Mat, 0);
+    const __m128 r1 = SIMDMath::LoadRow(Mat, 1);
+    const __m128 r2 = SIMDMath::LoadRow(Mat, 2);
+    const __m128 r3 = SIMDMath::LoadRow(Mat, 3);
+    for (Uint32 i = 0; i < Count; ++i)
+    {
+        const __m128 v = _mm_loadu_ps(&pSrc[i].x);
+        _mm_storeu_ps(&pDst[i].x,
+                      SIMDMath::TransformRow(_mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)),
+                                             _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)),
+                                             _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)),
+                                             _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)),
+                                             r0, r1, r2, r3));
+    }
+#else
+    const float4x4 m = Mat;
+    for (Uint32 i = 0; i < Count; ++i)
+        pDst[i] = SIMDMath::Transform(pSrc[i], m);
+#endif
+}
+
+void TransformPoints(const float3* pSrc, const float4x4& Mat, float3* pDst, Uint32 Count)
+{
+    CHECK_BATCH_ARGS(pSrc, pDst, Count);
+
+#if DILIGENT_SSE2_ENABLED
+    const __m128 r0 = SIMDMath::LoadRow(Mat, 0);
+    const __m128 r1 = SIMDMath::LoadRow(Mat, 1);
+    const __m128 r2 = SIMDMath::LoadRow(Mat, 2);
+    const __m128 r3 = SIMDMath::LoadRow(Mat, 3);
+    for (Uint32 i = 0; i < Count; ++i)
+    {
+        const float3& p = pSrc[i];
+
+        const __m128 v = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_load1_ps(&p.x), r0), _mm_mul_ps(_mm_load1_ps(&p.y), r1)),
+                                    _mm_add_ps(_mm_mul_ps(_mm_load1_ps(&p.z), r2), r3));
+        StoreFloat3(pDst[i], _mm_div_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))));
+    }
+#else
+    const float4x4 m = Mat;
+    for (Uint32 i = 0; i < Count; ++i)
+    {
+        const float4 v = SIMDMath::Transform(float4{pSrc[i], 1}, m);
+        pDst[i]        = float3{v.x, v.y, v.z} / v.w;
+    }
+#endif
+}
+
+void TransformVectors(const float3* pSrc, const float4x4& Mat, float3* pDst, Uint32 Count)
+{
+    CHECK_BATCH_ARGS(pSrc, pDst, Count);
+
+#if DILIGENT_SSE2_ENABLED
+    const __m128 r0 = SIMDMath::LoadRow(Mat, 0);
+    const __m128 r1 = SIMDMath::LoadRow(Mat, 1);
+    const __m128 r2 = SIMDMath::LoadRow(Mat, 2);
+    for (Uint32 i = 0; i < Count; ++i)
+    {
+        const float3& v = pSrc[i];
+        StoreFloat3(pDst[i],
+                    _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_load1_ps(&v.x), r0), _mm_mul_ps(_mm_load1_ps(&v.y), r1)),
+                               _mm_mul_ps(_mm_load1_ps(&v.z), r2)));
+    }
+#else
+    const float4x4 m = Mat;
+    for (Uint32 i = 0; i < Count; ++i)
+    {
+        const float4 v = SIMDMath::Transform(float4{pSrc[i], 0}, m);
+        pDst[i]        = float3{v.x, v.y, v.z};
+    }
+#endif
+}
+
+void MultiplyQuaternions(const QuaternionF* pLeft, const QuaternionF* pRight, QuaternionF* pDst, Uint32 Count)
+{
+    CHECK_BATCH_ARGS(pLeft, pDst, Count);
+    CHECK_BATCH_ARGS(pRight, pDst, Count);
+
+    for (Uint32 i = 0; i < Count; ++i)
+        pDst[i] = SIMDMath::Mul(pLeft[i], pRight[i]);
+}
+
+} // namespace Diligent
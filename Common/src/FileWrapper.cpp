@@ -26,6 +26,7 @@
 
 #include "FileWrapper.hpp"
 #include "DataBlobImpl.hpp"
+#include "MappedFileDataBlob.hpp"
 
 namespace Diligent
 {
@@ -99,6 +100,25 @@ bool FileWrapper::ReadWholeFile(const char* FilePath, IDataBlob** ppData, bool S
     return true;
 }
 
+bool FileWrapper::MapWholeFile(const char* FilePath, IDataBlob** ppData, EMappedFileAccessHint Hint, bool Silent)
+{
+    if (ppData == nullptr)
+    {
+        DEV_ERROR("Data pointer must not be null");
+        return false;
+    }
+
+    DEV_CHECK_ERR(*ppData == nullptr, "Data pointer is not null. This may result in memory leak.");
+
+    if (RefCntAutoPtr<MappedFileDataBlob> pData = MappedFileDataBlob::Create(FilePath, Hint))
+    {
+        *ppData = pData.Detach();
+        return true;
+    }
+
+    return ReadWholeFile(FilePath, ppData, Silent);
+}
+
 bool FileWrapper::WriteFile(const char* FilePath, const void* Data, size_t Size, bool Silent)
 {
     if (FilePath == nullptr || FilePath[0] == '\0')
@@ -27,6 +27,8 @@
 
 #include "pch.h"
 #include <algorithm>
+#include <atomic>
+#include <thread>
 #include "FixedBlockMemoryAllocator.hpp"
 #include "Align.hpp"
 
@@ -42,19 +44,28 @@ inline void FillWithDebugPattern(void* ptr, Uint8 Pattern, size_t NumBytes)
 #    define FillWithDebugPattern(...)
 #endif
 
-FixedBlockMemoryAllocator::MemoryPage::MemoryPage(FixedBlockMemoryAllocator& OwnerAllocator) :
+FixedBlockMemoryAllocator::MemoryPage::MemoryPage(FixedBlockMemoryAllocator& OwnerAllocator, size_t PageId) :
     // clang-format off
     m_NumFreeBlocks       {OwnerAllocator.m_NumBlocksInPage},
     m_NumInitializedBlocks{0},
     m_pOwnerAllocator     {&OwnerAllocator}
 // clang-format on
 {
-    const auto PageSize = OwnerAllocator.m_BlockSize * OwnerAllocator.m_NumBlocksInPage;
-    VERIFY_EXPR(PageSize > 0);
-    m_pPageStart = reinterpret_cast<Uint8*>(
-        OwnerAllocator.m_RawMemoryAllocator.Allocate(PageSize, "FixedBlockMemoryAllocator page", __FILE__, __LINE__));
+    const auto PageSize = OwnerAllocator.m_PageSize;
+    VERIFY_EXPR(PageSize > 0 && IsPowerOfTwo(PageSize));
+    VERIFY_EXPR(HeaderSize + OwnerAllocator.m_BlockSize * OwnerAllocator.m_NumBlocksInPage <= PageSize);
+
+    // Align the page by its size to find the page header from the block address
+    Uint8* pPageMemory = reinterpret_cast<Uint8*>(
+        OwnerAllocator.m_RawMemoryAllocator.AllocateAligned(PageSize, PageSize, "FixedBlockMemoryAllocator page", __FILE__, __LINE__));
+    FillWithDebugPattern(pPageMemory, NewPageMemPattern, PageSize);
+
+    PageHeader* pHeader = new (pPageMemory) PageHeader{};
+    pHeader->pOwner     = &OwnerAllocator;
+    pHeader->PageId     = PageId;
+
+    m_pPageStart     = pPageMemory + HeaderSize;
     m_pNextFreeBlock = m_pPageStart;
-    FillWithDebugPattern(m_pPageStart, NewPageMemPattern, PageSize);
 }
 
 FixedBlockMemoryAllocator::MemoryPage::MemoryPage(MemoryPage&& Page) noexcept :
@@ -76,7 +87,14 @@ FixedBlockMemoryAllocator::MemoryPage::MemoryPage(MemoryPage&& Page) noexcept :
 FixedBlockMemoryAllocator::MemoryPage::~MemoryPage()
 {
     if (m_pOwnerAllocator)
-        m_pOwnerAllocator->m_RawMemoryAllocator.Free(m_pPageStart);
+        m_pOwnerAllocator->m_RawMemoryAllocator.FreeAligned(reinterpret_cast<Uint8*>(m_pPageStart) - HeaderSize);
+}
+
+size_t FixedBlockMemoryAllocator::MemoryPage::GetPageId(const void* pBlockAddr, const FixedBlockMemoryAllocator& OwnerAllocator)
+{
+    const PageHeader* pHeader = AlignDown(reinterpret_cast<const PageHeader*>(pBlockAddr), OwnerAllocator.m_PageSize);
+    DEV_CHECK_ERR(pHeader->pOwner == &OwnerAllocator, "The block was not allocated by this allocator");
+    return pHeader->PageId;
 }
 
 void* FixedBlockMemoryAllocator::MemoryPage::GetBlockStartAddress(Uint32 BlockIndex) const
@@ -169,16 +187,43 @@ static size_t AdjustBlockSize(size_t BlockSize)
     return AlignUp(BlockSize, sizeof(void*));
 }
 
+size_t FixedBlockMemoryAllocator::GetPageSize(size_t BlockSize, Uint32 NumBlocksInPage)
+{
+    if (BlockSize == 0)
+        return 0;
+
+    const size_t MinPageSize = MemoryPage::HeaderSize + BlockSize * std::max(NumBlocksInPage, 1u);
+    return static_cast<size_t>(AlignUpToPowerOfTwo(Uint64{MinPageSize}));
+}
+
+Uint32 FixedBlockMemoryAllocator::GetNumBlocksInPage(size_t BlockSize, size_t PageSize)
+{
+    // Use all the space that remains after rounding the page size up
+    return BlockSize > 0 ?
+        static_cast<Uint32>((PageSize - MemoryPage::HeaderSize) / BlockSize) :
+        0;
+}
+
+// Thread index that is used to select the thread cache
+static Uint32 GetThreadIndex()
+{
+    static std::atomic<Uint32> NextThreadIndex{0};
+    static thread_local Uint32 ThreadIndex = NextThreadIndex.fetch_add(1);
+    return ThreadIndex;
+}
+
 FixedBlockMemoryAllocator::FixedBlockMemoryAllocator(IMemoryAllocator& RawMemoryAllocator,
                                                      size_t            BlockSize,
-                                                     Uint32            NumBlocksInPage) :
+                                                     Uint32            NumBlocksInPage,
+                                                     Uint32            ThreadCacheSize) :
     // clang-format off
     m_PagePool          (STD_ALLOCATOR_RAW_MEM(MemoryPage, RawMemoryAllocator, "Allocator for vector<MemoryPage>")),
     m_AvailablePages    (STD_ALLOCATOR_RAW_MEM(size_t, RawMemoryAllocator, "Allocator for unordered_set<size_t>") ),
-    m_AddrToPageId      (STD_ALLOCATOR_RAW_MEM(AddrToPageIdMapElem, RawMemoryAllocator, "Allocator for unordered_map<void*, size_t>")),
     m_RawMemoryAllocator{RawMemoryAllocator        },
     m_BlockSize         {AdjustBlockSize(BlockSize)},
-    m_NumBlocksInPage   {NumBlocksInPage           }
+    m_PageSize          {GetPageSize(m_BlockSize, NumBlocksInPage)},
+    m_NumBlocksInPage   {GetNumBlocksInPage(m_BlockSize, m_PageSize)},
+    m_ThreadCacheSize   {ThreadCacheSize}
 // clang-format on
 {
     // Allocate one page
@@ -186,10 +231,43 @@ FixedBlockMemoryAllocator::FixedBlockMemoryAllocator(IMemoryAllocator& RawMemory
     {
         CreateNewPage();
     }
+
+    if (m_ThreadCacheSize > 0)
+    {
+        // Use enough caches for all hardware threads to rarely share the cache
+        const Uint32 NumCores = std::max(std::thread::hardware_concurrency(), 1u);
+        m_NumThreadCaches     = 1;
+        while (m_NumThreadCaches < NumCores && m_NumThreadCaches < 64)
+            m_NumThreadCaches *= 2;
+
+        m_ThreadCaches = reinterpret_cast<ThreadCache*>(
+            m_RawMemoryAllocator.AllocateAligned(sizeof(ThreadCache) * m_NumThreadCaches, alignof(ThreadCache), "Fixed block allocator thread caches", __FILE__, __LINE__));
+        void** ppBlocks = reinterpret_cast<void**>(
+            m_RawMemoryAllocator.Allocate(sizeof(void*) * m_ThreadCacheSize * 2 * m_NumThreadCaches, "Fixed block allocator thread cache blocks", __FILE__, __LINE__));
+        for (Uint32 i = 0; i < m_NumThreadCaches; ++i)
+        {
+            ThreadCache* pCache = new (&m_ThreadCaches[i]) ThreadCache{};
+            pCache->ppBlocks    = ppBlocks + i * m_ThreadCacheSize * 2;
+        }
+    }
 }
 
 FixedBlockMemoryAllocator::~FixedBlockMemoryAllocator()
 {
+    if (m_ThreadCaches != nullptr)
+    {
+        void** ppBlocks = m_ThreadCaches[0].ppBlocks;
+        for (Uint32 i = 0; i < m_NumThreadCaches; ++i)
+        {
+            ThreadCache& Cache = m_ThreadCaches[i];
+            for (Uint32 b = 0; b < Cache.NumBlocks; ++b)
+                FreeToPages(Cache.ppBlocks[b]);
+            Cache.~ThreadCache();
+        }
+        m_RawMemoryAllocator.Free(ppBlocks);
+        m_RawMemoryAllocator.FreeAligned(m_ThreadCaches);
+    }
+
 #ifdef DILIGENT_DEBUG
     for (size_t p = 0; p < m_PagePool.size(); ++p)
     {
@@ -202,20 +280,13 @@ FixedBlockMemoryAllocator::~FixedBlockMemoryAllocator()
 void FixedBlockMemoryAllocator::CreateNewPage()
 {
     VERIFY_EXPR(m_BlockSize > 0);
-    m_PagePool.emplace_back(*this);
-    m_AvailablePages.insert(m_PagePool.size() - 1);
-    m_AddrToPageId.reserve(m_PagePool.size() * m_NumBlocksInPage);
+    const size_t PageId = m_PagePool.size();
+    m_PagePool.emplace_back(*this, PageId);
+    m_AvailablePages.insert(PageId);
 }
 
-void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+void* FixedBlockMemoryAllocator::AllocateFromPages()
 {
-    VERIFY_EXPR(Size > 0);
-
-    Size = AdjustBlockSize(Size);
-    VERIFY(m_BlockSize == Size, "Requested size (", Size, ") does not match the block size (", m_BlockSize, ")");
-
-    std::lock_guard<std::mutex> LockGuard(m_Mutex);
-
     if (m_AvailablePages.empty())
     {
         CreateNewPage();
@@ -224,7 +295,6 @@ void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescriptio
     auto  PageId = *m_AvailablePages.begin();
     auto& Page   = m_PagePool[PageId];
     auto* Ptr    = Page.Allocate();
-    m_AddrToPageId.insert(std::make_pair(Ptr, PageId));
     if (!Page.HasSpace())
     {
         m_AvailablePages.erase(m_AvailablePages.begin());
@@ -233,30 +303,85 @@ void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescriptio
     return Ptr;
 }
 
-void FixedBlockMemoryAllocator::Free(void* Ptr)
+void FixedBlockMemoryAllocator::FreeToPages(void* Ptr)
+{
+    const size_t PageId = MemoryPage::GetPageId(Ptr, *this);
+    VERIFY_EXPR(PageId < m_PagePool.size());
+    m_PagePool[PageId].DeAllocate(Ptr);
+    m_AvailablePages.insert(PageId);
+    // In current implementation pages are never released!
+    // Note that if we delete a page, all indices past it will be invalid
+}
+
+FixedBlockMemoryAllocator::ThreadCache& FixedBlockMemoryAllocator::GetThreadCache()
+{
+    VERIFY_EXPR(m_NumThreadCaches > 0 && IsPowerOfTwo(m_NumThreadCaches));
+    return m_ThreadCaches[GetThreadIndex() & (m_NumThreadCaches - 1)];
+}
+
+void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
 {
-    std::lock_guard<std::mutex> LockGuard(m_Mutex);
-    auto                        PageIdIt = m_AddrToPageId.find(Ptr);
-    if (PageIdIt != m_AddrToPageId.end())
+    VERIFY_EXPR(Size > 0);
+
+    Size = AdjustBlockSize(Size);
+    VERIFY(m_BlockSize == Size, "Requested size (", Size, ") does not match the block size (", m_BlockSize, ")");
+
+    if (m_ThreadCacheSize == 0)
     {
-        auto PageId = PageIdIt->second;
-        VERIFY_EXPR(PageId < m_PagePool.size());
-        m_PagePool[PageId].DeAllocate(Ptr);
-        m_AvailablePages.insert(PageId);
-        m_AddrToPageId.erase(PageIdIt);
-        if (m_AvailablePages.size() > 1 && !m_PagePool[PageId].HasAllocations())
-        {
-            // In current implementation pages are never released!
-            // Note that if we delete a page, all indices past it will be invalid
+        std::lock_guard<std::mutex> LockGuard(m_Mutex);
+        return AllocateFromPages();
+    }
 
-            //m_PagePool.erase(m_PagePool.begin() + PageId);
-            //m_AvailablePages.erase(PageId);
-        }
+    ThreadCache&             Cache = GetThreadCache();
+    Threading::SpinLockGuard CacheGuard{Cache.Lock};
+    if (Cache.NumBlocks == 0)
+    {
+        // Refill the cache from the page pool. The blocks are stored in the reverse order
+        // so that they are allocated in the same order as they are taken from the pool.
+        std::lock_guard<std::mutex> LockGuard(m_Mutex);
+        for (Uint32 i = 0; i < m_ThreadCacheSize; ++i)
+            Cache.ppBlocks[m_ThreadCacheSize - 1 - i] = AllocateFromPages();
+        Cache.NumBlocks = m_ThreadCacheSize;
     }
-    else
+
+    void* Ptr = Cache.ppBlocks[--Cache.NumBlocks];
+    FillWithDebugPattern(Ptr, MemoryPage::AllocatedBlockMemPattern, m_BlockSize);
+    return Ptr;
+}
+
+void FixedBlockMemoryAllocator::Free(void* Ptr)
+{
+    if (Ptr == nullptr)
+        return;
+
+    if (m_ThreadCacheSize == 0)
+    {
+        std::lock_guard<std::mutex> LockGuard(m_Mutex);
+        FreeToPages(Ptr);
+        return;
+    }
+
+    // Note that the block may be freed by a different thread than the one that allocated it.
+    ThreadCache&             Cache = GetThreadCache();
+    Threading::SpinLockGuard CacheGuard{Cache.Lock};
+    if (Cache.NumBlocks == m_ThreadCacheSize * 2)
     {
-        UNEXPECTED("Address not found in the allocations list - double freeing memory?");
+        // The cache is full - return the blocks that were freed first to the page pool
+        {
+            std::lock_guard<std::mutex> LockGuard(m_Mutex);
+            for (Uint32 i = 0; i < m_ThreadCacheSize; ++i)
+                FreeToPages(Cache.ppBlocks[i]);
+        }
+        std::copy(Cache.ppBlocks + m_ThreadCacheSize, Cache.ppBlocks + m_ThreadCacheSize * 2, Cache.ppBlocks);
+        Cache.NumBlocks = m_ThreadCacheSize;
     }
+
+#ifdef DILIGENT_DEVELOPMENT
+    // Validate the address
+    MemoryPage::GetPageId(Ptr, *this);
+#endif
+    FillWithDebugPattern(Ptr, MemoryPage::DeallocatedBlockMemPattern, m_BlockSize);
+    Cache.ppBlocks[Cache.NumBlocks++] = Ptr;
 }
 
 void* FixedBlockMemoryAllocator::AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
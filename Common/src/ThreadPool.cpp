@@ -27,22 +27,605 @@
 #include "ThreadPool.hpp"
 
 #include <algorithm>
+#include <array>
 #include <mutex>
 #include <thread>
 #include <map>
+#include <deque>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
+#include <memory>
 #include <condition_variable>
+#include <chrono>
 #include <cfloat>
 
 #include "PlatformMisc.hpp"
+#include "SpinLock.hpp"
+#include "WorkStealingQueue.hpp"
 
 namespace Diligent
 {
 
 AsyncTaskBase::~AsyncTaskBase()
 {
+    // Destroyed tasks are considered finished by the thread pools
+    InvokeCompletionCallbacks();
 }
 
+bool AsyncTaskBase::AddCompletionCallback(std::function<void()> Callback)
+{
+    Threading::SpinLockGuard Guard{m_CompletionCallbacksLock};
+    // NB: the flag must be set before the status is checked. SetStatus() stores the status
+    //     before reading the flag, so either the status is seen here, or the flag is seen there.
+    m_HasCompletionCallbacks.store(true);
+    if (IsFinished())
+        return false;
+
+    m_CompletionCallbacks.emplace_back(std::move(Callback));
+    return true;
+}
+
+void AsyncTaskBase::InvokeCompletionCallbacks()
+{
+    std::vector<std::function<void()>> Callbacks;
+    {
+        Threading::SpinLockGuard Guard{m_CompletionCallbacksLock};
+        Callbacks.swap(m_CompletionCallbacks);
+    }
+    for (auto& Callback : Callbacks)
+        Callback();
+}
+
+// Tracks the tasks whose prerequisites are not finished yet.
+//
+// A waiting task keeps an atomic counter of pending prerequisites and is added to the successor
+// list of every unfinished prerequisite. When a prerequisite finishes, the thread pool calls
+// OnTaskFinished(), which decrements the counters of its successors. A task is handed over to
+// the ready queue only when its last prerequisite completes, so blocked tasks never go through
+// the queue.
+//
+// Successor lists are keyed by the raw prerequisite pointer and are sharded to keep the lock
+// contention low. Since a prerequisite may be executed by another thread pool, completed manually
+// or destroyed without being run, the graph also subscribes to the completion of every
+// prerequisite derived from AsyncTaskBase. The callback adds the prerequisite to the list of
+// signaled prerequisites and wakes up the pool, which then calls ReleaseSignaledTasks().
+// Other IAsyncTask implementations can't notify the graph. While there are tasks that wait for
+// such prerequisites, the pool calls ReleaseFinishedTasks() when it has no other work, which
+// re-checks the prerequisites of all waiting tasks.
+class AsyncTaskDependencyGraph
+{
+public:
+    // OnPrerequisiteSignaled is called when a prerequisite that is not run by the pool may have
+    // been finished, see ReleaseSignaledTasks(). The function may be called by any thread
+    // while a shard lock is held, and must not access the graph.
+    explicit AsyncTaskDependencyGraph(std::function<void()> OnPrerequisiteSignaled) :
+        m_pSignals{std::make_shared<PrerequisiteSignals>(std::move(OnPrerequisiteSignaled))}
+    {}
+
+    // clang-format off
+    AsyncTaskDependencyGraph           (const AsyncTaskDependencyGraph&)  = delete;
+    AsyncTaskDependencyGraph           (      AsyncTaskDependencyGraph&&) = delete;
+    AsyncTaskDependencyGraph& operator=(const AsyncTaskDependencyGraph&)  = delete;
+    AsyncTaskDependencyGraph& operator=(      AsyncTaskDependencyGraph&&) = delete;
+    // clang-format on
+
+    ~AsyncTaskDependencyGraph()
+    {
+        VERIFY(m_NumWaitingTasks.load() == 0, "There are tasks waiting for their prerequisites. They will never run.");
+
+        // Completion callbacks may outlive the graph
+        m_pSignals->Detach();
+
+        std::unordered_set<WaitingTask*> WaitingTasks;
+        for (Shard& S : m_Shards)
+        {
+            for (auto& it : S.Successors)
+                WaitingTasks.insert(it.second.Tasks.begin(), it.second.Tasks.end());
+        }
+        for (WaitingTask* pWaiting : WaitingTasks)
+            delete pWaiting;
+    }
+
+    struct AddTaskResult
+    {
+        // The task is the only waiting task that has prerequisites that can't notify the graph.
+        // Threads that went to sleep while there were no such tasks must be woken up to start
+        // checking for stalled tasks.
+        bool FirstUnobservedTask = false;
+
+        // A task that was counted as waiting has been released. Since the task may finish
+        // before the waiting task counter is decremented, the caller must check if the pool
+        // has become idle.
+        bool TasksReleased = false;
+    };
+
+    // Adds the task to the graph. If all prerequisites are finished, the task is
+    // immediately passed to the ReadyTaskHandler.
+    template <typename HandlerType>
+    AddTaskResult AddTask(IAsyncTask*  pTask,
+                          IAsyncTask** ppPrerequisites,
+                          Uint32       NumPrerequisites,
+                          HandlerType  ReadyTaskHandler)
+    {
+        bool AllPrerequisitesFinished = true;
+        for (Uint32 i = 0; i < NumPrerequisites && AllPrerequisitesFinished; ++i)
+        {
+            if (ppPrerequisites[i] != nullptr && !ppPrerequisites[i]->IsFinished())
+                AllPrerequisitesFinished = false;
+        }
+        if (AllPrerequisitesFinished)
+        {
+            ReadyTaskHandler(RefCntAutoPtr<IAsyncTask>{pTask});
+            return {};
+        }
+
+        WaitingTask* pWaiting = new WaitingTask{pTask, ppPrerequisites, NumPrerequisites};
+        // The extra count prevents the task from being released while it is being registered
+        pWaiting->NumPending.store(static_cast<Uint32>(pWaiting->Prerequisites.size()) + 1);
+        m_NumWaitingTasks.fetch_add(1);
+
+        std::vector<WaitingTask*> ReadyTasks;
+        for (size_t i = 0; i < pWaiting->Prerequisites.size(); ++i)
+        {
+            Prerequisite& Prereq = pWaiting->Prerequisites[i];
+
+            Shard&                   S = GetShard(Prereq.pRawTask);
+            Threading::SpinLockGuard Guard{S.Lock};
+            // The prerequisite may have been satisfied by OnTaskFinished() through another
+            // slot with the same pointer, or by RemoveTask().
+            if (Prereq.Satisfied)
+                continue;
+
+            // Destroyed prerequisites are considered finished
+            auto pPrereqTask = Prereq.wpTask.Lock();
+            if (!pPrereqTask || pPrereqTask->IsFinished())
+            {
+                Prereq.Satisfied = true;
+                Decrement(pWaiting, 1, ReadyTasks);
+                continue;
+            }
+
+            // Add the task to the successor list of the prerequisite unless it has already been
+            // added for a duplicate prerequisite.
+            bool AlreadyAdded = false;
+            for (size_t j = 0; j < i && !AlreadyAdded; ++j)
+                AlreadyAdded = pWaiting->Prerequisites[j].pRawTask == Prereq.pRawTask && !pWaiting->Prerequisites[j].Satisfied;
+            if (AlreadyAdded)
+                continue;
+
+            AsyncTaskBase* pObservableTask = dynamic_cast<AsyncTaskBase*>(pPrereqTask.RawPtr());
+            if (pObservableTask == nullptr)
+                pWaiting->HasUnobservedPrerequisites = true;
+
+            auto it = S.Successors.find(Prereq.pRawTask);
+            if (it != S.Successors.end() && it->second.wpTask != Prereq.wpTask)
+            {
+                // The list belongs to a destroyed task that had the same address. Its successors
+                // are released, and the new task needs its own completion callback.
+                UpdateSuccessors(it->first, it->second.Tasks, ReadyTasks);
+                VERIFY(it->second.Tasks.empty(), "All successors of a destroyed task must be released");
+                S.Successors.erase(it);
+                it = S.Successors.end();
+            }
+            if (it == S.Successors.end())
+            {
+                // The first successor subscribes to the completion of the prerequisite
+                if (pObservableTask != nullptr &&
+                    !pObservableTask->AddCompletionCallback(
+                        [pSignals = m_pSignals, pRawTask = Prereq.pRawTask]() {
+                            pSignals->Signal(pRawTask);
+                        }))
+                {
+                    // The prerequisite has just finished
+                    Prereq.Satisfied = true;
+                    Decrement(pWaiting, 1, ReadyTasks);
+                    continue;
+                }
+                it = S.Successors.emplace(Prereq.pRawTask, SuccessorList{Prereq.wpTask}).first;
+            }
+            it->second.Tasks.push_back(pWaiting);
+        }
+
+        AddTaskResult Result;
+        if (pWaiting->HasUnobservedPrerequisites)
+            Result.FirstUnobservedTask = m_NumUnobservedTasks.fetch_add(1) == 0;
+
+        // Remove the registration count
+        Decrement(pWaiting, 1, ReadyTasks);
+        Result.TasksReleased = DispatchReadyTasks(ReadyTasks, ReadyTaskHandler);
+        return Result;
+    }
+
+    // Must be called after the task has finished. Successors whose last prerequisite
+    // was the finished task are passed to the ReadyTaskHandler.
+    // Returns true if any task has been released, see AddTaskResult::TasksReleased.
+    template <typename HandlerType>
+    bool OnTaskFinished(const IAsyncTask* pTask, HandlerType ReadyTaskHandler)
+    {
+        if (m_NumWaitingTasks.load() == 0)
+            return false;
+
+        std::vector<WaitingTask*> ReadyTasks;
+        {
+            Shard&                   S = GetShard(pTask);
+            Threading::SpinLockGuard Guard{S.Lock};
+
+            auto it = S.Successors.find(pTask);
+            if (it == S.Successors.end())
+                return false;
+
+            UpdateSuccessors(it->first, it->second.Tasks, ReadyTasks);
+            if (it->second.Tasks.empty())
+                S.Successors.erase(it);
+        }
+        return DispatchReadyTasks(ReadyTasks, ReadyTaskHandler);
+    }
+
+    // Releases the successors of the prerequisites that have notified the graph that they
+    // are finished or destroyed.
+    // Returns true if any task has been released, see AddTaskResult::TasksReleased.
+    template <typename HandlerType>
+    bool ReleaseSignaledTasks(HandlerType ReadyTaskHandler)
+    {
+        std::vector<const IAsyncTask*> SignaledTasks;
+        m_pSignals->Take(SignaledTasks);
+
+        bool TasksReleased = false;
+        for (const IAsyncTask* pTask : SignaledTasks)
+        {
+            if (OnTaskFinished(pTask, ReadyTaskHandler))
+                TasksReleased = true;
+        }
+        return TasksReleased;
+    }
+
+    bool HasSignaledPrerequisites() const
+    {
+        return m_pSignals->HasTasks();
+    }
+
+    // Re-checks the prerequisites of all waiting tasks and releases the tasks whose
+    // prerequisites are all finished or destroyed. This is only required for the
+    // prerequisites that can't notify the graph, see GetNumUnobservedTasks().
+    // Returns true if any task has been released, see AddTaskResult::TasksReleased.
+    template <typename HandlerType>
+    bool ReleaseFinishedTasks(HandlerType ReadyTaskHandler)
+    {
+        bool                      TasksReleased = false;
+        std::vector<WaitingTask*> ReadyTasks;
+        for (Shard& S : m_Shards)
+        {
+            {
+                Threading::SpinLockGuard Guard{S.Lock};
+                for (auto it = S.Successors.begin(); it != S.Successors.end();)
+                {
+                    UpdateSuccessors(it->first, it->second.Tasks, ReadyTasks);
+                    if (it->second.Tasks.empty())
+                        it = S.Successors.erase(it);
+                    else
+                        ++it;
+                }
+            }
+            if (DispatchReadyTasks(ReadyTasks, ReadyTaskHandler))
+                TasksReleased = true;
+            ReadyTasks.clear();
+        }
+        return TasksReleased;
+    }
+
+    // Removes the waiting task from the graph.
+    bool RemoveTask(const IAsyncTask* pTask)
+    {
+        // Find the task and mark it as removed while holding the lock of one of its
+        // unsatisfied prerequisites. The prerequisites of this shard will be satisfied last,
+        // which guarantees that the task object stays alive until then.
+        WaitingTask* pWaiting = nullptr;
+        size_t       ShardIdx = 0;
+        for (; ShardIdx < m_Shards.size() && pWaiting == nullptr; ++ShardIdx)
+        {
+            Shard&                   S = m_Shards[ShardIdx];
+            Threading::SpinLockGuard Guard{S.Lock};
+            for (auto it = S.Successors.begin(); it != S.Successors.end() && pWaiting == nullptr; ++it)
+            {
+                for (WaitingTask* pSuccessor : it->second.Tasks)
+                {
+                    if (pSuccessor->pTask == pTask && (pSuccessor->NumPending.fetch_or(RemovedFlag) & RemovedFlag) == 0)
+                    {
+                        pWaiting = pSuccessor;
+                        break;
+                    }
+                }
+            }
+        }
+        if (pWaiting == nullptr)
+            return false;
+        --ShardIdx;
+
+        std::vector<WaitingTask*> ReadyTasks;
+
+        // Satisfy the prerequisites in all other shards first
+        for (Prerequisite& Prereq : pWaiting->Prerequisites)
+        {
+            const size_t PrereqShardIdx = GetShardIndex(Prereq.pRawTask);
+            if (PrereqShardIdx == ShardIdx)
+                continue;
+
+            Shard&                   S = m_Shards[PrereqShardIdx];
+            Threading::SpinLockGuard Guard{S.Lock};
+            if (!Prereq.Satisfied)
+            {
+                RemoveSuccessor(S, Prereq.pRawTask, pWaiting);
+                Prereq.Satisfied = true;
+                Decrement(pWaiting, 1, ReadyTasks);
+            }
+        }
+
+        // Satisfy the prerequisites in the shard where the task was found.
+        // This must be the last access to the task object as it may be destroyed by
+        // another thread after the counter is decremented.
+        {
+            Shard&                   S = m_Shards[ShardIdx];
+            Threading::SpinLockGuard Guard{S.Lock};
+
+            Uint32 NumSatisfied = 0;
+            for (Prerequisite& Prereq : pWaiting->Prerequisites)
+            {
+                if (GetShardIndex(Prereq.pRawTask) != ShardIdx || Prereq.Satisfied)
+                    continue;
+
+                RemoveSuccessor(S, Prereq.pRawTask, pWaiting);
+                Prereq.Satisfied = true;
+                ++NumSatisfied;
+            }
+            Decrement(pWaiting, NumSatisfied, ReadyTasks);
+        }
+
+        // Removed tasks are not passed to the handler
+        DispatchReadyTasks(ReadyTasks, [](RefCntAutoPtr<IAsyncTask>&&) {});
+
+        return true;
+    }
+
+    // Checks if the task is waiting for its prerequisites.
+    bool HasTask(const IAsyncTask* pTask)
+    {
+        if (m_NumWaitingTasks.load() == 0)
+            return false;
+
+        for (Shard& S : m_Shards)
+        {
+            Threading::SpinLockGuard Guard{S.Lock};
+            for (auto& it : S.Successors)
+            {
+                for (WaitingTask* pSuccessor : it.second.Tasks)
+                {
+                    if (pSuccessor->pTask == pTask && (pSuccessor->NumPending.load() & RemovedFlag) == 0)
+                        return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    int GetNumWaitingTasks() const
+    {
+        return m_NumWaitingTasks.load();
+    }
+
+    // Returns the number of waiting tasks that have prerequisites that are not derived from
+    // AsyncTaskBase and thus can't notify the graph when they are finished.
+    int GetNumUnobservedTasks() const
+    {
+        return m_NumUnobservedTasks.load();
+    }
+
+private:
+    struct Prerequisite
+    {
+        explicit Prerequisite(IAsyncTask* pTask) :
+            pRawTask{pTask},
+            wpTask{pTask}
+        {}
+
+        bool IsFinished()
+        {
+            // Destroyed prerequisites are considered finished
+            auto pTask = wpTask.Lock();
+            return !pTask || pTask->IsFinished();
+        }
+
+        // Raw pointer is only used as the successor list key
+        const IAsyncTask* const   pRawTask;
+        RefCntWeakPtr<IAsyncTask> wpTask;
+
+        // Must only be accessed under the lock of the shard that owns pRawTask
+        bool Satisfied = false;
+    };
+
+    struct WaitingTask
+    {
+        WaitingTask(IAsyncTask* _pTask, IAsyncTask** ppPrerequisites, Uint32 NumPrerequisites) :
+            pTask{_pTask}
+        {
+            Prerequisites.reserve(NumPrerequisites);
+            for (Uint32 i = 0; i < NumPrerequisites; ++i)
+            {
+                if (ppPrerequisites[i] != nullptr)
+                    Prerequisites.emplace_back(ppPrerequisites[i]);
+            }
+        }
+
+        RefCntAutoPtr<IAsyncTask> pTask;
+        std::vector<Prerequisite> Prerequisites;
+
+        // The number of unsatisfied prerequisites. The most significant bit is set when the task is removed.
+        std::atomic<Uint32> NumPending{0};
+
+        // Whether some prerequisites can't notify the graph, see GetNumUnobservedTasks().
+        // Only written while the task is being added.
+        bool HasUnobservedPrerequisites = false;
+    };
+    static constexpr Uint32 RemovedFlag = 0x80000000u;
+
+    struct SuccessorList
+    {
+        // Identifies the task instance the list belongs to. A destroyed task's address
+        // may be reused by a new task before the list is cleaned up.
+        RefCntWeakPtr<IAsyncTask> wpTask;
+        std::vector<WaitingTask*> Tasks;
+    };
+
+    struct alignas(64) Shard
+    {
+        Threading::SpinLock                                  Lock;
+        std::unordered_map<const IAsyncTask*, SuccessorList> Successors;
+    };
+    static constexpr size_t NumShards = 64;
+
+    // The prerequisites that have notified the graph through their completion callbacks.
+    // The object is shared with the callbacks as they may outlive the graph.
+    class PrerequisiteSignals
+    {
+    public:
+        explicit PrerequisiteSignals(std::function<void()> OnSignaled) :
+            m_OnSignaled{std::move(OnSignaled)}
+        {}
+
+        void Signal(const IAsyncTask* pTask)
+        {
+            std::lock_guard<std::mutex> Lock{m_Mtx};
+            if (!m_OnSignaled)
+                return;
+
+            m_Tasks.push_back(pTask);
+            m_HasTasks.store(true);
+            m_OnSignaled();
+        }
+
+        void Take(std::vector<const IAsyncTask*>& Tasks)
+        {
+            std::lock_guard<std::mutex> Lock{m_Mtx};
+            Tasks.swap(m_Tasks);
+            m_HasTasks.store(false);
+        }
+
+        bool HasTasks() const
+        {
+            return m_HasTasks.load();
+        }
+
+        void Detach()
+        {
+            std::lock_guard<std::mutex> Lock{m_Mtx};
+            m_OnSignaled = nullptr;
+            m_Tasks.clear();
+            m_HasTasks.store(false);
+        }
+
+    private:
+        std::mutex                     m_Mtx;
+        std::function<void()>          m_OnSignaled;
+        std::vector<const IAsyncTask*> m_Tasks;
+        std::atomic<bool>              m_HasTasks{false};
+    };
+
+    static size_t GetShardIndex(const IAsyncTask* pTask)
+    {
+        return (reinterpret_cast<size_t>(pTask) >> 4) % NumShards;
+    }
+
+    Shard& GetShard(const IAsyncTask* pTask)
+    {
+        return m_Shards[GetShardIndex(pTask)];
+    }
+
+    // Satisfies the prerequisites of the successors that are finished and removes the
+    // successors whose prerequisites with the given pointer are all satisfied from the list.
+    // Must be called under the shard lock.
+    void UpdateSuccessors(const IAsyncTask* pPrereqTask, std::vector<WaitingTask*>& Successors, std::vector<WaitingTask*>& ReadyTasks)
+    {
+        auto RemoveIt = std::remove_if(
+            Successors.begin(), Successors.end(),
+            [&](WaitingTask* pSuccessor) {
+                bool   AllSatisfied = true;
+                Uint32 NumSatisfied = 0;
+                for (Prerequisite& Prereq : pSuccessor->Prerequisites)
+                {
+                    if (Prereq.pRawTask != pPrereqTask || Prereq.Satisfied)
+                        continue;
+
+                    if (Prereq.IsFinished())
+                    {
+                        Prereq.Satisfied = true;
+                        ++NumSatisfied;
+                    }
+                    else
+                    {
+                        AllSatisfied = false;
+                    }
+                }
+                // NB: the successor may be destroyed by another thread after its counter is decremented,
+                //     so this must be the last access to the object.
+                Decrement(pSuccessor, NumSatisfied, ReadyTasks);
+                return AllSatisfied;
+            });
+        Successors.erase(RemoveIt, Successors.end());
+    }
+
+    // Decrements the number of pending prerequisites. If the counter reaches zero,
+    // the task is added to the ready list and is owned by the calling thread.
+    static void Decrement(WaitingTask* pWaiting, Uint32 Count, std::vector<WaitingTask*>& ReadyTasks)
+    {
+        if (Count == 0)
+            return;
+
+        const Uint32 PrevNumPending = pWaiting->NumPending.fetch_sub(Count);
+        VERIFY_EXPR((PrevNumPending & ~RemovedFlag) >= Count);
+        if ((PrevNumPending & ~RemovedFlag) == Count)
+            ReadyTasks.push_back(pWaiting);
+    }
+
+    static void RemoveSuccessor(Shard& S, const IAsyncTask* pPrereqTask, WaitingTask* pSuccessor)
+    {
+        auto it = S.Successors.find(pPrereqTask);
+        if (it == S.Successors.end())
+            return;
+
+        auto& Successors = it->second.Tasks;
+        Successors.erase(std::remove(Successors.begin(), Successors.end(), pSuccessor), Successors.end());
+        if (Successors.empty())
+            S.Successors.erase(it);
+    }
+
+    template <typename HandlerType>
+    bool DispatchReadyTasks(std::vector<WaitingTask*>& ReadyTasks, HandlerType&& ReadyTaskHandler)
+    {
+        for (WaitingTask* pWaiting : ReadyTasks)
+        {
+            if ((pWaiting->NumPending.load() & RemovedFlag) == 0)
+                ReadyTaskHandler(std::move(pWaiting->pTask));
+            if (pWaiting->HasUnobservedPrerequisites)
+                m_NumUnobservedTasks.fetch_add(-1);
+            delete pWaiting;
+            // NB: decrement the counter after the task has been enqueued,
+            //     otherwise WaitForAllTasks() may miss the task.
+            m_NumWaitingTasks.fetch_add(-1);
+        }
+        return !ReadyTasks.empty();
+    }
+
+private:
+    std::array<Shard, NumShards>         m_Shards;
+    std::atomic<int>                     m_NumWaitingTasks{0};
+    std::atomic<int>                     m_NumUnobservedTasks{0};
+    std::shared_ptr<PrerequisiteSignals> m_pSignals;
+};
+
+// When there are tasks waiting for prerequisites that can't notify the pool, idle threads
+// periodically wake up to check if the pool is stalled, see AsyncTaskDependencyGraph::ReleaseFinishedTasks().
+static constexpr std::chrono::milliseconds StalledPoolCheckInterval{1};
+
 class ThreadPoolImpl final : public ObjectBase<IThreadPool>
 {
 public:
@@ -50,7 +633,16 @@ public:
 
     ThreadPoolImpl(IReferenceCounters*         pRefCounters,
                    const ThreadPoolCreateInfo& PoolCI) :
-        TBase{pRefCounters}
+        TBase{pRefCounters},
+        m_Dependencies{
+            [this]() {
+                // Lock the mutex to make sure that the waiting thread is either
+                // waiting on the condition variable or has not checked the predicate yet.
+                {
+                    std::lock_guard<std::mutex> Lock{m_TasksQueueMtx};
+                }
+                m_NextTaskCond.notify_one();
+            }}
     {
         m_WorkerThreads.reserve(PoolCI.NumThreads);
         for (Uint32 i = 0; i < PoolCI.NumThreads; ++i)
@@ -78,24 +670,55 @@ public:
         QueuedTaskInfo TaskInfo;
         {
             std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
-            if (WaitForTask)
-            {
-                // The effects of notify_one()/notify_all() and each of the three atomic parts of
-                // wait()/wait_for()/wait_until() (unlock+wait, wakeup, and lock) take place in a
-                // single total order that can be viewed as modification order of an atomic variable:
-                // the order is specific to this individual condition variable. This makes it impossible
-                // for notify_one() to, for example, be delayed and unblock a thread that started waiting
-                // just after the call to notify_one() was made.
-                m_NextTaskCond.wait(lock,
-                                    [this] //
-                                    {
-                                        return m_Stop.load() || !m_TasksQueue.empty();
-                                    } //
-                );
+            while (true)
+            {
+                if (WaitForTask)
+                {
+                    // The effects of notify_one()/notify_all() and each of the three atomic parts of
+                    // wait()/wait_for()/wait_until() (unlock+wait, wakeup, and lock) take place in a
+                    // single total order that can be viewed as modification order of an atomic variable:
+                    // the order is specific to this individual condition variable. This makes it impossible
+                    // for notify_one() to, for example, be delayed and unblock a thread that started waiting
+                    // just after the call to notify_one() was made.
+                    auto Pred = [this] //
+                    {
+                        return IsStopped() || !m_TasksQueue.empty() || m_Dependencies.HasSignaledPrerequisites();
+                    };
+                    if (m_Dependencies.GetNumUnobservedTasks() == 0)
+                    {
+                        // Stop waiting when the first task that waits for prerequisites that can't notify
+                        // the pool is added to start checking for stalled tasks, see EnqueueTask().
+                        m_NextTaskCond.wait(lock, [&Pred, this] {
+                            return Pred() || m_Dependencies.GetNumUnobservedTasks() > 0;
+                        });
+                    }
+                    else
+                        m_NextTaskCond.wait_for(lock, StalledPoolCheckInterval, Pred);
+                }
+
+                // If no task can finish in this pool, the waiting tasks can only be released by
+                // prerequisites that are run elsewhere or destroyed.
+                const bool IsStalled = m_TasksQueue.empty() && m_NumRunningTasks.load() == 0 && m_Dependencies.GetNumUnobservedTasks() > 0;
+                if (IsStalled || m_Dependencies.HasSignaledPrerequisites())
+                {
+                    lock.unlock();
+                    auto ReadyTaskHandler = [this](RefCntAutoPtr<IAsyncTask>&& pTask) {
+                        EnqueueReadyTask(std::move(pTask));
+                    };
+                    bool TasksReleased = m_Dependencies.ReleaseSignaledTasks(ReadyTaskHandler);
+                    if (IsStalled && m_Dependencies.ReleaseFinishedTasks(ReadyTaskHandler))
+                        TasksReleased = true;
+                    lock.lock();
+                    if (TasksReleased)
+                        NotifyIfIdle();
+                }
+
+                if (!WaitForTask || IsStopped() || !m_TasksQueue.empty())
+                    break;
             }
 
             // m_Stop must be accessed under the mutex
-            if (m_Stop.load() && m_TasksQueue.empty())
+            if (IsStopped() && m_TasksQueue.empty())
                 return false;
 
             if (!m_TasksQueue.empty())
@@ -112,33 +735,26 @@ public:
 
         if (TaskInfo.pTask)
         {
-            // Check prerequisites
-            bool  PrerequisitesMet  = true;
-            float MinPrereqPriority = +FLT_MAX;
-            for (auto& pPrereq : TaskInfo.Prerequisites)
-            {
-                if (auto pPrereqTask = pPrereq.Lock())
-                {
-                    if (!pPrereqTask->IsFinished())
-                    {
-                        PrerequisitesMet  = false;
-                        MinPrereqPriority = std::min(MinPrereqPriority, pPrereqTask->GetPriority());
-                    }
-                }
-            }
+            // NB: the task is only enqueued when all its prerequisites are finished,
+            //     see AsyncTaskDependencyGraph.
+            TaskInfo.pTask->SetStatus(ASYNC_TASK_STATUS_RUNNING);
+            ASYNC_TASK_STATUS ReturnStatus = TaskInfo.pTask->Run(ThreadId);
+            // NB: It is essential to set the task status after the Run() method returns.
+            //     This way if the GetStatus() method returns any value other than ASYNC_TASK_STATUS_RUNNING,
+            //     it is guaranteed that the task is not executed by any thread.
+            TaskInfo.pTask->SetStatus(ReturnStatus);
+            const bool TaskFinished = TaskInfo.pTask->IsFinished();
+            DEV_CHECK_ERR((TaskFinished || TaskInfo.pTask->GetStatus() == ASYNC_TASK_STATUS_NOT_STARTED),
+                          "Finished tasks must be in COMPLETE, CANCELLED or NOT_STARTED state");
 
-            bool TaskFinished = false;
-            if (PrerequisitesMet)
+            if (TaskFinished)
             {
-                TaskInfo.pTask->SetStatus(ASYNC_TASK_STATUS_RUNNING);
-                ASYNC_TASK_STATUS ReturnStatus = TaskInfo.pTask->Run(ThreadId);
-                // NB: It is essential to set the task status after the Run() method returns.
-                //     This way if the GetStatus() method returns any value other than ASYNC_TASK_STATUS_RUNNING,
-                //     it is guaranteed that the task is not executed by any thread.
-                TaskInfo.pTask->SetStatus(ReturnStatus);
-                TaskFinished = TaskInfo.pTask->IsFinished();
-                DEV_CHECK_ERR((TaskFinished || TaskInfo.pTask->GetStatus() == ASYNC_TASK_STATUS_NOT_STARTED),
-                              "Finished tasks must be in COMPLETE, CANCELLED or NOT_STARTED state");
+                // Release the successors before decrementing the running task counter,
+                // otherwise WaitForAllTasks() may miss them.
+                m_Dependencies.OnTaskFinished(TaskInfo.pTask,
+                                              [this](RefCntAutoPtr<IAsyncTask>&& pTask) {
+                                                  EnqueueReadyTask(std::move(pTask));
+                                              });
             }
 
             {
@@ -148,17 +764,17 @@ public:
 
                 if (TaskFinished)
                 {
-                    if (m_TasksQueue.empty() && NumRunningTasks == 0)
+                    if (m_TasksQueue.empty() && NumRunningTasks == 0 && m_Dependencies.GetNumWaitingTasks() == 0)
                     {
                         m_TasksFinishedCond.notify_one();
+                        // Wake up the threads that wait for the prerequisites of the last tasks to exit
+                        if (m_Stop.load())
+                            m_NextTaskCond.notify_all();
                     }
                 }
                 else
                 {
-                    // If prerequisites are not met or the task requested to be re-run,
-                    // re-enqueue the task with the minimum prerequisite priority
-                    if (TaskInfo.pTask->GetPriority() > MinPrereqPriority)
-                        TaskInfo.pTask->SetPriority(MinPrereqPriority);
+                    // The task requested to be re-run
                     m_TasksQueue.emplace(TaskInfo.pTask->GetPriority(), std::move(TaskInfo));
                 }
             }
@@ -180,44 +796,53 @@ public:
         if (pTask == nullptr)
             return;
 
+        DEV_CHECK_ERR(!m_Stop, "Enqueue on a stopped ThreadPool");
+
+        if (ppPrerequisites != nullptr && NumPrerequisites > 0)
         {
-            std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
-            DEV_CHECK_ERR(!m_Stop, "Enqueue on a stopped ThreadPool");
+            float MinPrereqPriority = +FLT_MAX;
+            for (Uint32 i = 0; i < NumPrerequisites; ++i)
+            {
+                if (ppPrerequisites[i] != nullptr)
+                    MinPrereqPriority = std::min(MinPrereqPriority, ppPrerequisites[i]->GetPriority());
+            }
+            if (pTask->GetPriority() > MinPrereqPriority)
+            {
+                pTask->SetPriority(MinPrereqPriority);
+            }
 
-            QueuedTaskInfo TaskInfo;
-            TaskInfo.pTask = pTask;
-            if (ppPrerequisites != nullptr && NumPrerequisites > 0)
+            const auto Result =
+                m_Dependencies.AddTask(pTask, ppPrerequisites, NumPrerequisites,
+                                       [this](RefCntAutoPtr<IAsyncTask>&& pReadyTask) {
+                                           EnqueueReadyTask(std::move(pReadyTask));
+                                       });
+            if (Result.FirstUnobservedTask || Result.TasksReleased)
             {
-                TaskInfo.Prerequisites.reserve(NumPrerequisites);
-                float MinPrereqPriority = +FLT_MAX;
-                for (Uint32 i = 0; i < NumPrerequisites; ++i)
-                {
-                    if (ppPrerequisites[i] != nullptr)
-                    {
-                        TaskInfo.Prerequisites.emplace_back(ppPrerequisites[i]);
-                        MinPrereqPriority = std::min(MinPrereqPriority, ppPrerequisites[i]->GetPriority());
-                    }
-                }
-                if (pTask->GetPriority() > MinPrereqPriority)
                 {
-                    TaskInfo.pTask->SetPriority(MinPrereqPriority);
+                    std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
+                    if (Result.TasksReleased)
+                        NotifyIfIdle();
                 }
+                // Wake up a thread that may be waiting without a timeout
+                if (Result.FirstUnobservedTask)
+                    m_NextTaskCond.notify_one();
             }
-
-            m_TasksQueue.emplace(pTask->GetPriority(), std::move(TaskInfo));
         }
-        m_NextTaskCond.notify_one();
+        else
+        {
+            EnqueueReadyTask(RefCntAutoPtr<IAsyncTask>{pTask});
+        }
     }
 
     virtual void DILIGENT_CALL_TYPE WaitForAllTasks() override final
     {
         std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
-        if (!m_TasksQueue.empty() || m_NumRunningTasks.load() > 0)
+        if (!m_TasksQueue.empty() || m_NumRunningTasks.load() > 0 || m_Dependencies.GetNumWaitingTasks() > 0)
         {
             m_TasksFinishedCond.wait(lock,
                                      [this] //
                                      {
-                                         return m_TasksQueue.empty() && m_NumRunningTasks.load() == 0;
+                                         return m_TasksQueue.empty() && m_NumRunningTasks.load() == 0 && m_Dependencies.GetNumWaitingTasks() == 0;
                                      } //
             );
         }
@@ -243,18 +868,32 @@ public:
 
     virtual bool DILIGENT_CALL_TYPE RemoveTask(IAsyncTask* pTask) override final
     {
-        std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
-
-        auto it = m_TasksQueue.begin();
-        while (it != m_TasksQueue.end() && it->second.pTask != pTask)
-            ++it;
-        if (it != m_TasksQueue.end())
+        // Release the task outside of the lock as the completion callbacks
+        // of a destroyed task may wake up the pool.
+        RefCntAutoPtr<IAsyncTask> pRemovedTask;
         {
-            m_TasksQueue.erase(it);
-            return true;
+            std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
+
+            auto it = m_TasksQueue.begin();
+            while (it != m_TasksQueue.end() && it->second.pTask != pTask)
+                ++it;
+            if (it != m_TasksQueue.end())
+            {
+                pRemovedTask = std::move(it->second.pTask);
+                m_TasksQueue.erase(it);
+            }
         }
+        if (pRemovedTask)
+            return true;
 
-        return false;
+        if (!m_Dependencies.RemoveTask(pTask))
+            return false;
+
+        {
+            std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
+            NotifyIfIdle();
+        }
+        return true;
     }
 
     virtual bool DILIGENT_CALL_TYPE ReprioritizeTask(IAsyncTask* pTask) override final
@@ -277,7 +916,10 @@ public:
 
             return true;
         }
-        return false;
+        lock.unlock();
+
+        // Tasks that wait for prerequisites are enqueued with their current priority
+        return m_Dependencies.HasTask(pTask);
     }
 
     virtual void DILIGENT_CALL_TYPE ReprioritizeAllTasks() override final
@@ -311,7 +953,7 @@ public:
     Uint32 DILIGENT_CALL_TYPE GetQueueSize() override final
     {
         std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
-        return StaticCast<Uint32>(m_TasksQueue.size());
+        return StaticCast<Uint32>(m_TasksQueue.size() + m_Dependencies.GetNumWaitingTasks());
     }
 
     virtual Uint32 DILIGENT_CALL_TYPE GetRunningTaskCount() const override final
@@ -322,17 +964,49 @@ public:
     ~ThreadPoolImpl()
     {
         StopThreads();
+        VERIFY_EXPR(m_Dependencies.GetNumWaitingTasks() == 0);
         VERIFY_EXPR(m_TasksQueue.empty());
         VERIFY_EXPR(m_NumRunningTasks.load() == 0);
     }
 
+private:
+    // Must be called while holding m_TasksQueueMtx
+    void NotifyIfIdle()
+    {
+        if (m_TasksQueue.empty() && m_NumRunningTasks.load() == 0 && m_Dependencies.GetNumWaitingTasks() == 0)
+        {
+            m_TasksFinishedCond.notify_one();
+            // Wake up the threads that wait for the prerequisites of the last tasks to exit
+            if (m_Stop.load())
+                m_NextTaskCond.notify_all();
+        }
+    }
+
+    // Threads only exit when the pool is stopped and no task waits for its prerequisites.
+    // The waiting tasks may still be released by prerequisites that run elsewhere.
+    // Must be called while holding m_TasksQueueMtx
+    bool IsStopped() const
+    {
+        return m_Stop.load() && m_Dependencies.GetNumWaitingTasks() == 0;
+    }
+
+    void EnqueueReadyTask(RefCntAutoPtr<IAsyncTask>&& pTask)
+    {
+        {
+            std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
+
+            const float Priority = pTask->GetPriority();
+            m_TasksQueue.emplace(Priority, QueuedTaskInfo{std::move(pTask)});
+        }
+        m_NextTaskCond.notify_one();
+    }
+
 private:
     std::vector<std::thread> m_WorkerThreads;
 
     struct QueuedTaskInfo
     {
-        RefCntAutoPtr<IAsyncTask>              pTask;
-        std::vector<RefCntWeakPtr<IAsyncTask>> Prerequisites;
+        RefCntAutoPtr<IAsyncTask> pTask;
     };
     // Priority queue
     std::mutex                                                m_TasksQueueMtx;
@@ -345,11 +1019,819 @@ private:
     std::atomic<bool>       m_Stop{false};
 
     std::atomic<int> m_NumRunningTasks{0};
+
+    // Tasks that wait for their prerequisites
+    AsyncTaskDependencyGraph m_Dependencies;
 };
 
+class WorkStealingThreadPoolImpl final : public ObjectBase<IThreadPool>
+{
+public:
+    using TBase = ObjectBase<IThreadPool>;
+
+    WorkStealingThreadPoolImpl(IReferenceCounters*         pRefCounters,
+                               const ThreadPoolCreateInfo& PoolCI) :
+        TBase{pRefCounters},
+        m_NumBuckets{std::max(PoolCI.NumPriorityBuckets, 1u)},
+        m_InjectionQueues(m_NumBuckets),
+        m_Dependencies{[this]() { WakeSleepingThread(); }}
+    {
+        m_Workers.reserve(PoolCI.NumThreads);
+        for (size_t i = 0; i < PoolCI.NumThreads; ++i)
+            m_Workers.emplace_back(std::make_unique<WorkerQueues>(m_NumBuckets));
+
+        m_WorkerThreads.reserve(PoolCI.NumThreads);
+        for (Uint32 i = 0; i < PoolCI.NumThreads; ++i)
+        {
+            m_WorkerThreads.emplace_back(
+                [this, PoolCI, i] //
+                {
+                    tl_WorkerInfo = {this, i};
+
+                    if (PoolCI.OnThreadStarted)
+                        PoolCI.OnThreadStarted(i);
+
+                    while (ProcessTask(i, /*WaitForTask =*/true))
+                    {
+                    }
+
+                    if (PoolCI.OnThreadExiting)
+                        PoolCI.OnThreadExiting(i);
+
+                    tl_WorkerInfo = {};
+                });
+        }
+    }
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_ThreadPool, TBase)
+
+    virtual bool DILIGENT_CALL_TYPE ProcessTask(Uint32 ThreadId, bool WaitForTask) override final
+    {
+        TaskNode* pNode = nullptr;
+        while (pNode == nullptr)
+        {
+            // Read the wake epoch before looking for a task, so that if a task is enqueued
+            // after the search, the epoch will have changed and the thread will not go to sleep.
+            const Uint64 WakeEpoch = m_WakeEpoch.load();
+
+            auto ReadyTaskHandler = [this](RefCntAutoPtr<IAsyncTask>&& pTask) {
+                EnqueueReadyTask(std::move(pTask));
+            };
+            if (m_Dependencies.HasSignaledPrerequisites() && m_Dependencies.ReleaseSignaledTasks(ReadyTaskHandler))
+                NotifyIfIdle();
+
+            pNode = DequeueTask();
+            if (pNode != nullptr)
+                break;
+
+            if (m_NumQueuedTasks.load() == 0 && m_NumRunningTasks.load() == 0 && m_Dependencies.GetNumUnobservedTasks() > 0)
+            {
+                // No task can finish in this pool, so the waiting tasks can only be released by
+                // prerequisites that are run elsewhere or destroyed.
+                if (m_Dependencies.ReleaseFinishedTasks(ReadyTaskHandler))
+                    NotifyIfIdle();
+                if (m_NumQueuedTasks.load() > 0)
+                    continue;
+            }
+
+            if (m_Stop.load() && m_NumQueuedTasks.load() == 0 && m_Dependencies.GetNumWaitingTasks() == 0)
+                return false;
+
+            if (!WaitForTask)
+                return true;
+
+            std::unique_lock<std::mutex> lock{m_SleepMtx};
+            m_NumSleepingThreads.fetch_add(1);
+            auto Pred = [this, WakeEpoch] //
+            {
+                // Threads only exit when no task waits for its prerequisites, which may be
+                // released by prerequisites that run elsewhere, see NotifyIfIdle().
+                return (m_Stop.load() && m_Dependencies.GetNumWaitingTasks() == 0) || m_WakeEpoch.load() != WakeEpoch;
+            };
+            if (m_Dependencies.GetNumUnobservedTasks() == 0)
+                m_WakeCond.wait(lock, Pred);
+            else
+                m_WakeCond.wait_for(lock, StalledPoolCheckInterval, Pred);
+            m_NumSleepingThreads.fetch_add(-1);
+        }
+
+        // NB: the task is only enqueued when all its prerequisites are finished,
+        //     see AsyncTaskDependencyGraph.
+        pNode->pTask->SetStatus(ASYNC_TASK_STATUS_RUNNING);
+        ASYNC_TASK_STATUS ReturnStatus = pNode->pTask->Run(ThreadId);
+        // NB: It is essential to set the task status after the Run() method returns.
+        //     This way if the GetStatus() method returns any value other than ASYNC_TASK_STATUS_RUNNING,
+        //     it is guaranteed that the task is not executed by any thread.
+        pNode->pTask->SetStatus(ReturnStatus);
+        const bool TaskFinished = pNode->pTask->IsFinished();
+        DEV_CHECK_ERR((TaskFinished || pNode->pTask->GetStatus() == ASYNC_TASK_STATUS_NOT_STARTED),
+                      "Finished tasks must be in COMPLETE, CANCELLED or NOT_STARTED state");
+
+        if (TaskFinished)
+        {
+            // Release the successors before decrementing the running task counter,
+            // otherwise WaitForAllTasks() may miss them.
+            m_Dependencies.OnTaskFinished(pNode->pTask,
+                                          [this](RefCntAutoPtr<IAsyncTask>&& pTask) {
+                                              EnqueueReadyTask(std::move(pTask));
+                                          });
+            delete pNode;
+        }
+        else
+        {
+            // The task requested to be re-run. Use the shared injection queue
+            // so that other tasks get a chance to run first.
+            // NB: we must increment the queued task counter before decrementing the running
+            //     task counter, otherwise WaitForAllTasks() may miss the task.
+            EnqueueNode(pNode, /*UseLocalQueue = */ false);
+        }
+        OnTaskFinished();
+
+        return true;
+    }
+
+    virtual void DILIGENT_CALL_TYPE EnqueueTask(IAsyncTask*  pTask,
+                                                IAsyncTask** ppPrerequisites,
+                                                Uint32       NumPrerequisites) override final
+    {
+        VERIFY_EXPR(pTask != nullptr);
+        if (pTask == nullptr)
+            return;
+
+        DEV_CHECK_ERR(!m_Stop, "Enqueue on a stopped ThreadPool");
+
+        if (ppPrerequisites != nullptr && NumPrerequisites > 0)
+        {
+            float MinPrereqPriority = +FLT_MAX;
+            for (Uint32 i = 0; i < NumPrerequisites; ++i)
+            {
+                if (ppPrerequisites[i] != nullptr)
+                    MinPrereqPriority = std::min(MinPrereqPriority, ppPrerequisites[i]->GetPriority());
+            }
+            if (pTask->GetPriority() > MinPrereqPriority)
+            {
+                pTask->SetPriority(MinPrereqPriority);
+            }
+
+            const auto Result =
+                m_Dependencies.AddTask(pTask, ppPrerequisites, NumPrerequisites,
+                                       [this](RefCntAutoPtr<IAsyncTask>&& pReadyTask) {
+                                           EnqueueReadyTask(std::move(pReadyTask));
+                                       });
+            if (Result.TasksReleased)
+                NotifyIfIdle();
+            // Wake up a thread that may be sleeping without a timeout
+            if (Result.FirstUnobservedTask)
+                WakeSleepingThread();
+        }
+        else
+        {
+            EnqueueReadyTask(RefCntAutoPtr<IAsyncTask>{pTask});
+        }
+    }
+
+    virtual void DILIGENT_CALL_TYPE WaitForAllTasks() override final
+    {
+        std::unique_lock<std::mutex> lock{m_IdleMtx};
+        m_IdleCond.wait(lock,
+                        [this] //
+                        {
+                            return m_NumQueuedTasks.load() == 0 && m_NumRunningTasks.load() == 0 && m_Dependencies.GetNumWaitingTasks() == 0;
+                        });
+    }
+
+    virtual void DILIGENT_CALL_TYPE StopThreads() override final
+    {
+        {
+            std::unique_lock<std::mutex> lock{m_SleepMtx};
+            // NB: even if the shared variable is atomic, it must be modified under the mutex
+            //     in order to correctly publish the modification to the waiting thread.
+            m_Stop.store(true);
+        }
+        m_WakeCond.notify_all();
+        for (std::thread& worker : m_WorkerThreads)
+            worker.join();
+
+        m_WorkerThreads.clear();
+    }
+
+    virtual bool DILIGENT_CALL_TYPE RemoveTask(IAsyncTask* pTask) override final
+    {
+        // Release the task outside of the lock
+        RefCntAutoPtr<IAsyncTask> pRemovedTask;
+        {
+            RegistryShard&           Shard = m_Registry[GetRegistryShardIndex(pTask)];
+            Threading::SpinLockGuard Guard{Shard.Lock};
+
+            TaskNode* pNode = Shard.Find(pTask);
+            if (pNode != nullptr)
+            {
+                // The node is still referenced by the deque or injection queue.
+                // It will be discarded when it is dequeued, see DequeueTask().
+                Shard.Remove(pNode);
+                pRemovedTask = std::move(pNode->pTask);
+            }
+        }
+
+        if (pRemovedTask)
+            m_NumQueuedTasks.fetch_add(-1);
+        else if (!m_Dependencies.RemoveTask(pTask))
+            return false;
+
+        NotifyIfIdle();
+        return true;
+    }
+
+    virtual bool DILIGENT_CALL_TYPE ReprioritizeTask(IAsyncTask* pTask) override final
+    {
+        const Uint32 Bucket = GetPriorityBucket(pTask->GetPriority());
+
+        TaskNode* pNewNode = nullptr;
+        {
+            RegistryShard&           Shard = m_Registry[GetRegistryShardIndex(pTask)];
+            Threading::SpinLockGuard Guard{Shard.Lock};
+
+            TaskNode* pNode = Shard.Find(pTask);
+            if (pNode != nullptr)
+            {
+                if (pNode->Bucket == Bucket)
+                    return true;
+
+                pNewNode = Shard.Move(pNode);
+            }
+        }
+
+        if (pNewNode == nullptr)
+        {
+            // Tasks that wait for prerequisites are enqueued with their current priority
+            return m_Dependencies.HasTask(pTask);
+        }
+
+        PushNode(pNewNode, Bucket, /*UseLocalQueue = */ false);
+        return true;
+    }
+
+    virtual void DILIGENT_CALL_TYPE ReprioritizeAllTasks() override final
+    {
+        std::vector<std::pair<TaskNode*, Uint32>> ReprioritizationList;
+        for (RegistryShard& Shard : m_Registry)
+        {
+            Threading::SpinLockGuard Guard{Shard.Lock};
+            for (TaskNode* pNode = Shard.pHead; pNode != nullptr;)
+            {
+                TaskNode*    pNext  = pNode->pNext;
+                const Uint32 Bucket = GetPriorityBucket(pNode->pTask->GetPriority());
+                if (pNode->Bucket != Bucket)
+                    ReprioritizationList.emplace_back(Shard.Move(pNode), Bucket);
+                pNode = pNext;
+            }
+        }
+
+        for (auto& it : ReprioritizationList)
+            PushNode(it.first, it.second, /*UseLocalQueue = */ false);
+    }
+
+    Uint32 DILIGENT_CALL_TYPE GetQueueSize() override final
+    {
+        return static_cast<Uint32>(std::max(m_NumQueuedTasks.load() + m_Dependencies.GetNumWaitingTasks(), 0));
+    }
+
+    virtual Uint32 DILIGENT_CALL_TYPE GetRunningTaskCount() const override final
+    {
+        return m_NumRunningTasks.load();
+    }
+
+    ~WorkStealingThreadPoolImpl()
+    {
+        StopThreads();
+        VERIFY_EXPR(m_NumQueuedTasks.load() == 0);
+        VERIFY_EXPR(m_Dependencies.GetNumWaitingTasks() == 0);
+        VERIFY_EXPR(m_NumRunningTasks.load() == 0);
+
+        // Release nodes of the removed tasks that are still referenced by the queues
+        TaskNode* pNode = nullptr;
+        for (auto& pWorker : m_Workers)
+        {
+            for (auto& Deque : pWorker->Deques)
+            {
+                while (Deque.Steal(pNode))
+                    delete pNode;
+            }
+        }
+        for (InjectionQueue& Queue : m_InjectionQueues)
+        {
+            for (TaskNode* pQueuedNode : Queue.Nodes)
+                delete pQueuedNode;
+        }
+    }
+
+private:
+    struct TaskNode
+    {
+        RefCntAutoPtr<IAsyncTask> pTask;
+
+        // The priority bucket the node was queued in.
+        Uint32 Bucket = 0;
+
+        // Index of the registry shard, see GetRegistryShardIndex().
+        Uint32 ShardIdx = 0;
+
+        // Whether the node is still in the registry. When a task is removed or moved to another bucket,
+        // the node is unregistered, but it stays in the queue until it is dequeued and discarded.
+        // Only modified under the registry shard lock.
+        bool Registered = false;
+
+        // Intrusive list of nodes in the registry shard
+        TaskNode* pPrev = nullptr;
+        TaskNode* pNext = nullptr;
+    };
+
+    // Registry of all queued tasks that is used to find tasks for removal and reprioritization.
+    // The registry is sharded by the task pointer to keep the lock contention low.
+    struct alignas(64) RegistryShard
+    {
+        Threading::SpinLock Lock;
+        TaskNode*           pHead = nullptr;
+
+        void Add(TaskNode* pNode)
+        {
+            VERIFY_EXPR(!pNode->Registered);
+            pNode->pPrev = nullptr;
+            pNode->pNext = pHead;
+            if (pHead != nullptr)
+                pHead->pPrev = pNode;
+            pHead             = pNode;
+            pNode->Registered = true;
+        }
+
+        void Remove(TaskNode* pNode)
+        {
+            VERIFY_EXPR(pNode->Registered);
+            if (pNode->pPrev != nullptr)
+                pNode->pPrev->pNext = pNode->pNext;
+            else
+                pHead = pNode->pNext;
+            if (pNode->pNext != nullptr)
+                pNode->pNext->pPrev = pNode->pPrev;
+            pNode->pPrev      = nullptr;
+            pNode->pNext      = nullptr;
+            pNode->Registered = false;
+        }
+
+        TaskNode* Find(IAsyncTask* pTask) const
+        {
+            TaskNode* pNode = pHead;
+            while (pNode != nullptr && pNode->pTask != pTask)
+                pNode = pNode->pNext;
+            return pNode;
+        }
+
+        // Unregisters the node and registers the new node that takes over the task.
+        // The old node stays in its queue and will be discarded when dequeued.
+        TaskNode* Move(TaskNode* pNode)
+        {
+            Remove(pNode);
+            TaskNode* pNewNode = new TaskNode{};
+            pNewNode->pTask    = std::move(pNode->pTask);
+            pNewNode->ShardIdx = pNode->ShardIdx;
+            Add(pNewNode);
+            return pNewNode;
+        }
+    };
+    static constexpr size_t RegistrySize = 64;
+
+    static Uint32 GetRegistryShardIndex(const IAsyncTask* pTask)
+    {
+        return static_cast<Uint32>((reinterpret_cast<size_t>(pTask) >> 4) % RegistrySize);
+    }
+
+    struct WorkerQueues
+    {
+        explicit WorkerQueues(Uint32 NumBuckets) :
+            Deques(NumBuckets)
+        {}
+        std::vector<WorkStealingQueue<TaskNode*>> Deques;
+    };
+
+    struct InjectionQueue
+    {
+        std::mutex            Mtx;
+        std::deque<TaskNode*> Nodes;
+        std::atomic<size_t>   Size{0};
+    };
+
+    struct WorkerInfo
+    {
+        const WorkStealingThreadPoolImpl* pPool = nullptr;
+        Uint32                            Id    = 0;
+    };
+    static thread_local WorkerInfo tl_WorkerInfo;
+
+    Uint32 GetPriorityBucket(float Priority) const
+    {
+        // NB: the negated comparison also handles NaN
+        if (!(Priority > 0.f))
+            return 0;
+        if (Priority >= static_cast<float>(m_NumBuckets - 1))
+            return m_NumBuckets - 1;
+        return static_cast<Uint32>(Priority);
+    }
+
+    void EnqueueReadyTask(RefCntAutoPtr<IAsyncTask>&& pTask)
+    {
+        TaskNode* pNode = new TaskNode{};
+        pNode->pTask    = std::move(pTask);
+        EnqueueNode(pNode, /*UseLocalQueue = */ true);
+    }
+
+    void EnqueueNode(TaskNode* pNode, bool UseLocalQueue)
+    {
+        pNode->ShardIdx = GetRegistryShardIndex(pNode->pTask);
+        {
+            RegistryShard&           Shard = m_Registry[pNode->ShardIdx];
+            Threading::SpinLockGuard Guard{Shard.Lock};
+            Shard.Add(pNode);
+        }
+        m_NumQueuedTasks.fetch_add(1);
+        PushNode(pNode, GetPriorityBucket(pNode->pTask->GetPriority()), UseLocalQueue);
+    }
+
+    void PushNode(TaskNode* pNode, Uint32 Bucket, bool UseLocalQueue)
+    {
+        pNode->Bucket = Bucket;
+        if (UseLocalQueue && tl_WorkerInfo.pPool == this)
+        {
+            m_Workers[tl_WorkerInfo.Id]->Deques[Bucket].Push(pNode);
+        }
+        else
+        {
+            InjectionQueue&             Queue = m_InjectionQueues[Bucket];
+            std::lock_guard<std::mutex> Lock{Queue.Mtx};
+            Queue.Nodes.push_back(pNode);
+            Queue.Size.fetch_add(1);
+        }
+
+        WakeSleepingThread();
+    }
+
+    void WakeSleepingThread()
+    {
+        m_WakeEpoch.fetch_add(1);
+        if (m_NumSleepingThreads.load() > 0)
+        {
+            // Lock the mutex to make sure that the sleeping thread is either
+            // waiting on the condition variable or has not checked the epoch yet.
+            {
+                std::lock_guard<std::mutex> Lock{m_SleepMtx};
+            }
+            m_WakeCond.notify_one();
+        }
+    }
+
+    // Returns the next task to run. The task is removed from the registry and
+    // the running task counter is incremented.
+    TaskNode* DequeueTask()
+    {
+        const Uint32 WorkerId = tl_WorkerInfo.pPool == this ? tl_WorkerInfo.Id : ~0u;
+
+        while (m_NumQueuedTasks.load() > 0)
+        {
+            TaskNode* pNode = nullptr;
+            for (Uint32 Bucket = m_NumBuckets; Bucket-- > 0 && pNode == nullptr;)
+            {
+                // Own deque first
+                if (WorkerId != ~0u && m_Workers[WorkerId]->Deques[Bucket].Pop(pNode))
+                    break;
+
+                // Then the shared injection queue
+                InjectionQueue& Queue = m_InjectionQueues[Bucket];
+                if (Queue.Size.load() > 0)
+                {
+                    std::lock_guard<std::mutex> Lock{Queue.Mtx};
+                    if (!Queue.Nodes.empty())
+                    {
+                        pNode = Queue.Nodes.front();
+                        Queue.Nodes.pop_front();
+                        Queue.Size.fetch_add(-1);
+                        break;
+                    }
+                }
+
+                // Finally, try to steal from other workers starting from the next one
+                const size_t NumWorkers = m_Workers.size();
+                for (size_t i = 0; i < NumWorkers; ++i)
+                {
+                    const size_t Victim = (WorkerId + 1 + i) % NumWorkers;
+                    if (Victim != WorkerId && m_Workers[Victim]->Deques[Bucket].Steal(pNode))
+                        break;
+                }
+            }
+
+            if (pNode == nullptr)
+                return nullptr;
+
+            // NB: we must increment the running task counter before decrementing
+            //     the queued task counter, otherwise WaitForAllTasks() may miss the task.
+            bool IsTaskValid = false;
+            {
+                RegistryShard&           Shard = m_Registry[pNode->ShardIdx];
+                Threading::SpinLockGuard Guard{Shard.Lock};
+                if (pNode->Registered)
+                {
+                    Shard.Remove(pNode);
+                    m_NumRunningTasks.fetch_add(1);
+                    IsTaskValid = true;
+                }
+            }
+
+            if (IsTaskValid)
+            {
+                m_NumQueuedTasks.fetch_add(-1);
+                return pNode;
+            }
+
+            // The task was removed or moved to another bucket
+            delete pNode;
+        }
+
+        return nullptr;
+    }
+
+    void OnTaskFinished()
+    {
+        m_NumRunningTasks.fetch_add(-1);
+        NotifyIfIdle();
+    }
+
+    void NotifyIfIdle()
+    {
+        if (m_NumQueuedTasks.load() == 0 && m_NumRunningTasks.load() == 0 && m_Dependencies.GetNumWaitingTasks() == 0)
+        {
+            {
+                std::lock_guard<std::mutex> Lock{m_IdleMtx};
+            }
+            m_IdleCond.notify_all();
+
+            // Wake up the threads that wait for the prerequisites of the last tasks to exit
+            if (m_Stop.load())
+            {
+                {
+                    std::lock_guard<std::mutex> Lock{m_SleepMtx};
+                }
+                m_WakeCond.notify_all();
+            }
+        }
+    }
+
+private:
+    const Uint32 m_NumBuckets;
+
+    std::vector<std::thread>                   m_WorkerThreads;
+    std::vector<std::unique_ptr<WorkerQueues>> m_Workers;
+    std::vector<InjectionQueue>                m_InjectionQueues;
+
+    std::array<RegistryShard, RegistrySize> m_Registry;
+
+    std::mutex              m_SleepMtx;
+    std::condition_variable m_WakeCond;
+    std::atomic<Uint64>     m_WakeEpoch{0};
+    std::atomic<int>        m_NumSleepingThreads{0};
+    std::atomic<bool>       m_Stop{false};
+
+    std::mutex              m_IdleMtx;
+    std::condition_variable m_IdleCond;
+
+    std::atomic<int> m_NumQueuedTasks{0};
+    std::atomic<int> m_NumRunningTasks{0};
+
+    // Tasks that wait for their prerequisites
+    AsyncTaskDependencyGraph m_Dependencies;
+};
+
+thread_local WorkStealingThreadPoolImpl::WorkerInfo WorkStealingThreadPoolImpl::tl_WorkerInfo;
+
 RefCntAutoPtr<IThreadPool> CreateThreadPool(const ThreadPoolCreateInfo& ThreadPoolCI)
 {
-    return RefCntAutoPtr<ThreadPoolImpl>{MakeNewRCObj<ThreadPoolImpl>()(ThreadPoolCI)};
+    switch (ThreadPoolCI.Scheduler)
+    {
+        case THREAD_POOL_SCHEDULER_PRIORITY_QUEUE:
+            return RefCntAutoPtr<ThreadPoolImpl>{MakeNewRCObj<ThreadPoolImpl>()(ThreadPoolCI)};
+
+        case THREAD_POOL_SCHEDULER_WORK_STEALING:
+            return RefCntAutoPtr<WorkStealingThreadPoolImpl>{MakeNewRCObj<WorkStealingThreadPoolImpl>()(ThreadPoolCI)};
+
+        default:
+            UNEXPECTED("Unexpected thread pool scheduler type");
+            return {};
+    }
+}
+
+struct TaskGroup::State
+{
+    std::mutex                        Mtx;
+    std::condition_variable           Cond;
+    std::deque<std::function<void()>> PendingTasks;
+    Uint32                            NumRunningTasks = 0;
+
+    // Runs the next pending task. Returns false if there are no pending tasks.
+    bool RunPendingTask()
+    {
+        std::function<void()> Task;
+        {
+            std::lock_guard<std::mutex> Lock{Mtx};
+            if (PendingTasks.empty())
+                return false;
+            Task = std::move(PendingTasks.front());
+            PendingTasks.pop_front();
+            ++NumRunningTasks;
+        }
+
+        Task();
+
+        {
+            std::lock_guard<std::mutex> Lock{Mtx};
+            --NumRunningTasks;
+            if (NumRunningTasks == 0)
+                Cond.notify_all();
+        }
+        return true;
+    }
+};
+
+TaskGroup::TaskGroup(IThreadPool* pThreadPool, float fPriority) :
+    m_pThreadPool{pThreadPool},
+    m_fPriority{fPriority},
+    m_pState{std::make_shared<State>()}
+{
+}
+
+TaskGroup::~TaskGroup()
+{
+    Wait();
+}
+
+void TaskGroup::Run(std::function<void()> Task)
+{
+    VERIFY_EXPR(Task);
+    {
+        std::lock_guard<std::mutex> Lock{m_pState->Mtx};
+        m_pState->PendingTasks.emplace_back(std::move(Task));
+        // Wake up the thread that waits for the running tasks, so that it can help
+        // executing the new task.
+        if (m_pState->NumRunningTasks > 0)
+            m_pState->Cond.notify_all();
+    }
+
+    if (m_pThreadPool)
+    {
+        // The pool task does not reference a specific group task: it runs the next pending one,
+        // if any. Pool tasks that start after the waiting thread has executed all tasks exit immediately.
+        EnqueueAsyncWork(
+            m_pThreadPool,
+            [pState = m_pState](Uint32 ThreadId) {
+                pState->RunPendingTask();
+                return ASYNC_TASK_STATUS_COMPLETE;
+            },
+            m_fPriority);
+    }
+}
+
+void TaskGroup::Wait()
+{
+    while (true)
+    {
+        while (m_pState->RunPendingTask())
+        {
+        }
+
+        std::unique_lock<std::mutex> Lock{m_pState->Mtx};
+        m_pState->Cond.wait(Lock,
+                            [this] //
+                            {
+                                return !m_pState->PendingTasks.empty() || m_pState->NumRunningTasks == 0;
+                            });
+        if (m_pState->PendingTasks.empty())
+            break;
+    }
+}
+
+
+namespace
+{
+
+class ParallelForState
+{
+public:
+    ParallelForState(Uint32                                     Begin,
+                     Uint32                                     End,
+                     Uint32                                     MinChunkSize,
+                     Uint32                                     NumThreads,
+                     const std::function<void(Uint32, Uint32)>& Handler) :
+        m_NextIndex{Begin},
+        m_End{End},
+        m_MinChunkSize{MinChunkSize},
+        m_NumThreads{NumThreads},
+        m_RangeSize{End - Begin},
+        m_pHandler{&Handler}
+    {}
+
+    // Processes the chunks of the range until there are no more chunks left.
+    void ProcessChunks()
+    {
+        Uint32 NumProcessed = 0;
+
+        Uint32 ChunkBegin = m_NextIndex.load();
+        while (ChunkBegin < m_End)
+        {
+            // Guided scheduling: every chunk takes a fraction of the remaining range, so that
+            // chunks are large at the start and get smaller towards the end to balance the load.
+            const Uint32 Remaining = m_End - ChunkBegin;
+            const Uint32 ChunkSize = std::min(Remaining, std::max(m_MinChunkSize, Remaining / (2 * m_NumThreads)));
+            if (m_NextIndex.compare_exchange_weak(ChunkBegin, ChunkBegin + ChunkSize))
+            {
+                // NB: the handler is only accessed while the range has not been fully processed,
+                //     so it is guaranteed to be alive.
+                (*m_pHandler)(ChunkBegin, ChunkBegin + ChunkSize);
+                NumProcessed += ChunkSize;
+                ChunkBegin = m_NextIndex.load();
+            }
+        }
+
+        if (NumProcessed > 0 && m_NumProcessed.fetch_add(NumProcessed) + NumProcessed == m_RangeSize)
+        {
+            std::lock_guard<std::mutex> Lock{m_Mtx};
+            m_Cond.notify_all();
+        }
+    }
+
+    // Waits until all chunks are processed.
+    void Wait()
+    {
+        std::unique_lock<std::mutex> Lock{m_Mtx};
+        m_Cond.wait(Lock,
+                    [this] //
+                    {
+                        return m_NumProcessed.load() == m_RangeSize;
+                    });
+    }
+
+private:
+    std::atomic<Uint32> m_NextIndex;
+    std::atomic<Uint32> m_NumProcessed{0};
+
+    const Uint32 m_End;
+    const Uint32 m_MinChunkSize;
+    const Uint32 m_NumThreads;
+    const Uint32 m_RangeSize;
+
+    const std::function<void(Uint32, Uint32)>* const m_pHandler;
+
+    std::mutex              m_Mtx;
+    std::condition_variable m_Cond;
+};
+
+} // namespace
+
+void ParallelForRange(IThreadPool*                               pThreadPool,
+                      Uint32                                     Begin,
+                      Uint32                                     End,
+                      const std::function<void(Uint32, Uint32)>& Handler,
+                      Uint32                                     MinChunkSize,
+                      float                                      fPriority,
+                      Uint32                                     NumThreads)
+{
+    if (Begin >= End)
+        return;
+
+    MinChunkSize = std::max(MinChunkSize, 1u);
+
+    if (NumThreads == 0)
+        NumThreads = std::max(std::thread::hardware_concurrency(), 1u);
+
+    const Uint32 NumChunks = (End - Begin - 1) / MinChunkSize + 1;
+    NumThreads             = std::min(NumThreads, NumChunks);
+    if (pThreadPool == nullptr || NumThreads <= 1)
+    {
+        Handler(Begin, End);
+        return;
+    }
+
+    auto pState = std::make_shared<ParallelForState>(Begin, End, MinChunkSize, NumThreads, Handler);
+    // The calling thread is one of the threads that process the range
+    for (Uint32 i = 0; i < NumThreads - 1; ++i)
+    {
+        EnqueueAsyncWork(
+            pThreadPool,
+            [pState](Uint32 ThreadId) {
+                pState->ProcessChunks();
+                return ASYNC_TASK_STATUS_COMPLETE;
+            },
+            fPriority);
+    }
+
+    pState->ProcessChunks();
+    // Only wait for the chunks that are being processed by other threads
+    pState->Wait();
 }
 
 Uint64 PinWorkerThread(Uint32 ThreadId, Uint64 AllowedCoresMask)
@@ -0,0 +1,143 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// CPU encoder and decoder of block-compressed texture formats
+
+#include "../../GraphicsEngine/interface/GraphicsTypes.h"
+#include "../../../Common/interface/ThreadPool.h"
+
+namespace Diligent
+{
+
+/// Block compression quality
+enum BC_COMPRESSION_QUALITY : Uint8
+{
+    /// Endpoints are taken from the bounding box of the block colors.
+    /// BC7 blocks are only encoded with mode 6.
+    BC_COMPRESSION_QUALITY_FAST = 0,
+
+    /// Endpoints are fitted along the principal axis of the block colors and refined
+    /// by the least-squares method. BC7 blocks additionally try two-subset mode 1 for
+    /// opaque blocks and separate-alpha mode 5 for translucent blocks.
+    BC_COMPRESSION_QUALITY_NORMAL,
+
+    /// More refinement iterations, an endpoint neighborhood search for BC4 and BC5,
+    /// and all BC7 modes with more partition candidates.
+    BC_COMPRESSION_QUALITY_HIGH,
+
+    BC_COMPRESSION_QUALITY_COUNT
+};
+
+
+/// Returns true if the format is supported by EncodeBC() and DecodeBC().
+
+/// \remarks    BC1, BC2, BC3, BC4, BC5 and BC7 formats are supported.
+///             The uncompressed data are in the format returned by BCFormatToUncompressed():
+///             RGBA8 for BC1, BC2, BC3 and BC7, R8 for BC4 and RG8 for BC5.
+bool IsBCCodecSupported(TEXTURE_FORMAT Format);
+
+
+/// EncodeBC function attributes
+struct BCEncodeAttribs
+{
+    /// Block-compressed format.
+    TEXTURE_FORMAT Format = TEX_FORMAT_UNKNOWN;
+
+    /// Texture width, in texels.
+    Uint32 Width = 0;
+
+    /// Texture height, in texels.
+    Uint32 Height = 0;
+
+    /// Pointer to the uncompressed texels.
+    const void* pSrcData = nullptr;
+
+    /// Uncompressed data stride, in bytes.
+    size_t SrcStride = 0;
+
+    /// Pointer to the compressed blocks.
+    void* pDstData = nullptr;
+
+    /// Stride between rows of compressed blocks, in bytes.
+    size_t DstStride = 0;
+
+    /// Compression quality.
+    BC_COMPRESSION_QUALITY Quality = BC_COMPRESSION_QUALITY_NORMAL;
+
+    /// An optional thread pool to use to encode the rows of blocks in parallel.
+    IThreadPool* pThreadPool = nullptr;
+};
+
+/// Compresses the texture data.
+
+/// \return     true if the data were compressed, and false if the format is not supported.
+///
+/// \remarks    If the texture size is not a multiple of the block size, the boundary blocks are
+///             padded by replicating the last row and column of texels.
+///
+///             sRGB data are compressed as is, without conversion to linear space.
+bool EncodeBC(const BCEncodeAttribs& Attribs);
+
+
+/// DecodeBC function attributes
+struct BCDecodeAttribs
+{
+    /// Block-compressed format.
+    TEXTURE_FORMAT Format = TEX_FORMAT_UNKNOWN;
+
+    /// Texture width, in texels.
+    Uint32 Width = 0;
+
+    /// Texture height, in texels.
+    Uint32 Height = 0;
+
+    /// Pointer to the compressed blocks.
+    const void* pSrcData = nullptr;
+
+    /// Stride between rows of compressed blocks, in bytes.
+    size_t SrcStride = 0;
+
+    /// Pointer to the uncompressed texels.
+    void* pDstData = nullptr;
+
+    /// Uncompressed data stride, in bytes.
+    size_t DstStride = 0;
+
+    /// An optional thread pool to use to decode the rows of blocks in parallel.
+    IThreadPool* pThreadPool = nullptr;
+};
+
+/// Decompresses the texture data.
+
+/// \return     true if the data were decompressed, and false if the format is not supported.
+///
+/// \remarks    Only the texels within the texture size are written.
+bool DecodeBC(const BCDecodeAttribs& Attribs);
+
+} // namespace Diligent
@@ -0,0 +1,272 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Defines Diligent::DefragmentationPlanner class
+
+#include <vector>
+#include <algorithm>
+
+#include "../../../Primitives/interface/BasicTypes.h"
+#include "VariableSizeAllocationsManager.hpp"
+#include "../../../Common/interface/Align.hpp"
+
+namespace Diligent
+{
+
+/// Computes the set of region moves that compacts allocations of the VariableSizeAllocationsManager.
+
+/// The planner moves allocations from the end of the managed space into the free blocks
+/// at its beginning. An allocation is only moved to a lower offset, and only into space that is
+/// free at the time the plan is computed, so that the source and destination regions of all moves
+/// never overlap each other or any live allocation. As a result, the moves may be executed in any
+/// order and spread over several frames.
+///
+/// The destination regions are reserved in the manager by ComputePlan(). When the data of a move
+/// has been copied, the source region must be released with CommitMove(). The destination regions
+/// of the moves that will not be executed must be released with CancelMove().
+class DefragmentationPlanner
+{
+public:
+    using OffsetType = VariableSizeAllocationsManager::OffsetType;
+    using Allocation = VariableSizeAllocationsManager::Allocation;
+
+    /// Describes a movable allocation.
+    struct AllocationDesc
+    {
+        /// The allocation region as returned by VariableSizeAllocationsManager::Allocate().
+        Allocation Region;
+
+        /// The alignment that was used to allocate the region.
+        OffsetType Alignment = 1;
+    };
+
+    /// Planner limits.
+    struct Limits
+    {
+        /// The maximum total number of bytes to move. Zero means no limit.
+        OffsetType MaxBytesToMove = 0;
+
+        /// The maximum number of moves. Zero means no limit.
+        Uint32 MaxMoves = 0;
+    };
+
+    /// Region move.
+    struct Move
+    {
+        /// Index of the allocation in the array passed to ComputePlan().
+        Uint32 AllocationIndex = 0;
+
+        /// The source region, which is released by CommitMove().
+        Allocation SrcRegion;
+
+        /// The destination region reserved in the manager.
+        Allocation DstRegion;
+
+        /// The aligned offsets of the data to copy.
+        OffsetType SrcOffset = 0;
+        OffsetType DstOffset = 0;
+
+        /// The size of the data to copy.
+        OffsetType Size = 0;
+    };
+
+    /// Defragmentation plan.
+    struct Plan
+    {
+        std::vector<Move> Moves;
+
+        /// The total size of the data to copy.
+        OffsetType BytesToMove = 0;
+
+        /// Fragmentation of the free space before and after all moves
+        /// are committed, see VariableSizeAllocationsManager::GetFragmentation().
+        double FragmentationBefore = 0;
+        double FragmentationAfter  = 0;
+
+        /// The size of the largest free block before and after all moves are committed.
+        OffsetType MaxFreeBlockSizeBefore = 0;
+        OffsetType MaxFreeBlockSizeAfter  = 0;
+    };
+
+    /// Computes the defragmentation plan and reserves the destination regions in the manager.
+
+    /// \param[in] Mgr            - The allocations manager.
+    /// \param[in] pAllocations   - An array of NumAllocations movable allocations.
+    ///                             All other allocated regions of the manager are not moved.
+    /// \param[in] NumAllocations - The number of allocations in pAllocations array.
+    /// \param[in] PlanLimits     - Plan limits, see Diligent::DefragmentationPlanner::Limits.
+    static Plan ComputePlan(VariableSizeAllocationsManager& Mgr,
+                            const AllocationDesc*           pAllocations,
+                            Uint32                          NumAllocations,
+                            const Limits&                   PlanLimits)
+    {
+        Plan DefragPlan;
+        DefragPlan.FragmentationBefore    = Mgr.GetFragmentation();
+        DefragPlan.MaxFreeBlockSizeBefore = Mgr.GetMaxFreeBlockSize();
+        DefragPlan.FragmentationAfter     = DefragPlan.FragmentationBefore;
+        DefragPlan.MaxFreeBlockSizeAfter  = DefragPlan.MaxFreeBlockSizeBefore;
+
+        struct Block
+        {
+            OffsetType Offset;
+            OffsetType Size;
+        };
+
+        // Free blocks sorted by offset. Note that the regions released by the moves
+        // are not reused by the plan to keep all moves independent.
+        std::vector<Block> Holes;
+        Holes.reserve(Mgr.GetNumFreeBlocks());
+        Mgr.ProcessFreeBlocks([&Holes](OffsetType Offset, OffsetType Size) {
+            Holes.push_back({Offset, Size});
+        });
+        if (Holes.size() < 2 || NumAllocations == 0)
+            return DefragPlan;
+
+        // Process allocations starting from the highest offset
+        std::vector<Uint32> Order(NumAllocations);
+        for (Uint32 i = 0; i < NumAllocations; ++i)
+        {
+            VERIFY(pAllocations[i].Region.IsValid(), "Allocation ", i, " is not valid");
+            VERIFY(IsPowerOfTwo(pAllocations[i].Alignment), "Alignment of allocation ", i, " is not a power of two");
+            Order[i] = i;
+        }
+        std::sort(Order.begin(), Order.end(), [pAllocations](Uint32 i0, Uint32 i1) {
+            return pAllocations[i0].Region.UnalignedOffset > pAllocations[i1].Region.UnalignedOffset;
+        });
+
+        size_t FirstHole = 0;
+        for (Uint32 AllocIdx : Order)
+        {
+            const AllocationDesc& Alloc = pAllocations[AllocIdx];
+
+            // Skip exhausted holes
+            while (FirstHole < Holes.size() && Holes[FirstHole].Size == 0)
+                ++FirstHole;
+            // Allocations below the first hole are already compacted
+            if (FirstHole == Holes.size() || Alloc.Region.UnalignedOffset < Holes[FirstHole].Offset)
+                break;
+
+            const OffsetType SrcOffset = AlignUp(Alloc.Region.UnalignedOffset, Alloc.Alignment);
+            const OffsetType Size      = Alloc.Region.UnalignedOffset + Alloc.Region.Size - SrcOffset;
+            if (PlanLimits.MaxBytesToMove != 0 && DefragPlan.BytesToMove + Size > PlanLimits.MaxBytesToMove)
+                continue;
+
+            // Find the first hole below the allocation that can hold it
+            for (size_t i = FirstHole; i < Holes.size() && Holes[i].Offset < Alloc.Region.UnalignedOffset; ++i)
+            {
+                Block& Hole = Holes[i];
+                if (Hole.Size == 0)
+                    continue;
+
+                const OffsetType DstOffset = AlignUp(Hole.Offset, Alloc.Alignment);
+                const OffsetType DstEnd    = DstOffset + Size;
+                if (DstEnd > Hole.Offset + Hole.Size)
+                    continue;
+
+                Move NewMove;
+                NewMove.AllocationIndex = AllocIdx;
+                NewMove.SrcRegion       = Alloc.Region;
+                NewMove.DstRegion       = Mgr.AllocateAt(Hole.Offset, Size, Alloc.Alignment);
+                NewMove.SrcOffset       = SrcOffset;
+                NewMove.DstOffset       = DstOffset;
+                NewMove.Size            = Size;
+                VERIFY_EXPR(NewMove.DstRegion.IsValid() && NewMove.DstRegion.UnalignedOffset + NewMove.DstRegion.Size == DstEnd);
+
+                Hole.Size -= DstEnd - Hole.Offset;
+                Hole.Offset = DstEnd;
+
+                DefragPlan.BytesToMove += Size;
+                DefragPlan.Moves.push_back(NewMove);
+                break;
+            }
+
+            if (PlanLimits.MaxMoves != 0 && DefragPlan.Moves.size() >= PlanLimits.MaxMoves)
+                break;
+        }
+
+        if (!DefragPlan.Moves.empty())
+        {
+            // Compute the free space layout after all moves are committed
+            std::vector<Block> FreeBlocks;
+            FreeBlocks.reserve(Holes.size() + DefragPlan.Moves.size());
+            for (const Block& Hole : Holes)
+            {
+                if (Hole.Size != 0)
+                    FreeBlocks.push_back(Hole);
+            }
+            for (const Move& M : DefragPlan.Moves)
+                FreeBlocks.push_back({M.SrcRegion.UnalignedOffset, M.SrcRegion.Size});
+            std::sort(FreeBlocks.begin(), FreeBlocks.end(), [](const Block& B0, const Block& B1) {
+                return B0.Offset < B1.Offset;
+            });
+
+            OffsetType TotalFreeSize = 0;
+            OffsetType MaxFreeBlock  = 0;
+            OffsetType CurrStart     = FreeBlocks[0].Offset;
+            OffsetType CurrEnd       = CurrStart;
+            for (const Block& FreeBlock : FreeBlocks)
+            {
+                VERIFY(FreeBlock.Offset >= CurrEnd, "Overlapping free blocks");
+                if (FreeBlock.Offset != CurrEnd)
+                    CurrStart = FreeBlock.Offset;
+                CurrEnd = FreeBlock.Offset + FreeBlock.Size;
+                TotalFreeSize += FreeBlock.Size;
+                MaxFreeBlock = (std::max)(MaxFreeBlock, CurrEnd - CurrStart);
+            }
+
+            DefragPlan.MaxFreeBlockSizeAfter = MaxFreeBlock;
+            DefragPlan.FragmentationAfter    = TotalFreeSize != 0 ?
+                1.0 - static_cast<double>(MaxFreeBlock) / static_cast<double>(TotalFreeSize) :
+                0.0;
+        }
+
+        return DefragPlan;
+    }
+
+    static Plan ComputePlan(VariableSizeAllocationsManager& Mgr,
+                            const AllocationDesc*           pAllocations,
+                            Uint32                          NumAllocations)
+    {
+        return ComputePlan(Mgr, pAllocations, NumAllocations, Limits{});
+    }
+
+    /// Releases the source region of the move after its data has been copied.
+    static void CommitMove(VariableSizeAllocationsManager& Mgr, Move& M)
+    {
+        Mgr.Free(std::move(M.SrcRegion));
+    }
+
+    /// Releases the destination region of the move that will not be executed.
+    static void CancelMove(VariableSizeAllocationsManager& Mgr, Move& M)
+    {
+        Mgr.Free(std::move(M.DstRegion));
+    }
+};
+
+} // namespace Diligent
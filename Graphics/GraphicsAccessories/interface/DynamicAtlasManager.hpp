@@ -33,9 +33,12 @@
 
 #include <map>
 #include <unordered_map>
+#include <vector>
+#include <memory>
 
 #include "../../../Primitives/interface/BasicTypes.h"
 #include "../../../Common/interface/HashUtils.hpp"
+#include "../../../Common/interface/PagedList.hpp"
 
 namespace Diligent
 {
@@ -98,7 +101,22 @@ public:
         };
     };
 
-    DynamicAtlasManager(Uint32 Width, Uint32 Height);
+    /// Packing strategy
+    enum class PackingMode : Uint8
+    {
+        /// Free space is recursively split into non-overlapping regions that are
+        /// merged back when all regions of the split are released.
+        Guillotine,
+
+        /// Regions are placed on top of the skyline (the upper boundary of the allocated
+        /// space) using the bottom-left rule. Free space left below the skyline and released
+        /// regions are kept in a set of non-overlapping free rectangles that is searched first.
+        /// This mode packs tighter than the guillotine mode when the regions have similar
+        /// heights, such as glyphs.
+        Skyline
+    };
+
+    DynamicAtlasManager(Uint32 Width, Uint32 Height, PackingMode Mode = PackingMode::Guillotine);
     ~DynamicAtlasManager();
 
     // clang-format off
@@ -111,21 +129,34 @@ public:
     Region Allocate(Uint32 Width, Uint32 Height);
     void   Free(Region&& R);
 
+    // In skyline mode, returns the number of free rectangles below the skyline
+    // plus the number of skyline segments that do not touch the top of the atlas.
     Uint32 GetFreeRegionCount() const
     {
+        if (m_Mode == PackingMode::Skyline)
+        {
+            Uint32 Count = static_cast<Uint32>(m_FreeRects.size());
+            VERIFY_EXPR(m_FreeRectsByWidth.size() == m_FreeRects.size() && m_FreeRectsByHeight.size() == m_FreeRects.size());
+            for (const SkylineSegment& Segment : m_Skyline)
+                Count += Segment.y < m_Height ? 1 : 0;
+            return Count;
+        }
+
         VERIFY_EXPR(m_FreeRegionsByWidth.size() == m_FreeRegionsByHeight.size());
         return static_cast<Uint32>(m_FreeRegionsByWidth.size());
     }
 
-    Uint32 GetWidth() const { return m_Width; }
-    Uint32 GetHeight() const { return m_Height; }
-    Uint64 GetTotalFreeArea() const { return m_TotalFreeArea; }
+    Uint32      GetWidth() const { return m_Width; }
+    Uint32      GetHeight() const { return m_Height; }
+    Uint64      GetTotalFreeArea() const { return m_TotalFreeArea; }
+    PackingMode GetPackingMode() const { return m_Mode; }
 
     bool IsEmpty() const
     {
-        VERIFY_EXPR(m_AllocatedRegions.empty() && (m_TotalFreeArea == Uint64{m_Width} * Uint64{m_Height}) ||
-                    !m_AllocatedRegions.empty() && (m_TotalFreeArea < Uint64{m_Width} * Uint64{m_Height}));
-        return m_AllocatedRegions.empty();
+        const bool NoAllocations = m_Mode == PackingMode::Skyline ? m_NumAllocatedRects == 0 : m_AllocatedRegions.empty();
+        VERIFY_EXPR((NoAllocations && m_TotalFreeArea == Uint64{m_Width} * Uint64{m_Height}) ||
+                    (!NoAllocations && m_TotalFreeArea < Uint64{m_Width} * Uint64{m_Height}));
+        return NoAllocations;
     }
 
 #define CMP(Member)                 \
@@ -166,8 +197,19 @@ private:
     void DbgRecursiveVerifyConsistency(const Node& N, Uint32& Area) const;
 #endif
 
-    const Uint32 m_Width;
-    const Uint32 m_Height;
+    Region AllocateSkyline(Uint32 Width, Uint32 Height);
+    void   FreeSkyline(const Region& R);
+    Region AllocateFromFreeRects(Uint32 Width, Uint32 Height);
+    void   AddFreeRect(Region R);
+    void   InsertFreeRect(const Region& R);
+    void   RemoveFreeRect(const Region& R);
+    bool   LowerSkyline(const Region& R);
+    void   LowerSkylineToFreeRects(const Region& R);
+    void   ResetSkyline();
+
+    const Uint32      m_Width;
+    const Uint32      m_Height;
+    const PackingMode m_Mode;
 
     Uint64 m_TotalFreeArea = 0;
 
@@ -182,7 +224,7 @@ private:
         void MergeChildren();
         bool HasChildren() const
         {
-            VERIFY_EXPR(NumChildren == 0 && !Children || NumChildren != 0 && Children);
+            VERIFY_EXPR((NumChildren == 0 && !Children) || (NumChildren != 0 && Children));
             VERIFY(!IsAllocated || NumChildren == 0, "Allocated nodes can't have children");
             return NumChildren != 0;
         }
@@ -229,6 +271,46 @@ private:
     std::map<Region, Node*, HeightFirstCompare> m_FreeRegionsByHeight;
     // Allocated regions
     std::unordered_map<Region, Node*, Region::Hasher> m_AllocatedRegions;
+
+    struct SkylineSegment
+    {
+        Uint32 x     = 0;
+        Uint32 y     = 0;
+        Uint32 width = 0;
+
+        SkylineSegment(Uint32 _x, Uint32 _y, Uint32 _width) :
+            // clang-format off
+            x    {_x},
+            y    {_y},
+            width{_width}
+        // clang-format on
+        {}
+    };
+    using SkylineType = PagedList<SkylineSegment, 64>;
+    void MergeSkylineSegments(SkylineType::iterator it);
+
+    // Skyline mode: skyline segments sorted by x that cover the entire atlas width
+    SkylineType m_Skyline;
+
+    // Skyline mode: non-overlapping free rectangles below the skyline.
+    // The maps below reference the rectangles in this list.
+    using FreeRectListType = PagedList<Region, 64>;
+    FreeRectListType m_FreeRects;
+
+    // Skyline mode: free rectangles ordered by width->height->x->y
+    std::map<Region, FreeRectListType::iterator, WidthFirstCompare> m_FreeRectsByWidth;
+    // Skyline mode: free rectangles ordered by height->width->y->x
+    std::map<Region, FreeRectListType::iterator, HeightFirstCompare> m_FreeRectsByHeight;
+
+    // (y, x) position of the rectangle edge
+    using EdgePosition = std::pair<Uint32, Uint32>;
+    // Skyline mode: free rectangles ordered by the bottom edge, then by the left edge
+    std::map<EdgePosition, FreeRectListType::iterator> m_FreeRectsByBottom;
+    // Skyline mode: free rectangles ordered by the top edge, then by the left edge
+    std::map<EdgePosition, FreeRectListType::iterator> m_FreeRectsByTop;
+
+    // Skyline mode: the number of allocated regions
+    Uint32 m_NumAllocatedRects = 0;
 };
 
 } // namespace Diligent
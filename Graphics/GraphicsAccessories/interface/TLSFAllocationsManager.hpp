@@ -0,0 +1,644 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+// Helper class that handles free memory block management using the two-level segregated fit (TLSF) algorithm
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+#include "VariableSizeAllocationsManager.hpp"
+#include "../../../Platforms/interface/PlatformMisc.hpp"
+
+namespace Diligent
+{
+
+// The class is an alternative to VariableSizeAllocationsManager with the same interface that
+// performs both allocation and deallocation in constant time.
+//
+// Free blocks are kept in segregated lists. The first level splits block sizes into power-of-two
+// classes, and the second level linearly subdivides each class into 16 bins. Two levels of bitmaps
+// record which lists are not empty, so that a suitable list is found with two bit scans:
+//
+//      FL bitmap     SL bitmaps           Free lists
+//
+//      | 1 |  -->  | 0 | 1 | 0 | ... |
+//                        '----------->  [64, 68) -> [64, 68)
+//      | 0 |
+//      | 1 |  -->  | 1 | 0 | 0 | ... |
+//                    '--------------->  [128, 136)
+//
+// Unlike CPU-side TLSF allocators, the class cannot store boundary tags in the managed memory.
+// Instead, it keeps two open-addressing hash tables that map the start and end offsets of every free
+// block to its node. This lets Free() find and merge the adjacent free blocks without searching.
+// Block nodes are recycled through a free list, so neither Allocate() nor Free() allocates memory
+// unless the number of free blocks exceeds its previous maximum.
+//
+// Note that the class uses the good-fit strategy: the requested size is rounded up to the next bin
+// boundary, so that any block in the selected list is large enough. As a result, the allocated block
+// may be slightly larger than the best-fitting block VariableSizeAllocationsManager would pick.
+class TLSFAllocationsManager
+{
+public:
+    using OffsetType = VariableSizeAllocationsManager::OffsetType;
+    using CreateInfo = VariableSizeAllocationsManager::CreateInfo;
+    using Allocation = VariableSizeAllocationsManager::Allocation;
+
+private:
+    static constexpr Uint32 InvalidNode = ~Uint32{0};
+
+    static constexpr Uint32 SLIndexCountLog2 = 4;
+    static constexpr Uint32 SLIndexCount     = 1u << SLIndexCountLog2;
+    static constexpr Uint32 FLIndexCount     = sizeof(OffsetType) * 8 - SLIndexCountLog2 + 1;
+
+    struct FreeBlock
+    {
+        OffsetType Offset = 0;
+        OffsetType Size   = 0;
+
+        // Previous and next blocks in the free list; unused nodes are linked through NextFree
+        Uint32 PrevFree = InvalidNode;
+        Uint32 NextFree = InvalidNode;
+    };
+
+    // Open-addressing hash table with linear probing that maps block offsets to node indices
+    class OffsetToNodeMap
+    {
+    public:
+        explicit OffsetToNodeMap(IMemoryAllocator& Allocator) :
+            m_Slots{STD_ALLOCATOR_RAW_MEM(Slot, Allocator, "Allocator for vector<Slot>")}
+        {}
+
+        Uint32 Find(OffsetType Key) const
+        {
+            if (m_Slots.empty())
+                return InvalidNode;
+
+            const size_t Mask = m_Slots.size() - 1;
+            for (size_t Idx = GetHomeSlot(Key);; Idx = (Idx + 1) & Mask)
+            {
+                const Slot& S = m_Slots[Idx];
+                if (S.Node == InvalidNode || S.Key == Key)
+                    return S.Node;
+            }
+        }
+
+        void Insert(OffsetType Key, Uint32 Node)
+        {
+            VERIFY_EXPR(Node != InvalidNode);
+            if ((m_Size + 1) * 2 > m_Slots.size())
+                Grow();
+
+            const size_t Mask = m_Slots.size() - 1;
+            size_t       Idx  = GetHomeSlot(Key);
+            while (m_Slots[Idx].Node != InvalidNode)
+            {
+                VERIFY(m_Slots[Idx].Key != Key, "Key ", Key, " is already present in the map");
+                Idx = (Idx + 1) & Mask;
+            }
+            m_Slots[Idx] = Slot{Key, Node};
+            ++m_Size;
+        }
+
+        void Erase(OffsetType Key)
+        {
+            VERIFY_EXPR(!m_Slots.empty());
+            const size_t Mask = m_Slots.size() - 1;
+
+            size_t Idx = GetHomeSlot(Key);
+            while (m_Slots[Idx].Key != Key)
+            {
+                VERIFY(m_Slots[Idx].Node != InvalidNode, "Key ", Key, " is not found in the map");
+                Idx = (Idx + 1) & Mask;
+            }
+
+            // Backward-shift deletion: move the following entries of the probe sequence
+            // into the hole so that no tombstones are required.
+            for (size_t Next = (Idx + 1) & Mask; m_Slots[Next].Node != InvalidNode; Next = (Next + 1) & Mask)
+            {
+                const size_t Home = GetHomeSlot(m_Slots[Next].Key);
+                // The entry may be moved to the hole if its home slot is not in (Idx, Next] cyclic range
+                const bool CanMove = Idx <= Next ?
+                    (Home <= Idx || Home > Next) :
+                    (Home <= Idx && Home > Next);
+                if (CanMove)
+                {
+                    m_Slots[Idx] = m_Slots[Next];
+                    Idx          = Next;
+                }
+            }
+            m_Slots[Idx] = Slot{};
+            --m_Size;
+        }
+
+        size_t GetSize() const { return m_Size; }
+
+    private:
+        struct Slot
+        {
+            OffsetType Key  = 0;
+            Uint32     Node = InvalidNode;
+        };
+
+        size_t GetHomeSlot(OffsetType Key) const
+        {
+            // Offsets are typically aligned, so use Fibonacci hashing to spread them over the table
+            return static_cast<size_t>((Uint64{Key} * Uint64{0x9E3779B97F4A7C15}) >> m_Shift);
+        }
+
+        void Grow()
+        {
+            const size_t NewCapacity = (std::max)(m_Slots.size() * 2, size_t{64});
+
+            decltype(m_Slots) OldSlots{NewCapacity, Slot{}, m_Slots.get_allocator()};
+            OldSlots.swap(m_Slots);
+            m_Shift = 64 - PlatformMisc::GetMSB(Uint64{NewCapacity});
+            m_Size  = 0;
+            for (const Slot& S : OldSlots)
+            {
+                if (S.Node != InvalidNode)
+                    Insert(S.Key, S.Node);
+            }
+        }
+
+        std::vector<Slot, STDAllocatorRawMem<Slot>> m_Slots;
+
+        size_t m_Size  = 0;
+        Uint32 m_Shift = 64;
+    };
+
+public:
+    explicit TLSFAllocationsManager(const CreateInfo& CI)
+        // clang-format off
+        : m_Nodes         {STD_ALLOCATOR_RAW_MEM(FreeBlock, CI.Allocator, "Allocator for vector<FreeBlock>")}
+        , m_BlocksByOffset{CI.Allocator}
+        , m_BlocksByEnd   {CI.Allocator}
+        , m_MaxSize       {CI.MaxSize}
+        , m_FreeSize      {CI.MaxSize}
+#ifdef DILIGENT_DEBUG
+        , m_DbgDisableDebugValidation{CI.DbgDisableDebugValidation}
+#endif
+    // clang-format on
+    {
+        for (auto& FreeLists : m_FreeLists)
+            std::fill(std::begin(FreeLists), std::end(FreeLists), InvalidNode);
+
+        if (m_MaxSize > 0)
+            AddFreeBlock(0, m_MaxSize);
+        ResetCurrAlignment();
+
+#ifdef DILIGENT_DEBUG
+        DbgVerifyList();
+#endif
+    }
+
+    TLSFAllocationsManager(OffsetType MaxSize, IMemoryAllocator& Allocator) :
+        TLSFAllocationsManager{CreateInfo{Allocator, MaxSize}}
+    {}
+
+    ~TLSFAllocationsManager()
+    {
+#ifdef DILIGENT_DEBUG
+        if (m_NumFreeBlocks != 0)
+        {
+            VERIFY(m_NumFreeBlocks == 1, "Single free block is expected");
+            const Uint32 Node = m_BlocksByOffset.Find(0);
+            VERIFY(Node != InvalidNode, "Head chunk offset is expected to be 0");
+            VERIFY(Node == InvalidNode || m_Nodes[Node].Size == m_MaxSize, "Head chunk size is expected to be ", m_MaxSize);
+        }
+#endif
+    }
+
+    // clang-format off
+    TLSFAllocationsManager(TLSFAllocationsManager&& rhs) noexcept
+        : m_Nodes         {std::move(rhs.m_Nodes)         }
+        , m_BlocksByOffset{std::move(rhs.m_BlocksByOffset)}
+        , m_BlocksByEnd   {std::move(rhs.m_BlocksByEnd)   }
+        , m_FirstUnusedNode{rhs.m_FirstUnusedNode}
+        , m_FLBitmap      {rhs.m_FLBitmap     }
+        , m_NumFreeBlocks {rhs.m_NumFreeBlocks}
+        , m_MaxSize       {rhs.m_MaxSize      }
+        , m_FreeSize      {rhs.m_FreeSize     }
+        , m_CurrAlignment {rhs.m_CurrAlignment}
+#ifdef DILIGENT_DEBUG
+        , m_DbgDisableDebugValidation{rhs.m_DbgDisableDebugValidation}
+#endif
+    {
+        // clang-format on
+        std::copy(std::begin(rhs.m_SLBitmaps), std::end(rhs.m_SLBitmaps), std::begin(m_SLBitmaps));
+        for (Uint32 FL = 0; FL < FLIndexCount; ++FL)
+            std::copy(std::begin(rhs.m_FreeLists[FL]), std::end(rhs.m_FreeLists[FL]), std::begin(m_FreeLists[FL]));
+
+        rhs.m_FirstUnusedNode = InvalidNode;
+        rhs.m_FLBitmap        = 0;
+        rhs.m_NumFreeBlocks   = 0;
+        rhs.m_MaxSize         = 0;
+        rhs.m_FreeSize        = 0;
+        rhs.m_CurrAlignment   = 0;
+    }
+
+    // clang-format off
+    TLSFAllocationsManager& operator = (      TLSFAllocationsManager&&) = delete;
+    TLSFAllocationsManager             (const TLSFAllocationsManager&)  = delete;
+    TLSFAllocationsManager& operator = (const TLSFAllocationsManager&)  = delete;
+    // clang-format on
+
+    // Offset returned by Allocate() may not be aligned, but the size of the allocation
+    // is sufficient to properly align it
+    Allocation Allocate(OffsetType Size, OffsetType Alignment)
+    {
+        VERIFY_EXPR(Size > 0);
+        VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be power of 2");
+        Size = AlignUp(Size, Alignment);
+        if (m_FreeSize < Size)
+            return Allocation::InvalidAllocation();
+
+        const OffsetType AlignmentReserve = (Alignment > m_CurrAlignment) ? Alignment - m_CurrAlignment : 0;
+
+        const Uint32 Node = FindFreeBlock(Size + AlignmentReserve);
+        if (Node == InvalidNode)
+            return Allocation::InvalidAllocation();
+
+        //     Block.Offset
+        //        |                                  |
+        //        |<----------Block.Size------------>|
+        //        |<------Size------>|<---NewSize--->|
+        //        |                  |
+        //      Offset              NewOffset
+        //
+        const OffsetType Offset    = m_Nodes[Node].Offset;
+        const OffsetType BlockSize = m_Nodes[Node].Size;
+        VERIFY_EXPR(Size + AlignmentReserve <= BlockSize);
+        VERIFY_EXPR(Offset % m_CurrAlignment == 0);
+
+        const OffsetType AlignedOffset = AlignUp(Offset, Alignment);
+        const OffsetType AdjustedSize  = Size + (AlignedOffset - Offset);
+        VERIFY_EXPR(AdjustedSize <= Size + AlignmentReserve);
+
+        RemoveFreeBlock(Node);
+        if (BlockSize > AdjustedSize)
+        {
+            AddFreeBlock(Offset + AdjustedSize, BlockSize - AdjustedSize);
+        }
+
+        m_FreeSize -= AdjustedSize;
+
+        if ((Size & (m_CurrAlignment - 1)) != 0)
+        {
+            if (IsPowerOfTwo(Size))
+            {
+                VERIFY_EXPR(Size >= Alignment && Size < m_CurrAlignment);
+                m_CurrAlignment = Size;
+            }
+            else
+            {
+                m_CurrAlignment = (std::min)(m_CurrAlignment, Alignment);
+            }
+        }
+
+#ifdef DILIGENT_DEBUG
+        if (!m_DbgDisableDebugValidation)
+            DbgVerifyList();
+#endif
+        return Allocation{Offset, AdjustedSize};
+    }
+
+    void Free(Allocation&& allocation)
+    {
+        VERIFY_EXPR(allocation.IsValid());
+        Free(allocation.UnalignedOffset, allocation.Size);
+        allocation = Allocation{};
+    }
+
+    void Free(OffsetType Offset, OffsetType Size)
+    {
+        VERIFY_EXPR(Offset != Allocation::InvalidOffset && Offset + Size <= m_MaxSize);
+        VERIFY(m_BlocksByOffset.Find(Offset) == InvalidNode, "Block at offset ", Offset, " is already free");
+
+        OffsetType NewOffset = Offset;
+        OffsetType NewSize   = Size;
+
+        //   PrevBlock.Offset           Offset            NextBlock.Offset
+        //     |                          |                    |
+        //     |<-----PrevBlock.Size----->|<------Size-------->|<-----NextBlock.Size----->|
+        //
+        const Uint32 PrevNode = m_BlocksByEnd.Find(Offset);
+        if (PrevNode != InvalidNode)
+        {
+            NewOffset = m_Nodes[PrevNode].Offset;
+            NewSize += m_Nodes[PrevNode].Size;
+            RemoveFreeBlock(PrevNode);
+        }
+
+        const Uint32 NextNode = m_BlocksByOffset.Find(Offset + Size);
+        if (NextNode != InvalidNode)
+        {
+            NewSize += m_Nodes[NextNode].Size;
+            RemoveFreeBlock(NextNode);
+        }
+
+        AddFreeBlock(NewOffset, NewSize);
+
+        m_FreeSize += Size;
+        if (IsEmpty())
+        {
+            // Reset current alignment
+            VERIFY_EXPR(GetNumFreeBlocks() == 1);
+            ResetCurrAlignment();
+        }
+
+#ifdef DILIGENT_DEBUG
+        if (!m_DbgDisableDebugValidation)
+            DbgVerifyList();
+#endif
+    }
+
+    // clang-format off
+    bool IsFull() const{ return m_FreeSize==0; };
+    bool IsEmpty()const{ return m_FreeSize==m_MaxSize; };
+    OffsetType GetMaxSize() const{return m_MaxSize;}
+    OffsetType GetFreeSize()const{return m_FreeSize;}
+    OffsetType GetUsedSize()const{return m_MaxSize - m_FreeSize;}
+    // clang-format on
+
+    size_t GetNumFreeBlocks() const
+    {
+        return m_NumFreeBlocks;
+    }
+
+    OffsetType GetMaxFreeBlockSize() const
+    {
+        if (m_FLBitmap == 0)
+            return 0;
+
+        // The largest block is in the highest non-empty list, but not necessarily at its head
+        const Uint32 FL = PlatformMisc::GetMSB(m_FLBitmap);
+        const Uint32 SL = PlatformMisc::GetMSB(m_SLBitmaps[FL]);
+
+        OffsetType MaxSize = 0;
+        for (Uint32 Node = m_FreeLists[FL][SL]; Node != InvalidNode; Node = m_Nodes[Node].NextFree)
+            MaxSize = (std::max)(MaxSize, m_Nodes[Node].Size);
+        return MaxSize;
+    }
+
+    // Returns the fragmentation of the free space, a value in [0, 1] range.
+    // 0 means that all free space is contiguous; values close to 1 indicate that
+    // the free space is split into many small blocks.
+    double GetFragmentation() const
+    {
+        return m_FreeSize > 0 ?
+            1.0 - static_cast<double>(GetMaxFreeBlockSize()) / static_cast<double>(m_FreeSize) :
+            0.0;
+    }
+
+    void Extend(size_t ExtraSize)
+    {
+        OffsetType NewBlockOffset = m_MaxSize;
+        OffsetType NewBlockSize   = ExtraSize;
+
+        const Uint32 LastNode = m_BlocksByEnd.Find(m_MaxSize);
+        if (LastNode != InvalidNode)
+        {
+            // Extend the last block
+            NewBlockOffset = m_Nodes[LastNode].Offset;
+            NewBlockSize += m_Nodes[LastNode].Size;
+            RemoveFreeBlock(LastNode);
+        }
+
+        AddFreeBlock(NewBlockOffset, NewBlockSize);
+
+        m_MaxSize += ExtraSize;
+        m_FreeSize += ExtraSize;
+
+#ifdef DILIGENT_DEBUG
+        if (!m_DbgDisableDebugValidation)
+            DbgVerifyList();
+#endif
+    }
+
+private:
+    // Returns the list indices for a block of the given size
+    static void MappingInsert(OffsetType Size, Uint32& FL, Uint32& SL)
+    {
+        if (Size < SLIndexCount)
+        {
+            // Small blocks are stored in the first list with the granularity of 1
+            FL = 0;
+            SL = static_cast<Uint32>(Size);
+        }
+        else
+        {
+            const Uint32 MSB = PlatformMisc::GetMSB(Uint64{Size});
+
+            FL = MSB - SLIndexCountLog2 + 1;
+            SL = static_cast<Uint32>(Size >> (MSB - SLIndexCountLog2)) ^ SLIndexCount;
+        }
+        VERIFY_EXPR(FL < FLIndexCount && SL < SLIndexCount);
+    }
+
+    Uint32 FindFreeBlock(OffsetType Size) const
+    {
+        Uint32 FL = 0, SL = 0;
+
+        // Round the size up to the next list boundary so that every block in the list
+        // starting from that boundary is large enough.
+        OffsetType RoundedSize = Size;
+        if (Size >= SLIndexCount)
+            RoundedSize += (OffsetType{1} << (PlatformMisc::GetMSB(Uint64{Size}) - SLIndexCountLog2)) - 1;
+        if (RoundedSize >= Size)
+        {
+            MappingInsert(RoundedSize, FL, SL);
+
+            Uint32 SLBitmap = m_SLBitmaps[FL] & (~Uint32{0} << SL);
+            if (SLBitmap == 0)
+            {
+                const Uint64 FLBitmap = FL + 1 < FLIndexCount ? m_FLBitmap & (~Uint64{0} << (FL + 1)) : 0;
+                if (FLBitmap != 0)
+                {
+                    FL       = PlatformMisc::GetLSB(FLBitmap);
+                    SLBitmap = m_SLBitmaps[FL];
+                }
+            }
+
+            if (SLBitmap != 0)
+            {
+                SL = PlatformMisc::GetLSB(SLBitmap);
+                return m_FreeLists[FL][SL];
+            }
+        }
+
+        // No larger list is available. The first block of the list that contains the requested
+        // size may still be large enough.
+        MappingInsert(Size, FL, SL);
+        const Uint32 Node = m_FreeLists[FL][SL];
+        return (Node != InvalidNode && m_Nodes[Node].Size >= Size) ? Node : InvalidNode;
+    }
+
+    void AddFreeBlock(OffsetType Offset, OffsetType Size)
+    {
+        VERIFY_EXPR(Size > 0);
+
+        Uint32 Node = m_FirstUnusedNode;
+        if (Node != InvalidNode)
+        {
+            m_FirstUnusedNode = m_Nodes[Node].NextFree;
+        }
+        else
+        {
+            Node = static_cast<Uint32>(m_Nodes.size());
+            m_Nodes.emplace_back();
+        }
+
+        Uint32 FL = 0, SL = 0;
+        MappingInsert(Size, FL, SL);
+
+        FreeBlock& Block = m_Nodes[Node];
+        Block.Offset     = Offset;
+        Block.Size       = Size;
+        Block.PrevFree   = InvalidNode;
+        Block.NextFree   = m_FreeLists[FL][SL];
+        if (Block.NextFree != InvalidNode)
+            m_Nodes[Block.NextFree].PrevFree = Node;
+
+        m_FreeLists[FL][SL] = Node;
+        m_SLBitmaps[FL] |= Uint32{1} << SL;
+        m_FLBitmap |= Uint64{1} << FL;
+
+        m_BlocksByOffset.Insert(Offset, Node);
+        m_BlocksByEnd.Insert(Offset + Size, Node);
+        ++m_NumFreeBlocks;
+    }
+
+    void RemoveFreeBlock(Uint32 Node)
+    {
+        FreeBlock& Block = m_Nodes[Node];
+
+        Uint32 FL = 0, SL = 0;
+        MappingInsert(Block.Size, FL, SL);
+
+        if (Block.PrevFree != InvalidNode)
+        {
+            m_Nodes[Block.PrevFree].NextFree = Block.NextFree;
+        }
+        else
+        {
+            VERIFY_EXPR(m_FreeLists[FL][SL] == Node);
+            m_FreeLists[FL][SL] = Block.NextFree;
+            if (Block.NextFree == InvalidNode)
+            {
+                m_SLBitmaps[FL] &= ~(Uint32{1} << SL);
+                if (m_SLBitmaps[FL] == 0)
+                    m_FLBitmap &= ~(Uint64{1} << FL);
+            }
+        }
+        if (Block.NextFree != InvalidNode)
+            m_Nodes[Block.NextFree].PrevFree = Block.PrevFree;
+
+        m_BlocksByOffset.Erase(Block.Offset);
+        m_BlocksByEnd.Erase(Block.Offset + Block.Size);
+        --m_NumFreeBlocks;
+
+        Block.PrevFree    = InvalidNode;
+        Block.NextFree    = m_FirstUnusedNode;
+        m_FirstUnusedNode = Node;
+    }
+
+    void ResetCurrAlignment()
+    {
+        for (m_CurrAlignment = 1; m_CurrAlignment * 2 <= m_MaxSize; m_CurrAlignment *= 2)
+        {}
+    }
+
+#ifdef DILIGENT_DEBUG
+    void DbgVerifyList()
+    {
+        VERIFY_EXPR(IsPowerOfTwo(m_CurrAlignment));
+        VERIFY_EXPR(m_BlocksByOffset.GetSize() == m_NumFreeBlocks);
+        VERIFY_EXPR(m_BlocksByEnd.GetSize() == m_NumFreeBlocks);
+
+        OffsetType TotalFreeSize = 0;
+        size_t     NumBlocks     = 0;
+        for (Uint32 FL = 0; FL < FLIndexCount; ++FL)
+        {
+            VERIFY_EXPR(((m_FLBitmap >> FL) & 1) == (m_SLBitmaps[FL] != 0 ? 1 : 0));
+            for (Uint32 SL = 0; SL < SLIndexCount; ++SL)
+            {
+                VERIFY_EXPR(((m_SLBitmaps[FL] >> SL) & 1) == (m_FreeLists[FL][SL] != InvalidNode ? 1 : 0));
+
+                Uint32 PrevNode = InvalidNode;
+                for (Uint32 Node = m_FreeLists[FL][SL]; Node != InvalidNode; Node = m_Nodes[Node].NextFree)
+                {
+                    const FreeBlock& Block = m_Nodes[Node];
+                    VERIFY_EXPR(Block.PrevFree == PrevNode);
+                    VERIFY_EXPR(Block.Size > 0 && Block.Offset + Block.Size <= m_MaxSize);
+                    VERIFY((Block.Offset & (m_CurrAlignment - 1)) == 0, "Block offset (", Block.Offset, ") is not ", m_CurrAlignment, "-aligned");
+                    if (Block.Offset + Block.Size < m_MaxSize)
+                        VERIFY((Block.Size & (m_CurrAlignment - 1)) == 0, "All block sizes except for the last one must be ", m_CurrAlignment, "-aligned");
+
+                    Uint32 BlockFL = 0, BlockSL = 0;
+                    MappingInsert(Block.Size, BlockFL, BlockSL);
+                    VERIFY(BlockFL == FL && BlockSL == SL, "Block is in the wrong free list");
+
+                    VERIFY_EXPR(m_BlocksByOffset.Find(Block.Offset) == Node);
+                    VERIFY_EXPR(m_BlocksByEnd.Find(Block.Offset + Block.Size) == Node);
+                    VERIFY(m_BlocksByEnd.Find(Block.Offset) == InvalidNode, "Unmerged adjacent blocks detected");
+
+                    TotalFreeSize += Block.Size;
+                    ++NumBlocks;
+                    PrevNode = Node;
+                }
+            }
+        }
+
+        VERIFY_EXPR(NumBlocks == m_NumFreeBlocks);
+        VERIFY_EXPR(TotalFreeSize == m_FreeSize);
+    }
+#endif
+
+    std::vector<FreeBlock, STDAllocatorRawMem<FreeBlock>> m_Nodes;
+
+    OffsetToNodeMap m_BlocksByOffset;
+    OffsetToNodeMap m_BlocksByEnd;
+
+    Uint32 m_FirstUnusedNode = InvalidNode;
+
+    Uint64 m_FLBitmap                  = 0;
+    Uint32 m_SLBitmaps[FLIndexCount]   = {};
+    Uint32 m_FreeLists[FLIndexCount][SLIndexCount];
+
+    size_t m_NumFreeBlocks = 0;
+
+    OffsetType m_MaxSize       = 0;
+    OffsetType m_FreeSize      = 0;
+    OffsetType m_CurrAlignment = 0;
+#ifdef DILIGENT_DEBUG
+    bool m_DbgDisableDebugValidation = false;
+#endif
+    // When adding new members, do not forget to update move ctor
+};
+
+} // namespace Diligent
@@ -247,18 +247,57 @@ public:
 
         m_FreeSize -= AdjustedSize;
 
-        if ((Size & (m_CurrAlignment - 1)) != 0)
-        {
-            if (IsPowerOfTwo(Size))
-            {
-                VERIFY_EXPR(Size >= Alignment && Size < m_CurrAlignment);
-                m_CurrAlignment = Size;
-            }
-            else
-            {
-                m_CurrAlignment = (std::min)(m_CurrAlignment, Alignment);
-            }
-        }
+        UpdateCurrAlignment(Size, Alignment);
+
+#ifdef DILIGENT_DEBUG
+        VERIFY_EXPR(m_FreeBlocksByOffset.size() == m_FreeBlocksBySize.size());
+        if (!m_DbgDisableDebugValidation)
+            DbgVerifyList();
+#endif
+        return Allocation{Offset, AdjustedSize};
+    }
+
+    // Allocates the region that starts at the given unaligned offset. The allocation is sized
+    // the same way as in Allocate(), so that Size bytes fit at the offset aligned by Alignment.
+    // Returns an invalid allocation if the region does not lie entirely within one free block.
+    Allocation AllocateAt(OffsetType Offset, OffsetType Size, OffsetType Alignment)
+    {
+        VERIFY_EXPR(Size > 0);
+        VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be power of 2");
+        Size = AlignUp(Size, Alignment);
+
+        const auto AdjustedSize = Size + (AlignUp(Offset, Alignment) - Offset);
+        if (m_FreeSize < AdjustedSize)
+            return Allocation::InvalidAllocation();
+
+        // Find the free block that contains the offset
+        auto BlockIt = m_FreeBlocksByOffset.upper_bound(Offset);
+        if (BlockIt == m_FreeBlocksByOffset.begin())
+            return Allocation::InvalidAllocation();
+        --BlockIt;
+
+        const auto BlockOffset = BlockIt->first;
+        const auto BlockEnd    = BlockOffset + BlockIt->second.Size;
+        if (Offset + AdjustedSize > BlockEnd)
+            return Allocation::InvalidAllocation();
+
+        //   BlockOffset          Offset                       BlockEnd
+        //        |                  |                             |
+        //        |<----Head Size--->|<--AdjustedSize-->|<-Tail--->|
+        //
+        m_FreeBlocksBySize.erase(BlockIt->second.OrderBySizeIt);
+        m_FreeBlocksByOffset.erase(BlockIt);
+        if (Offset > BlockOffset)
+            AddNewBlock(BlockOffset, Offset - BlockOffset);
+        if (Offset + AdjustedSize < BlockEnd)
+            AddNewBlock(Offset + AdjustedSize, BlockEnd - (Offset + AdjustedSize));
+
+        m_FreeSize -= AdjustedSize;
+
+        // Free block offsets must remain aligned by the current alignment
+        while ((Offset & (m_CurrAlignment - 1)) != 0)
+            m_CurrAlignment /= 2;
+        UpdateCurrAlignment(Size, Alignment);
 
 #ifdef DILIGENT_DEBUG
         VERIFY_EXPR(m_FreeBlocksByOffset.size() == m_FreeBlocksBySize.size());
@@ -391,6 +430,24 @@ public:
         return !m_FreeBlocksBySize.empty() ? m_FreeBlocksBySize.rbegin()->first : 0;
     }
 
+    // Calls Handler(Offset, Size) for every free block in the order of increasing offsets.
+    template <typename HandlerType>
+    void ProcessFreeBlocks(HandlerType&& Handler) const
+    {
+        for (const auto& Block : m_FreeBlocksByOffset)
+            Handler(Block.first, Block.second.Size);
+    }
+
+    // Returns the fragmentation of the free space, a value in [0, 1] range.
+    // 0 means that all free space is contiguous; values close to 1 indicate that
+    // the free space is split into many small blocks.
+    double GetFragmentation() const
+    {
+        return m_FreeSize > 0 ?
+            1.0 - static_cast<double>(GetMaxFreeBlockSize()) / static_cast<double>(m_FreeSize) :
+            0.0;
+    }
+
     void Extend(size_t ExtraSize)
     {
         size_t NewBlockOffset = m_MaxSize;
@@ -437,6 +494,22 @@ private:
         NewBlockIt.first->second.OrderBySizeIt = OrderIt;
     }
 
+    void UpdateCurrAlignment(OffsetType Size, OffsetType Alignment)
+    {
+        if ((Size & (m_CurrAlignment - 1)) != 0)
+        {
+            if (IsPowerOfTwo(Size))
+            {
+                VERIFY_EXPR(Size >= Alignment && Size < m_CurrAlignment);
+                m_CurrAlignment = Size;
+            }
+            else
+            {
+                m_CurrAlignment = (std::min)(m_CurrAlignment, Alignment);
+            }
+        }
+    }
+
     void ResetCurrAlignment()
     {
         for (m_CurrAlignment = 1; m_CurrAlignment * 2 <= m_MaxSize; m_CurrAlignment *= 2)
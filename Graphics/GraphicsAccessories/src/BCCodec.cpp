@@ -0,0 +1,2020 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "BCCodec.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <climits>
+#include <cmath>
+#include <cstring>
+
+#include "GraphicsAccessories.hpp"
+#include "ThreadPool.hpp"
+#include "DebugUtilities.hpp"
+#include "Intrinsics.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+enum BC_FAMILY : Uint8
+{
+    BC_FAMILY_UNKNOWN = 0,
+    BC_FAMILY_BC1,
+    BC_FAMILY_BC2,
+    BC_FAMILY_BC3,
+    BC_FAMILY_BC4,
+    BC_FAMILY_BC5,
+    BC_FAMILY_BC7
+};
+
+struct BCFormatInfo
+{
+    BC_FAMILY Family    = BC_FAMILY_UNKNOWN;
+    bool      Signed    = false;
+    Uint32    BlockSize = 0; // Compressed block size, in bytes
+    Uint32    TexelSize = 0; // Uncompressed texel size, in bytes
+};
+
+BCFormatInfo GetBCFormatInfo(TEXTURE_FORMAT Format)
+{
+    switch (Format)
+    {
+        case TEX_FORMAT_BC1_TYPELESS:
+        case TEX_FORMAT_BC1_UNORM:
+        case TEX_FORMAT_BC1_UNORM_SRGB:
+            return {BC_FAMILY_BC1, false, 8, 4};
+
+        case TEX_FORMAT_BC2_TYPELESS:
+        case TEX_FORMAT_BC2_UNORM:
+        case TEX_FORMAT_BC2_UNORM_SRGB:
+            return {BC_FAMILY_BC2, false, 16, 4};
+
+        case TEX_FORMAT_BC3_TYPELESS:
+        case TEX_FORMAT_BC3_UNORM:
+        case TEX_FORMAT_BC3_UNORM_SRGB:
+            return {BC_FAMILY_BC3, false, 16, 4};
+
+        case TEX_FORMAT_BC4_TYPELESS:
+        case TEX_FORMAT_BC4_UNORM:
+            return {BC_FAMILY_BC4, false, 8, 1};
+        case TEX_FORMAT_BC4_SNORM:
+            return {BC_FAMILY_BC4, true, 8, 1};
+
+        case TEX_FORMAT_BC5_TYPELESS:
+        case TEX_FORMAT_BC5_UNORM:
+            return {BC_FAMILY_BC5, false, 16, 2};
+        case TEX_FORMAT_BC5_SNORM:
+            return {BC_FAMILY_BC5, true, 16, 2};
+
+        case TEX_FORMAT_BC7_TYPELESS:
+        case TEX_FORMAT_BC7_UNORM:
+        case TEX_FORMAT_BC7_UNORM_SRGB:
+            return {BC_FAMILY_BC7, false, 16, 4};
+
+        default:
+            return {};
+    }
+}
+
+inline int RoundDiv(int Num, int Den)
+{
+    return Num >= 0 ? (Num + Den / 2) / Den : -((-Num + Den / 2) / Den);
+}
+
+inline Uint32 RoundToUint(float Val, Uint32 MaxVal)
+{
+    return static_cast<Uint32>(std::min(std::max(Val + 0.5f, 0.f), static_cast<float>(MaxVal)));
+}
+
+
+// Copies the block texels to a contiguous array. The texels outside of the texture
+// are replaced with the nearest texels of the last row and column.
+void LoadBlock(const Uint8* pSrc, size_t Stride, Uint32 TexelSize, Uint32 Width, Uint32 Height, Uint32 BlockX, Uint32 BlockY, Uint8* pTexels)
+{
+    for (Uint32 y = 0; y < 4; ++y)
+    {
+        const Uint8* pRow = pSrc + size_t{std::min(BlockY * 4 + y, Height - 1)} * Stride;
+        for (Uint32 x = 0; x < 4; ++x)
+        {
+            const Uint32 Col = std::min(BlockX * 4 + x, Width - 1);
+            memcpy(pTexels + (y * 4 + x) * TexelSize, pRow + size_t{Col} * TexelSize, TexelSize);
+        }
+    }
+}
+
+// Copies the block texels that are inside the texture to the destination
+void StoreBlock(const Uint8* pTexels, Uint32 TexelSize, Uint32 Width, Uint32 Height, Uint32 BlockX, Uint32 BlockY, Uint8* pDst, size_t Stride)
+{
+    const Uint32 NumCols = std::min(Width - BlockX * 4, 4u);
+    const Uint32 NumRows = std::min(Height - BlockY * 4, 4u);
+    for (Uint32 y = 0; y < NumRows; ++y)
+    {
+        memcpy(pDst + size_t{BlockY * 4 + y} * Stride + size_t{BlockX} * 4 * TexelSize, pTexels + y * 4 * TexelSize, NumCols * TexelSize);
+    }
+}
+
+
+// Block texels converted to floats
+struct alignas(16) BlockTexels
+{
+    float Texels[16][4];
+};
+
+// Palette in the structure-of-arrays layout. The number of entries is padded to a multiple
+// of four with entries that are never selected.
+struct alignas(16) PaletteSoA
+{
+    float  Channels[4][16];
+    Uint32 NumEntries = 0;
+
+    void Init(Uint32 _NumEntries)
+    {
+        NumEntries = _NumEntries;
+        for (Uint32 c = 0; c < 4; ++c)
+        {
+            for (Uint32 k = NumEntries; k < 16; ++k)
+                Channels[c][k] = 1e18f;
+        }
+    }
+
+    void SetEntry(Uint32 k, float r, float g, float b, float a)
+    {
+        Channels[0][k] = r;
+        Channels[1][k] = g;
+        Channels[2][k] = b;
+        Channels[3][k] = a;
+    }
+};
+
+// Finds the nearest palette entry for every texel in the list and returns the total
+// weighted squared error. The channel weights are either 0 or 1.
+float FindNearestEntries(const BlockTexels& Block, const Uint8* pTexelIds, Uint32 NumTexels, const PaletteSoA& Palette, const float ChannelWeights[4], Uint8* pIndices)
+{
+    float TotalError = 0;
+
+#if DILIGENT_SSE2_ENABLED
+    const __m128  w[4]    = {_mm_set1_ps(ChannelWeights[0]), _mm_set1_ps(ChannelWeights[1]), _mm_set1_ps(ChannelWeights[2]), _mm_set1_ps(ChannelWeights[3])};
+    const Uint32 NumVecs = (Palette.NumEntries + 3) / 4;
+    for (Uint32 i = 0; i < NumTexels; ++i)
+    {
+        const float* t = Block.Texels[pTexelIds[i]];
+
+        const __m128 tr = _mm_set1_ps(t[0]);
+        const __m128 tg = _mm_set1_ps(t[1]);
+        const __m128 tb = _mm_set1_ps(t[2]);
+        const __m128 ta = _mm_set1_ps(t[3]);
+
+        __m128  BestDist = _mm_set1_ps(FLT_MAX);
+        __m128i BestIdx  = _mm_setzero_si128();
+        __m128i Idx      = _mm_setr_epi32(0, 1, 2, 3);
+        for (Uint32 v = 0; v < NumVecs; ++v)
+        {
+            const __m128 dr   = _mm_sub_ps(_mm_load_ps(Palette.Channels[0] + v * 4), tr);
+            const __m128 dg   = _mm_sub_ps(_mm_load_ps(Palette.Channels[1] + v * 4), tg);
+            const __m128 db   = _mm_sub_ps(_mm_load_ps(Palette.Channels[2] + v * 4), tb);
+            const __m128 da   = _mm_sub_ps(_mm_load_ps(Palette.Channels[3] + v * 4), ta);
+            const __m128 Dist = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(dr, dr), w[0]), _mm_mul_ps(_mm_mul_ps(dg, dg), w[1])),
+                                                      _mm_mul_ps(_mm_mul_ps(db, db), w[2])),
+                                           _mm_mul_ps(_mm_mul_ps(da, da), w[3]));
+
+            const __m128 Less = _mm_cmplt_ps(Dist, BestDist);
+            BestDist          = _mm_or_ps(_mm_and_ps(Less, Dist), _mm_andnot_ps(Less, BestDist));
+            BestIdx           = _mm_or_si128(_mm_and_si128(_mm_castps_si128(Less), Idx), _mm_andnot_si128(_mm_castps_si128(Less), BestIdx));
+            Idx               = _mm_add_epi32(Idx, _mm_set1_epi32(4));
+        }
+
+        alignas(16) float  Dists[4];
+        alignas(16) Uint32 Indices[4];
+        _mm_store_ps(Dists, BestDist);
+        _mm_store_si128(reinterpret_cast<__m128i*>(Indices), BestIdx);
+        Uint32 Best = 0;
+        for (Uint32 l = 1; l < 4; ++l)
+        {
+            if (Dists[l] < Dists[Best] || (Dists[l] == Dists[Best] && Indices[l] < Indices[Best]))
+                Best = l;
+        }
+        pIndices[pTexelIds[i]] = static_cast<Uint8>(Indices[Best]);
+        TotalError += Dists[Best];
+    }
+#elif DILIGENT_NEON_ENABLED
+    const float32x4_t w[4]    = {vdupq_n_f32(ChannelWeights[0]), vdupq_n_f32(ChannelWeights[1]), vdupq_n_f32(ChannelWeights[2]), vdupq_n_f32(ChannelWeights[3])};
+    const Uint32      NumVecs = (Palette.NumEntries + 3) / 4;
+    for (Uint32 i = 0; i < NumTexels; ++i)
+    {
+        const float* t = Block.Texels[pTexelIds[i]];
+
+        const float32x4_t tr = vdupq_n_f32(t[0]);
+        const float32x4_t tg = vdupq_n_f32(t[1]);
+        const float32x4_t tb = vdupq_n_f32(t[2]);
+        const float32x4_t ta = vdupq_n_f32(t[3]);
+
+        const Uint32 FirstIdx[4] = {0, 1, 2, 3};
+        float32x4_t  BestDist    = vdupq_n_f32(FLT_MAX);
+        uint32x4_t   BestIdx     = vdupq_n_u32(0);
+        uint32x4_t   Idx         = vld1q_u32(FirstIdx);
+        for (Uint32 v = 0; v < NumVecs; ++v)
+        {
+            const float32x4_t dr   = vsubq_f32(vld1q_f32(Palette.Channels[0] + v * 4), tr);
+            const float32x4_t dg   = vsubq_f32(vld1q_f32(Palette.Channels[1] + v * 4), tg);
+            const float32x4_t db   = vsubq_f32(vld1q_f32(Palette.Channels[2] + v * 4), tb);
+            const float32x4_t da   = vsubq_f32(vld1q_f32(Palette.Channels[3] + v * 4), ta);
+            const float32x4_t Dist = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(vmulq_f32(dr, dr), w[0]), vmulq_f32(vmulq_f32(dg, dg), w[1])),
+                                                         vmulq_f32(vmulq_f32(db, db), w[2])),
+                                               vmulq_f32(vmulq_f32(da, da), w[3]));
+
+            const uint32x4_t Less = vcltq_f32(Dist, BestDist);
+            BestDist              = vbslq_f32(Less, Dist, BestDist);
+            BestIdx               = vbslq_u32(Less, Idx, BestIdx);
+            Idx                   = vaddq_u32(Idx, vdupq_n_u32(4));
+        }
+
+        float  Dists[4];
+        Uint32 Indices[4];
+        vst1q_f32(Dists, BestDist);
+        vst1q_u32(Indices, BestIdx);
+        Uint32 Best = 0;
+        for (Uint32 l = 1; l < 4; ++l)
+        {
+            if (Dists[l] < Dists[Best] || (Dists[l] == Dists[Best] && Indices[l] < Indices[Best]))
+                Best = l;
+        }
+        pIndices[pTexelIds[i]] = static_cast<Uint8>(Indices[Best]);
+        TotalError += Dists[Best];
+    }
+#else
+    for (Uint32 i = 0; i < NumTexels; ++i)
+    {
+        const float* t = Block.Texels[pTexelIds[i]];
+
+        float  BestDist = FLT_MAX;
+        Uint32 BestIdx  = 0;
+        for (Uint32 k = 0; k < Palette.NumEntries; ++k)
+        {
+            const float dr   = Palette.Channels[0][k] - t[0];
+            const float dg   = Palette.Channels[1][k] - t[1];
+            const float db   = Palette.Channels[2][k] - t[2];
+            const float da   = Palette.Channels[3][k] - t[3];
+            const float Dist = ((dr * dr * ChannelWeights[0] + dg * dg * ChannelWeights[1]) + db * db * ChannelWeights[2]) + da * da * ChannelWeights[3];
+            if (Dist < BestDist)
+            {
+                BestDist = Dist;
+                BestIdx  = k;
+            }
+        }
+        pIndices[pTexelIds[i]] = static_cast<Uint8>(BestIdx);
+        TotalError += BestDist;
+    }
+#endif
+
+    return TotalError;
+}
+
+// Finds the principal axis of the texels and returns the endpoints of the segment
+// that contains the projections of all texels onto the axis.
+void FitEndpoints(const BlockTexels& Block, const Uint8* pTexelIds, Uint32 NumTexels, Uint32 NumChannels, float E0[4], float E1[4])
+{
+    float Mean[4] = {};
+    float Min[4]  = {FLT_MAX, FLT_MAX, FLT_MAX, FLT_MAX};
+    float Max[4]  = {-FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX};
+    for (Uint32 i = 0; i < NumTexels; ++i)
+    {
+        const float* t = Block.Texels[pTexelIds[i]];
+        for (Uint32 c = 0; c < NumChannels; ++c)
+        {
+            Mean[c] += t[c];
+            Min[c] = std::min(Min[c], t[c]);
+            Max[c] = std::max(Max[c], t[c]);
+        }
+    }
+    for (Uint32 c = 0; c < NumChannels; ++c)
+        Mean[c] /= static_cast<float>(NumTexels);
+
+    float Cov[4][4] = {};
+    for (Uint32 i = 0; i < NumTexels; ++i)
+    {
+        const float* t = Block.Texels[pTexelIds[i]];
+        for (Uint32 c0 = 0; c0 < NumChannels; ++c0)
+        {
+            for (Uint32 c1 = c0; c1 < NumChannels; ++c1)
+                Cov[c0][c1] += (t[c0] - Mean[c0]) * (t[c1] - Mean[c1]);
+        }
+    }
+    for (Uint32 c0 = 0; c0 < NumChannels; ++c0)
+    {
+        for (Uint32 c1 = 0; c1 < c0; ++c1)
+            Cov[c0][c1] = Cov[c1][c0];
+    }
+
+    // Power iteration starting with the bounding box diagonal. The signs of the diagonal
+    // components are taken from the covariance with the channel that has the largest range.
+    Uint32 MaxRangeChannel = 0;
+    for (Uint32 c = 1; c < NumChannels; ++c)
+    {
+        if (Max[c] - Min[c] > Max[MaxRangeChannel] - Min[MaxRangeChannel])
+            MaxRangeChannel = c;
+    }
+    float Axis[4] = {};
+    for (Uint32 c = 0; c < NumChannels; ++c)
+        Axis[c] = (Cov[MaxRangeChannel][c] < 0 ? -1.f : 1.f) * (Max[c] - Min[c]);
+
+    for (Uint32 Iter = 0; Iter < 6; ++Iter)
+    {
+        float NewAxis[4] = {};
+        float MaxComp    = 0;
+        for (Uint32 c0 = 0; c0 < NumChannels; ++c0)
+        {
+            for (Uint32 c1 = 0; c1 < NumChannels; ++c1)
+                NewAxis[c0] += Cov[c0][c1] * Axis[c1];
+            MaxComp = std::max(MaxComp, std::abs(NewAxis[c0]));
+        }
+        if (MaxComp < 1e-6f)
+            break;
+        for (Uint32 c = 0; c < NumChannels; ++c)
+            Axis[c] = NewAxis[c] / MaxComp;
+    }
+
+    float AxisLenSq = 0;
+    for (Uint32 c = 0; c < NumChannels; ++c)
+        AxisLenSq += Axis[c] * Axis[c];
+
+    float MinT = 0;
+    float MaxT = 0;
+    if (AxisLenSq > 1e-12f)
+    {
+        MinT = FLT_MAX;
+        MaxT = -FLT_MAX;
+        for (Uint32 i = 0; i < NumTexels; ++i)
+        {
+            const float* t = Block.Texels[pTexelIds[i]];
+
+            float T = 0;
+            for (Uint32 c = 0; c < NumChannels; ++c)
+                T += (t[c] - Mean[c]) * Axis[c];
+            T /= AxisLenSq;
+            MinT = std::min(MinT, T);
+            MaxT = std::max(MaxT, T);
+        }
+    }
+
+    for (Uint32 c = 0; c < NumChannels; ++c)
+    {
+        E0[c] = std::min(std::max(Mean[c] + MinT * Axis[c], 0.f), 255.f);
+        E1[c] = std::min(std::max(Mean[c] + MaxT * Axis[c], 0.f), 255.f);
+    }
+}
+
+// Computes the endpoints that minimize the squared error for the given interpolation weights.
+// Returns false if the system is degenerate.
+bool SolveEndpoints(const BlockTexels& Block, const Uint8* pTexelIds, Uint32 NumTexels, const float* pWeights, Uint32 FirstChannel, Uint32 NumChannels, float E0[4], float E1[4])
+{
+    float AA = 0, AB = 0, BB = 0;
+    float AX[4] = {};
+    float BX[4] = {};
+    for (Uint32 i = 0; i < NumTexels; ++i)
+    {
+        const Uint8  Id = pTexelIds[i];
+        const float  b  = pWeights[Id];
+        const float  a  = 1.f - b;
+        const float* t  = Block.Texels[Id];
+
+        AA += a * a;
+        AB += a * b;
+        BB += b * b;
+        for (Uint32 c = FirstChannel; c < FirstChannel + NumChannels; ++c)
+        {
+            AX[c] += a * t[c];
+            BX[c] += b * t[c];
+        }
+    }
+
+    const float Det = AA * BB - AB * AB;
+    if (std::abs(Det) < 1e-6f)
+        return false;
+
+    const float InvDet = 1.f / Det;
+    for (Uint32 c = FirstChannel; c < FirstChannel + NumChannels; ++c)
+    {
+        E0[c] = std::min(std::max((AX[c] * BB - BX[c] * AB) * InvDet, 0.f), 255.f);
+        E1[c] = std::min(std::max((BX[c] * AA - AX[c] * AB) * InvDet, 0.f), 255.f);
+    }
+    return true;
+}
+
+constexpr float RGBWeights[4]   = {1, 1, 1, 0};
+constexpr float RGBAWeights[4]  = {1, 1, 1, 1};
+constexpr float AlphaWeights[4] = {0, 0, 0, 1};
+
+constexpr Uint8 AllTexelIds[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+
+
+// ---------------------------------------------------------------------------------------------
+// BC1 color block
+
+inline Uint32 Expand5(Uint32 v) { return (v << 3u) | (v >> 2u); }
+inline Uint32 Expand6(Uint32 v) { return (v << 2u) | (v >> 4u); }
+
+inline void UnpackRGB565(Uint16 Color, Uint32 RGB[3])
+{
+    RGB[0] = Expand5((Color >> 11u) & 31u);
+    RGB[1] = Expand6((Color >> 5u) & 63u);
+    RGB[2] = Expand5(Color & 31u);
+}
+
+inline Uint16 QuantizeRGB565(const float RGB[3])
+{
+    return static_cast<Uint16>((RoundToUint(RGB[0] * (31.f / 255.f), 31) << 11u) |
+                               (RoundToUint(RGB[1] * (63.f / 255.f), 63) << 5u) |
+                               RoundToUint(RGB[2] * (31.f / 255.f), 31));
+}
+
+// Computes the palette of the color block. In four-color mode, all entries are opaque.
+// In three-color mode, the last entry is transparent black.
+void GetBC1Palette(Uint16 Color0, Uint16 Color1, bool FourColorMode, Uint8 Palette[4][4])
+{
+    Uint32 P0[3], P1[3];
+    UnpackRGB565(Color0, P0);
+    UnpackRGB565(Color1, P1);
+    for (Uint32 c = 0; c < 3; ++c)
+    {
+        Palette[0][c] = static_cast<Uint8>(P0[c]);
+        Palette[1][c] = static_cast<Uint8>(P1[c]);
+        if (FourColorMode)
+        {
+            Palette[2][c] = static_cast<Uint8>((2 * P0[c] + P1[c] + 1) / 3);
+            Palette[3][c] = static_cast<Uint8>((P0[c] + 2 * P1[c] + 1) / 3);
+        }
+        else
+        {
+            Palette[2][c] = static_cast<Uint8>((P0[c] + P1[c] + 1) / 2);
+            Palette[3][c] = 0;
+        }
+    }
+    Palette[0][3] = Palette[1][3] = Palette[2][3] = 255;
+    Palette[3][3] = FourColorMode ? 255 : 0;
+}
+
+// BC2 and BC3 color blocks are always decoded in four-color mode
+void DecodeBC1ColorBlock(const Uint8* pBlock, bool AlwaysFourColors, Uint8 Texels[16][4])
+{
+    const Uint16 Color0  = static_cast<Uint16>(pBlock[0] | (pBlock[1] << 8u));
+    const Uint16 Color1  = static_cast<Uint16>(pBlock[2] | (pBlock[3] << 8u));
+    const Uint32 Indices = Uint32{pBlock[4]} | (Uint32{pBlock[5]} << 8u) | (Uint32{pBlock[6]} << 16u) | (Uint32{pBlock[7]} << 24u);
+
+    Uint8 Palette[4][4];
+    GetBC1Palette(Color0, Color1, AlwaysFourColors || Color0 > Color1, Palette);
+    for (Uint32 i = 0; i < 16; ++i)
+        memcpy(Texels[i], Palette[(Indices >> (i * 2)) & 3u], 4);
+}
+
+// Endpoints of the four-color mode block whose third palette entry matches the value best.
+struct BC1SingleColorEntry
+{
+    Uint8 Hi;
+    Uint8 Lo;
+};
+
+struct BC1SingleColorTables
+{
+    std::array<BC1SingleColorEntry, 256> Table5;
+    std::array<BC1SingleColorEntry, 256> Table6;
+
+    BC1SingleColorTables()
+    {
+        InitTable(Table5, 5);
+        InitTable(Table6, 6);
+    }
+
+    static void InitTable(std::array<BC1SingleColorEntry, 256>& Table, Uint32 NumBits)
+    {
+        const Uint32 MaxVal = (1u << NumBits) - 1;
+        for (int v = 0; v < 256; ++v)
+        {
+            int Best = INT_MAX;
+            for (Uint32 Hi = 0; Hi <= MaxVal; ++Hi)
+            {
+                for (Uint32 Lo = 0; Lo <= MaxVal; ++Lo)
+                {
+                    const int P0 = static_cast<int>(NumBits == 5 ? Expand5(Hi) : Expand6(Hi));
+                    const int P1 = static_cast<int>(NumBits == 5 ? Expand5(Lo) : Expand6(Lo));
+                    // Prefer close endpoints as decoders may compute the interpolated value differently
+                    const int Err = std::abs((2 * P0 + P1 + 1) / 3 - v) * 256 + std::abs(P0 - P1);
+                    if (Err < Best)
+                    {
+                        Best     = Err;
+                        Table[v] = {static_cast<Uint8>(Hi), static_cast<Uint8>(Lo)};
+                    }
+                }
+            }
+        }
+    }
+};
+
+const BC1SingleColorTables& GetBC1SingleColorTables()
+{
+    static const BC1SingleColorTables Tables;
+    return Tables;
+}
+
+class BC1ColorEncoder
+{
+public:
+    BC1ColorEncoder(const Uint8 Texels[16][4], bool UseAlpha, bool AlwaysFourColors) :
+        m_AlwaysFourColors{AlwaysFourColors}
+    {
+        for (Uint32 i = 0; i < 16; ++i)
+        {
+            for (Uint32 c = 0; c < 4; ++c)
+                m_Block.Texels[i][c] = static_cast<float>(Texels[i][c]);
+
+            if (UseAlpha && Texels[i][3] < 128)
+                m_TransparentMask |= 1u << i;
+            else
+                m_OpaqueIds[m_NumOpaque++] = static_cast<Uint8>(i);
+        }
+    }
+
+    void Encode(BC_COMPRESSION_QUALITY Quality, Uint8* pBlock)
+    {
+        Candidate Best;
+        if (m_NumOpaque == 0)
+        {
+            // All texels are transparent
+            Best.Color0  = 0;
+            Best.Color1  = 0;
+            Best.Indices = ~0u;
+            Best.Error   = 0;
+        }
+        else if (IsSingleColor() && m_TransparentMask == 0)
+        {
+            EncodeSingleColor(Best);
+        }
+        else
+        {
+            // Blocks with transparent texels must use three-color mode
+            const bool FourColorMode = m_TransparentMask == 0;
+
+            float E0[4], E1[4];
+            if (Quality == BC_COMPRESSION_QUALITY_FAST)
+                GetBoundingBoxEndpoints(E0, E1);
+            else
+                FitEndpoints(m_Block, m_OpaqueIds, m_NumOpaque, 3, E0, E1);
+
+            const Uint32 NumRefineIters = Quality == BC_COMPRESSION_QUALITY_FAST ? 0 : (Quality == BC_COMPRESSION_QUALITY_NORMAL ? 1 : 3);
+            EncodeEndpoints(E0, E1, FourColorMode, NumRefineIters, Best);
+
+            // Three-color mode without the transparent entry may be better for some opaque blocks
+            if (Quality == BC_COMPRESSION_QUALITY_HIGH && FourColorMode && !m_AlwaysFourColors && Best.Error > 0)
+                EncodeEndpoints(E0, E1, false, NumRefineIters, Best);
+        }
+
+        WriteBlock(Best, pBlock);
+    }
+
+private:
+    struct Candidate
+    {
+        Uint16 Color0        = 0;
+        Uint16 Color1        = 0;
+        bool   FourColorMode = true;
+        Uint32 Indices       = 0;
+        float  Error         = FLT_MAX;
+    };
+
+    bool IsSingleColor() const
+    {
+        for (Uint32 i = 1; i < m_NumOpaque; ++i)
+        {
+            const float* t0 = m_Block.Texels[m_OpaqueIds[0]];
+            const float* t1 = m_Block.Texels[m_OpaqueIds[i]];
+            if (t0[0] != t1[0] || t0[1] != t1[1] || t0[2] != t1[2])
+                return false;
+        }
+        return true;
+    }
+
+    void EncodeSingleColor(Candidate& Best) const
+    {
+        const BC1SingleColorTables& Tables = GetBC1SingleColorTables();
+
+        const float*               t = m_Block.Texels[m_OpaqueIds[0]];
+        const BC1SingleColorEntry& R = Tables.Table5[static_cast<size_t>(t[0])];
+        const BC1SingleColorEntry& G = Tables.Table6[static_cast<size_t>(t[1])];
+        const BC1SingleColorEntry& B = Tables.Table5[static_cast<size_t>(t[2])];
+
+        Best.Color0        = static_cast<Uint16>((R.Hi << 11u) | (G.Hi << 5u) | B.Hi);
+        Best.Color1        = static_cast<Uint16>((R.Lo << 11u) | (G.Lo << 5u) | B.Lo);
+        Best.FourColorMode = true;
+        Best.Indices       = 0xAAAAAAAAu; // All texels use the third entry
+        Best.Error         = 0;
+    }
+
+    // Returns the bounding box corners along the diagonal that best matches the color distribution
+    void GetBoundingBoxEndpoints(float E0[4], float E1[4]) const
+    {
+        float Min[3]  = {FLT_MAX, FLT_MAX, FLT_MAX};
+        float Max[3]  = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+        float Mean[3] = {};
+        for (Uint32 i = 0; i < m_NumOpaque; ++i)
+        {
+            const float* t = m_Block.Texels[m_OpaqueIds[i]];
+            for (Uint32 c = 0; c < 3; ++c)
+            {
+                Min[c] = std::min(Min[c], t[c]);
+                Max[c] = std::max(Max[c], t[c]);
+                Mean[c] += t[c];
+            }
+        }
+        for (Uint32 c = 0; c < 3; ++c)
+            Mean[c] /= static_cast<float>(m_NumOpaque);
+
+        // Green has the largest weight in the 5:6:5 color, so flip the other channels
+        // if they are negatively correlated with it.
+        float CovRG = 0, CovBG = 0;
+        for (Uint32 i = 0; i < m_NumOpaque; ++i)
+        {
+            const float* t = m_Block.Texels[m_OpaqueIds[i]];
+            CovRG += (t[0] - Mean[0]) * (t[1] - Mean[1]);
+            CovBG += (t[2] - Mean[2]) * (t[1] - Mean[1]);
+        }
+
+        for (Uint32 c = 0; c < 3; ++c)
+        {
+            // Inset the box to reduce the error of the interpolated entries
+            const float Inset = (Max[c] - Min[c]) / 16.f;
+            E0[c]             = Min[c] + Inset;
+            E1[c]             = Max[c] - Inset;
+        }
+        if (CovRG < 0)
+            std::swap(E0[0], E1[0]);
+        if (CovBG < 0)
+            std::swap(E0[2], E1[2]);
+    }
+
+    float Evaluate(Uint16 Color0, Uint16 Color1, bool FourColorMode, Uint8 Indices[16]) const
+    {
+        Uint8 Palette[4][4];
+        GetBC1Palette(Color0, Color1, FourColorMode, Palette);
+
+        PaletteSoA Pal;
+        Pal.Init(FourColorMode ? 4 : 3);
+        for (Uint32 k = 0; k < Pal.NumEntries; ++k)
+            Pal.SetEntry(k, Palette[k][0], Palette[k][1], Palette[k][2], 0);
+
+        // Transparent texels use the last entry
+        for (Uint32 i = 0; i < 16; ++i)
+            Indices[i] = 3;
+        return FindNearestEntries(m_Block, m_OpaqueIds, m_NumOpaque, Pal, RGBWeights, Indices);
+    }
+
+    void EncodeEndpoints(float E0[4], float E1[4], bool FourColorMode, Uint32 NumRefineIters, Candidate& Best) const
+    {
+        // Interpolation weights of the second endpoint for the palette entries
+        static constexpr float FourColorWeights[4]  = {0, 1, 1.f / 3.f, 2.f / 3.f};
+        static constexpr float ThreeColorWeights[4] = {0, 1, 0.5f, 0};
+
+        for (Uint32 Iter = 0;; ++Iter)
+        {
+            const Uint16 Color0 = QuantizeRGB565(E0);
+            const Uint16 Color1 = QuantizeRGB565(E1);
+
+            Uint8       Indices[16];
+            const float Error = Evaluate(Color0, Color1, FourColorMode, Indices);
+            if (Error < Best.Error)
+            {
+                Best.Color0        = Color0;
+                Best.Color1        = Color1;
+                Best.FourColorMode = FourColorMode;
+                Best.Error         = Error;
+                Best.Indices       = 0;
+                for (Uint32 i = 0; i < 16; ++i)
+                    Best.Indices |= Uint32{Indices[i]} << (i * 2);
+            }
+
+            if (Iter == NumRefineIters || Error == 0)
+                break;
+
+            float Weights[16];
+            for (Uint32 i = 0; i < 16; ++i)
+                Weights[i] = (FourColorMode ? FourColorWeights : ThreeColorWeights)[Indices[i]];
+            if (!SolveEndpoints(m_Block, m_OpaqueIds, m_NumOpaque, Weights, 0, 3, E0, E1))
+                break;
+        }
+    }
+
+    void WriteBlock(Candidate Best, Uint8* pBlock) const
+    {
+        if (Best.FourColorMode)
+        {
+            if (Best.Color0 < Best.Color1)
+            {
+                // Swap the endpoints: 0 <-> 1, 2 <-> 3
+                std::swap(Best.Color0, Best.Color1);
+                Best.Indices ^= 0x55555555u;
+            }
+            else if (Best.Color0 == Best.Color1)
+            {
+                // All entries are the same
+                Best.Indices = 0;
+            }
+        }
+        else
+        {
+            if (Best.Color0 > Best.Color1)
+            {
+                // Swap the endpoints: 0 <-> 1, 2 and 3 stay the same
+                std::swap(Best.Color0, Best.Color1);
+                Best.Indices ^= (~Best.Indices >> 1u) & 0x55555555u;
+            }
+        }
+
+        pBlock[0] = static_cast<Uint8>(Best.Color0 & 0xFFu);
+        pBlock[1] = static_cast<Uint8>(Best.Color0 >> 8u);
+        pBlock[2] = static_cast<Uint8>(Best.Color1 & 0xFFu);
+        pBlock[3] = static_cast<Uint8>(Best.Color1 >> 8u);
+        for (Uint32 i = 0; i < 4; ++i)
+            pBlock[4 + i] = static_cast<Uint8>(Best.Indices >> (i * 8u));
+    }
+
+private:
+    const bool  m_AlwaysFourColors;
+    BlockTexels m_Block;
+    Uint8       m_OpaqueIds[16]   = {};
+    Uint32      m_NumOpaque       = 0;
+    Uint32      m_TransparentMask = 0;
+};
+
+void EncodeBC1ColorBlock(const Uint8 Texels[16][4], bool UseAlpha, bool AlwaysFourColors, BC_COMPRESSION_QUALITY Quality, Uint8* pBlock)
+{
+    BC1ColorEncoder{Texels, UseAlpha, AlwaysFourColors}.Encode(Quality, pBlock);
+}
+
+
+// ---------------------------------------------------------------------------------------------
+// BC4 block (also used for BC3 alpha and BC5 channels)
+
+// Computes the palette of the block. The signed values are in [-127, 127] range.
+void GetBC4Palette(int E0, int E1, bool Signed, int Palette[8])
+{
+    Palette[0] = E0;
+    Palette[1] = E1;
+    if (E0 > E1)
+    {
+        for (int i = 1; i <= 6; ++i)
+            Palette[i + 1] = RoundDiv((7 - i) * E0 + i * E1, 7);
+    }
+    else
+    {
+        for (int i = 1; i <= 4; ++i)
+            Palette[i + 1] = RoundDiv((5 - i) * E0 + i * E1, 5);
+        Palette[6] = Signed ? -127 : 0;
+        Palette[7] = Signed ? 127 : 255;
+    }
+}
+
+template <typename ValueType>
+void DecodeBC4Block(const Uint8* pBlock, bool Signed, ValueType* pValues, Uint32 ValueStride)
+{
+    // -128 is decoded as -127
+    const int E0 = Signed ? std::max(static_cast<int>(static_cast<Int8>(pBlock[0])), -127) : pBlock[0];
+    const int E1 = Signed ? std::max(static_cast<int>(static_cast<Int8>(pBlock[1])), -127) : pBlock[1];
+
+    int Palette[8];
+    GetBC4Palette(E0, E1, Signed, Palette);
+
+    Uint64 Indices = 0;
+    for (Uint32 i = 0; i < 6; ++i)
+        Indices |= Uint64{pBlock[2 + i]} << (i * 8u);
+    for (Uint32 i = 0; i < 16; ++i)
+        pValues[i * ValueStride] = static_cast<ValueType>(Palette[(Indices >> (i * 3u)) & 7u]);
+}
+
+class BC4Encoder
+{
+public:
+    BC4Encoder(const int Values[16], bool Signed) :
+        m_Signed{Signed},
+        m_MinVal{Signed ? -127 : 0},
+        m_MaxVal{Signed ? 127 : 255}
+    {
+        for (Uint32 i = 0; i < 16; ++i)
+            m_Values[i] = std::min(std::max(Values[i], m_MinVal), m_MaxVal);
+    }
+
+    void Encode(BC_COMPRESSION_QUALITY Quality, Uint8* pBlock)
+    {
+        int Min = m_Values[0];
+        int Max = m_Values[0];
+        for (Uint32 i = 1; i < 16; ++i)
+        {
+            Min = std::min(Min, m_Values[i]);
+            Max = std::max(Max, m_Values[i]);
+        }
+
+        Candidate Best;
+        if (Min == Max)
+        {
+            // Six-value mode with equal endpoints and zero indices reproduces the value exactly
+            Best.E0 = Best.E1 = Min;
+        }
+        else
+        {
+            Evaluate(Max, Min, Best);
+            if (Quality != BC_COMPRESSION_QUALITY_FAST)
+            {
+                Refine(Best);
+
+                // Six-value mode represents the extreme values exactly and interpolates the rest
+                int InnerMin = m_MaxVal;
+                int InnerMax = m_MinVal;
+                for (Uint32 i = 0; i < 16; ++i)
+                {
+                    if (m_Values[i] != m_MinVal && m_Values[i] != m_MaxVal)
+                    {
+                        InnerMin = std::min(InnerMin, m_Values[i]);
+                        InnerMax = std::max(InnerMax, m_Values[i]);
+                    }
+                }
+                if (InnerMin <= InnerMax && (Min == m_MinVal || Max == m_MaxVal))
+                    Evaluate(InnerMin, InnerMax, Best);
+
+                if (Quality == BC_COMPRESSION_QUALITY_HIGH)
+                {
+                    // Search the neighborhood of the endpoints
+                    constexpr int Radius = 2;
+
+                    const Candidate Center = Best;
+                    for (int d0 = -Radius; d0 <= Radius && Best.Error > 0; ++d0)
+                    {
+                        for (int d1 = -Radius; d1 <= Radius && Best.Error > 0; ++d1)
+                        {
+                            const int E0 = Center.E0 + d0;
+                            const int E1 = Center.E1 + d1;
+                            if (E0 < m_MinVal || E0 > m_MaxVal || E1 < m_MinVal || E1 > m_MaxVal)
+                                continue;
+                            // The search must not switch the mode
+                            if ((E0 > E1) != (Center.E0 > Center.E1))
+                                continue;
+                            Evaluate(E0, E1, Best);
+                        }
+                    }
+                }
+            }
+        }
+
+        pBlock[0] = static_cast<Uint8>(Best.E0);
+        pBlock[1] = static_cast<Uint8>(Best.E1);
+        Uint64 Indices = 0;
+        for (Uint32 i = 0; i < 16; ++i)
+            Indices |= Uint64{Best.Indices[i]} << (i * 3u);
+        for (Uint32 i = 0; i < 6; ++i)
+            pBlock[2 + i] = static_cast<Uint8>(Indices >> (i * 8u));
+    }
+
+private:
+    struct Candidate
+    {
+        int   E0          = 0;
+        int   E1          = 0;
+        Uint8 Indices[16] = {};
+        int   Error       = INT_MAX;
+    };
+
+    void Evaluate(int E0, int E1, Candidate& Best) const
+    {
+        int Palette[8];
+        GetBC4Palette(E0, E1, m_Signed, Palette);
+
+        Candidate Cand;
+        Cand.E0    = E0;
+        Cand.E1    = E1;
+        Cand.Error = 0;
+        for (Uint32 i = 0; i < 16; ++i)
+        {
+            int BestDist = INT_MAX;
+            for (Uint32 k = 0; k < 8; ++k)
+            {
+                const int Dist = std::abs(Palette[k] - m_Values[i]);
+                if (Dist < BestDist)
+                {
+                    BestDist        = Dist;
+                    Cand.Indices[i] = static_cast<Uint8>(k);
+                }
+            }
+            Cand.Error += BestDist * BestDist;
+        }
+
+        if (Cand.Error < Best.Error)
+            Best = Cand;
+    }
+
+    // Refines the eight-value mode endpoints by the least-squares method
+    void Refine(Candidate& Best) const
+    {
+        if (Best.E0 <= Best.E1 || Best.Error == 0)
+            return;
+
+        static constexpr float Weights[8] = {0, 1, 1.f / 7.f, 2.f / 7.f, 3.f / 7.f, 4.f / 7.f, 5.f / 7.f, 6.f / 7.f};
+
+        float AA = 0, AB = 0, BB = 0, AX = 0, BX = 0;
+        for (Uint32 i = 0; i < 16; ++i)
+        {
+            const float b = Weights[Best.Indices[i]];
+            const float a = 1.f - b;
+            AA += a * a;
+            AB += a * b;
+            BB += b * b;
+            AX += a * static_cast<float>(m_Values[i]);
+            BX += b * static_cast<float>(m_Values[i]);
+        }
+        const float Det = AA * BB - AB * AB;
+        if (std::abs(Det) < 1e-6f)
+            return;
+
+        const int E0 = static_cast<int>(std::floor((AX * BB - BX * AB) / Det + 0.5f));
+        const int E1 = static_cast<int>(std::floor((BX * AA - AX * AB) / Det + 0.5f));
+        if (E0 > E1 && E1 >= m_MinVal && E0 <= m_MaxVal)
+            Evaluate(E0, E1, Best);
+    }
+
+private:
+    const bool m_Signed;
+    const int  m_MinVal;
+    const int  m_MaxVal;
+    int        m_Values[16];
+};
+
+// Encodes one channel of the texels
+template <typename ValueType>
+void EncodeBC4Block(const ValueType* pValues, Uint32 ValueStride, bool Signed, BC_COMPRESSION_QUALITY Quality, Uint8* pBlock)
+{
+    int Values[16];
+    for (Uint32 i = 0; i < 16; ++i)
+        Values[i] = static_cast<int>(pValues[i * ValueStride]);
+    BC4Encoder{Values, Signed}.Encode(Quality, pBlock);
+}
+
+
+// ---------------------------------------------------------------------------------------------
+// BC2 explicit alpha block
+
+void DecodeBC2AlphaBlock(const Uint8* pBlock, Uint8 Texels[16][4])
+{
+    for (Uint32 i = 0; i < 16; ++i)
+        Texels[i][3] = static_cast<Uint8>(((pBlock[i / 2] >> ((i & 1u) * 4u)) & 0xFu) * 17u);
+}
+
+void EncodeBC2AlphaBlock(const Uint8 Texels[16][4], Uint8* pBlock)
+{
+    for (Uint32 i = 0; i < 8; ++i)
+    {
+        const Uint32 A0 = (Texels[i * 2 + 0][3] + 8u) / 17u;
+        const Uint32 A1 = (Texels[i * 2 + 1][3] + 8u) / 17u;
+        pBlock[i]       = static_cast<Uint8>(A0 | (A1 << 4u));
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------
+// BC7 block
+
+struct BC7ModeInfo
+{
+    Uint8 NumSubsets;
+    Uint8 PartitionBits;
+    Uint8 RotationBits;
+    Uint8 IndexSelectionBits;
+    Uint8 ColorBits;
+    Uint8 AlphaBits;
+    Uint8 EndpointPBits; // Unique p-bit per endpoint
+    Uint8 SharedPBits;   // Shared p-bit per subset
+    Uint8 IndexBits;
+    Uint8 Index2Bits;
+};
+
+// clang-format off
+constexpr BC7ModeInfo BC7Modes[8] =
+{
+    // Subsets  Partition  Rotation  IdxSel  Color  Alpha  EndpointPB  SharedPB  Index  Index2
+    {  3,       4,         0,        0,      4,     0,     1,          0,        3,     0},
+    {  2,       6,         0,        0,      6,     0,     0,          1,        3,     0},
+    {  3,       6,         0,        0,      5,     0,     0,          0,        2,     0},
+    {  2,       6,         0,        0,      7,     0,     1,          0,        2,     0},
+    {  1,       0,         2,        1,      5,     6,     0,          0,        2,     3},
+    {  1,       0,         2,        0,      7,     8,     0,          0,        2,     2},
+    {  1,       0,         0,        0,      7,     7,     1,          0,        4,     0},
+    {  2,       6,         0,        0,      5,     5,     1,          0,        2,     0},
+};
+
+// Two-subset partitions: bit i is the subset of texel i
+constexpr Uint16 BC7Partitions2[64] =
+{
+    0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80, 0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+    0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE, 0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+    0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A, 0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+    0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C, 0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22,
+};
+
+// Three-subset partitions
+constexpr Uint8 BC7Partitions3[64][16] =
+{
+    {0,0,1,1,0,0,1,1,0,2,2,1,2,2,2,2}, {0,0,0,1,0,0,1,1,2,2,1,1,2,2,2,1}, {0,0,0,0,2,0,0,1,2,2,1,1,2,2,1,1}, {0,2,2,2,0,0,2,2,0,0,1,1,0,1,1,1},
+    {0,0,0,0,0,0,0,0,1,1,2,2,1,1,2,2}, {0,0,1,1,0,0,1,1,0,0,2,2,0,0,2,2}, {0,0,2,2,0,0,2,2,1,1,1,1,1,1,1,1}, {0,0,1,1,0,0,1,1,2,2,1,1,2,2,1,1},
+    {0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2}, {0,0,0,0,1,1,1,1,1,1,1,1,2,2,2,2}, {0,0,0,0,1,1,1,1,2,2,2,2,2,2,2,2}, {0,0,1,2,0,0,1,2,0,0,1,2,0,0,1,2},
+    {0,1,1,2,0,1,1,2,0,1,1,2,0,1,1,2}, {0,1,2,2,0,1,2,2,0,1,2,2,0,1,2,2}, {0,0,1,1,0,1,1,2,1,1,2,2,1,2,2,2}, {0,0,1,1,2,0,0,1,2,2,0,0,2,2,2,0},
+    {0,0,0,1,0,0,1,1,0,1,1,2,1,1,2,2}, {0,1,1,1,0,0,1,1,2,0,0,1,2,2,0,0}, {0,0,0,0,1,1,2,2,1,1,2,2,1,1,2,2}, {0,0,2,2,0,0,2,2,0,0,2,2,1,1,1,1},
+    {0,1,1,1,0,1,1,1,0,2,2,2,0,2,2,2}, {0,0,0,1,0,0,0,1,2,2,2,1,2,2,2,1}, {0,0,0,0,0,0,1,1,0,1,2,2,0,1,2,2}, {0,0,0,0,1,1,0,0,2,2,1,0,2,2,1,0},
+    {0,1,2,2,0,1,2,2,0,0,1,1,0,0,0,0}, {0,0,1,2,0,0,1,2,1,1,2,2,2,2,2,2}, {0,1,1,0,1,2,2,1,1,2,2,1,0,1,1,0}, {0,0,0,0,0,1,1,0,1,2,2,1,1,2,2,1},
+    {0,0,2,2,1,1,0,2,1,1,0,2,0,0,2,2}, {0,1,1,0,0,1,1,0,2,0,0,2,2,2,2,2}, {0,0,1,1,0,1,2,2,0,1,2,2,0,0,1,1}, {0,0,0,0,2,0,0,0,2,2,1,1,2,2,2,1},
+    {0,0,0,0,0,0,0,2,1,1,2,2,1,2,2,2}, {0,2,2,2,0,0,2,2,0,0,1,2,0,0,1,1}, {0,0,1,1,0,0,1,2,0,0,2,2,0,2,2,2}, {0,1,2,0,0,1,2,0,0,1,2,0,0,1,2,0},
+    {0,0,0,0,1,1,1,1,2,2,2,2,0,0,0,0}, {0,1,2,0,1,2,0,1,2,0,1,2,0,1,2,0}, {0,1,2,0,2,0,1,2,1,2,0,1,0,1,2,0}, {0,0,1,1,2,2,0,0,1,1,2,2,0,0,1,1},
+    {0,0,1,1,1,1,2,2,2,2,0,0,0,0,1,1}, {0,1,0,1,0,1,0,1,2,2,2,2,2,2,2,2}, {0,0,0,0,0,0,0,0,2,1,2,1,2,1,2,1}, {0,0,2,2,1,1,2,2,0,0,2,2,1,1,2,2},
+    {0,0,2,2,0,0,1,1,0,0,2,2,0,0,1,1}, {0,2,2,0,1,2,2,1,0,2,2,0,1,2,2,1}, {0,1,0,1,2,2,2,2,2,2,2,2,0,1,0,1}, {0,0,0,0,2,1,2,1,2,1,2,1,2,1,2,1},
+    {0,1,0,1,0,1,0,1,0,1,0,1,2,2,2,2}, {0,2,2,2,0,1,1,1,0,2,2,2,0,1,1,1}, {0,0,0,2,1,1,1,2,0,0,0,2,1,1,1,2}, {0,0,0,0,2,1,1,2,2,1,1,2,2,1,1,2},
+    {0,2,2,2,0,1,1,1,0,1,1,1,0,2,2,2}, {0,0,0,2,1,1,1,2,1,1,1,2,0,0,0,2}, {0,1,1,0,0,1,1,0,0,1,1,0,2,2,2,2}, {0,0,0,0,0,0,0,0,2,1,1,2,2,1,1,2},
+    {0,1,1,0,0,1,1,0,2,2,2,2,2,2,2,2}, {0,0,2,2,0,0,1,1,0,0,1,1,0,0,2,2}, {0,0,2,2,1,1,2,2,1,1,2,2,0,0,2,2}, {0,0,0,0,0,0,0,0,0,0,0,0,2,1,1,2},
+    {0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,1}, {0,2,2,2,1,2,2,2,0,2,2,2,1,2,2,2}, {0,1,0,1,2,2,2,2,2,2,2,2,2,2,2,2}, {0,1,1,1,2,0,1,1,2,2,0,1,2,2,2,0},
+};
+
+// Anchor texel of the second subset in two-subset partitions
+constexpr Uint8 BC7Anchors2[64] =
+{
+    15,15,15,15,15,15,15,15, 15,15,15,15,15,15,15,15,
+    15, 2, 8, 2, 2, 8, 8,15,  2, 8, 2, 2, 8, 8, 2, 2,
+    15,15, 6, 8, 2, 8,15,15,  2, 8, 2, 2, 2,15,15, 6,
+     6, 2, 6, 8,15,15, 2, 2, 15,15,15,15,15, 2, 2,15,
+};
+
+// Anchor texels of the second and third subsets in three-subset partitions
+constexpr Uint8 BC7Anchors3[2][64] =
+{
+    {
+         3, 3,15,15, 8, 3,15,15,  8, 8, 6, 6, 6, 5, 3, 3,
+         3, 3, 8,15, 3, 3, 6,10,  5, 8, 8, 6, 8, 5,15,15,
+         8,15, 3, 5, 6,10, 8,15, 15, 3,15, 5,15,15,15,15,
+         3,15, 5, 5, 5, 8, 5,10,  5,10, 8,13,15,12, 3, 3,
+    },
+    {
+        15, 8, 8, 3,15,15, 3, 8, 15,15,15,15,15,15,15, 8,
+        15, 8,15, 3,15, 8,15, 8,  3,15, 6,10,15,15,10, 8,
+        15, 3,15,10,10, 8, 9,10,  6,15, 8,15, 3, 6, 6, 8,
+        15, 3,15,15,15,15,15,15, 15,15,15,15, 3,15,15, 8,
+    },
+};
+
+constexpr Uint8 BC7Weights2[4]  = {0, 21, 43, 64};
+constexpr Uint8 BC7Weights3[8]  = {0, 9, 18, 27, 37, 46, 55, 64};
+constexpr Uint8 BC7Weights4[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+// clang-format on
+
+inline const Uint8* GetBC7Weights(Uint32 IndexBits)
+{
+    return IndexBits == 2 ? BC7Weights2 : (IndexBits == 3 ? BC7Weights3 : BC7Weights4);
+}
+
+inline Uint32 GetBC7Subset(Uint32 NumSubsets, Uint32 Partition, Uint32 Texel)
+{
+    return NumSubsets == 1 ? 0 : (NumSubsets == 2 ? (BC7Partitions2[Partition] >> Texel) & 1u : BC7Partitions3[Partition][Texel]);
+}
+
+inline Uint32 GetBC7AnchorTexel(Uint32 NumSubsets, Uint32 Partition, Uint32 Subset)
+{
+    return Subset == 0 ? 0 : (NumSubsets == 2 ? BC7Anchors2[Partition] : BC7Anchors3[Subset - 1][Partition]);
+}
+
+inline bool IsBC7AnchorTexel(Uint32 NumSubsets, Uint32 Partition, Uint32 Texel)
+{
+    for (Uint32 s = 0; s < NumSubsets; ++s)
+    {
+        if (GetBC7AnchorTexel(NumSubsets, Partition, s) == Texel)
+            return true;
+    }
+    return false;
+}
+
+inline Uint32 InterpolateBC7(Uint32 E0, Uint32 E1, Uint32 Weight)
+{
+    return ((64 - Weight) * E0 + Weight * E1 + 32) >> 6u;
+}
+
+// Expands the value with the given number of bits to 8 bits
+inline Uint32 UnquantizeBC7(Uint32 Value, Uint32 NumBits)
+{
+    Value <<= 8u - NumBits;
+    return Value | (Value >> NumBits);
+}
+
+class BC7BitReader
+{
+public:
+    explicit BC7BitReader(const Uint8* pBlock)
+    {
+        memcpy(&m_Lo, pBlock, 8);
+        memcpy(&m_Hi, pBlock + 8, 8);
+    }
+
+    Uint32 Read(Uint32 NumBits)
+    {
+        Uint64 Bits = 0;
+        if (m_Pos >= 64)
+        {
+            Bits = m_Hi >> (m_Pos - 64);
+        }
+        else
+        {
+            Bits = m_Lo >> m_Pos;
+            if (m_Pos + NumBits > 64)
+                Bits |= m_Hi << (64 - m_Pos);
+        }
+        m_Pos += NumBits;
+        return static_cast<Uint32>(Bits & ((Uint64{1} << NumBits) - 1));
+    }
+
+private:
+    Uint64 m_Lo  = 0;
+    Uint64 m_Hi  = 0;
+    Uint32 m_Pos = 0;
+};
+
+class BC7BitWriter
+{
+public:
+    void Write(Uint32 Value, Uint32 NumBits)
+    {
+        VERIFY_EXPR(m_Pos + NumBits <= 128 && (Value >> NumBits) == 0);
+        const Uint64 Bits = Value;
+        if (m_Pos >= 64)
+        {
+            m_Hi |= Bits << (m_Pos - 64);
+        }
+        else
+        {
+            m_Lo |= Bits << m_Pos;
+            if (m_Pos + NumBits > 64)
+                m_Hi |= Bits >> (64 - m_Pos);
+        }
+        m_Pos += NumBits;
+    }
+
+    void Flush(Uint8* pBlock) const
+    {
+        VERIFY_EXPR(m_Pos == 128);
+        memcpy(pBlock, &m_Lo, 8);
+        memcpy(pBlock + 8, &m_Hi, 8);
+    }
+
+private:
+    Uint64 m_Lo  = 0;
+    Uint64 m_Hi  = 0;
+    Uint32 m_Pos = 0;
+};
+
+void DecodeBC7Block(const Uint8* pBlock, Uint8 Texels[16][4])
+{
+    BC7BitReader Reader{pBlock};
+
+    Uint32 Mode = 0;
+    while (Mode < 8 && Reader.Read(1) == 0)
+        ++Mode;
+    if (Mode == 8)
+    {
+        // Reserved mode: the block is decoded as transparent black
+        memset(Texels, 0, 16 * 4);
+        return;
+    }
+
+    const BC7ModeInfo& Info = BC7Modes[Mode];
+
+    const Uint32 Partition      = Reader.Read(Info.PartitionBits);
+    const Uint32 Rotation       = Reader.Read(Info.RotationBits);
+    const Uint32 IndexSelection = Reader.Read(Info.IndexSelectionBits);
+
+    const Uint32 NumEndpoints = Info.NumSubsets * 2u;
+
+    Uint32 Endpoints[6][4] = {};
+    for (Uint32 c = 0; c < 3; ++c)
+    {
+        for (Uint32 e = 0; e < NumEndpoints; ++e)
+            Endpoints[e][c] = Reader.Read(Info.ColorBits);
+    }
+    for (Uint32 e = 0; e < NumEndpoints && Info.AlphaBits > 0; ++e)
+        Endpoints[e][3] = Reader.Read(Info.AlphaBits);
+
+    Uint32 ColorBits = Info.ColorBits;
+    Uint32 AlphaBits = Info.AlphaBits;
+    if (Info.EndpointPBits || Info.SharedPBits)
+    {
+        for (Uint32 e = 0; e < NumEndpoints; ++e)
+        {
+            if (Info.EndpointPBits || (e & 1u) == 0)
+            {
+                const Uint32 PBit = Reader.Read(1);
+                for (Uint32 e1 = e; e1 < (Info.EndpointPBits ? e + 1 : e + 2); ++e1)
+                {
+                    for (Uint32 c = 0; c < 4; ++c)
+                        Endpoints[e1][c] = (Endpoints[e1][c] << 1u) | PBit;
+                }
+            }
+        }
+        ++ColorBits;
+        if (AlphaBits > 0)
+            ++AlphaBits;
+    }
+
+    for (Uint32 e = 0; e < NumEndpoints; ++e)
+    {
+        for (Uint32 c = 0; c < 3; ++c)
+            Endpoints[e][c] = UnquantizeBC7(Endpoints[e][c], ColorBits);
+        Endpoints[e][3] = AlphaBits > 0 ? UnquantizeBC7(Endpoints[e][3], AlphaBits) : 255;
+    }
+
+    Uint32 Indices[16];
+    Uint32 Indices2[16] = {};
+    for (Uint32 i = 0; i < 16; ++i)
+        Indices[i] = Reader.Read(Info.IndexBits - (IsBC7AnchorTexel(Info.NumSubsets, Partition, i) ? 1 : 0));
+    for (Uint32 i = 0; i < 16 && Info.Index2Bits > 0; ++i)
+        Indices2[i] = Reader.Read(Info.Index2Bits - (i == 0 ? 1 : 0));
+
+    const Uint8* ColorWeights = GetBC7Weights(Info.Index2Bits > 0 && IndexSelection ? Info.Index2Bits : Info.IndexBits);
+    const Uint8* AlphaWeights = GetBC7Weights(Info.Index2Bits > 0 && !IndexSelection ? Info.Index2Bits : Info.IndexBits);
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const Uint32  Subset = GetBC7Subset(Info.NumSubsets, Partition, i);
+        const Uint32* E0     = Endpoints[Subset * 2 + 0];
+        const Uint32* E1     = Endpoints[Subset * 2 + 1];
+
+        Uint32 ColorIdx = Indices[i];
+        Uint32 AlphaIdx = Indices[i];
+        if (Info.Index2Bits > 0)
+        {
+            if (IndexSelection)
+                ColorIdx = Indices2[i];
+            else
+                AlphaIdx = Indices2[i];
+        }
+
+        for (Uint32 c = 0; c < 3; ++c)
+            Texels[i][c] = static_cast<Uint8>(InterpolateBC7(E0[c], E1[c], ColorWeights[ColorIdx]));
+        Texels[i][3] = static_cast<Uint8>(InterpolateBC7(E0[3], E1[3], AlphaWeights[AlphaIdx]));
+
+        if (Rotation != 0)
+            std::swap(Texels[i][3], Texels[i][Rotation - 1]);
+    }
+}
+
+// Returns the quantized value whose expansion to 8 bits is the closest to the given value
+inline Uint32 QuantizeBC7Channel(float Value, Uint32 NumBits, Uint32 PBit, bool HasPBit)
+{
+    const Uint32 MaxVal  = (1u << NumBits) - 1;
+    const Uint32 Initial = HasPBit ?
+        RoundToUint((Value * static_cast<float>((2u << NumBits) - 1) / 255.f - static_cast<float>(PBit)) * 0.5f, MaxVal) :
+        RoundToUint(Value * static_cast<float>(MaxVal) / 255.f, MaxVal);
+
+    // Bit replication is not exactly linear, so check the neighbors
+    Uint32 Best     = Initial;
+    float  BestDist = FLT_MAX;
+    for (Uint32 q = Initial > 0 ? Initial - 1 : 0; q <= std::min(Initial + 1, MaxVal); ++q)
+    {
+        const float Decoded = static_cast<float>(HasPBit ? UnquantizeBC7((q << 1u) | PBit, NumBits + 1) : UnquantizeBC7(q, NumBits));
+        const float Dist    = std::abs(Decoded - Value);
+        if (Dist < BestDist)
+        {
+            BestDist = Dist;
+            Best     = q;
+        }
+    }
+    return Best;
+}
+
+// Mode 5 endpoints that reproduce every 8-bit value exactly with color index 1
+struct BC7SingleColorTables
+{
+    struct Entry
+    {
+        Uint8 E0;
+        Uint8 E1;
+    };
+    std::array<Entry, 256> Table7;
+
+    BC7SingleColorTables()
+    {
+        for (int v = 0; v < 256; ++v)
+        {
+            int Best = INT_MAX;
+            for (Uint32 E0 = 0; E0 < 128; ++E0)
+            {
+                for (Uint32 E1 = 0; E1 < 128; ++E1)
+                {
+                    const Uint32 P0 = UnquantizeBC7(E0, 7);
+                    const Uint32 P1 = UnquantizeBC7(E1, 7);
+                    // Prefer close endpoints, same as for BC1
+                    const int Err = std::abs(static_cast<int>(InterpolateBC7(P0, P1, BC7Weights2[1])) - v) * 256 + std::abs(static_cast<int>(P0) - static_cast<int>(P1));
+                    if (Err < Best)
+                    {
+                        Best      = Err;
+                        Table7[v] = {static_cast<Uint8>(E0), static_cast<Uint8>(E1)};
+                    }
+                }
+            }
+        }
+    }
+};
+
+const BC7SingleColorTables& GetBC7SingleColorTables()
+{
+    static const BC7SingleColorTables Tables;
+    return Tables;
+}
+
+inline Uint32 DequantizeBC7Channel(Uint32 Value, Uint32 NumBits, Uint32 PBit, bool HasPBit)
+{
+    return HasPBit ? UnquantizeBC7((Value << 1u) | PBit, NumBits + 1) : UnquantizeBC7(Value, NumBits);
+}
+
+// Returns the squared distance of the texels from their principal axis
+float ComputeLineFitError(const BlockTexels& Block, const Uint8* pTexelIds, Uint32 NumTexels, Uint32 NumChannels)
+{
+    float Mean[4] = {};
+    for (Uint32 i = 0; i < NumTexels; ++i)
+    {
+        for (Uint32 c = 0; c < NumChannels; ++c)
+            Mean[c] += Block.Texels[pTexelIds[i]][c];
+    }
+    for (Uint32 c = 0; c < NumChannels; ++c)
+        Mean[c] /= static_cast<float>(NumTexels);
+
+    float Cov[4][4] = {};
+    for (Uint32 i = 0; i < NumTexels; ++i)
+    {
+        const float* t = Block.Texels[pTexelIds[i]];
+        for (Uint32 c0 = 0; c0 < NumChannels; ++c0)
+        {
+            for (Uint32 c1 = c0; c1 < NumChannels; ++c1)
+                Cov[c0][c1] += (t[c0] - Mean[c0]) * (t[c1] - Mean[c1]);
+        }
+    }
+
+    float  Trace      = 0;
+    Uint32 MaxChannel = 0;
+    for (Uint32 c0 = 0; c0 < NumChannels; ++c0)
+    {
+        for (Uint32 c1 = 0; c1 < c0; ++c1)
+            Cov[c0][c1] = Cov[c1][c0];
+        Trace += Cov[c0][c0];
+        if (Cov[c0][c0] > Cov[MaxChannel][MaxChannel])
+            MaxChannel = c0;
+    }
+    if (Trace < 1e-6f)
+        return 0;
+
+    float Axis[4] = {};
+    for (Uint32 c = 0; c < NumChannels; ++c)
+        Axis[c] = Cov[MaxChannel][c];
+
+    float Eigenvalue = 0;
+    for (Uint32 Iter = 0; Iter < 4; ++Iter)
+    {
+        float NewAxis[4] = {};
+        float Dot = 0, LenSq = 0;
+        for (Uint32 c0 = 0; c0 < NumChannels; ++c0)
+        {
+            for (Uint32 c1 = 0; c1 < NumChannels; ++c1)
+                NewAxis[c0] += Cov[c0][c1] * Axis[c1];
+            Dot += NewAxis[c0] * Axis[c0];
+            LenSq += Axis[c0] * Axis[c0];
+        }
+        if (LenSq < 1e-12f)
+            break;
+        // Rayleigh quotient of the current approximation
+        Eigenvalue = Dot / LenSq;
+
+        float MaxComp = 0;
+        for (Uint32 c = 0; c < NumChannels; ++c)
+            MaxComp = std::max(MaxComp, std::abs(NewAxis[c]));
+        if (MaxComp < 1e-12f)
+            break;
+        for (Uint32 c = 0; c < NumChannels; ++c)
+            Axis[c] = NewAxis[c] / MaxComp;
+    }
+
+    return std::max(Trace - Eigenvalue, 0.f);
+}
+
+struct BC7EncodedBlock
+{
+    Uint32 Mode           = 0;
+    Uint32 Partition      = 0;
+    Uint32 Rotation       = 0;
+    Uint32 IndexSelection = 0;
+
+    // Quantized endpoints without p-bits
+    Uint8 Endpoints[6][4] = {};
+    Uint8 PBits[6]        = {};
+
+    // Modes 4 and 5 encode color and alpha indices separately
+    Uint8 ColorIndices[16] = {};
+    Uint8 AlphaIndices[16] = {};
+
+    float Error = FLT_MAX;
+};
+
+void PackBC7Block(const BC7EncodedBlock& Enc, Uint8* pBlock)
+{
+    const BC7ModeInfo& Info = BC7Modes[Enc.Mode];
+
+    const Uint32 NumEndpoints = Info.NumSubsets * 2u;
+
+    BC7BitWriter Writer;
+    Writer.Write(1u << Enc.Mode, Enc.Mode + 1);
+    Writer.Write(Enc.Partition, Info.PartitionBits);
+    Writer.Write(Enc.Rotation, Info.RotationBits);
+    Writer.Write(Enc.IndexSelection, Info.IndexSelectionBits);
+    for (Uint32 c = 0; c < 3; ++c)
+    {
+        for (Uint32 e = 0; e < NumEndpoints; ++e)
+            Writer.Write(Enc.Endpoints[e][c], Info.ColorBits);
+    }
+    for (Uint32 e = 0; e < NumEndpoints && Info.AlphaBits > 0; ++e)
+        Writer.Write(Enc.Endpoints[e][3], Info.AlphaBits);
+    for (Uint32 e = 0; e < NumEndpoints && Info.EndpointPBits; ++e)
+        Writer.Write(Enc.PBits[e], 1);
+    for (Uint32 s = 0; s < Info.NumSubsets && Info.SharedPBits; ++s)
+        Writer.Write(Enc.PBits[s * 2], 1);
+
+    const bool   SwapIndices = Info.Index2Bits > 0 && Enc.IndexSelection != 0;
+    const Uint8* Indices     = SwapIndices ? Enc.AlphaIndices : Enc.ColorIndices;
+    const Uint8* Indices2    = SwapIndices ? Enc.ColorIndices : Enc.AlphaIndices;
+    for (Uint32 i = 0; i < 16; ++i)
+        Writer.Write(Indices[i], Info.IndexBits - (IsBC7AnchorTexel(Info.NumSubsets, Enc.Partition, i) ? 1 : 0));
+    for (Uint32 i = 0; i < 16 && Info.Index2Bits > 0; ++i)
+        Writer.Write(Indices2[i], Info.Index2Bits - (i == 0 ? 1 : 0));
+
+    Writer.Flush(pBlock);
+}
+
+class BC7Encoder
+{
+public:
+    BC7Encoder(const Uint8 Texels[16][4], BC_COMPRESSION_QUALITY Quality) :
+        m_Quality{Quality},
+        m_NumRefineIters{Quality == BC_COMPRESSION_QUALITY_FAST ? 0u : (Quality == BC_COMPRESSION_QUALITY_NORMAL ? 1u : 2u)},
+        m_ExhaustivePBits{Quality == BC_COMPRESSION_QUALITY_HIGH}
+    {
+        for (Uint32 i = 0; i < 16; ++i)
+        {
+            for (Uint32 c = 0; c < 4; ++c)
+                m_Block.Texels[i][c] = static_cast<float>(Texels[i][c]);
+            m_Opaque = m_Opaque && Texels[i][3] == 255;
+        }
+    }
+
+    void Encode(Uint8* pBlock)
+    {
+        if (IsSingleColor())
+        {
+            EncodeSingleColor();
+            PackBC7Block(m_Best, pBlock);
+            return;
+        }
+
+        // Mode 6 encodes all channels of the block with 4-bit indices
+        EncodeMode(6, 0, 0, 0);
+
+        if (m_Quality == BC_COMPRESSION_QUALITY_NORMAL)
+        {
+            if (m_Opaque)
+                EncodePartitionedMode(1, 4);
+            else
+                EncodeMode(5, 0, 0, 0);
+        }
+        else if (m_Quality == BC_COMPRESSION_QUALITY_HIGH)
+        {
+            if (m_Opaque)
+            {
+                EncodePartitionedMode(1, 16);
+                EncodePartitionedMode(3, 16);
+                EncodePartitionedMode(0, 8);
+                EncodePartitionedMode(2, 8);
+            }
+            else
+            {
+                EncodePartitionedMode(7, 16);
+            }
+
+            // Separate color and alpha modes with all channel rotations
+            for (Uint32 Rotation = 0; Rotation < 4; ++Rotation)
+            {
+                EncodeMode(5, 0, Rotation, 0);
+                EncodeMode(4, 0, Rotation, 0);
+                EncodeMode(4, 0, Rotation, 1);
+            }
+        }
+
+        PackBC7Block(m_Best, pBlock);
+    }
+
+private:
+    struct SubsetEncoding
+    {
+        Uint8 E0[4] = {};
+        Uint8 E1[4] = {};
+        Uint8 PBit0 = 0;
+        Uint8 PBit1 = 0;
+        float Error = FLT_MAX;
+    };
+
+    bool IsSingleColor() const
+    {
+        for (Uint32 i = 1; i < 16; ++i)
+        {
+            if (memcmp(m_Block.Texels[i], m_Block.Texels[0], sizeof(m_Block.Texels[0])) != 0)
+                return false;
+        }
+        return true;
+    }
+
+    // Mode 5 reproduces any color exactly: color endpoints are interpolated with index 1
+    // and alpha is stored in full precision.
+    void EncodeSingleColor()
+    {
+        const BC7SingleColorTables& Tables = GetBC7SingleColorTables();
+
+        const float* t = m_Block.Texels[0];
+
+        m_Best      = {};
+        m_Best.Mode = 5;
+        for (Uint32 c = 0; c < 3; ++c)
+        {
+            const BC7SingleColorTables::Entry& Entry = Tables.Table7[static_cast<size_t>(t[c])];
+
+            m_Best.Endpoints[0][c] = Entry.E0;
+            m_Best.Endpoints[1][c] = Entry.E1;
+        }
+        m_Best.Endpoints[0][3] = m_Best.Endpoints[1][3] = static_cast<Uint8>(t[3]);
+        for (Uint32 i = 0; i < 16; ++i)
+            m_Best.ColorIndices[i] = 1;
+        m_Best.Error = 0;
+    }
+
+    // Encodes the channels [FirstChannel, FirstChannel + NumChannels) of the subset texels
+    void EncodeSubset(const BlockTexels& Block,
+                      const Uint8*       pTexelIds,
+                      Uint32             NumTexels,
+                      const BC7ModeInfo& Info,
+                      Uint32             FirstChannel,
+                      Uint32             NumChannels,
+                      Uint32             IndexBits,
+                      const float        ChannelWeights[4],
+                      Uint32             AnchorTexel,
+                      SubsetEncoding&    Enc,
+                      Uint8*             pIndices) const
+    {
+        const bool   HasPBits   = Info.EndpointPBits || Info.SharedPBits;
+        const Uint32 NumEntries = 1u << IndexBits;
+        const Uint8* Weights    = GetBC7Weights(IndexBits);
+        const Uint32 EndChannel = FirstChannel + NumChannels;
+
+        float E0[4] = {};
+        float E1[4] = {};
+        if (NumChannels == 1)
+        {
+            E0[FirstChannel] = 255;
+            for (Uint32 i = 0; i < NumTexels; ++i)
+            {
+                E0[FirstChannel] = std::min(E0[FirstChannel], Block.Texels[pTexelIds[i]][FirstChannel]);
+                E1[FirstChannel] = std::max(E1[FirstChannel], Block.Texels[pTexelIds[i]][FirstChannel]);
+            }
+        }
+        else
+        {
+            VERIFY_EXPR(FirstChannel == 0);
+            FitEndpoints(Block, pTexelIds, NumTexels, NumChannels, E0, E1);
+        }
+
+        auto GetChannelBits = [&Info](Uint32 c) -> Uint32 {
+            return c < 3 ? Info.ColorBits : Info.AlphaBits;
+        };
+        // Returns the squared quantization error of the endpoint
+        auto GetQuantizationError = [&](const float E[4], Uint32 PBit) {
+            float Err = 0;
+            for (Uint32 c = FirstChannel; c < EndChannel; ++c)
+            {
+                const Uint32 Bits = GetChannelBits(c);
+                const float  d    = static_cast<float>(DequantizeBC7Channel(QuantizeBC7Channel(E[c], Bits, PBit, true), Bits, PBit, true)) - E[c];
+                Err += d * d;
+            }
+            return Err;
+        };
+
+        Uint8 Indices[16];
+        for (Uint32 Iter = 0;; ++Iter)
+        {
+            Uint32 PBitCombos[4][2] = {};
+            Uint32 NumCombos        = 1;
+            if (HasPBits)
+            {
+                if (m_ExhaustivePBits)
+                {
+                    if (Info.EndpointPBits)
+                    {
+                        for (Uint32 i = 0; i < 4; ++i)
+                        {
+                            PBitCombos[i][0] = i & 1u;
+                            PBitCombos[i][1] = i >> 1u;
+                        }
+                        NumCombos = 4;
+                    }
+                    else
+                    {
+                        PBitCombos[1][0] = PBitCombos[1][1] = 1;
+                        NumCombos                           = 2;
+                    }
+                }
+                else if (Info.EndpointPBits)
+                {
+                    PBitCombos[0][0] = GetQuantizationError(E0, 1) < GetQuantizationError(E0, 0) ? 1 : 0;
+                    PBitCombos[0][1] = GetQuantizationError(E1, 1) < GetQuantizationError(E1, 0) ? 1 : 0;
+                }
+                else
+                {
+                    const Uint32 SharedPBit = GetQuantizationError(E0, 1) + GetQuantizationError(E1, 1) < GetQuantizationError(E0, 0) + GetQuantizationError(E1, 0) ? 1 : 0;
+
+                    PBitCombos[0][0] = PBitCombos[0][1] = SharedPBit;
+                }
+            }
+
+            for (Uint32 Combo = 0; Combo < NumCombos; ++Combo)
+            {
+                const Uint32 PBit0 = PBitCombos[Combo][0];
+                const Uint32 PBit1 = PBitCombos[Combo][1];
+
+                Uint8  Q0[4] = {}, Q1[4] = {};
+                Uint32 D0[4] = {255, 255, 255, 255};
+                Uint32 D1[4] = {255, 255, 255, 255};
+                for (Uint32 c = FirstChannel; c < EndChannel; ++c)
+                {
+                    const Uint32 Bits = GetChannelBits(c);
+
+                    Q0[c] = static_cast<Uint8>(QuantizeBC7Channel(E0[c], Bits, PBit0, HasPBits));
+                    Q1[c] = static_cast<Uint8>(QuantizeBC7Channel(E1[c], Bits, PBit1, HasPBits));
+                    D0[c] = DequantizeBC7Channel(Q0[c], Bits, PBit0, HasPBits);
+                    D1[c] = DequantizeBC7Channel(Q1[c], Bits, PBit1, HasPBits);
+                }
+
+                PaletteSoA Pal;
+                Pal.Init(NumEntries);
+                for (Uint32 k = 0; k < NumEntries; ++k)
+                {
+                    for (Uint32 c = 0; c < 4; ++c)
+                        Pal.Channels[c][k] = static_cast<float>(InterpolateBC7(D0[c], D1[c], Weights[k]));
+                }
+
+                const float Error = FindNearestEntries(Block, pTexelIds, NumTexels, Pal, ChannelWeights, Indices);
+                if (Error < Enc.Error)
+                {
+                    memcpy(Enc.E0, Q0, sizeof(Q0));
+                    memcpy(Enc.E1, Q1, sizeof(Q1));
+                    Enc.PBit0 = static_cast<Uint8>(PBit0);
+                    Enc.PBit1 = static_cast<Uint8>(PBit1);
+                    Enc.Error = Error;
+                    for (Uint32 i = 0; i < NumTexels; ++i)
+                        pIndices[pTexelIds[i]] = Indices[pTexelIds[i]];
+                }
+            }
+
+            if (Iter == m_NumRefineIters || Enc.Error == 0)
+                break;
+
+            float TexelWeights[16];
+            for (Uint32 i = 0; i < NumTexels; ++i)
+                TexelWeights[pTexelIds[i]] = static_cast<float>(Weights[pIndices[pTexelIds[i]]]) / 64.f;
+            if (!SolveEndpoints(Block, pTexelIds, NumTexels, TexelWeights, FirstChannel, NumChannels, E0, E1))
+                break;
+        }
+
+        // The most significant bit of the anchor texel index is not stored and must be zero
+        if (pIndices[AnchorTexel] >= NumEntries / 2)
+        {
+            for (Uint32 c = FirstChannel; c < EndChannel; ++c)
+                std::swap(Enc.E0[c], Enc.E1[c]);
+            std::swap(Enc.PBit0, Enc.PBit1);
+            for (Uint32 i = 0; i < NumTexels; ++i)
+                pIndices[pTexelIds[i]] = static_cast<Uint8>(NumEntries - 1 - pIndices[pTexelIds[i]]);
+        }
+    }
+
+    void EncodeMode(Uint32 Mode, Uint32 Partition, Uint32 Rotation, Uint32 IndexSelection)
+    {
+        if (m_Best.Error == 0)
+            return;
+
+        const BC7ModeInfo& Info = BC7Modes[Mode];
+
+        // Rotation swaps the alpha channel with one of the color channels
+        BlockTexels        RotatedBlock;
+        const BlockTexels* pBlock = &m_Block;
+        if (Rotation != 0)
+        {
+            RotatedBlock = m_Block;
+            for (Uint32 i = 0; i < 16; ++i)
+                std::swap(RotatedBlock.Texels[i][3], RotatedBlock.Texels[i][Rotation - 1]);
+            pBlock = &RotatedBlock;
+        }
+
+        BC7EncodedBlock Enc;
+        Enc.Mode           = Mode;
+        Enc.Partition      = Partition;
+        Enc.Rotation       = Rotation;
+        Enc.IndexSelection = IndexSelection;
+        Enc.Error          = 0;
+
+        Uint8  SubsetTexels[3][16];
+        Uint32 SubsetSizes[3] = {};
+        for (Uint32 i = 0; i < 16; ++i)
+        {
+            const Uint32 Subset = GetBC7Subset(Info.NumSubsets, Partition, i);
+            SubsetTexels[Subset][SubsetSizes[Subset]++] = static_cast<Uint8>(i);
+        }
+
+        if (Info.Index2Bits == 0)
+        {
+            // Modes without alpha decode it as 255 and are only used for opaque blocks
+            const Uint32 NumChannels = Info.AlphaBits > 0 ? 4 : 3;
+            for (Uint32 s = 0; s < Info.NumSubsets; ++s)
+            {
+                SubsetEncoding SubsetEnc;
+                EncodeSubset(*pBlock, SubsetTexels[s], SubsetSizes[s], Info, 0, NumChannels, Info.IndexBits, RGBAWeights,
+                             GetBC7AnchorTexel(Info.NumSubsets, Partition, s), SubsetEnc, Enc.ColorIndices);
+                memcpy(Enc.Endpoints[s * 2 + 0], SubsetEnc.E0, 4);
+                memcpy(Enc.Endpoints[s * 2 + 1], SubsetEnc.E1, 4);
+                Enc.PBits[s * 2 + 0] = SubsetEnc.PBit0;
+                Enc.PBits[s * 2 + 1] = SubsetEnc.PBit1;
+
+                Enc.Error += SubsetEnc.Error;
+                if (Enc.Error >= m_Best.Error)
+                    return;
+            }
+        }
+        else
+        {
+            const Uint32 ColorIndexBits = IndexSelection ? Info.Index2Bits : Info.IndexBits;
+            const Uint32 AlphaIndexBits = IndexSelection ? Info.IndexBits : Info.Index2Bits;
+
+            SubsetEncoding ColorEnc;
+            EncodeSubset(*pBlock, AllTexelIds, 16, Info, 0, 3, ColorIndexBits, RGBWeights, 0, ColorEnc, Enc.ColorIndices);
+            if (ColorEnc.Error >= m_Best.Error)
+                return;
+
+            SubsetEncoding AlphaEnc;
+            EncodeSubset(*pBlock, AllTexelIds, 16, Info, 3, 1, AlphaIndexBits, AlphaWeights, 0, AlphaEnc, Enc.AlphaIndices);
+
+            memcpy(Enc.Endpoints[0], ColorEnc.E0, 3);
+            memcpy(Enc.Endpoints[1], ColorEnc.E1, 3);
+            Enc.Endpoints[0][3] = AlphaEnc.E0[3];
+            Enc.Endpoints[1][3] = AlphaEnc.E1[3];
+            Enc.Error           = ColorEnc.Error + AlphaEnc.Error;
+        }
+
+        if (Enc.Error < m_Best.Error)
+            m_Best = Enc;
+    }
+
+    // Encodes the mode with the partitions whose texels are the best approximated by lines
+    void EncodePartitionedMode(Uint32 Mode, Uint32 MaxPartitions)
+    {
+        if (m_Best.Error == 0)
+            return;
+
+        const BC7ModeInfo& Info          = BC7Modes[Mode];
+        const Uint32       NumPartitions = 1u << Info.PartitionBits;
+        const Uint32       NumChannels   = Info.AlphaBits > 0 ? 4 : 3;
+
+        std::array<std::pair<float, Uint32>, 64> Estimates;
+        for (Uint32 p = 0; p < NumPartitions; ++p)
+        {
+            Uint8  SubsetTexels[3][16];
+            Uint32 SubsetSizes[3] = {};
+            for (Uint32 i = 0; i < 16; ++i)
+            {
+                const Uint32 Subset = GetBC7Subset(Info.NumSubsets, p, i);
+                SubsetTexels[Subset][SubsetSizes[Subset]++] = static_cast<Uint8>(i);
+            }
+
+            float Error = 0;
+            for (Uint32 s = 0; s < Info.NumSubsets; ++s)
+                Error += ComputeLineFitError(m_Block, SubsetTexels[s], SubsetSizes[s], NumChannels);
+            Estimates[p] = {Error, p};
+        }
+
+        MaxPartitions = std::min(MaxPartitions, NumPartitions);
+        std::partial_sort(Estimates.begin(), Estimates.begin() + MaxPartitions, Estimates.begin() + NumPartitions);
+        for (Uint32 i = 0; i < MaxPartitions; ++i)
+            EncodeMode(Mode, Estimates[i].second, 0, 0);
+    }
+
+private:
+    const BC_COMPRESSION_QUALITY m_Quality;
+    const Uint32                 m_NumRefineIters;
+    const bool                   m_ExhaustivePBits;
+
+    BlockTexels     m_Block;
+    bool            m_Opaque = true;
+    BC7EncodedBlock m_Best;
+};
+
+
+// ---------------------------------------------------------------------------------------------
+
+void EncodeBlock(const BCFormatInfo& FmtInfo, const Uint8* pTexels, BC_COMPRESSION_QUALITY Quality, Uint8* pBlock)
+{
+    const Uint8(*Texels)[4] = reinterpret_cast<const Uint8(*)[4]>(pTexels);
+    switch (FmtInfo.Family)
+    {
+        case BC_FAMILY_BC1:
+            EncodeBC1ColorBlock(Texels, true, false, Quality, pBlock);
+            break;
+
+        case BC_FAMILY_BC2:
+            EncodeBC2AlphaBlock(Texels, pBlock);
+            EncodeBC1ColorBlock(Texels, false, true, Quality, pBlock + 8);
+            break;
+
+        case BC_FAMILY_BC3:
+            EncodeBC4Block(pTexels + 3, 4, false, Quality, pBlock);
+            EncodeBC1ColorBlock(Texels, false, true, Quality, pBlock + 8);
+            break;
+
+        case BC_FAMILY_BC4:
+            if (FmtInfo.Signed)
+                EncodeBC4Block(reinterpret_cast<const Int8*>(pTexels), 1, true, Quality, pBlock);
+            else
+                EncodeBC4Block(pTexels, 1, false, Quality, pBlock);
+            break;
+
+        case BC_FAMILY_BC5:
+            if (FmtInfo.Signed)
+            {
+                EncodeBC4Block(reinterpret_cast<const Int8*>(pTexels), 2, true, Quality, pBlock);
+                EncodeBC4Block(reinterpret_cast<const Int8*>(pTexels) + 1, 2, true, Quality, pBlock + 8);
+            }
+            else
+            {
+                EncodeBC4Block(pTexels, 2, false, Quality, pBlock);
+                EncodeBC4Block(pTexels + 1, 2, false, Quality, pBlock + 8);
+            }
+            break;
+
+        case BC_FAMILY_BC7:
+            BC7Encoder{Texels, Quality}.Encode(pBlock);
+            break;
+
+        default:
+            UNEXPECTED("Unexpected block compression format family");
+    }
+}
+
+void DecodeBlock(const BCFormatInfo& FmtInfo, const Uint8* pBlock, Uint8* pTexels)
+{
+    Uint8(*Texels)[4] = reinterpret_cast<Uint8(*)[4]>(pTexels);
+    switch (FmtInfo.Family)
+    {
+        case BC_FAMILY_BC1:
+            DecodeBC1ColorBlock(pBlock, false, Texels);
+            break;
+
+        case BC_FAMILY_BC2:
+            DecodeBC1ColorBlock(pBlock + 8, true, Texels);
+            DecodeBC2AlphaBlock(pBlock, Texels);
+            break;
+
+        case BC_FAMILY_BC3:
+            DecodeBC1ColorBlock(pBlock + 8, true, Texels);
+            DecodeBC4Block(pBlock, false, pTexels + 3, 4);
+            break;
+
+        case BC_FAMILY_BC4:
+            if (FmtInfo.Signed)
+                DecodeBC4Block(pBlock, true, reinterpret_cast<Int8*>(pTexels), 1);
+            else
+                DecodeBC4Block(pBlock, false, pTexels, 1);
+            break;
+
+        case BC_FAMILY_BC5:
+            if (FmtInfo.Signed)
+            {
+                DecodeBC4Block(pBlock, true, reinterpret_cast<Int8*>(pTexels), 2);
+                DecodeBC4Block(pBlock + 8, true, reinterpret_cast<Int8*>(pTexels) + 1, 2);
+            }
+            else
+            {
+                DecodeBC4Block(pBlock, false, pTexels, 2);
+                DecodeBC4Block(pBlock + 8, false, pTexels + 1, 2);
+            }
+            break;
+
+        case BC_FAMILY_BC7:
+            DecodeBC7Block(pBlock, Texels);
+            break;
+
+        default:
+            UNEXPECTED("Unexpected block compression format family");
+    }
+}
+
+} // namespace
+
+
+bool IsBCCodecSupported(TEXTURE_FORMAT Format)
+{
+    return GetBCFormatInfo(Format).Family != BC_FAMILY_UNKNOWN;
+}
+
+bool EncodeBC(const BCEncodeAttribs& Attribs)
+{
+    const BCFormatInfo FmtInfo = GetBCFormatInfo(Attribs.Format);
+    if (FmtInfo.Family == BC_FAMILY_UNKNOWN)
+        return false;
+
+    DEV_CHECK_ERR(Attribs.Width > 0 && Attribs.Height > 0, "Texture size must not be zero");
+    DEV_CHECK_ERR(Attribs.pSrcData != nullptr && Attribs.pDstData != nullptr, "Source and destination data must not be null");
+    DEV_CHECK_ERR(Attribs.SrcStride >= size_t{Attribs.Width} * FmtInfo.TexelSize, "Source stride (", Attribs.SrcStride, ") is too small");
+    DEV_CHECK_ERR(Attribs.DstStride >= size_t{(Attribs.Width + 3) / 4} * FmtInfo.BlockSize, "Destination stride (", Attribs.DstStride, ") is too small");
+    DEV_CHECK_ERR(Attribs.Quality < BC_COMPRESSION_QUALITY_COUNT, "Invalid compression quality");
+
+    const Uint8* pSrc = static_cast<const Uint8*>(Attribs.pSrcData);
+    Uint8*       pDst = static_cast<Uint8*>(Attribs.pDstData);
+
+    const Uint32 NumBlocksX = (Attribs.Width + 3) / 4;
+    const Uint32 NumBlocksY = (Attribs.Height + 3) / 4;
+    ParallelFor(Attribs.pThreadPool, 0, NumBlocksY,
+                [&](Uint32 BlockY) {
+                    Uint8* pDstRow = pDst + size_t{BlockY} * Attribs.DstStride;
+                    for (Uint32 BlockX = 0; BlockX < NumBlocksX; ++BlockX)
+                    {
+                        alignas(16) Uint8 Texels[16 * 4];
+                        LoadBlock(pSrc, Attribs.SrcStride, FmtInfo.TexelSize, Attribs.Width, Attribs.Height, BlockX, BlockY, Texels);
+                        EncodeBlock(FmtInfo, Texels, Attribs.Quality, pDstRow + size_t{BlockX} * FmtInfo.BlockSize);
+                    }
+                });
+
+    return true;
+}
+
+bool DecodeBC(const BCDecodeAttribs& Attribs)
+{
+    const BCFormatInfo FmtInfo = GetBCFormatInfo(Attribs.Format);
+    if (FmtInfo.Family == BC_FAMILY_UNKNOWN)
+        return false;
+
+    DEV_CHECK_ERR(Attribs.Width > 0 && Attribs.Height > 0, "Texture size must not be zero");
+    DEV_CHECK_ERR(Attribs.pSrcData != nullptr && Attribs.pDstData != nullptr, "Source and destination data must not be null");
+    DEV_CHECK_ERR(Attribs.SrcStride >= size_t{(Attribs.Width + 3) / 4} * FmtInfo.BlockSize, "Source stride (", Attribs.SrcStride, ") is too small");
+    DEV_CHECK_ERR(Attribs.DstStride >= size_t{Attribs.Width} * FmtInfo.TexelSize, "Destination stride (", Attribs.DstStride, ") is too small");
+
+    const Uint8* pSrc = static_cast<const Uint8*>(Attribs.pSrcData);
+    Uint8*       pDst = static_cast<Uint8*>(Attribs.pDstData);
+
+    const Uint32 NumBlocksX = (Attribs.Width + 3) / 4;
+    const Uint32 NumBlocksY = (Attribs.Height + 3) / 4;
+    ParallelFor(Attribs.pThreadPool, 0, NumBlocksY,
+                [&](Uint32 BlockY) {
+                    const Uint8* pSrcRow = pSrc + size_t{BlockY} * Attribs.SrcStride;
+                    for (Uint32 BlockX = 0; BlockX < NumBlocksX; ++BlockX)
+                    {
+                        alignas(16) Uint8 Texels[16 * 4];
+                        DecodeBlock(FmtInfo, pSrcRow + size_t{BlockX} * FmtInfo.BlockSize, Texels);
+                        StoreBlock(Texels, FmtInfo.TexelSize, Attribs.Width, Attribs.Height, BlockX, BlockY, pDst, Attribs.DstStride);
+                    }
+                });
+
+    return true;
+}
+
+} // namespace Diligent
@@ -28,6 +28,7 @@
 #include "DynamicAtlasManager.hpp"
 
 #include <climits>
+#include <algorithm>
 
 #include "AdvancedMath.hpp"
 
@@ -110,19 +111,37 @@ void DynamicAtlasManager::Node::MergeChildren()
 }
 
 
-DynamicAtlasManager::DynamicAtlasManager(Uint32 Width, Uint32 Height) :
+DynamicAtlasManager::DynamicAtlasManager(Uint32 Width, Uint32 Height, PackingMode Mode) :
     m_Width{Width},
     m_Height{Height},
+    m_Mode{Mode},
     m_TotalFreeArea{Uint64{Width} * Uint64{Height}}
 {
-    m_Root->R = Region{0, 0, Width, Height};
-    RegisterNode(*m_Root);
+    if (m_Mode == PackingMode::Skyline)
+    {
+        m_Root.reset();
+        ResetSkyline();
+    }
+    else
+    {
+        m_Root->R = Region{0, 0, Width, Height};
+        RegisterNode(*m_Root);
+    }
 }
 
 
 DynamicAtlasManager::~DynamicAtlasManager()
 {
-    if (m_Root)
+    if (m_Mode == PackingMode::Skyline)
+    {
+        // Skyline is empty in a moved-from object
+        if (!m_Skyline.empty())
+        {
+            DEV_CHECK_ERR(m_NumAllocatedRects == 0, "There must be no allocated regions");
+            DEV_CHECK_ERR(m_Skyline.size() == 1 && m_Skyline.front().y == 0 && m_FreeRects.empty(), "The skyline is expected to be flat");
+        }
+    }
+    else if (m_Root)
     {
 #if DILIGENT_DEBUG
         DbgVerifyConsistency();
@@ -184,6 +203,9 @@ void DynamicAtlasManager::UnregisterNode(const Node& N)
 
 DynamicAtlasManager::Region DynamicAtlasManager::Allocate(Uint32 Width, Uint32 Height)
 {
+    if (m_Mode == PackingMode::Skyline)
+        return AllocateSkyline(Width, Height);
+
     auto it_w = m_FreeRegionsByWidth.lower_bound(Region{0, 0, Width, 0});
     while (it_w != m_FreeRegionsByWidth.end() && it_w->first.height < Height)
         ++it_w;
@@ -333,6 +355,13 @@ void DynamicAtlasManager::Free(Region&& R)
     DbgVerifyRegion(R);
 #endif
 
+    if (m_Mode == PackingMode::Skyline)
+    {
+        FreeSkyline(R);
+        R = InvalidRegion;
+        return;
+    }
+
     auto node_it = m_AllocatedRegions.find(R);
     if (node_it == m_AllocatedRegions.end())
     {
@@ -370,6 +399,334 @@ void DynamicAtlasManager::Free(Region&& R)
 }
 
 
+static bool RegionsOverlap(const DynamicAtlasManager::Region& R0, const DynamicAtlasManager::Region& R1)
+{
+    // clang-format off
+    return R0.x < R1.x + R1.width  && R1.x < R0.x + R0.width &&
+           R0.y < R1.y + R1.height && R1.y < R0.y + R0.height;
+    // clang-format on
+}
+
+void DynamicAtlasManager::ResetSkyline()
+{
+    m_Skyline.clear();
+    m_Skyline.emplace_back(0, 0, m_Width);
+    m_FreeRects.clear();
+    m_FreeRectsByWidth.clear();
+    m_FreeRectsByHeight.clear();
+    m_FreeRectsByBottom.clear();
+    m_FreeRectsByTop.clear();
+}
+
+DynamicAtlasManager::Region DynamicAtlasManager::AllocateSkyline(Uint32 Width, Uint32 Height)
+{
+    // Free rectangles below the skyline are always preferred as they do not grow the skyline
+    Region R = AllocateFromFreeRects(Width, Height);
+    if (R.IsEmpty())
+    {
+        // Find the skyline position where the top of the new region is the lowest (bottom-left rule)
+        auto   BestSegment = m_Skyline.end();
+        Uint32 BestTop     = UINT_MAX;
+        Uint32 BestY       = 0;
+        Uint32 BestWidth   = UINT_MAX;
+        for (auto Start = m_Skyline.begin(); Start != m_Skyline.end(); ++Start)
+        {
+            if (Start->x + Width > m_Width)
+                break;
+
+            // The region rests on the highest segment it spans
+            Uint32 y         = Start->y;
+            Uint32 Remaining = Width;
+            for (auto it = Start; Remaining > 0 && y + Height <= m_Height; ++it)
+            {
+                VERIFY_EXPR(it != m_Skyline.end());
+                y = std::max(y, it->y);
+                Remaining -= std::min(Remaining, it->width);
+            }
+            if (y + Height > m_Height)
+                continue;
+
+            if (y + Height < BestTop || (y + Height == BestTop && Start->width < BestWidth))
+            {
+                BestSegment = Start;
+                BestTop     = y + Height;
+                BestY       = y;
+                BestWidth   = Start->width;
+            }
+        }
+
+        if (BestSegment == m_Skyline.end())
+            return Region{};
+
+        R = Region{BestSegment->x, BestY, Width, Height};
+
+        // Space between the region and the segments below it can't be reached from
+        // the skyline anymore and is moved to the free rectangles.
+        //                 ______________
+        //    ______      |              |
+        //   |      |     |      R       |
+        //   |      |_____|______________|
+        //   |      |     |   Free   |   |
+        //   |      |     |__________|   |
+        //   |      |     |          |   |
+        //
+        auto End = BestSegment;
+        for (; End != m_Skyline.end() && End->x < R.x + R.width; ++End)
+        {
+            if (End->y < R.y)
+            {
+                const Uint32 x1 = std::min(End->x + End->width, R.x + R.width);
+                AddFreeRect(Region{End->x, End->y, x1 - End->x, R.y - End->y});
+            }
+        }
+
+        // Replace the covered segments with the top of the new region
+        const SkylineSegment Last = *std::prev(End);
+        m_Skyline.erase(BestSegment, End);
+        auto it = m_Skyline.emplace(End, R.x, R.y + R.height, R.width);
+        if (Last.x + Last.width > R.x + R.width)
+        {
+            // The last segment is partially covered
+            m_Skyline.emplace(End, R.x + R.width, Last.y, Last.x + Last.width - (R.x + R.width));
+        }
+        MergeSkylineSegments(it);
+    }
+
+    VERIFY_EXPR(m_TotalFreeArea >= Uint64{R.width} * Uint64{R.height});
+    m_TotalFreeArea -= Uint64{R.width} * Uint64{R.height};
+    ++m_NumAllocatedRects;
+
+    return R;
+}
+
+void DynamicAtlasManager::MergeSkylineSegments(SkylineType::iterator it)
+{
+    VERIFY_EXPR(it != m_Skyline.end());
+    auto Next = std::next(it);
+    if (Next != m_Skyline.end() && Next->y == it->y)
+    {
+        it->width += Next->width;
+        m_Skyline.erase(Next);
+    }
+    if (it != m_Skyline.begin())
+    {
+        auto Prev = std::prev(it);
+        if (Prev->y == it->y)
+        {
+            Prev->width += it->width;
+            m_Skyline.erase(it);
+        }
+    }
+}
+
+DynamicAtlasManager::Region DynamicAtlasManager::AllocateFromFreeRects(Uint32 Width, Uint32 Height)
+{
+    // Find the smallest-width and the smallest-height rectangles that fit the region,
+    // and use the one with the smaller area, same as the guillotine mode does.
+    auto it_w = m_FreeRectsByWidth.lower_bound(Region{0, 0, Width, 0});
+    while (it_w != m_FreeRectsByWidth.end() && it_w->first.height < Height)
+        ++it_w;
+
+    auto it_h = m_FreeRectsByHeight.lower_bound(Region{0, 0, 0, Height});
+    while (it_h != m_FreeRectsByHeight.end() && it_h->first.width < Width)
+        ++it_h;
+
+    const Uint64 AreaW = it_w != m_FreeRectsByWidth.end() ? Uint64{it_w->first.width} * Uint64{it_w->first.height} : 0;
+    const Uint64 AreaH = it_h != m_FreeRectsByHeight.end() ? Uint64{it_h->first.width} * Uint64{it_h->first.height} : 0;
+    if (AreaW == 0 && AreaH == 0)
+        return Region{};
+
+    const Region F = (AreaH == 0 || (AreaW != 0 && AreaW <= AreaH)) ? it_w->first : it_h->first;
+    VERIFY_EXPR(F.width >= Width && F.height >= Height);
+    RemoveFreeRect(F);
+
+    // Split the remaining space along the shorter leftover axis, so that
+    // the larger of the two new rectangles is as large as possible.
+    //
+    //    ________________          ________________
+    //   |        |       |        |                |
+    //   |   A1   |       |        |       B1       |
+    //   |________|  A0   |        |________________|
+    //   |        |       |        |        |       |
+    //   |   R    |       |        |   R    |  B0   |
+    //   |________|_______|        |________|_______|
+    //
+    const Region R{F.x, F.y, Width, Height};
+    if (F.width - Width > F.height - Height)
+    {
+        if (F.width > Width)
+            InsertFreeRect(Region{F.x + Width, F.y, F.width - Width, F.height}); // A0
+        if (F.height > Height)
+            InsertFreeRect(Region{F.x, F.y + Height, Width, F.height - Height}); // A1
+    }
+    else
+    {
+        if (F.width > Width)
+            InsertFreeRect(Region{F.x + Width, F.y, F.width - Width, Height}); // B0
+        if (F.height > Height)
+            InsertFreeRect(Region{F.x, F.y + Height, F.width, F.height - Height}); // B1
+    }
+
+    return R;
+}
+
+void DynamicAtlasManager::InsertFreeRect(const Region& R)
+{
+    VERIFY_EXPR(!R.IsEmpty());
+    auto it = m_FreeRects.insert(m_FreeRects.end(), R);
+    m_FreeRectsByWidth.emplace(R, it);
+    m_FreeRectsByHeight.emplace(R, it);
+    m_FreeRectsByBottom.emplace(EdgePosition{R.y, R.x}, it);
+    m_FreeRectsByTop.emplace(EdgePosition{R.y + R.height, R.x}, it);
+}
+
+void DynamicAtlasManager::RemoveFreeRect(const Region& R)
+{
+    auto it = m_FreeRectsByWidth.find(R);
+    VERIFY_EXPR(it != m_FreeRectsByWidth.end());
+    m_FreeRects.erase(it->second);
+    m_FreeRectsByWidth.erase(it);
+    m_FreeRectsByHeight.erase(R);
+    m_FreeRectsByBottom.erase(EdgePosition{R.y, R.x});
+    m_FreeRectsByTop.erase(EdgePosition{R.y + R.height, R.x});
+}
+
+void DynamicAtlasManager::AddFreeRect(Region R)
+{
+    // Merge the rectangle with the free rectangles that share an entire edge with it.
+    // Since the rectangles do not overlap, every edge may only be shared with one rectangle.
+    while (true)
+    {
+        Region F;
+
+        // The rectangle to the right starts at the bottom-right corner of R
+        auto it = m_FreeRectsByBottom.lower_bound(EdgePosition{R.y, R.x});
+        if (it != m_FreeRectsByBottom.end() && it->first == EdgePosition{R.y, R.x + R.width} && it->second->height == R.height)
+            F = *it->second;
+
+        // The rectangle to the left is the previous one with the same bottom edge
+        if (F.IsEmpty() && it != m_FreeRectsByBottom.begin())
+        {
+            const Region& Left = *std::prev(it)->second;
+            if (Left.y == R.y && Left.x + Left.width == R.x && Left.height == R.height)
+                F = Left;
+        }
+
+        // The rectangle above starts at the top-left corner of R
+        if (F.IsEmpty())
+        {
+            it = m_FreeRectsByBottom.find(EdgePosition{R.y + R.height, R.x});
+            if (it != m_FreeRectsByBottom.end() && it->second->width == R.width)
+                F = *it->second;
+        }
+
+        // The rectangle below ends at the bottom-left corner of R
+        if (F.IsEmpty())
+        {
+            it = m_FreeRectsByTop.find(EdgePosition{R.y, R.x});
+            if (it != m_FreeRectsByTop.end() && it->second->width == R.width)
+                F = *it->second;
+        }
+
+        if (F.IsEmpty())
+            break;
+
+        RemoveFreeRect(F);
+        if (F.y == R.y)
+        {
+            R.x = std::min(R.x, F.x);
+            R.width += F.width;
+        }
+        else
+        {
+            R.y = std::min(R.y, F.y);
+            R.height += F.height;
+        }
+    }
+
+    InsertFreeRect(R);
+}
+
+bool DynamicAtlasManager::LowerSkyline(const Region& R)
+{
+    // Find the segment that contains the left edge of the region
+    auto it = m_Skyline.begin();
+    while (it != m_Skyline.end() && it->x + it->width <= R.x)
+        ++it;
+    VERIFY_EXPR(it != m_Skyline.end());
+
+    // The skyline can only be lowered if the region is directly below it along its entire width.
+    // Since adjacent segments with the same height are merged, this means that the region is
+    // below a single segment.
+    if (it->y != R.y + R.height || it->x + it->width < R.x + R.width)
+        return false;
+
+    const SkylineSegment Segment = *it;
+
+    *it = SkylineSegment{R.x, R.y, R.width};
+    if (Segment.x + Segment.width > R.x + R.width)
+        m_Skyline.emplace(std::next(it), R.x + R.width, Segment.y, Segment.x + Segment.width - (R.x + R.width));
+    if (Segment.x < R.x)
+        m_Skyline.emplace(it, Segment.x, Segment.y, R.x - Segment.x);
+    MergeSkylineSegments(it);
+
+    return true;
+}
+
+void DynamicAtlasManager::LowerSkylineToFreeRects(const Region& R)
+{
+    // Lowering the skyline may expose free rectangles directly below the lowered part.
+    // Their top edges are at the new skyline level.
+    std::vector<Region> LoweredRegions{R};
+    while (!LoweredRegions.empty())
+    {
+        const Region Lowered = LoweredRegions.back();
+        LoweredRegions.pop_back();
+
+        // Only the rectangle that starts before the lowered region may overlap it from the left
+        auto it = m_FreeRectsByTop.lower_bound(EdgePosition{Lowered.y, Lowered.x});
+        if (it != m_FreeRectsByTop.begin() && std::prev(it)->first.first == Lowered.y)
+            --it;
+        while (it != m_FreeRectsByTop.end() && it->first.first == Lowered.y && it->first.second < Lowered.x + Lowered.width)
+        {
+            const Region F = *it->second;
+            ++it;
+            if (LowerSkyline(F))
+            {
+                RemoveFreeRect(F);
+                LoweredRegions.push_back(F);
+            }
+        }
+    }
+}
+
+void DynamicAtlasManager::FreeSkyline(const Region& R)
+{
+#if DILIGENT_DEBUG
+    for (const Region& FreeRect : m_FreeRects)
+    {
+        VERIFY(!RegionsOverlap(FreeRect, R), "Region [", R.x, ", ", R.x + R.width, ") x [", R.y, ", ", R.y + R.height,
+               ") overlaps free region [", FreeRect.x, ", ", FreeRect.x + FreeRect.width, ") x [", FreeRect.y, ", ", FreeRect.y + FreeRect.height,
+               "). Have you ever allocated it?");
+    }
+#endif
+    VERIFY_EXPR(m_NumAllocatedRects > 0);
+    --m_NumAllocatedRects;
+    m_TotalFreeArea += Uint64{R.width} * Uint64{R.height};
+
+    if (m_NumAllocatedRects == 0)
+    {
+        VERIFY_EXPR(m_TotalFreeArea == Uint64{m_Width} * Uint64{m_Height});
+        ResetSkyline();
+        return;
+    }
+
+    if (LowerSkyline(R))
+        LowerSkylineToFreeRects(R);
+    else
+        AddFreeRect(R);
+}
+
 #if DILIGENT_DEBUG
 
 void DynamicAtlasManager::DbgVerifyRegion(const Region& R) const
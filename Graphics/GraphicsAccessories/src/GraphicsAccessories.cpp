@@ -2680,6 +2680,14 @@ TEXTURE_FORMAT BCFormatToUncompressed(TEXTURE_FORMAT Fmt)
         case TEX_FORMAT_BC5_SNORM:
             return TEX_FORMAT_RG8_SNORM;
 
+        // RGBA 8:8:8:8
+        case TEX_FORMAT_BC7_TYPELESS:
+            return TEX_FORMAT_RGBA8_TYPELESS;
+        case TEX_FORMAT_BC7_UNORM:
+            return TEX_FORMAT_RGBA8_UNORM;
+        case TEX_FORMAT_BC7_UNORM_SRGB:
+            return TEX_FORMAT_RGBA8_UNORM_SRGB;
+
         default:
             return TEX_FORMAT_UNKNOWN;
     }
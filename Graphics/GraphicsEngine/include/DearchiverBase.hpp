@@ -213,11 +213,10 @@ private:
     ArchiveData* FindArchive(ResourceType ResType, const char* ResName);
 
 private:
-    // Resource type and name -> archive index that contains this resource.
-    // Names must be unique for each resource type.
     using NamedResourceKey = DeviceObjectArchive::NamedResourceKey;
-    std::unordered_map<NamedResourceKey, size_t, NamedResourceKey::Hasher> m_ResNameToArchiveIdx;
 
+    // Archives are searched in the order they were loaded.
+    // Names must be unique for each resource type.
     std::vector<ArchiveData> m_Archives;
 };
 
@@ -238,16 +237,11 @@ RefCntAutoPtr<IPipelineResourceSignature> DearchiverBase::UnpackResourceSignatur
     }
 
     // Find the archive that contains this signature
-    auto archive_idx_it = m_ResNameToArchiveIdx.find(NamedResourceKey{PRSData::ArchiveResType, DeArchiveInfo.Name});
-    if (archive_idx_it == m_ResNameToArchiveIdx.end())
+    const ArchiveData* pArchive = FindArchive(PRSData::ArchiveResType, DeArchiveInfo.Name);
+    if (pArchive == nullptr)
         return {};
 
-    const auto& pObjArchive = m_Archives[archive_idx_it->second].pObjArchive;
-    if (!pObjArchive)
-    {
-        UNEXPECTED("Null object archives should never be added to the list. This is a bug.");
-        return {};
-    }
+    const auto& pObjArchive = pArchive->pObjArchive;
 
     PRSData PRS{GetRawAllocator()};
     if (!pObjArchive->LoadResourceCommonData(PRSData::ArchiveResType, DeArchiveInfo.Name, PRS))
@@ -29,6 +29,8 @@
 
 #include "../../GraphicsEngine/interface/Shader.h"
 
+#include "../../../Primitives/interface/DefineRefMacro.h"
+
 DILIGENT_BEGIN_NAMESPACE(Diligent)
 
 
@@ -38,4 +40,76 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 void CreateDefaultShaderSourceStreamFactory(const Char*                       SearchDirectories,
                                             IShaderSourceInputStreamFactory** ppShaderSourceStreamFactory);
 
+
+// clang-format off
+/// Shader source file cache mode, see Diligent::DefaultShaderSourceStreamFactoryCreateInfo.
+DILIGENT_TYPED_ENUM(SHADER_SOURCE_FILE_CACHE_MODE, Uint8)
+{
+    /// The cache is not used: every request looks up the file in the search
+    /// directories and opens a new file stream.
+    SHADER_SOURCE_FILE_CACHE_MODE_NONE = 0,
+
+    /// The resolved file paths and the file contents are cached until they are
+    /// invalidated with InvalidateShaderSourceFileCache(). Requests for the cached files
+    /// do not access the file system.
+    SHADER_SOURCE_FILE_CACHE_MODE_EXPLICIT,
+
+    /// Same as SHADER_SOURCE_FILE_CACHE_MODE_EXPLICIT, but the modification time of
+    /// the file is checked on every request, and the file is reloaded if it has changed.
+    /// Files that were not found are searched again on every request.
+    ///
+    /// \note   New files that shadow the cached ones in the preceding search directories
+    ///         are only found after the cache is invalidated with InvalidateShaderSourceFileCache().
+    SHADER_SOURCE_FILE_CACHE_MODE_MODIFICATION_TIME,
+};
+// clang-format on
+
+/// Default shader source stream factory create info
+struct DefaultShaderSourceStreamFactoryCreateInfo
+{
+    /// Semicolon-separated list of search directories.
+    const Char* SearchDirectories DEFAULT_INITIALIZER(nullptr);
+
+    /// Cache mode, see Diligent::SHADER_SOURCE_FILE_CACHE_MODE.
+    ///
+    /// \remarks    The file contents are kept in a single cache shared by all factories,
+    ///             so that the headers included by different shaders are only loaded once.
+    ///             The size of the cache is bounded, see SetShaderSourceFileCacheMaxSize().
+    SHADER_SOURCE_FILE_CACHE_MODE CacheMode DEFAULT_INITIALIZER(SHADER_SOURCE_FILE_CACHE_MODE_NONE);
+};
+typedef struct DefaultShaderSourceStreamFactoryCreateInfo DefaultShaderSourceStreamFactoryCreateInfo;
+
+/// Creates a default shader source stream factory with the specified attributes
+/// \param [in]  CreateInfo                  - Factory create info, see Diligent::DefaultShaderSourceStreamFactoryCreateInfo.
+/// \param [out] ppShaderSourceStreamFactory - Memory address where the pointer to the shader source stream factory will be written.
+void CreateDefaultShaderSourceStreamFactory2(const DefaultShaderSourceStreamFactoryCreateInfo REF CreateInfo,
+                                             IShaderSourceInputStreamFactory**                    ppShaderSourceStreamFactory);
+
+/// Sets the maximum total size, in bytes, of the file contents kept in the shared shader source file cache.
+/// When the size is exceeded, the least recently used files are evicted. The default size is 64 MB.
+void SetShaderSourceFileCacheMaxSize(size_t MaxSize);
+
+/// Invalidates the shared shader source file cache, e.g. when the shader files are reloaded.
+/// \param [in] FilePath - Path of the file to invalidate, i.e. the search directory followed
+///                        by the file name, or null to invalidate all files.
+///
+/// \remarks    The contents of the invalidated files are removed from the cache.
+///             Any invalidation also resets the resolved file paths in all factories.
+///
+/// \note       The cache does not convert the paths to absolute ones: FilePath must match the path
+///             the file was resolved to exactly, up to redundant separators and '.' and '..' components.
+///             For example, a file found through a relative search directory is not invalidated
+///             by its absolute path.
+void InvalidateShaderSourceFileCache(const Char* FilePath);
+
+/// Returns the generation of the shared shader source file cache. The generation is incremented
+/// every time the cache is invalidated with InvalidateShaderSourceFileCache(), and every time a file
+/// is reloaded because its modification time has changed (see SHADER_SOURCE_FILE_CACHE_MODE_MODIFICATION_TIME).
+///
+/// \remarks   Data derived from the shader source files, such as their content hashes,
+///            can be discarded when the generation changes.
+Uint64 GetShaderSourceFileCacheGeneration();
+
+#include "../../../Primitives/interface/UndefRefMacro.h"
+
 DILIGENT_END_NAMESPACE // namespace Diligent
@@ -32,6 +32,7 @@
 #include <array>
 #include <vector>
 #include <unordered_map>
+#include <mutex>
 
 #include "GraphicsTypes.h"
 #include "FileStream.h"
@@ -44,11 +45,13 @@
 
 // Device object archive structure:
 //
-// | Header |  Resource Data  |  Shader Data  |
+// | Header |  Directory  |  Resource Data  |  Shader Data  |
+//
+//     |  Directory  | = | NumResources | Shader Blocks | Entry1 | Entry2 | ... | EntryN |
 //
 //     |  Resource Data  | = | Res1 | Res2 | ... | ResN |
 //
-//         | ResI | = | Type | Name | Common Data |  OpenGL data | D3D11 data | ...  | Metal-iOS data |
+//         | ResI | = | Name | Common Data |  OpenGL data | D3D11 data | ...  | Metal-iOS data |
 //
 //     |  Shader Data  | =  |  OpenGL shaders | D3D11 shaders | ...  | Metal-iOS shaders |
 //
@@ -57,8 +60,17 @@
 // - Archive version
 // - API version
 
-// Resource data contains an array of resources. Each resource contains:
+// The directory contains the offset and size of the shader block for every device type
+// and an array of resource entries sorted by resource type and name. Each entry contains:
 // - Type (Signature, Graphics Pipeline, Render Pass, etc.)
+// - Offset and length of the resource name
+// - Offset and size of the resource data
+//
+// The directory allows finding any resource with a binary search without reading the rest
+// of the archive. Resource data and device shader blocks are only decoded when they are
+// accessed for the first time.
+//
+// Resource data contains an array of resources. Each resource contains:
 // - Name
 // - Common data (e.g. a resource description)
 // - Device-specific data (e.g. shader indices)
@@ -69,11 +81,11 @@
 // For pipelines, device-specific data is the array of shader indices in the
 // archive's shader array, e.g.:
 //
-// | PsoX | = |   Type   |   Name   |   Common Data   |   OpenGL data   |    D3D11 data   | ...
-//              Graphics   "My PSO"    <Description>        {0, 1}             {1, 2}
-//                                                                  ____________|  |
-//                                                                 |               |
-//                                                                 V               V
+// | PsoX | = |   Name   |   Common Data   |   OpenGL data   |    D3D11 data   | ...
+//              "My PSO"    <Description>        {0, 1}             {1, 2}
+//                                                       ____________|  |
+//                                                      |               |
+//                                                      V               V
 // | GL Shader 0 | GL Shader 1 |  ... | D3D11 Shader 0 | D3D11 Shader 1 | D3D11 Shader 2 | ...
 
 namespace Diligent
@@ -128,7 +140,7 @@ public:
     };
 
     static constexpr Uint32 HeaderMagicNumber = 0xDE00000A;
-    static constexpr Uint32 ArchiveVersion    = 8;
+    static constexpr Uint32 ArchiveVersion    = 9;
 
     struct ArchiveHeader
     {
@@ -253,17 +265,17 @@ public:
                                 const char*      Name,
                                 ReourceDataType& ResData) const
     {
-        auto it = m_NamedResources.find(NamedResourceKey{Type, Name});
-        if (it == m_NamedResources.end())
+        const auto* pRes = FindResource(Type, Name);
+        if (pRes == nullptr)
         {
             LOG_ERROR_MESSAGE("Resource '", Name, "' is not present in the archive");
             return false;
         }
-        VERIFY_EXPR(SafeStrEqual(Name, it->first.GetName()));
+        VERIFY_EXPR(SafeStrEqual(Name, pRes->first.GetName()));
         // Use string copy from the map
-        Name = it->first.GetName();
+        Name = pRes->first.GetName();
 
-        Serializer<SerializerMode::Read> Ser{it->second.Common};
+        Serializer<SerializerMode::Read> Ser{pRes->second.Common};
 
         auto Res = ResData.Deserialize(Name, Ser);
         VERIFY_EXPR(Ser.IsEnded());
@@ -274,20 +286,33 @@ public:
                                                 const char*  Name,
                                                 DeviceType   DevType) const noexcept;
 
+    using NamedResourcesMap = std::unordered_map<NamedResourceKey, ResourceData, NamedResourceKey::Hasher>;
+
+    /// Returns the resource with the given type and name, or null if the resource is not present in the archive.
+    /// The resource data is decoded when the resource is accessed for the first time.
+    const NamedResourcesMap::value_type* FindResource(ResourceType Type, const char* Name) const noexcept;
+
+    /// Returns true if the archive contains the resource with the given type and name.
+    /// The resource data is not decoded.
+    bool HasResource(ResourceType Type, const char* Name) const noexcept;
+
     ResourceData& GetResourceData(ResourceType Type, const char* Name) noexcept
     {
+        LoadAllResources();
         constexpr auto MakeCopy = true;
         return m_NamedResources[NamedResourceKey{Type, Name, MakeCopy}];
     }
 
     auto& GetDeviceShaders(DeviceType Type) noexcept
     {
+        // Make sure that shaders from the archive data are decoded
+        GetDeviceShaderList(Type);
         return m_DeviceShaders[static_cast<size_t>(Type)];
     }
 
-    const auto& GetSerializedShader(DeviceType Type, size_t Idx) const noexcept
+    const SerializedData& GetSerializedShader(DeviceType Type, size_t Idx) const noexcept
     {
-        const auto& DeviceShaders = m_DeviceShaders[static_cast<size_t>(Type)];
+        const auto& DeviceShaders = GetDeviceShaderList(Type);
         if (Idx < DeviceShaders.size())
             return DeviceShaders[Idx];
 
@@ -295,19 +320,55 @@ public:
         return NullData;
     }
 
+    /// Returns all named resources in the archive.
+    /// \note  This method decodes all resources that have not been accessed yet.
     const auto& GetNamedResources() const
     {
+        LoadAllResources();
         return m_NamedResources;
     }
 
     void Clear() noexcept;
 
 private:
-    // Named resources
-    std::unordered_map<NamedResourceKey, ResourceData, NamedResourceKey::Hasher> m_NamedResources;
+    const std::vector<SerializedData>& GetDeviceShaderList(DeviceType Type) const noexcept;
+
+    // Decodes all resources and device shaders that have not been accessed yet.
+    void LoadAllResources() const noexcept;
+
+    struct DirectoryEntry;
+    bool GetDirectoryEntry(Uint32 Idx, DirectoryEntry& Entry) const noexcept;
+    bool FindDirectoryEntry(ResourceType Type, const char* Name, DirectoryEntry& Entry) const noexcept;
+
+    const NamedResourcesMap::value_type* DecodeResource(const DirectoryEntry& Entry) const noexcept;
+
+    bool DecodeDeviceShaders(DeviceType Type) const noexcept;
+
+private:
+    // Named resources. When the archive is loaded from data, resources are
+    // added to the map when they are accessed for the first time.
+    mutable NamedResourcesMap m_NamedResources;
+
+    // Shaders. Device shaders are decoded when they are accessed for the first time.
+    mutable std::array<std::vector<SerializedData>, static_cast<size_t>(DeviceType::Count)> m_DeviceShaders;
+
+    // Sorted resource directory in the archive data.
+    const Uint8* m_pDirectory    = nullptr;
+    Uint32       m_NumDirEntries = 0;
+
+    // Indicates that all directory entries have been decoded into m_NamedResources.
+    mutable bool m_AllResourcesLoaded = true;
+
+    struct DataBlock
+    {
+        Uint32 Offset = 0;
+        Uint32 Size   = 0;
+    };
+    // Device shader blocks that have not been decoded yet.
+    mutable std::array<DataBlock, static_cast<size_t>(DeviceType::Count)> m_PendingShaderBlocks{};
 
-    // Shaders
-    std::array<std::vector<SerializedData>, static_cast<size_t>(DeviceType::Count)> m_DeviceShaders;
+    // Protects lazy decoding of resources and shaders.
+    mutable std::mutex m_LazyLoadMtx;
 
     // Strong reference to the original data blob.
     // Resources will not make copies and reference this data.
@@ -49,6 +49,7 @@
 #include "SRBMemoryAllocator.hpp"
 #include "ShaderResourceCacheCommon.hpp"
 #include "HashUtils.hpp"
+#include "ResourceNameIndex.hpp"
 
 #if defined(_MSC_VER) && defined(FindResource)
 #    error One of Windows headers leaks FindResource macro, which may result in odd errors. You need to undef the macro.
@@ -679,7 +680,8 @@ public:
     /// index in m_Desc.Resources[], or InvalidPipelineResourceIndex if the resource is not found.
     Uint32 FindResource(SHADER_TYPE ShaderStage, const char* ResourceName) const
     {
-        return Diligent::FindResource(this->m_Desc.Resources, this->m_Desc.NumResources, ShaderStage, ResourceName);
+        static_assert(InvalidPipelineResourceIndex == ResourceNameIndex::InvalidIndex, "Invalid index values must match");
+        return m_ResourceNameIndex.Find(this->m_Desc.Resources, this->m_Desc.NumResources, ShaderStage, ResourceName);
     }
 
     /// Finds an immutable with the given name in the specified shader stage and returns its
@@ -803,6 +805,7 @@ protected:
         FixedLinearAllocator Allocator{RawAllocator};
 
         ReserveSpaceForPipelineResourceSignatureDesc(Allocator, Desc);
+        Allocator.AddSpace<ResourceNameIndex::Entry>(ResourceNameIndex::GetTableSize(Desc.NumResources));
 
         Allocator.AddSpace<PipelineResourceAttribsType>(Desc.NumResources);
 
@@ -825,6 +828,14 @@ protected:
 
         CopyPipelineResourceSignatureDesc(Allocator, Desc, this->m_Desc, m_ResourceOffsets);
 
+        {
+            // Resources are indexed after they have been sorted by variable type, so that
+            // the indices in the table match the indices in m_Desc.Resources[].
+            const size_t NameTableSize = ResourceNameIndex::GetTableSize(this->m_Desc.NumResources);
+            m_ResourceNameIndex.Initialize(Allocator.ConstructArray<ResourceNameIndex::Entry>(NameTableSize), NameTableSize,
+                                           this->m_Desc.Resources, this->m_Desc.NumResources);
+        }
+
 #ifdef DILIGENT_DEBUG
         VERIFY_EXPR(m_ResourceOffsets[SHADER_RESOURCE_VARIABLE_TYPE_NUM_TYPES] == this->m_Desc.NumResources);
         for (Uint32 VarType = 0; VarType < SHADER_RESOURCE_VARIABLE_TYPE_NUM_TYPES; ++VarType)
@@ -1007,6 +1018,8 @@ protected:
         static_assert(std::is_trivially_destructible<ImmutableSamplerAttribsType>::value, "Destructors for m_pImmutableSamplerAttribs[] are required");
         m_pImmutableSamplerAttribs = nullptr;
 
+        m_ResourceNameIndex = {};
+
         if (m_pImmutableSamplers != nullptr)
         {
             for (size_t i = 0; i < this->m_Desc.NumImmutableSamplers; ++i)
@@ -1081,6 +1094,9 @@ protected:
 
     size_t m_Hash = 0;
 
+    // Name index of m_Desc.Resources[]. The table is allocated in m_pRawMemory.
+    ResourceNameIndex m_ResourceNameIndex;
+
     // Resource offsets (e.g. index of the first resource), for each variable type.
     std::array<Uint16, SHADER_RESOURCE_VARIABLE_TYPE_NUM_TYPES + 1> m_ResourceOffsets = {};
 
@@ -128,6 +128,8 @@ public:
     ///
     /// \remarks Render device uses fixed block allocators (see FixedBlockMemoryAllocator) to allocate memory for
     ///          device objects. The object sizes from EngineImplTraits are used to initialize the allocators.
+    ///          Allocators for the objects that are frequently created from multiple threads (SRBs and views)
+    ///          use thread caches.
     RenderDeviceBase(IReferenceCounters*        pRefCounters,
                      IMemoryAllocator&          RawMemAllocator,
                      IEngineFactory*            pEngineFactory,
@@ -144,13 +146,13 @@ public:
         m_wpDeferredContexts  (EngineCI.NumDeferredContexts, RefCntWeakPtr<DeviceContextImplType>(), STD_ALLOCATOR_RAW_MEM(RefCntWeakPtr<DeviceContextImplType>, RawMemAllocator, "Allocator for vector<RefCntWeakPtr<DeviceContextImplType>>")),
         m_RawMemAllocator     {RawMemAllocator},
         m_TexObjAllocator     {RawMemAllocator, sizeof(TextureImplType),                   16},
-        m_TexViewObjAllocator {RawMemAllocator, sizeof(TextureViewImplType),               32},
+        m_TexViewObjAllocator {RawMemAllocator, sizeof(TextureViewImplType),               32, 8},
         m_BufObjAllocator     {RawMemAllocator, sizeof(BufferImplType),                    16},
-        m_BuffViewObjAllocator{RawMemAllocator, sizeof(BufferViewImplType),                32},
+        m_BuffViewObjAllocator{RawMemAllocator, sizeof(BufferViewImplType),                32, 8},
         m_ShaderObjAllocator  {RawMemAllocator, sizeof(ShaderImplType),                    16},
         m_SamplerObjAllocator {RawMemAllocator, sizeof(SamplerImplType),                   32},
         m_PSOAllocator        {RawMemAllocator, sizeof(PipelineStateImplType),             16},
-        m_SRBAllocator        {RawMemAllocator, sizeof(ShaderResourceBindingImplType),     64},
+        m_SRBAllocator        {RawMemAllocator, sizeof(ShaderResourceBindingImplType),     64, 16},
         m_ResMappingAllocator {RawMemAllocator, sizeof(ResourceMappingImpl),                8},
         m_FenceAllocator      {RawMemAllocator, sizeof(FenceImplType),                     16},
         m_QueryAllocator      {RawMemAllocator, sizeof(QueryImplType),                     16},
@@ -0,0 +1,152 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::ResourceNameIndex class
+
+#include <cstring>
+
+#include "BasicTypes.h"
+#include "GraphicsTypes.h"
+#include "Align.hpp"
+#include "HashUtils.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+/// Hash index that maps resource names to the indices of the items in an array of
+/// resource descriptions (PipelineResourceDesc, ShaderResourceVariableDesc, etc.).
+/// Every item must have the Name and ShaderStages members.
+///
+/// The index uses open addressing with linear probing and does not own its table:
+/// the memory is provided by the caller (typically by the FixedLinearAllocator that
+/// also holds the items). Items are inserted in the order of their indices, so for every
+/// name the probe sequence visits the matching items in increasing index order, and Find()
+/// returns the same item as the linear search does.
+///
+/// Arrays that are too small to benefit from hashing are not indexed, and Find() falls
+/// back to the linear search.
+class ResourceNameIndex
+{
+public:
+    static constexpr Uint32 InvalidIndex = ~0u;
+
+    /// Arrays with fewer items are searched linearly.
+    static constexpr Uint32 MinIndexedItems = 16;
+
+    struct Entry
+    {
+        Uint32 Hash   = 0;
+        Uint32 Stages = 0;
+        Uint32 Index  = InvalidIndex;
+    };
+
+    /// Returns the number of table entries required to index NumItems items.
+    static size_t GetTableSize(Uint32 NumItems) noexcept
+    {
+        if (NumItems < MinIndexedItems)
+            return 0;
+
+        // Keep the load factor at or below 1/2 so that probe sequences stay short.
+        return AlignUpToPowerOfTwo(size_t{NumItems} * 2);
+    }
+
+    static Uint32 HashName(const char* Name) noexcept
+    {
+        return static_cast<Uint32>(CStringHash<Char>{}(Name));
+    }
+
+    /// Builds the index for the items. pTable must point to TableSize default-constructed
+    /// entries, where TableSize is the value returned by GetTableSize(NumItems).
+    template <typename ItemType>
+    void Initialize(Entry* pTable, size_t TableSize, const ItemType* Items, Uint32 NumItems) noexcept
+    {
+        VERIFY_EXPR(TableSize == GetTableSize(NumItems));
+        VERIFY_EXPR(TableSize == 0 || pTable != nullptr);
+
+        m_pTable = TableSize > 0 ? pTable : nullptr;
+        m_Mask   = TableSize > 0 ? static_cast<Uint32>(TableSize - 1) : 0;
+        if (m_pTable == nullptr)
+            return;
+
+        for (Uint32 i = 0; i < NumItems; ++i)
+        {
+            const ItemType& Item = Items[i];
+            const Uint32    Hash = HashName(Item.Name);
+
+            Uint32 Slot = Hash & m_Mask;
+            while (m_pTable[Slot].Index != InvalidIndex)
+                Slot = (Slot + 1) & m_Mask;
+
+            m_pTable[Slot] = {Hash, static_cast<Uint32>(Item.ShaderStages), i};
+        }
+    }
+
+    /// Finds the first item with the given name that is defined in any of the stages 'Stages'
+    /// and returns its index in Items[], or InvalidIndex if there is no such item.
+    /// Items must be the same array that was used to initialize the index.
+    template <typename ItemType>
+    Uint32 Find(const ItemType* Items, Uint32 NumItems, SHADER_TYPE Stages, const char* Name) const noexcept
+    {
+        VERIFY_EXPR(Name != nullptr);
+        if (m_pTable == nullptr)
+        {
+            for (Uint32 i = 0; i < NumItems; ++i)
+            {
+                const ItemType& Item = Items[i];
+                if ((Item.ShaderStages & Stages) != 0 && strcmp(Item.Name, Name) == 0)
+                    return i;
+            }
+            return InvalidIndex;
+        }
+
+        const Uint32 Hash = HashName(Name);
+        for (Uint32 Slot = Hash & m_Mask;; Slot = (Slot + 1) & m_Mask)
+        {
+            const Entry& Ent = m_pTable[Slot];
+            if (Ent.Index == InvalidIndex)
+                return InvalidIndex;
+
+            if (Ent.Hash == Hash && (Ent.Stages & Stages) != 0)
+            {
+                VERIFY_EXPR(Ent.Index < NumItems);
+                if (strcmp(Items[Ent.Index].Name, Name) == 0)
+                    return Ent.Index;
+            }
+        }
+    }
+
+    bool IsIndexed() const noexcept { return m_pTable != nullptr; }
+
+private:
+    Entry* m_pTable = nullptr;
+    Uint32 m_Mask   = 0;
+};
+
+} // namespace Diligent
@@ -31,12 +31,14 @@
 /// Implementation of the Diligent::ShaderBase template class
 
 #include <vector>
+#include <algorithm>
 
 #include "ShaderResourceVariable.h"
 #include "PipelineState.h"
 #include "StringTools.hpp"
 #include "GraphicsAccessories.hpp"
 #include "ShaderResourceCacheCommon.hpp"
+#include "ResourceNameIndex.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "EngineMemory.h"
 
@@ -804,6 +806,8 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
 
     const PipelineResourceDesc& GetDesc() const { return m_ParentManager.GetResourceDesc(m_ResIndex); }
 
+    Uint32 GetResIndex() const { return m_ResIndex; }
+
 protected:
     // Variable manager that owns this variable
     VarManagerType& m_ParentManager;
@@ -831,10 +835,11 @@ protected:
         VERIFY(m_pVariables == nullptr, "Destroy() has not been called. The shader variable memory will leak.");
     }
 
-    void Initialize(const PipelineResourceSignatureType& Signature, IMemoryAllocator& Allocator, size_t Size)
+    void Initialize(const PipelineResourceSignatureType& Signature, IMemoryAllocator& Allocator, size_t Size, SHADER_TYPE ShaderStages)
     {
         VERIFY_EXPR(m_pSignature == nullptr);
-        m_pSignature = &Signature;
+        m_pSignature   = &Signature;
+        m_ShaderStages = ShaderStages;
 
         if (Size > 0)
         {
@@ -860,6 +865,28 @@ protected:
 #endif
     }
 
+    // Finds the variable with the given name using the name index of the signature.
+    // Variables are created in the order of increasing resource indices (resources are
+    // processed by variable type, and the allowed types are always given in ascending order),
+    // so the variable of the resource is located by binary search.
+    VariableType* FindVariableByName(const Char* Name) const
+    {
+        const Uint32 NumVariables = static_cast<const ThisImplType*>(this)->m_NumVariables;
+        if (NumVariables == 0)
+            return nullptr;
+
+        const Uint32 ResIndex = m_pSignature->FindResource(m_ShaderStages, Name);
+        if (ResIndex == ResourceNameIndex::InvalidIndex)
+            return nullptr;
+
+        VariableType* const pVarsEnd = m_pVariables + NumVariables;
+        VariableType* const pVar     = std::lower_bound(m_pVariables, pVarsEnd, ResIndex,
+                                                        [](const VariableType& Var, Uint32 Idx) {
+                                                            return Var.GetResIndex() < Idx;
+                                                        });
+        return (pVar != pVarsEnd && pVar->GetResIndex() == ResIndex) ? pVar : nullptr;
+    }
+
     void BindResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags)
     {
         DEV_CHECK_ERR(pResourceMapping != nullptr, "Failed to bind resources: resource mapping is null");
@@ -902,6 +929,9 @@ protected:
 
     PipelineResourceSignatureType const* m_pSignature = nullptr;
 
+    // Shader stages the variables of this manager are created for.
+    SHADER_TYPE m_ShaderStages = SHADER_TYPE_UNKNOWN;
+
     // Memory is allocated through the allocator provided by the pipeline resource signature. If allocation
     // granularity > 1, fixed block memory allocator is used. This ensures that all resources from different
     // shader resource bindings reside in continuous memory. If allocation granularity == 1, raw allocator is used.
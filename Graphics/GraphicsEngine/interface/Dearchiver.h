@@ -232,6 +232,8 @@ DILIGENT_BEGIN_INTERFACE(IDearchiver, IObject)
     /// \note       If the archive was not copied, the dearchiver will keep a strong reference
     ///             to the pArchive data blob. It will be kept alive until the dearchiver object
     ///             is released or the Reset() method is called.
+    ///             This allows loading the archive from a memory-mapped file (see
+    ///             FileWrapper::MapWholeFile()) without reading it into memory.
     ///
     /// \warning    If the archive was loaded without making a copy, the application
     ///             must not modify its contents while it is in use by the dearchiver.
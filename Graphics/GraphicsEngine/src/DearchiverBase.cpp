@@ -490,18 +490,20 @@ DearchiverBase::ArchiveData* DearchiverBase::FindArchive(ResourceType ResType, c
     VERIFY_EXPR(ResType != ResourceType::Undefined);
     VERIFY_EXPR(ResName != nullptr);
 
-    const auto archive_idx_it = m_ResNameToArchiveIdx.find(NamedResourceKey{ResType, ResName});
-    if (archive_idx_it == m_ResNameToArchiveIdx.end())
-        return nullptr;
-
-    auto& Archive = m_Archives[archive_idx_it->second];
-    if (!Archive.pObjArchive)
+    // Resources from the archives loaded first take precedence
+    for (ArchiveData& Archive : m_Archives)
     {
-        UNEXPECTED("Null object archives should never be added to the list. This is a bug.");
-        return nullptr;
+        if (!Archive.pObjArchive)
+        {
+            UNEXPECTED("Null object archives should never be added to the list. This is a bug.");
+            continue;
+        }
+
+        if (Archive.pObjArchive->HasResource(ResType, ResName))
+            return &Archive;
     }
 
-    return &Archive;
+    return nullptr;
 }
 
 template <typename PSOCreateInfoType>
@@ -666,24 +668,21 @@ bool DearchiverBase::LoadArchive(const IDataBlob* pArchiveData, Uint32 ContentVe
     if (!pObjArchive->Deserialize(DeviceObjectArchive::CreateInfo{pArchiveData, ContentVersion, MakeCopy}))
         return false;
 
-    const size_t ArchiveIdx = m_Archives.size();
-
-    const auto& ArchiveResources = pObjArchive->GetNamedResources();
-    for (const auto& it : ArchiveResources)
+    // Resources are not decoded when the archive is loaded. Names only need to be
+    // checked for conflicts if there are other archives.
+    if (!m_Archives.empty())
     {
-        const ResourceType ResType      = it.first.GetType();
-        const char*        ResName      = it.first.GetName();
-        constexpr bool     MakeNameCopy = true;
-
-        const auto it_inserted = m_ResNameToArchiveIdx.emplace(NamedResourceKey{ResType, ResName, MakeNameCopy}, ArchiveIdx);
-        if (!it_inserted.second)
+        for (const auto& it : pObjArchive->GetNamedResources())
         {
-            const auto& OtherArchiveResources = m_Archives[it_inserted.first->second].pObjArchive->GetNamedResources();
-            const auto  it_other              = OtherArchiveResources.find(NamedResourceKey{ResType, ResName});
+            const ResourceType ResType = it.first.GetType();
+            const char*        ResName = it.first.GetName();
+
+            const ArchiveData* pOtherArchive = FindArchive(ResType, ResName);
+            if (pOtherArchive == nullptr)
+                continue;
 
-            const bool IsDuplicate =
-                (it_other != OtherArchiveResources.end()) &&
-                (it.second == it_other->second);
+            const auto* pOtherRes   = pOtherArchive->pObjArchive->FindResource(ResType, ResName);
+            const bool  IsDuplicate = (pOtherRes != nullptr) && (pOtherRes->second == it.second);
             if (!IsDuplicate)
             {
                 LOG_ERROR_MESSAGE("Resource with name '", ResName, "' already exists in the archive.");
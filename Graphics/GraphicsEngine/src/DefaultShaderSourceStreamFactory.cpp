@@ -27,18 +27,132 @@
 
 #include "DefaultShaderSourceStreamFactory.h"
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
 #include "ObjectBase.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "EngineMemory.h"
 #include "BasicFileStream.hpp"
+#include "MemoryFileStream.hpp"
+#include "DataBlobImpl.hpp"
+#include "ProxyDataBlob.hpp"
+#include "FileWrapper.hpp"
+#include "LRUCache.hpp"
 
 namespace Diligent
 {
 
+namespace
+{
+
+// Shader source file contents shared by all factories that use the cache.
+class ShaderSourceFileCache
+{
+public:
+    static ShaderSourceFileCache& Get()
+    {
+        static ShaderSourceFileCache Cache;
+        return Cache;
+    }
+
+    // Returns the file contents, or null if the file can't be read.
+    // If CheckModTime is true, the file is reloaded when its modification time changes.
+    RefCntAutoPtr<IDataBlob> GetFileData(const String& Path, bool CheckModTime)
+    {
+        Uint64 ModTime = 0;
+        if (CheckModTime)
+        {
+            ModTime = FileSystem::GetFileModificationTime(Path.c_str());
+            // Zero modification time may also mean that the platform does not support it.
+            if (ModTime == 0 && !FileSystem::FileExists(Path.c_str()))
+            {
+                m_Files.Erase(Path);
+                return {};
+            }
+        }
+
+        FileData Data = LoadFileData(Path, ModTime);
+        if (CheckModTime && Data.pData && Data.ModTime != ModTime)
+        {
+            // The file has changed since it was cached
+            m_Files.Erase(Path);
+            m_Generation.fetch_add(1);
+            Data = LoadFileData(Path, ModTime);
+        }
+        return Data.pData;
+    }
+
+    void SetMaxSize(size_t MaxSize)
+    {
+        m_Files.SetMaxSize(MaxSize);
+    }
+
+    // Removes the contents of the file (or all files if Path is null) from the cache.
+    // The files are keyed by the simplified resolved paths, which are not made absolute,
+    // so Path must match the resolved path of the file.
+    void Invalidate(const Char* Path)
+    {
+        if (Path != nullptr)
+            m_Files.Erase(FileSystem::SimplifyPath(Path));
+        else
+            m_Files.Clear();
+
+        m_Generation.fetch_add(1);
+    }
+
+    // Returns the counter that is incremented by every invalidation and every reload
+    // of a modified file.
+    Uint64 GetGeneration() const
+    {
+        return m_Generation.load();
+    }
+
+private:
+    struct FileData
+    {
+        RefCntAutoPtr<IDataBlob> pData;
+        // The modification time of the file when it was loaded
+        Uint64 ModTime = 0;
+    };
+
+    FileData LoadFileData(const String& Path, Uint64 ModTime)
+    {
+        try
+        {
+            return m_Files.Get(Path,
+                               [&Path, ModTime](FileData& Data, size_t& Size) //
+                               {
+                                   if (!FileWrapper::ReadWholeFile(Path.c_str(), &Data.pData, /*Silent = */ true))
+                                       throw std::runtime_error{"Failed to read the file"};
+                                   Data.ModTime = ModTime;
+                                   Size         = std::max(Data.pData->GetSize(), size_t{1});
+                               });
+        }
+        catch (...)
+        {
+            // The failed entry is not cached and will be removed from the LRU list later.
+            return {};
+        }
+    }
+
+    static constexpr size_t DefaultMaxSize = size_t{64} << 20;
+
+    ShardedLRUCache<String, FileData> m_Files{DefaultMaxSize};
+
+    std::atomic<Uint64> m_Generation{0};
+};
+
+} // namespace
+
 class DefaultShaderSourceStreamFactory final : public ObjectBase<IShaderSourceInputStreamFactory>
 {
 public:
-    DefaultShaderSourceStreamFactory(IReferenceCounters* pRefCounters, const Char* SearchDirectories);
+    DefaultShaderSourceStreamFactory(IReferenceCounters*                               pRefCounters,
+                                     const DefaultShaderSourceStreamFactoryCreateInfo& CreateInfo);
 
     virtual void DILIGENT_CALL_TYPE CreateInputStream(const Char* Name, IFileStream** ppStream) override final;
 
@@ -48,14 +162,34 @@ public:
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_IShaderSourceInputStreamFactory, ObjectBase<IShaderSourceInputStreamFactory>)
 
+private:
+    // Returns the path of the first file with the given name found in the search directories,
+    // or an empty string if the file is not found.
+    String FindFile(const Char* Name) const;
+
+    // Same as FindFile(), but memoizes the result until the cache is invalidated.
+    String FindFileCached(const Char* Name);
+
+    RefCntAutoPtr<IFileStream> CreateCachedStream(const Char* Name);
+
 private:
     std::vector<String> m_SearchDirectories;
+
+    const SHADER_SOURCE_FILE_CACHE_MODE m_CacheMode;
+
+    std::mutex m_ResolvedPathsMtx;
+    // Resolved file paths, including the empty paths of the files that were not found
+    // (except in the modification time mode).
+    std::unordered_map<String, String> m_ResolvedPaths;
+    Uint64                             m_ResolvedPathsGeneration = 0;
 };
 
-DefaultShaderSourceStreamFactory::DefaultShaderSourceStreamFactory(IReferenceCounters* pRefCounters, const Char* SearchDirectories) :
-    ObjectBase<IShaderSourceInputStreamFactory>(pRefCounters)
+DefaultShaderSourceStreamFactory::DefaultShaderSourceStreamFactory(IReferenceCounters*                               pRefCounters,
+                                                                   const DefaultShaderSourceStreamFactoryCreateInfo& CreateInfo) :
+    ObjectBase<IShaderSourceInputStreamFactory>(pRefCounters),
+    m_CacheMode{CreateInfo.CacheMode}
 {
-    FileSystem::SplitPathList(SearchDirectories,
+    FileSystem::SplitPathList(CreateInfo.SearchDirectories,
                               [&](const char* Path, size_t Len) //
                               {
                                   String SearchPath{Path, Len};
@@ -66,6 +200,9 @@ DefaultShaderSourceStreamFactory::DefaultShaderSourceStreamFactory(IReferenceCou
                                   return true;
                               });
     m_SearchDirectories.push_back("");
+
+    if (m_CacheMode != SHADER_SOURCE_FILE_CACHE_MODE_NONE)
+        m_ResolvedPathsGeneration = ShaderSourceFileCache::Get().GetGeneration();
 }
 
 void DefaultShaderSourceStreamFactory::CreateInputStream(const Char*   Name,
@@ -74,41 +211,116 @@ void DefaultShaderSourceStreamFactory::CreateInputStream(const Char*   Name,
     CreateInputStream2(Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE, ppStream);
 }
 
-void DefaultShaderSourceStreamFactory::CreateInputStream2(const Char*                             Name,
-                                                          CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
-                                                          IFileStream**                           ppStream)
+String DefaultShaderSourceStreamFactory::FindFile(const Char* Name) const
 {
-    auto CreateFileStream = [](const char* Path) //
+    if (FileSystem::IsPathAbsolute(Name))
+    {
+        return FileSystem::FileExists(Name) ? String{Name} : String{};
+    }
+
+    for (const auto& SearchDir : m_SearchDirectories)
     {
-        RefCntAutoPtr<BasicFileStream> pFileStream;
-        if (FileSystem::FileExists(Path))
+        auto FullPath = SearchDir + ((Name[0] == '\\' || Name[0] == '/') ? Name + 1 : Name);
+        if (FileSystem::FileExists(FullPath.c_str()))
+            return FullPath;
+    }
+
+    return {};
+}
+
+String DefaultShaderSourceStreamFactory::FindFileCached(const Char* Name)
+{
+    const Uint64 Generation = ShaderSourceFileCache::Get().GetGeneration();
+    {
+        std::lock_guard<std::mutex> Lock{m_ResolvedPathsMtx};
+        if (m_ResolvedPathsGeneration != Generation)
         {
-            pFileStream = BasicFileStream::Create(Path, EFileAccessMode::Read);
-            if (!pFileStream->IsValid())
-                pFileStream.Release();
+            m_ResolvedPaths.clear();
+            m_ResolvedPathsGeneration = Generation;
         }
-        return pFileStream;
-    };
 
-    RefCntAutoPtr<BasicFileStream> pFileStream;
-    if (FileSystem::IsPathAbsolute(Name))
+        auto it = m_ResolvedPaths.find(Name);
+        if (it != m_ResolvedPaths.end())
+            return it->second;
+    }
+
+    // Search the file while the mutex is not locked. If another thread resolves the same
+    // name at the same time, both threads will get the same path.
+    String Path = FindFile(Name);
+    // Normalize the path so that it can be used as the key in the shared cache.
+    if (!Path.empty())
+        Path = FileSystem::SimplifyPath(Path.c_str());
+
+    // In modification time mode, files that were not found are searched again on every
+    // request, so that new files are picked up without explicit invalidation.
+    if (!Path.empty() || m_CacheMode != SHADER_SOURCE_FILE_CACHE_MODE_MODIFICATION_TIME)
+    {
+        std::lock_guard<std::mutex> Lock{m_ResolvedPathsMtx};
+        if (m_ResolvedPathsGeneration == Generation)
+            m_ResolvedPaths.emplace(Name, Path);
+    }
+
+    return Path;
+}
+
+RefCntAutoPtr<IFileStream> DefaultShaderSourceStreamFactory::CreateCachedStream(const Char* Name)
+{
+    ShaderSourceFileCache& FileCache    = ShaderSourceFileCache::Get();
+    const bool             CheckModTime = m_CacheMode == SHADER_SOURCE_FILE_CACHE_MODE_MODIFICATION_TIME;
+
+    String Path = FindFileCached(Name);
+    if (Path.empty())
+        return {};
+
+    RefCntAutoPtr<IDataBlob> pData = FileCache.GetFileData(Path, CheckModTime);
+    if (!pData && CheckModTime)
+    {
+        // The file may have been deleted or moved: search it again.
+        {
+            std::lock_guard<std::mutex> Lock{m_ResolvedPathsMtx};
+            m_ResolvedPaths.erase(Name);
+        }
+        Path = FindFileCached(Name);
+        if (!Path.empty())
+            pData = FileCache.GetFileData(Path, CheckModTime);
+    }
+    if (!pData)
+        return {};
+
+    // The cached contents are shared between all streams and must not be modified,
+    // so wrap them into a read-only proxy blob that keeps a reference to the data.
+    RefCntAutoPtr<IDataBlob> pStreamData;
+    if (pData->GetSize() > 0)
+        pStreamData = ProxyDataBlob::Create(pData->GetConstDataPtr(), pData->GetSize(), pData.RawPtr());
+    else
+        pStreamData = DataBlobImpl::Create();
+
+    return RefCntAutoPtr<IFileStream>{MemoryFileStream::Create(pStreamData)};
+}
+
+void DefaultShaderSourceStreamFactory::CreateInputStream2(const Char*                             Name,
+                                                          CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
+                                                          IFileStream**                           ppStream)
+{
+    RefCntAutoPtr<IFileStream> pStream;
+    if (m_CacheMode != SHADER_SOURCE_FILE_CACHE_MODE_NONE)
     {
-        pFileStream = CreateFileStream(Name);
+        pStream = CreateCachedStream(Name);
     }
     else
     {
-        for (const auto& SearchDir : m_SearchDirectories)
+        const String Path = FindFile(Name);
+        if (!Path.empty())
         {
-            const auto FullPath = SearchDir + ((Name[0] == '\\' || Name[0] == '/') ? Name + 1 : Name);
-            pFileStream         = CreateFileStream(FullPath.c_str());
-            if (pFileStream)
-                break;
+            RefCntAutoPtr<BasicFileStream> pFileStream = BasicFileStream::Create(Path.c_str(), EFileAccessMode::Read);
+            if (pFileStream->IsValid())
+                pStream = pFileStream;
         }
     }
 
-    if (pFileStream)
+    if (pStream)
     {
-        pFileStream->QueryInterface(IID_FileStream, reinterpret_cast<IObject**>(ppStream));
+        *ppStream = pStream.Detach();
     }
     else
     {
@@ -120,16 +332,39 @@ void DefaultShaderSourceStreamFactory::CreateInputStream2(const Char*
     }
 }
 
-void CreateDefaultShaderSourceStreamFactory(const Char*                       SearchDirectories,
-                                            IShaderSourceInputStreamFactory** ppShaderSourceStreamFactory)
+void CreateDefaultShaderSourceStreamFactory2(const DefaultShaderSourceStreamFactoryCreateInfo& CreateInfo,
+                                             IShaderSourceInputStreamFactory**                 ppShaderSourceStreamFactory)
 {
     DEV_CHECK_ERR(ppShaderSourceStreamFactory != nullptr, "ppShaderSourceStreamFactory must not be null.");
     DEV_CHECK_ERR(*ppShaderSourceStreamFactory == nullptr, "*ppShaderSourceStreamFactory is not null. Make sure the pointer is null to avoid memory leaks.");
 
     auto& Allocator = GetRawAllocator();
     auto* pStreamFactory =
-        NEW_RC_OBJ(Allocator, "DefaultShaderSourceStreamFactory instance", DefaultShaderSourceStreamFactory)(SearchDirectories);
+        NEW_RC_OBJ(Allocator, "DefaultShaderSourceStreamFactory instance", DefaultShaderSourceStreamFactory)(CreateInfo);
     pStreamFactory->QueryInterface(IID_IShaderSourceInputStreamFactory, reinterpret_cast<IObject**>(ppShaderSourceStreamFactory));
 }
 
+void CreateDefaultShaderSourceStreamFactory(const Char*                       SearchDirectories,
+                                            IShaderSourceInputStreamFactory** ppShaderSourceStreamFactory)
+{
+    DefaultShaderSourceStreamFactoryCreateInfo CreateInfo;
+    CreateInfo.SearchDirectories = SearchDirectories;
+    CreateDefaultShaderSourceStreamFactory2(CreateInfo, ppShaderSourceStreamFactory);
+}
+
+void SetShaderSourceFileCacheMaxSize(size_t MaxSize)
+{
+    ShaderSourceFileCache::Get().SetMaxSize(MaxSize);
+}
+
+void InvalidateShaderSourceFileCache(const Char* FilePath)
+{
+    ShaderSourceFileCache::Get().Invalidate(FilePath);
+}
+
+Uint64 GetShaderSourceFileCacheGeneration()
+{
+    return ShaderSourceFileCache::Get().GetGeneration();
+}
+
 } // namespace Diligent
@@ -28,6 +28,7 @@
 
 #include <algorithm>
 #include <sstream>
+#include <cstring>
 
 #include "Shader.h"
 #include "EngineMemory.h"
@@ -106,6 +107,14 @@ struct ArchiveSerializer
         return true;
     }
 
+    bool SerializeResource(ConstQual<const char*>& Name, ConstQual<ResourceData>& ResData) const
+    {
+        if (!Ser(Name))
+            return false;
+
+        return SerializeResourceData(ResData);
+    }
+
     bool SerializeShaders(ConstQual<ShadersVector>& Shaders) const;
 };
 
@@ -144,8 +153,35 @@ bool ArchiveSerializer<SerializerMode::Read>::SerializeShaders(ShadersVector& Sh
     return true;
 }
 
+// Resource blocks and device shader blocks are aligned by this value in the archive data
+constexpr Uint32 ArchiveBlockAlignment = 8;
+
+// Compares resource names the same way the directory is sorted
+int CompareResourceNames(const char* Name1, size_t Len1, const char* Name2, size_t Len2)
+{
+    if (int Res = std::memcmp(Name1, Name2, std::min(Len1, Len2)))
+        return Res;
+
+    return Len1 < Len2 ? -1 : (Len1 > Len2 ? +1 : 0);
+}
+
 } // namespace
 
+// Resource directory entry.
+// The resource name is serialized at the beginning of the resource data block.
+struct DeviceObjectArchive::DirectoryEntry
+{
+    Uint32 Type       = 0;
+    Uint32 NameLength = 0;
+    Uint32 DataOffset = 0;
+    Uint32 DataSize   = 0;
+
+    const char* GetName(const Uint8* pArchiveData) const
+    {
+        return NameLength > 0 ? reinterpret_cast<const char*>(pArchiveData + DataOffset + sizeof(Uint32)) : "";
+    }
+};
+
 DeviceObjectArchive::DeviceObjectArchive(Uint32 ContentVersion) noexcept :
     m_ContentVersion{ContentVersion}
 {
@@ -154,7 +190,11 @@ DeviceObjectArchive::DeviceObjectArchive(Uint32 ContentVersion) noexcept :
 void DeviceObjectArchive::Clear() noexcept
 {
     m_NamedResources.clear();
-    m_DeviceShaders = {};
+    m_DeviceShaders       = {};
+    m_pDirectory          = nullptr;
+    m_NumDirEntries       = 0;
+    m_AllResourcesLoaded  = true;
+    m_PendingShaderBlocks = {};
     m_pArchiveData.Release();
     m_ContentVersion = 0;
 }
@@ -181,10 +221,12 @@ bool DeviceObjectArchive::Deserialize(const CreateInfo& CI) noexcept
         DataBlobImpl::MakeCopy(CI.pData) :
         const_cast<IDataBlob*>(CI.pData); // Need to remove const for AddRef/Release
 
+    const size_t ArchiveSize = m_pArchiveData->GetSize();
+
     Serializer<SerializerMode::Read> Reader{
         SerializedData{
-            const_cast<void*>(CI.pData->GetConstDataPtr()),
-            CI.pData->GetSize(),
+            const_cast<void*>(m_pArchiveData->GetConstDataPtr()),
+            ArchiveSize,
         },
     };
     ArchiveSerializer<SerializerMode::Read> ArchiveReader{Reader};
@@ -213,29 +255,188 @@ bool DeviceObjectArchive::Deserialize(const CreateInfo& CI) noexcept
     Uint32 NumResources = 0;
     CHECK_ARCHIVE(Reader(NumResources), "Failed to read the number of named resources in the device object archive.");
 
-    for (Uint32 res = 0; res < NumResources; ++res)
+    for (DataBlock& Block : m_PendingShaderBlocks)
     {
-        const char*  Name    = nullptr;
-        ResourceType ResType = ResourceType::Undefined;
-        CHECK_ARCHIVE(Reader(ResType, Name), "Failed to read the type and name of resource ", res, "/", NumResources, '.');
-        VERIFY_EXPR(Name != nullptr);
+        CHECK_ARCHIVE(Reader(Block.Offset, Block.Size), "Failed to read the location of the shader data in the device object archive.");
+        CHECK_ARCHIVE(size_t{Block.Offset} + size_t{Block.Size} <= ArchiveSize, "Shader data is out of the device object archive bounds.");
+    }
+
+    // Only the directory location is recorded here. Resources and shaders
+    // are decoded when they are accessed for the first time.
+    CHECK_ARCHIVE(Reader.GetRemainingSize() >= size_t{NumResources} * sizeof(DirectoryEntry), "The device object archive directory is truncated.");
+    m_pDirectory         = static_cast<const Uint8*>(Reader.GetCurrentPtr());
+    m_NumDirEntries      = NumResources;
+    m_AllResourcesLoaded = (NumResources == 0);
+#undef CHECK_ARCHIVE
+
+    return true;
+}
+
+bool DeviceObjectArchive::GetDirectoryEntry(Uint32 Idx, DirectoryEntry& Entry) const noexcept
+{
+    VERIFY_EXPR(m_pDirectory != nullptr && Idx < m_NumDirEntries);
+
+    static_assert(sizeof(DirectoryEntry) == sizeof(Uint32) * 4, "Unexpected directory entry size");
+    // The directory may not be properly aligned
+    std::memcpy(&Entry, m_pDirectory + size_t{Idx} * sizeof(DirectoryEntry), sizeof(DirectoryEntry));
 
-        // No need to make the name copy as we keep the source data blob alive.
-        constexpr bool MakeNameCopy = false;
-        ResourceData&  ResData      = m_NamedResources[NamedResourceKey{ResType, Name, MakeNameCopy}];
+    const Uint8* pArchiveData = m_pArchiveData->GetConstDataPtr<Uint8>();
 
-        CHECK_ARCHIVE(ArchiveReader.SerializeResourceData(ResData), "Failed to read data of resource '", Name, "'.");
+    const size_t BlockEnd = size_t{Entry.DataOffset} + size_t{Entry.DataSize};
+    // Name is serialized as | Length with null | Characters | Null terminator |
+    const size_t NameEnd = size_t{Entry.DataOffset} + sizeof(Uint32) + size_t{Entry.NameLength} + (Entry.NameLength > 0 ? 1 : 0);
+    if (BlockEnd > m_pArchiveData->GetSize() || NameEnd > BlockEnd ||
+        (Entry.NameLength > 0 && pArchiveData[NameEnd - 1] != '\0') ||
+        Entry.Type == static_cast<Uint32>(ResourceType::Undefined) || Entry.Type >= static_cast<Uint32>(ResourceType::Count))
+    {
+        LOG_ERROR_MESSAGE("Directory entry ", Idx, " is invalid. Device object archive may be corrupted.");
+        return false;
     }
 
-    for (std::vector<SerializedData>& Shaders : m_DeviceShaders)
+    return true;
+}
+
+bool DeviceObjectArchive::FindDirectoryEntry(ResourceType Type, const char* Name, DirectoryEntry& Entry) const noexcept
+{
+    if (m_AllResourcesLoaded || Name == nullptr)
+        return false;
+
+    const Uint8* pArchiveData = m_pArchiveData->GetConstDataPtr<Uint8>();
+    const size_t NameLen      = strlen(Name);
+
+    // Entries are sorted by resource type and name
+    Uint32 First = 0;
+    Uint32 Last  = m_NumDirEntries;
+    while (First < Last)
     {
-        CHECK_ARCHIVE(ArchiveReader.SerializeShaders(Shaders), "Failed to read shader data from the device object archive.");
+        const Uint32 Mid = First + (Last - First) / 2;
+        if (!GetDirectoryEntry(Mid, Entry))
+            return false;
+
+        int Cmp = 0;
+        if (static_cast<Uint32>(Type) != Entry.Type)
+            Cmp = static_cast<Uint32>(Type) < Entry.Type ? -1 : +1;
+        else
+            Cmp = CompareResourceNames(Name, NameLen, Entry.GetName(pArchiveData), Entry.NameLength);
+
+        if (Cmp == 0)
+            return true;
+
+        if (Cmp < 0)
+            Last = Mid;
+        else
+            First = Mid + 1;
+    }
+
+    return false;
+}
+
+const DeviceObjectArchive::NamedResourcesMap::value_type* DeviceObjectArchive::DecodeResource(const DirectoryEntry& Entry) const noexcept
+{
+    Serializer<SerializerMode::Read> Reader{
+        SerializedData{
+            const_cast<Uint8*>(m_pArchiveData->GetConstDataPtr<Uint8>(Entry.DataOffset)),
+            Entry.DataSize,
+        },
+    };
+    ArchiveSerializer<SerializerMode::Read> ArchiveReader{Reader};
+
+    const char*  Name = nullptr;
+    ResourceData ResData;
+    if (!ArchiveReader.SerializeResource(Name, ResData))
+    {
+        LOG_ERROR_MESSAGE("Failed to read data of resource '", Entry.GetName(m_pArchiveData->GetConstDataPtr<Uint8>()), "'.");
+        return nullptr;
+    }
+    VERIFY_EXPR(Name != nullptr && strlen(Name) == Entry.NameLength);
+
+    // No need to make the name copy as we keep the source data blob alive.
+    constexpr bool MakeNameCopy = false;
+    auto           it           = m_NamedResources.emplace(NamedResourceKey{static_cast<ResourceType>(Entry.Type), Name, MakeNameCopy}, std::move(ResData)).first;
+    return &*it;
+}
+
+bool DeviceObjectArchive::DecodeDeviceShaders(DeviceType Type) const noexcept
+{
+    DataBlock& Block = m_PendingShaderBlocks[static_cast<size_t>(Type)];
+    if (Block.Size == 0)
+        return true;
+
+    Serializer<SerializerMode::Read> Reader{
+        SerializedData{
+            const_cast<Uint8*>(m_pArchiveData->GetConstDataPtr<Uint8>(Block.Offset)),
+            Block.Size,
+        },
+    };
+    Block = {};
+
+    std::vector<SerializedData>& Shaders = m_DeviceShaders[static_cast<size_t>(Type)];
+    if (!ArchiveSerializer<SerializerMode::Read>{Reader}.SerializeShaders(Shaders))
+    {
+        LOG_ERROR_MESSAGE("Failed to read shader data from the device object archive.");
+        Shaders.clear();
+        return false;
     }
-#undef CHECK_ARCHIVE
 
     return true;
 }
 
+const DeviceObjectArchive::NamedResourcesMap::value_type* DeviceObjectArchive::FindResource(ResourceType Type, const char* Name) const noexcept
+{
+    std::lock_guard<std::mutex> Lock{m_LazyLoadMtx};
+
+    auto it = m_NamedResources.find(NamedResourceKey{Type, Name});
+    if (it != m_NamedResources.end())
+        return &*it;
+
+    DirectoryEntry Entry;
+    if (!FindDirectoryEntry(Type, Name, Entry))
+        return nullptr;
+
+    return DecodeResource(Entry);
+}
+
+bool DeviceObjectArchive::HasResource(ResourceType Type, const char* Name) const noexcept
+{
+    std::lock_guard<std::mutex> Lock{m_LazyLoadMtx};
+
+    if (m_NamedResources.find(NamedResourceKey{Type, Name}) != m_NamedResources.end())
+        return true;
+
+    DirectoryEntry Entry;
+    return FindDirectoryEntry(Type, Name, Entry);
+}
+
+const std::vector<SerializedData>& DeviceObjectArchive::GetDeviceShaderList(DeviceType Type) const noexcept
+{
+    std::lock_guard<std::mutex> Lock{m_LazyLoadMtx};
+    DecodeDeviceShaders(Type);
+    return m_DeviceShaders[static_cast<size_t>(Type)];
+}
+
+void DeviceObjectArchive::LoadAllResources() const noexcept
+{
+    std::lock_guard<std::mutex> Lock{m_LazyLoadMtx};
+
+    if (!m_AllResourcesLoaded)
+    {
+        const Uint8* pArchiveData = m_pArchiveData->GetConstDataPtr<Uint8>();
+        for (Uint32 i = 0; i < m_NumDirEntries; ++i)
+        {
+            DirectoryEntry Entry;
+            if (!GetDirectoryEntry(i, Entry))
+                continue;
+
+            if (m_NamedResources.find(NamedResourceKey{static_cast<ResourceType>(Entry.Type), Entry.GetName(pArchiveData)}) == m_NamedResources.end())
+                DecodeResource(Entry);
+        }
+        m_AllResourcesLoaded = true;
+    }
+
+    for (size_t i = 0; i < m_PendingShaderBlocks.size(); ++i)
+        DecodeDeviceShaders(static_cast<DeviceType>(i));
+}
+
 void DeviceObjectArchive::Serialize(IDataBlob** ppDataBlob) const
 {
     if (ppDataBlob == nullptr)
@@ -245,47 +446,131 @@ void DeviceObjectArchive::Serialize(IDataBlob** ppDataBlob) const
     }
     DEV_CHECK_ERR(*ppDataBlob == nullptr, "Data blob object must be null");
 
-    auto SerializeThis = [this](auto& Ser) {
+    LoadAllResources();
+
+    // Sort resources by type and name to build the directory
+    std::vector<const NamedResourcesMap::value_type*> SortedResources;
+    SortedResources.reserve(m_NamedResources.size());
+    for (const auto& res_it : m_NamedResources)
+        SortedResources.emplace_back(&res_it);
+    std::sort(SortedResources.begin(), SortedResources.end(),
+              [](const NamedResourcesMap::value_type* pRes1, const NamedResourcesMap::value_type* pRes2) {
+                  const ResourceType Type1 = pRes1->first.GetType();
+                  const ResourceType Type2 = pRes2->first.GetType();
+                  if (Type1 != Type2)
+                      return Type1 < Type2;
+
+                  const char* Name1 = pRes1->first.GetName();
+                  const char* Name2 = pRes2->first.GetName();
+                  return CompareResourceNames(Name1, strlen(Name1), Name2, strlen(Name2)) < 0;
+              });
+
+    ArchiveHeader Header;
+    Header.ContentVersion = m_ContentVersion;
+
+    const Uint32 NumResources = StaticCast<Uint32>(SortedResources.size());
+
+    std::vector<DirectoryEntry>                                   Directory(NumResources);
+    std::array<DataBlock, static_cast<size_t>(DeviceType::Count)> ShaderBlocks{};
+
+    auto SerializeDirectory = [&](auto& Ser) {
         constexpr auto SerMode    = std::remove_reference<decltype(Ser)>::type::GetMode();
         const auto     ArchiveSer = ArchiveSerializer<SerMode>{Ser};
 
-        ArchiveHeader Header;
-        Header.ContentVersion = m_ContentVersion;
-
         auto res = ArchiveSer.SerializeHeader(Header);
         VERIFY(res, "Failed to serialize header");
 
-        Uint32 NumResources = StaticCast<Uint32>(m_NamedResources.size());
-        res                 = Ser(NumResources);
+        res = Ser(NumResources);
         VERIFY(res, "Failed to serialize the number of resources");
 
-        for (const auto& res_it : m_NamedResources)
+        for (const DataBlock& Block : ShaderBlocks)
         {
-            const auto* Name    = res_it.first.GetName();
-            const auto  ResType = res_it.first.GetType();
-
-            res = Ser(ResType, Name);
-            VERIFY(res, "Failed to serialize resource type and name");
-
-            res = ArchiveSer.SerializeResourceData(res_it.second);
-            VERIFY(res, "Failed to serialize resource data");
+            res = Ser(Block.Offset, Block.Size);
+            VERIFY(res, "Failed to serialize shader data location");
         }
 
-        for (auto& Shaders : m_DeviceShaders)
+        for (const DirectoryEntry& Entry : Directory)
         {
-            res = ArchiveSer.SerializeShaders(Shaders);
-            VERIFY(res, "Failed to serialize shaders");
+            res = Ser(Entry.Type, Entry.NameLength, Entry.DataOffset, Entry.DataSize);
+            VERIFY(res, "Failed to serialize directory entry");
         }
     };
 
-    Serializer<SerializerMode::Measure> Measurer;
-    SerializeThis(Measurer);
+    // Compute the archive layout
+    Serializer<SerializerMode::Measure> DirMeasurer;
+    SerializeDirectory(DirMeasurer);
+    const size_t DirectorySize = DirMeasurer.GetSize();
+
+    size_t ArchiveSize = DirectorySize;
+    for (Uint32 i = 0; i < NumResources; ++i)
+    {
+        const auto& Res  = *SortedResources[i];
+        const char* Name = Res.first.GetName();
+
+        Serializer<SerializerMode::Measure> Measurer;
+        ArchiveSerializer<SerializerMode::Measure>{Measurer}.SerializeResource(Name, Res.second);
+
+        ArchiveSize = AlignUp(ArchiveSize, size_t{ArchiveBlockAlignment});
 
-    auto pDataBlob = DataBlobImpl::Create(Measurer.GetSize());
+        DirectoryEntry& Entry = Directory[i];
+        Entry.Type            = static_cast<Uint32>(Res.first.GetType());
+        Entry.NameLength      = StaticCast<Uint32>(strlen(Name));
+        Entry.DataOffset      = StaticCast<Uint32>(ArchiveSize);
+        Entry.DataSize        = StaticCast<Uint32>(Measurer.GetSize());
 
-    Serializer<SerializerMode::Write> Writer{SerializedData{pDataBlob->GetDataPtr(), pDataBlob->GetSize()}};
-    SerializeThis(Writer);
-    VERIFY_EXPR(Writer.IsEnded());
+        ArchiveSize += Entry.DataSize;
+    }
+
+    for (size_t dev = 0; dev < m_DeviceShaders.size(); ++dev)
+    {
+        const auto& Shaders = m_DeviceShaders[dev];
+        if (Shaders.empty())
+            continue;
+
+        Serializer<SerializerMode::Measure> Measurer;
+        ArchiveSerializer<SerializerMode::Measure>{Measurer}.SerializeShaders(Shaders);
+
+        ArchiveSize = AlignUp(ArchiveSize, size_t{ArchiveBlockAlignment});
+
+        ShaderBlocks[dev].Offset = StaticCast<Uint32>(ArchiveSize);
+        ShaderBlocks[dev].Size   = StaticCast<Uint32>(Measurer.GetSize());
+
+        ArchiveSize += ShaderBlocks[dev].Size;
+    }
+
+    // Write the data
+    auto   pDataBlob    = DataBlobImpl::Create(ArchiveSize);
+    Uint8* pArchiveData = pDataBlob->GetDataPtr<Uint8>();
+    {
+        Serializer<SerializerMode::Write> Writer{SerializedData{pArchiveData, DirectorySize}};
+        SerializeDirectory(Writer);
+        VERIFY_EXPR(Writer.IsEnded());
+    }
+
+    for (Uint32 i = 0; i < NumResources; ++i)
+    {
+        const auto&           Res   = *SortedResources[i];
+        const DirectoryEntry& Entry = Directory[i];
+
+        Serializer<SerializerMode::Write> Writer{SerializedData{pArchiveData + Entry.DataOffset, Entry.DataSize}};
+
+        auto res = ArchiveSerializer<SerializerMode::Write>{Writer}.SerializeResource(Res.first.GetName(), Res.second);
+        VERIFY(res, "Failed to serialize resource data");
+        VERIFY_EXPR(Writer.IsEnded());
+    }
+
+    for (size_t dev = 0; dev < m_DeviceShaders.size(); ++dev)
+    {
+        const DataBlock& Block = ShaderBlocks[dev];
+        if (Block.Size == 0)
+            continue;
+
+        Serializer<SerializerMode::Write> Writer{SerializedData{pArchiveData + Block.Offset, Block.Size}};
+
+        auto res = ArchiveSerializer<SerializerMode::Write>{Writer}.SerializeShaders(m_DeviceShaders[dev]);
+        VERIFY(res, "Failed to serialize shaders");
+        VERIFY_EXPR(Writer.IsEnded());
+    }
 
     *ppDataBlob = pDataBlob.Detach();
 }
@@ -352,19 +637,21 @@ const SerializedData& DeviceObjectArchive::GetDeviceSpecificData(ResourceType Ty
                                                                  const char*  Name,
                                                                  DeviceType   DevType) const noexcept
 {
-    auto it = m_NamedResources.find(NamedResourceKey{Type, Name});
-    if (it == m_NamedResources.end())
+    const auto* pRes = FindResource(Type, Name);
+    if (pRes == nullptr)
     {
         LOG_ERROR_MESSAGE("Resource '", Name, "' is not present in the archive");
         static const SerializedData NullData;
         return NullData;
     }
-    VERIFY_EXPR(SafeStrEqual(Name, it->first.GetName()));
-    return it->second.DeviceSpecific[static_cast<size_t>(DevType)];
+    VERIFY_EXPR(SafeStrEqual(Name, pRes->first.GetName()));
+    return pRes->second.DeviceSpecific[static_cast<size_t>(DevType)];
 }
 
 std::string DeviceObjectArchive::ToString() const
 {
+    LoadAllResources();
+
     std::stringstream Output;
     Output << "Archive contents:\n";
 
@@ -525,6 +812,8 @@ std::string DeviceObjectArchive::ToString() const
 
 void DeviceObjectArchive::RemoveDeviceData(DeviceType Dev) noexcept(false)
 {
+    LoadAllResources();
+
     for (auto& res_it : m_NamedResources)
         res_it.second.DeviceSpecific[static_cast<size_t>(Dev)] = {};
 
@@ -533,6 +822,9 @@ void DeviceObjectArchive::RemoveDeviceData(DeviceType Dev) noexcept(false)
 
 void DeviceObjectArchive::AppendDeviceData(const DeviceObjectArchive& Src, DeviceType Dev) noexcept(false)
 {
+    LoadAllResources();
+    Src.LoadAllResources();
+
     auto& Allocator = GetRawAllocator();
     for (auto& dst_res_it : m_NamedResources)
     {
@@ -562,6 +854,9 @@ void DeviceObjectArchive::Merge(const DeviceObjectArchive& Src) noexcept(false)
     if (m_ContentVersion != Src.m_ContentVersion)
         LOG_WARNING_MESSAGE("Merging archives with different content versions (", m_ContentVersion, " and ", Src.m_ContentVersion, ").");
 
+    LoadAllResources();
+    Src.LoadAllResources();
+
     static_assert(static_cast<size_t>(ResourceType::Count) == 8, "Did you add a new resource type? You may need to handle it here.");
 
     auto&                  Allocator = GetRawAllocator();
@@ -89,7 +89,7 @@ private:
         RefCntAutoPtr<IDataBlob> pBlob;
 
         explicit BlobHashKey(IDataBlob* _pBlob) :
-            Hash{ComputeHashRaw(_pBlob->GetConstDataPtr(), _pBlob->GetSize())},
+            Hash{ComputeHashRaw(_pBlob->GetConstDataPtr(), _pBlob->GetSize(), RawHashMethod::XXH3)},
             pBlob{_pBlob}
         {}
 
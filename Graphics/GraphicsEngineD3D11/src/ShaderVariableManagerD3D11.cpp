@@ -191,7 +191,7 @@ void ShaderVariableManagerD3D11::Initialize(const PipelineResourceSignatureD3D11
     // clang-format on
 
     VERIFY_EXPR(m_MemorySize == GetRequiredMemorySize(Signature, AllowedVarTypes, NumAllowedTypes, ShaderType));
-    TBase::Initialize(Signature, Allocator, m_MemorySize);
+    TBase::Initialize(Signature, Allocator, m_MemorySize, ShaderType);
 
     // clang-format off
     VERIFY_EXPR(ResCounters.NumCBs     == GetNumCBs()     );
@@ -98,7 +98,7 @@ void ShaderVariableManagerD3D12::Initialize(const PipelineResourceSignatureD3D12
     if (m_NumVariables == 0)
         return;
 
-    TBase::Initialize(Signature, Allocator, MemSize);
+    TBase::Initialize(Signature, Allocator, MemSize, ShaderType);
 
     Uint32 VarInd = 0;
     ProcessSignatureResources(Signature, AllowedVarTypes, NumAllowedTypes, ShaderType,
@@ -135,13 +135,7 @@ const ShaderVariableManagerD3D12::ResourceAttribs& ShaderVariableManagerD3D12::G
 
 ShaderVariableD3D12Impl* ShaderVariableManagerD3D12::GetVariable(const Char* Name) const
 {
-    for (Uint32 v = 0; v < m_NumVariables; ++v)
-    {
-        auto& Var = m_pVariables[v];
-        if (strcmp(Var.GetDesc().Name, Name) == 0)
-            return &Var;
-    }
-    return nullptr;
+    return FindVariableByName(Name);
 }
 
 
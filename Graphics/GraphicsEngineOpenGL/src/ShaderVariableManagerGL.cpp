@@ -117,7 +117,7 @@ void ShaderVariableManagerGL::Initialize(const PipelineResourceSignatureGLImpl&
     // clang-format off
     auto TotalMemorySize = m_VariableEndOffset;
     VERIFY_EXPR(TotalMemorySize == GetRequiredMemorySize(Signature, AllowedVarTypes, NumAllowedTypes, ShaderType));
-    TBase::Initialize(Signature, Allocator, TotalMemorySize);
+    TBase::Initialize(Signature, Allocator, TotalMemorySize, ShaderType);
 
     // clang-format off
     VERIFY_EXPR(Counters.NumUBs           == GetNumUBs()           );
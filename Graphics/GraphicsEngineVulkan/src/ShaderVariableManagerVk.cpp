@@ -92,7 +92,7 @@ void ShaderVariableManagerVk::Initialize(const PipelineResourceSignatureVkImpl&
     if (m_NumVariables == 0)
         return;
 
-    TBase::Initialize(Signature, Allocator, MemSize);
+    TBase::Initialize(Signature, Allocator, MemSize, ShaderType);
 
     Uint32 VarInd = 0;
     ProcessSignatureResources(Signature, AllowedVarTypes, NumAllowedTypes, ShaderType,
@@ -116,13 +116,7 @@ void ShaderVariableManagerVk::Destroy(IMemoryAllocator& Allocator)
 
 ShaderVariableVkImpl* ShaderVariableManagerVk::GetVariable(const Char* Name) const
 {
-    for (Uint32 v = 0; v < m_NumVariables; ++v)
-    {
-        ShaderVariableVkImpl& Var = m_pVariables[v];
-        if (strcmp(Var.GetDesc().Name, Name) == 0)
-            return &Var;
-    }
-    return nullptr;
+    return FindVariableByName(Name);
 }
 
 
@@ -93,7 +93,7 @@ void ShaderVariableManagerWebGPU::Initialize(const PipelineResourceSignatureWebG
     if (m_NumVariables == 0)
         return;
 
-    TBase::Initialize(Signature, Allocator, MemSize);
+    TBase::Initialize(Signature, Allocator, MemSize, ShaderType);
 
     Uint32 VarInd = 0;
     ProcessSignatureResources(Signature, AllowedVarTypes, NumAllowedTypes, ShaderType,
@@ -117,13 +117,7 @@ void ShaderVariableManagerWebGPU::Destroy(IMemoryAllocator& Allocator)
 
 ShaderVariableWebGPUImpl* ShaderVariableManagerWebGPU::GetVariable(const Char* Name) const
 {
-    for (Uint32 v = 0; v < m_NumVariables; ++v)
-    {
-        ShaderVariableWebGPUImpl& Var = m_pVariables[v];
-        if (strcmp(Var.GetDesc().Name, Name) == 0)
-            return &Var;
-    }
-    return nullptr;
+    return FindVariableByName(Name);
 }
 
 ShaderVariableWebGPUImpl* ShaderVariableManagerWebGPU::GetVariable(Uint32 Index) const
@@ -90,6 +90,31 @@ struct IBufferSuballocation : public IObject
 };
 
 
+/// Compact handle of a buffer region allocated by IBufferSuballocator::AllocateBatch().
+
+/// Unlike IBufferSuballocation, the handle is not a reference-counted object: the region
+/// must be explicitly released with IBufferSuballocator::FreeBatch() before the suballocator
+/// is destroyed.
+struct BufferSuballocationHandle
+{
+    /// The start offset of the region, in bytes.
+    Uint32 Offset = 0;
+
+    /// The region size, in bytes.
+    Uint32 Size = 0;
+
+    /// Internal data required to release the region.
+    Uint32 UnalignedOffset = ~0u;
+    Uint32 AllocatedSize   = 0;
+
+    /// Returns true if the handle references a valid region.
+    bool IsValid() const
+    {
+        return AllocatedSize != 0;
+    }
+};
+
+
 /// Buffer suballocator usage stats.
 struct BufferSuballocatorUsageStats
 {
@@ -115,6 +140,54 @@ struct BufferSuballocatorUsageStats
     }
 };
 
+/// Buffer region move computed by IBufferSuballocator::PlanDefragmentation().
+struct BufferSuballocatorDefragmentationMove
+{
+    /// The offset of the data to copy, in bytes.
+    Uint32 SrcOffset = 0;
+
+    /// The offset the data must be copied to, in bytes.
+    Uint32 DstOffset = 0;
+
+    /// The number of bytes to copy.
+    Uint32 Size = 0;
+};
+
+/// Buffer suballocator defragmentation attributes.
+struct BufferSuballocatorDefragmentationAttribs
+{
+    /// The maximum total number of bytes to move. Zero means no limit.
+    Uint64 MaxBytesToMove = 0;
+
+    /// The maximum number of moves. Zero means no limit.
+    Uint32 MaxMoves = 0;
+};
+
+/// Buffer suballocator defragmentation plan.
+struct BufferSuballocatorDefragmentationPlan
+{
+    /// A pointer to the array of NumMoves region moves.
+
+    /// The array is owned by the suballocator and remains valid until the next call
+    /// of IBufferSuballocator::PlanDefragmentation() or IBufferSuballocator::CancelDefragmentation().
+    const BufferSuballocatorDefragmentationMove* pMoves = nullptr;
+
+    /// The number of moves in pMoves array.
+    Uint32 NumMoves = 0;
+
+    /// The total number of bytes to copy.
+    Uint64 BytesToMove = 0;
+
+    /// Fragmentation of the free space before and after all moves are committed.
+    /// The value is in [0, 1] range, where 0 means that all free space is contiguous.
+    Float32 FragmentationBefore = 0;
+    Float32 FragmentationAfter  = 0;
+
+    /// The size of the largest free chunk before and after all moves are committed, in bytes.
+    Uint64 MaxFreeChunkSizeBefore = 0;
+    Uint64 MaxFreeChunkSizeAfter  = 0;
+};
+
 /// Buffer suballocator.
 struct IBufferSuballocator : public IObject
 {
@@ -151,12 +224,103 @@ struct IBufferSuballocator : public IObject
                           IBufferSuballocation** ppSuballocation) = 0;
 
 
+    /// Performs multiple suballocations from the buffer.
+
+    /// \param[in]  NumSuballocations - The number of suballocations to perform.
+    /// \param[in]  pSizes            - An array of NumSuballocations suballocation sizes, in bytes.
+    /// \param[in]  Alignment         - Required alignment of every suballocation.
+    /// \param[out] ppSuballocations  - An array of NumSuballocations pointers where the new
+    ///                                 suballocations will be stored.
+    ///
+    /// \return     The number of suballocations that were successfully performed.
+    ///
+    /// \remarks    All regions are reserved under a single lock, and the usage stats are updated once.
+    ///             If the buffer can't hold all suballocations, the pointers for the suballocations
+    ///             that failed are left null.
+    ///             The method is thread-safe and can be called from multiple threads simultaneously.
+    virtual Uint32 AllocateBatch(Uint32                 NumSuballocations,
+                                 const Uint32*          pSizes,
+                                 Uint32                 Alignment,
+                                 IBufferSuballocation** ppSuballocations) = 0;
+
+    /// Performs multiple suballocations from the buffer and returns compact handles instead of objects.
+
+    /// \param[in]  NumSuballocations - The number of suballocations to perform.
+    /// \param[in]  pSizes            - An array of NumSuballocations suballocation sizes, in bytes.
+    /// \param[in]  Alignment         - Required alignment of every suballocation.
+    /// \param[out] pHandles          - An array of NumSuballocations handles where the new
+    ///                                 regions will be written.
+    ///
+    /// \return     The number of suballocations that were successfully performed.
+    ///
+    /// \remarks    The handles for the suballocations that failed are invalid (see BufferSuballocationHandle::IsValid()).
+    ///             The regions must be released with FreeBatch() before the suballocator is destroyed.
+    ///             The method is thread-safe and can be called from multiple threads simultaneously.
+    virtual Uint32 AllocateBatch(Uint32                     NumSuballocations,
+                                 const Uint32*              pSizes,
+                                 Uint32                     Alignment,
+                                 BufferSuballocationHandle* pHandles) = 0;
+
+    /// Releases the regions previously allocated with AllocateBatch().
+
+    /// \param[in]     NumHandles - The number of handles in pHandles array.
+    /// \param[in,out] pHandles   - An array of handles to release. Invalid handles are ignored.
+    ///                             All handles are reset when the method returns.
+    ///
+    /// \remarks    All regions are released under a single lock, and the usage stats are updated once.
+    ///             The method is thread-safe and can be called from multiple threads simultaneously.
+    virtual void FreeBatch(Uint32                     NumHandles,
+                           BufferSuballocationHandle* pHandles) = 0;
+
+
+    /// Computes the set of region moves that compacts the suballocations.
+
+    /// \param[in]  Attribs - Defragmentation attributes, see Diligent::BufferSuballocatorDefragmentationAttribs.
+    /// \param[out] Plan    - Defragmentation plan, see Diligent::BufferSuballocatorDefragmentationPlan.
+    ///
+    /// \remarks    Suballocations are only moved to lower offsets into the space that is free when the
+    ///             plan is computed. The source and destination regions of the moves never overlap each
+    ///             other or any live suballocation, so the moves can be executed in any order, and
+    ///             may be spread over several frames.
+    ///
+    ///             The destination regions are reserved until the moves are committed with CommitDefragmentation()
+    ///             or canceled with CancelDefragmentation(). Any moves of the previous plan that have not been
+    ///             committed are canceled.
+    ///
+    ///             Only the suballocations represented by IBufferSuballocation objects are moved.
+    ///             The regions allocated by AllocateBatch() as handles are never moved.
+    ///
+    ///             The method is thread-safe and can be called from multiple threads simultaneously.
+    virtual void PlanDefragmentation(const BufferSuballocatorDefragmentationAttribs& Attribs,
+                                     BufferSuballocatorDefragmentationPlan&          Plan) = 0;
+
+    /// Commits the moves of the current defragmentation plan.
+
+    /// \param[in]  FirstMove - Index of the first move to commit.
+    /// \param[in]  NumMoves  - The number of moves to commit.
+    ///
+    /// \remarks    An application must call this method after it has recorded the commands that copy
+    ///             the data of the moves in the internal buffer. The method updates the offsets of the moved
+    ///             suballocations, releases their source regions and increments the suballocator version.
+    ///             An application must not use the source regions after the moves have been committed.
+    ///
+    ///             If a suballocation has been released before its move is committed, the move is ignored.
+    ///
+    ///             The method is thread-safe and can be called from multiple threads simultaneously.
+    virtual void CommitDefragmentation(Uint32 FirstMove, Uint32 NumMoves) = 0;
+
+    /// Cancels all moves of the current defragmentation plan that have not been committed.
+
+    /// \remarks    The method is thread-safe and can be called from multiple threads simultaneously.
+    virtual void CancelDefragmentation() = 0;
+
+
     /// Returns the suballocator usage stats, see Diligent::BufferSuballocatorUsageStats.
     virtual void GetUsageStats(BufferSuballocatorUsageStats& UsageStats) = 0;
 
 
     /// Returns the internal buffer version. The version is incremented every time
-    /// the buffer is expanded.
+    /// the buffer is expanded or the suballocations are moved by CommitDefragmentation().
     virtual Uint32 GetVersion() const = 0;
 };
 
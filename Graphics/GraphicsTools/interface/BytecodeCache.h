@@ -35,9 +35,37 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 struct BytecodeCacheCreateInfo
 {
     enum RENDER_DEVICE_TYPE DeviceType DEFAULT_INITIALIZER(RENDER_DEVICE_TYPE_UNDEFINED);
+
+    /// The maximum total size of the byte code kept in memory, in bytes.
+    /// When the size is exceeded, the least recently used byte code is evicted.
+    /// The byte code that references the loaded cache data does not count toward
+    /// the budget and is never evicted.
+    /// 0 means no limit.
+    Uint64 MaxSize DEFAULT_INITIALIZER(0);
 };
 typedef struct BytecodeCacheCreateInfo BytecodeCacheCreateInfo;
 
+
+/// Bytecode cache statistics.
+struct BytecodeCacheStats
+{
+    /// The number of GetBytecode() calls that found the byte code.
+    Uint64 HitCount DEFAULT_INITIALIZER(0);
+
+    /// The number of GetBytecode() calls that did not find the byte code.
+    Uint64 MissCount DEFAULT_INITIALIZER(0);
+
+    /// The number of byte code entries evicted to stay within the budget.
+    Uint64 EvictionCount DEFAULT_INITIALIZER(0);
+
+    /// The total size of the byte code kept in memory, in bytes.
+    Uint64 Size DEFAULT_INITIALIZER(0);
+
+    /// The size of the loaded cache data, in bytes.
+    Uint64 LoadedDataSize DEFAULT_INITIALIZER(0);
+};
+typedef struct BytecodeCacheStats BytecodeCacheStats;
+
 // clang-format on
 
 // {D1F8295F-F9D7-4CD4-9D13-D950FE7572C1}
@@ -53,12 +81,20 @@ static DILIGENT_CONSTEXPR INTERFACE_ID IID_BytecodeCache = {0xD1F8295F, 0xF9D7,
 // clang-format off
 
 /// Byte code cache interface
+///
+/// All methods of the byte code cache are thread-safe. The cache is intended to be
+/// shared by all threads that compile shaders.
 DILIGENT_BEGIN_INTERFACE(IBytecodeCache, IObject)
 {
     /// Loads the cache data from the binary blob
     ///
     /// \param [in] pData - A pointer to the cache data.
     /// \return     true if the data was loaded successfully, and false otherwise.
+    ///
+    /// \remarks    The cache does not copy the data, but keeps a reference to the data blob
+    ///             and looks up the byte code directly in it. The data blob may thus be backed
+    ///             by a memory-mapped file, in which case only the accessed pages are loaded.
+    ///             The data blob must not be modified while it is referenced by the cache.
     VIRTUAL bool METHOD(Load)(THIS_
                               IDataBlob* pData) PURE;
 
@@ -69,6 +105,9 @@ DILIGENT_BEGIN_INTERFACE(IBytecodeCache, IObject)
     ///                           data blob containing the byte code will be written.
     ///                           The function calls AddRef(), so that the new object will have
     ///                           one reference.
+    ///
+    /// \remarks    The byte code returned for the loaded data references the memory of the
+    ///             loaded data blob and is read-only: use IDataBlob::GetConstDataPtr() to access it.
     VIRTUAL void METHOD(GetBytecode)(THIS_
                                      const ShaderCreateInfo REF ShaderCI,
                                      IDataBlob**                ppByteCode) PURE;
@@ -104,6 +143,12 @@ DILIGENT_BEGIN_INTERFACE(IBytecodeCache, IObject)
 
     /// Clears the cache and resets it to default state.
     VIRTUAL void METHOD(Clear)(THIS) PURE;
+
+    /// Returns the cache statistics.
+
+    /// \param [out] Stats - Cache statistics.
+    VIRTUAL void METHOD(GetStats)(THIS_
+                                  BytecodeCacheStats REF Stats) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -118,6 +163,7 @@ DILIGENT_END_INTERFACE
 #    define IBytecodeCache_RemoveBytecode(This, ...) CALL_IFACE_METHOD(BytecodeCache, RemoveBytecode, This, __VA_ARGS__)
 #    define IBytecodeCache_Store(This, ...)          CALL_IFACE_METHOD(BytecodeCache, Store,          This, __VA_ARGS__)
 #    define IBytecodeCache_Clear(This)               CALL_IFACE_METHOD(BytecodeCache, Clear,          This)
+#    define IBytecodeCache_GetStats(This, ...)       CALL_IFACE_METHOD(BytecodeCache, GetStats,       This, __VA_ARGS__)
 // clang-format on
 
 #endif
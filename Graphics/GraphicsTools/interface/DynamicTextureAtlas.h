@@ -178,6 +178,22 @@ struct IDynamicTextureAtlas : public IObject
 };
 
 
+// clang-format off
+/// Dynamic texture atlas packing mode
+DILIGENT_TYPED_ENUM(DYNAMIC_TEXTURE_ATLAS_PACKING_MODE, Uint8)
+{
+    /// Free space in every slice is recursively split into non-overlapping regions.
+    /// This mode works best for regions of similar sizes.
+    DYNAMIC_TEXTURE_ATLAS_PACKING_MODE_GUILLOTINE = 0,
+
+    /// Regions are placed on top of the skyline of every slice.
+    /// This mode packs tighter when the regions have similar heights, such as glyphs,
+    /// but allocation is somewhat slower than in the guillotine mode.
+    DYNAMIC_TEXTURE_ATLAS_PACKING_MODE_SKYLINE
+};
+// clang-format on
+
+
 /// Dynamic texture atlas create information.
 struct DynamicTextureAtlasCreateInfo
 {
@@ -239,6 +255,9 @@ struct DynamicTextureAtlasCreateInfo
 
     /// Silence allocation errors.
     bool Silent = false;
+
+    /// Packing mode, see Diligent::DYNAMIC_TEXTURE_ATLAS_PACKING_MODE.
+    DYNAMIC_TEXTURE_ATLAS_PACKING_MODE PackingMode = DYNAMIC_TEXTURE_ATLAS_PACKING_MODE_GUILLOTINE;
 };
 
 
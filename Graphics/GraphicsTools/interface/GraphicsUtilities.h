@@ -34,6 +34,7 @@
 #include "../../GraphicsEngine/interface/Buffer.h"
 #include "../../GraphicsEngine/interface/RenderDevice.h"
 #include "../../../Common/interface/GeometryPrimitives.h"
+#include "../../../Common/interface/ThreadPool.h"
 
 DILIGENT_BEGIN_NAMESPACE(Diligent)
 
@@ -139,6 +140,69 @@ typedef struct ComputeMipLevelAttribs ComputeMipLevelAttribs;
 void DILIGENT_GLOBAL_FUNCTION(ComputeMipLevel)(const ComputeMipLevelAttribs REF Attribs);
 
 
+// clang-format off
+
+/// ComputeMipChain function attributes
+struct ComputeMipChainAttribs
+{
+    /// Texture format.
+    TEXTURE_FORMAT Format         DEFAULT_INITIALIZER(TEX_FORMAT_UNKNOWN);
+
+    /// The width of the most detailed mip level.
+    Uint32 Width                  DEFAULT_INITIALIZER(0);
+
+    /// The height of the most detailed mip level.
+    Uint32 Height                 DEFAULT_INITIALIZER(0);
+
+    /// Pointer to the most detailed mip level data.
+    const void* pFineMipData      DEFAULT_INITIALIZER(nullptr);
+
+    /// The most detailed mip level data stride, in bytes.
+    size_t FineMipStride          DEFAULT_INITIALIZER(0);
+
+    /// The number of coarse mip levels to compute.
+    ///
+    /// \remarks    The number must not exceed the number of mip levels in the full
+    ///             mip chain minus one (see ComputeMipLevelsCount()).
+    Uint32 NumCoarseMips          DEFAULT_INITIALIZER(0);
+
+    /// An array of NumCoarseMips pointers to the coarse mip level data.
+    /// Element i is the data of mip level i + 1.
+    void* const* ppCoarseMipData  DEFAULT_INITIALIZER(nullptr);
+
+    /// An array of NumCoarseMips coarse mip level strides, in bytes.
+    const size_t* pCoarseMipStrides DEFAULT_INITIALIZER(nullptr);
+
+    /// Filter type, see ComputeMipLevelAttribs::FilterType.
+    MIP_FILTER_TYPE FilterType    DEFAULT_INITIALIZER(MIP_FILTER_TYPE_DEFAULT);
+
+    /// Alpha cutoff value, see ComputeMipLevelAttribs::AlphaCutoff.
+    float AlphaCutoff             DEFAULT_INITIALIZER(0);
+
+    /// An optional thread pool to use to process the mip levels in parallel.
+    IThreadPool* pThreadPool      DEFAULT_INITIALIZER(nullptr);
+};
+typedef struct ComputeMipChainAttribs ComputeMipChainAttribs;
+// clang-format on
+
+/// Computes coarse mip levels of a texture from the most detailed level.
+
+/// \remarks    The result is the same as the result of calling ComputeMipLevel() for every
+///             level in turn, but the levels are computed in one pass over the texture:
+///             the texture is processed by horizontal bands of rows, and all coarse levels
+///             of a band are computed while its data are in the cache.
+///
+///             RGBA8 (UNORM and sRGB) as well as 16- and 32-bit float formats with
+///             one, two or four components are filtered by SIMD kernels.
+///
+///             If a thread pool is given, the bands are processed in parallel.
+///
+///             BC1, BC2, BC3, BC4, BC5 and BC7 levels are decoded, filtered in the uncompressed
+///             format and encoded back with the normal compression quality (see EncodeBC()).
+///             ComputeMipLevel() handles these formats the same way.
+void DILIGENT_GLOBAL_FUNCTION(ComputeMipChain)(const ComputeMipChainAttribs REF Attribs);
+
+
 /// Creates a sparse texture in Metal backend.
 
 /// \param [in]  pDevice   - A pointer to the render device.
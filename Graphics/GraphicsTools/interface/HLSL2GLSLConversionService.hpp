@@ -0,0 +1,187 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of a HLSL2GLSLConversionService class
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "../../GraphicsEngine/interface/Shader.h"
+#include "../../../Primitives/interface/DataBlob.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "../../../Common/interface/ThreadPool.h"
+#include "XXH128Hasher.hpp"
+
+namespace Diligent
+{
+
+/// HLSL to GLSL conversion service create information.
+struct HLSL2GLSLConversionServiceCreateInfo
+{
+    /// Shader source input stream factory that is used to load shader sources
+    /// and includes.
+    IShaderSourceInputStreamFactory* pSourceStreamFactory = nullptr;
+
+    /// An optional thread pool that is used by ConvertBatch().
+    /// If null, all conversions are performed by the calling thread.
+    IThreadPool* pThreadPool = nullptr;
+};
+
+
+/// Caches HLSL to GLSL conversion results and converts shaders concurrently.
+
+/// The service keeps the converted GLSL source of every conversion keyed by the 128-bit hash
+/// of the shader source and conversion attributes, so that converting the same shader again
+/// returns the cached result.
+///
+/// The source of every shader is loaded, expanded with includes and tokenized only once.
+/// All conversions of the same source (e.g. different entry points and shader stages)
+/// start from a copy of the tokenized source.
+///
+/// The converter does not expand shader macros: preprocessor directives are copied to the GLSL
+/// source as is. Shader permutations that only differ by macros thus share the same conversion.
+///
+/// All methods of the class are thread-safe.
+class HLSL2GLSLConversionService
+{
+public:
+    /// Conversion attributes, see HLSL2GLSLConverterImpl::ConversionAttribs.
+    struct ConversionAttribs
+    {
+        /// HLSL source code. Can be null, in which case the source code will be loaded from the
+        /// input stream factory using InputFileName.
+        const Char* HLSLSource = nullptr;
+
+        /// Number of symbols in HLSLSource string. Ignored if HLSLSource is null.
+        size_t NumSymbols = 0;
+
+        /// Input file name. If HLSLSource is not null, this name will only be used for
+        /// information purposes.
+        const Char* InputFileName = nullptr;
+
+        /// Shader entry point.
+        const Char* EntryPoint = nullptr;
+
+        /// Shader type. See Diligent::SHADER_TYPE.
+        SHADER_TYPE ShaderType = SHADER_TYPE_UNKNOWN;
+
+        /// Whether to include GLSL definitions supporting HLSL->GLSL conversion.
+        bool IncludeDefinitions = false;
+
+        /// Combined texture sampler suffix.
+        const Char* SamplerSuffix = "_sampler";
+
+        /// Whether to use in-out location qualifiers.
+        bool UseInOutLocationQualifiers = true;
+
+        /// Whether to add layout(row_major) qualifier to uniform blocks.
+        bool UseRowMajorMatrices = false;
+    };
+
+    /// Conversion statistics.
+    struct Statistics
+    {
+        /// The total number of conversion requests.
+        Uint32 NumRequests = 0;
+
+        /// The number of requests that were served from the cache.
+        Uint32 NumCacheHits = 0;
+
+        /// The number of shader sources that were loaded and tokenized.
+        Uint32 NumSourcesParsed = 0;
+
+        /// The number of conversion failures.
+        Uint32 NumFailures = 0;
+    };
+
+    explicit HLSL2GLSLConversionService(const HLSL2GLSLConversionServiceCreateInfo& CreateInfo);
+    ~HLSL2GLSLConversionService();
+
+    // clang-format off
+    HLSL2GLSLConversionService           (const HLSL2GLSLConversionService&)  = delete;
+    HLSL2GLSLConversionService& operator=(const HLSL2GLSLConversionService&)  = delete;
+    HLSL2GLSLConversionService           (      HLSL2GLSLConversionService&&) = delete;
+    HLSL2GLSLConversionService& operator=(      HLSL2GLSLConversionService&&) = delete;
+    // clang-format on
+
+    /// Converts HLSL source to GLSL.
+
+    /// \param [in] Attribs - Conversion attributes.
+    /// \return     The data blob containing the converted GLSL source code, or null
+    ///             if the conversion failed.
+    ///
+    /// \remarks    The returned blob may be shared with other callers and must not be modified.
+    RefCntAutoPtr<IDataBlob> Convert(const ConversionAttribs& Attribs);
+
+    /// Converts a batch of shaders.
+
+    /// \param [in]  pAttribs     - Array of NumShaders conversion attributes.
+    /// \param [in]  NumShaders   - The number of shaders to convert.
+    /// \param [out] ppGLSLSource - Array of NumShaders data blob pointers that receive the
+    ///                             converted GLSL sources. Failed conversions are set to null.
+    ///
+    /// \remarks    The shaders are converted in parallel by the thread pool set in the
+    ///             create info and the calling thread.
+    void ConvertBatch(const ConversionAttribs*  pAttribs,
+                      Uint32                    NumShaders,
+                      RefCntAutoPtr<IDataBlob>* ppGLSLSource);
+
+    /// Releases all cached conversion results and tokenized sources.
+
+    /// \remarks    The application must call this method when shader source files are modified.
+    void Reset();
+
+    /// Returns the conversion statistics.
+    Statistics GetStatistics() const;
+
+private:
+    struct SourceCacheEntry;
+
+    std::shared_ptr<SourceCacheEntry> GetSourceCacheEntry(const XXH128Hash& SourceHash);
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> m_pSourceStreamFactory;
+    RefCntAutoPtr<IThreadPool>                     m_pThreadPool;
+
+    std::mutex m_SourcesMtx;
+    // Source hash -> tokenized source
+    std::unordered_map<XXH128Hash, std::shared_ptr<SourceCacheEntry>> m_Sources;
+
+    std::mutex m_ResultsMtx;
+    // Source and conversion attributes hash -> GLSL source
+    std::unordered_map<XXH128Hash, RefCntAutoPtr<IDataBlob>> m_Results;
+
+    std::atomic<Uint32> m_NumRequests{0};
+    std::atomic<Uint32> m_NumCacheHits{0};
+    std::atomic<Uint32> m_NumSourcesParsed{0};
+    std::atomic<Uint32> m_NumFailures{0};
+};
+
+} // namespace Diligent
@@ -135,6 +135,8 @@ DILIGENT_BEGIN_INTERFACE(IRenderStateCache, IObject)
     /// \note       If the data were not copied, the cache will keep a strong reference
     ///             to the pCacheData data blob. It will be kept alive until the cache object
     ///             is released or the Reset() method is called.
+    ///             This allows loading the cache from a memory-mapped file (see
+    ///             FileWrapper::MapWholeFile()) without reading it into memory.
     ///
     /// \warning    If the data were loaded without making a copy, the application
     ///             must not modify it while it is in use by the cache object.
@@ -29,6 +29,8 @@
 /// \file
 /// C++ struct wrappers for render state cache.
 
+#include <cstdio>
+
 #include "RenderStateCache.h"
 #include "../../GraphicsEngine/interface/GraphicsTypesX.hpp"
 #include "../../../Common/interface/FileWrapper.hpp"
@@ -171,15 +173,10 @@ public:
         if (!FileSystem::FileExists(FilePath))
             return;
 
-        FileWrapper CacheDataFile{FilePath};
-        if (!CacheDataFile)
-        {
-            LOG_ERROR_MESSAGE("Failed to open render state cache file ", FilePath);
-            return;
-        }
-
-        auto pCacheData = DataBlobImpl::Create();
-        if (!CacheDataFile->Read(pCacheData))
+        // Map the file rather than read it: the cache references the data without
+        // copying it, and objects are only read from the file when they are requested.
+        RefCntAutoPtr<IDataBlob> pCacheData;
+        if (!FileWrapper::MapWholeFile(FilePath, &pCacheData, EMappedFileAccessHint::Random, /*Silent = */ true))
         {
             LOG_ERROR_MESSAGE("Failed to read render state cache file ", FilePath);
             return;
@@ -209,9 +206,33 @@ public:
         {
             if (pCacheData)
             {
-                FileWrapper CacheDataFile{FilePath, EFileAccessMode::Overwrite};
-                if (CacheDataFile->Write(pCacheData->GetConstDataPtr(), pCacheData->GetSize()))
+                // The loaded cache file may be memory-mapped and referenced by both the cache and the new data,
+                // so it must not be truncated. Write the data to a temporary file and replace the original one.
+                const std::string TmpFilePath = std::string{FilePath} + ".tmp";
+                if (FileWrapper::WriteFile(TmpFilePath.c_str(), pCacheData->GetConstDataPtr(), pCacheData->GetSize()))
+                {
+                    bool Replaced = std::rename(TmpFilePath.c_str(), FilePath) == 0;
+#if PLATFORM_WIN32 || PLATFORM_UNIVERSAL_WINDOWS
+                    // On Windows, rename fails if the destination file exists
+                    if (!Replaced && std::remove(FilePath) == 0)
+                    {
+                        if (std::rename(TmpFilePath.c_str(), FilePath) != 0)
+                        {
+                            // The original file is gone: keep the new data in the temporary file
+                            LOG_ERROR_MESSAGE("Failed to rename ", TmpFilePath, " to state cache file ", FilePath);
+                            return;
+                        }
+                        Replaced = true;
+                    }
+#endif
+                    if (!Replaced)
+                    {
+                        LOG_ERROR_MESSAGE("Failed to replace state cache file ", FilePath);
+                        std::remove(TmpFilePath.c_str());
+                        return;
+                    }
                     LOG_INFO_MESSAGE("Successfully saved state cache file ", FilePath, " (", FormatMemorySize(pCacheData->GetSize()), ").");
+                }
             }
         }
         else
@@ -87,6 +87,26 @@ struct IVertexPoolAllocation : public IObject
 };
 
 
+/// Compact handle of a vertex range allocated by IVertexPool::AllocateBatch().
+
+/// Unlike IVertexPoolAllocation, the handle is not a reference-counted object: the range
+/// must be explicitly released with IVertexPool::FreeBatch() before the pool is destroyed.
+struct VertexPoolAllocationHandle
+{
+    /// The start vertex of the allocation.
+    Uint32 StartVertex = 0;
+
+    /// The number of vertices in the allocation.
+    Uint32 VertexCount = 0;
+
+    /// Returns true if the handle references a valid allocation.
+    bool IsValid() const
+    {
+        return VertexCount != 0;
+    }
+};
+
+
 /// Vertex pool usage stats.
 struct VertexPoolUsageStats
 {
@@ -117,6 +137,54 @@ struct VertexPoolUsageStats
 };
 
 
+/// Vertex range move computed by IVertexPool::PlanDefragmentation().
+struct VertexPoolDefragmentationMove
+{
+    /// The first vertex of the range to copy.
+    Uint32 SrcVertex = 0;
+
+    /// The vertex the range must be copied to.
+    Uint32 DstVertex = 0;
+
+    /// The number of vertices to copy.
+    Uint32 VertexCount = 0;
+};
+
+/// Vertex pool defragmentation attributes.
+struct VertexPoolDefragmentationAttribs
+{
+    /// The maximum total number of vertices to move. Zero means no limit.
+    Uint32 MaxVerticesToMove = 0;
+
+    /// The maximum number of moves. Zero means no limit.
+    Uint32 MaxMoves = 0;
+};
+
+/// Vertex pool defragmentation plan.
+struct VertexPoolDefragmentationPlan
+{
+    /// A pointer to the array of NumMoves vertex range moves.
+
+    /// The array is owned by the pool and remains valid until the next call
+    /// of IVertexPool::PlanDefragmentation() or IVertexPool::CancelDefragmentation().
+    const VertexPoolDefragmentationMove* pMoves = nullptr;
+
+    /// The number of moves in pMoves array.
+    Uint32 NumMoves = 0;
+
+    /// The total number of vertices to copy.
+    Uint64 VerticesToMove = 0;
+
+    /// Fragmentation of the free space before and after all moves are committed.
+    /// The value is in [0, 1] range, where 0 means that all free space is contiguous.
+    Float32 FragmentationBefore = 0;
+    Float32 FragmentationAfter  = 0;
+
+    /// The largest contiguous free vertex range before and after all moves are committed.
+    Uint64 MaxFreeVertexCountBefore = 0;
+    Uint64 MaxFreeVertexCountAfter  = 0;
+};
+
 /// Vertex pool element description.
 struct VertexPoolElementDesc
 {
@@ -250,11 +318,97 @@ struct IVertexPool : public IObject
                           IVertexPoolAllocation** ppAllocation) = 0;
 
 
+    /// Performs multiple allocations from the pool.
+
+    /// \param[in]  NumAllocations - The number of allocations to perform.
+    /// \param[in]  pNumVertices   - An array of NumAllocations vertex counts.
+    /// \param[out] ppAllocations  - An array of NumAllocations pointers where the new
+    ///                              allocations will be stored.
+    ///
+    /// \return     The number of allocations that were successfully performed.
+    ///
+    /// \remarks    All ranges are reserved under a single lock, and the usage stats are updated once.
+    ///             If the pool can't hold all allocations, the pointers for the allocations
+    ///             that failed are left null.
+    ///             The method is thread-safe and can be called from multiple threads simultaneously.
+    virtual Uint32 AllocateBatch(Uint32                  NumAllocations,
+                                 const Uint32*           pNumVertices,
+                                 IVertexPoolAllocation** ppAllocations) = 0;
+
+    /// Performs multiple allocations from the pool and returns compact handles instead of objects.
+
+    /// \param[in]  NumAllocations - The number of allocations to perform.
+    /// \param[in]  pNumVertices   - An array of NumAllocations vertex counts.
+    /// \param[out] pHandles       - An array of NumAllocations handles where the new
+    ///                              vertex ranges will be written.
+    ///
+    /// \return     The number of allocations that were successfully performed.
+    ///
+    /// \remarks    The handles for the allocations that failed are invalid (see VertexPoolAllocationHandle::IsValid()).
+    ///             The ranges must be released with FreeBatch() before the pool is destroyed.
+    ///             The method is thread-safe and can be called from multiple threads simultaneously.
+    virtual Uint32 AllocateBatch(Uint32                      NumAllocations,
+                                 const Uint32*               pNumVertices,
+                                 VertexPoolAllocationHandle* pHandles) = 0;
+
+    /// Releases the vertex ranges previously allocated with AllocateBatch().
+
+    /// \param[in]     NumHandles - The number of handles in pHandles array.
+    /// \param[in,out] pHandles   - An array of handles to release. Invalid handles are ignored.
+    ///                             All handles are reset when the method returns.
+    ///
+    /// \remarks    All ranges are released under a single lock, and the usage stats are updated once.
+    ///             The method is thread-safe and can be called from multiple threads simultaneously.
+    virtual void FreeBatch(Uint32                      NumHandles,
+                           VertexPoolAllocationHandle* pHandles) = 0;
+
+
+    /// Computes the set of vertex range moves that compacts the allocations.
+
+    /// \param[in]  Attribs - Defragmentation attributes, see Diligent::VertexPoolDefragmentationAttribs.
+    /// \param[out] Plan    - Defragmentation plan, see Diligent::VertexPoolDefragmentationPlan.
+    ///
+    /// \remarks    The ranges must be copied in every internal buffer. Allocations are only moved
+    ///             to lower vertices into the space that is free when the plan is computed, so the
+    ///             moves never overlap each other or any live allocation. They can be executed in
+    ///             any order, and may be spread over several frames.
+    ///
+    ///             The destination ranges are reserved until the moves are committed with CommitDefragmentation()
+    ///             or canceled with CancelDefragmentation(). Any moves of the previous plan that have not been
+    ///             committed are canceled.
+    ///
+    ///             Only the allocations represented by IVertexPoolAllocation objects are moved.
+    ///             The ranges allocated by AllocateBatch() as handles are never moved.
+    ///
+    ///             The method is thread-safe and can be called from multiple threads simultaneously.
+    virtual void PlanDefragmentation(const VertexPoolDefragmentationAttribs& Attribs,
+                                     VertexPoolDefragmentationPlan&          Plan) = 0;
+
+    /// Commits the moves of the current defragmentation plan.
+
+    /// \param[in]  FirstMove - Index of the first move to commit.
+    /// \param[in]  NumMoves  - The number of moves to commit.
+    ///
+    /// \remarks    An application must call this method after it has recorded the commands that copy
+    ///             the vertex data of the moves in all internal buffers. The method updates the start
+    ///             vertices of the moved allocations, releases their source ranges and increments the pool
+    ///             version. An application must not use the source ranges after the moves have been committed.
+    ///
+    ///             If an allocation has been released before its move is committed, the move is ignored.
+    ///
+    ///             The method is thread-safe and can be called from multiple threads simultaneously.
+    virtual void CommitDefragmentation(Uint32 FirstMove, Uint32 NumMoves) = 0;
+
+    /// Cancels all moves of the current defragmentation plan that have not been committed.
+
+    /// \remarks    The method is thread-safe and can be called from multiple threads simultaneously.
+    virtual void CancelDefragmentation() = 0;
+
     /// Returns the usage stats, see Diligent::VertexPoolUsageStats.
     virtual void GetUsageStats(VertexPoolUsageStats& UsageStats) = 0;
 
     /// Returns the internal buffer version. The version is incremented every time
-    /// any internal buffer is recreated.
+    /// any internal buffer is recreated or the allocations are moved by CommitDefragmentation().
     virtual Uint32 GetVersion() const = 0;
 
     /// Returns the pool description.
@@ -47,6 +47,11 @@ struct XXH128Hash
     {
         return LowPart == RHS.LowPart && HighPart == RHS.HighPart;
     }
+
+    constexpr bool operator!=(const XXH128Hash& RHS) const noexcept
+    {
+        return !(*this == RHS);
+    }
 };
 
 struct XXH128State final
@@ -170,6 +175,27 @@ private:
     XXH3_state_s* m_State = nullptr;
 };
 
+/// Sets the maximum number of shader source files whose content hashes are cached by XXH128State::Update(const ShaderCreateInfo&).
+/// When the number is exceeded, the least recently used files are evicted.
+/// \param [in] MaxNumFiles - The maximum number of cached files. Zero, which is the default value,
+///                           disables the cache, so that the files are read and hashed every time.
+///
+/// \remarks   When the cache is enabled, shader source files loaded through a stream factory are read
+///            and hashed once, and the results are reused for all subsequent shaders. The cached hashes
+///            are discarded when the shared shader source file cache is invalidated with InvalidateShaderSourceFileCache()
+///            or when the default factory reloads a modified file, see GetShaderSourceFileCacheGeneration().
+///            The cached hashes themselves are not checked against the file modification times, so other
+///            modifications of the files (e.g. when shaders are hot-reloaded) require InvalidateShaderSourceHashCache().
+void SetShaderSourceHashCacheMaxSize(size_t MaxNumFiles);
+
+/// Invalidates the cached content hashes of the shader source files used by XXH128State::Update(const ShaderCreateInfo&),
+/// see SetShaderSourceHashCacheMaxSize().
+/// \param [in] pStreamFactory - Shader source stream factory whose files should be invalidated.
+///                              If null, the files of all factories are invalidated.
+/// \param [in] FilePath       - Path of the file to invalidate. If null, all files of the
+///                              factory are invalidated.
+void InvalidateShaderSourceHashCache(IShaderSourceInputStreamFactory* pStreamFactory = nullptr, const char* FilePath = nullptr);
+
 } // namespace Diligent
 
 namespace std
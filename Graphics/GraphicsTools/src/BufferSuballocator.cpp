@@ -29,12 +29,14 @@
 
 #include <mutex>
 #include <atomic>
+#include <vector>
 
 #include "DebugUtilities.hpp"
 #include "ObjectBase.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "DynamicBuffer.hpp"
 #include "VariableSizeAllocationsManager.hpp"
+#include "DefragmentationPlanner.hpp"
 #include "Align.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
 #include "FixedBlockMemoryAllocator.hpp"
@@ -52,13 +54,15 @@ public:
                             BufferSuballocatorImpl*                      pParentAllocator,
                             Uint32                                       Offset,
                             Uint32                                       Size,
+                            Uint32                                       Alignment,
                             VariableSizeAllocationsManager::Allocation&& Subregion) :
         // clang-format off
         TBase             {pRefCounters},
         m_pParentAllocator{pParentAllocator},
         m_Subregion       {std::move(Subregion)},
         m_Offset          {Offset},
-        m_Size            {Size}
+        m_Size            {Size},
+        m_Alignment       {Alignment}
     // clang-format on
     {
         VERIFY_EXPR(m_pParentAllocator);
@@ -83,7 +87,7 @@ public:
 
     virtual Uint32 GetOffset() const override final
     {
-        return m_Offset;
+        return m_Offset.load();
     }
 
     virtual Uint32 GetSize() const override final
@@ -108,12 +112,25 @@ public:
     }
 
 private:
+    friend class BufferSuballocatorImpl;
+
     RefCntAutoPtr<BufferSuballocatorImpl> m_pParentAllocator;
 
+    // The members below are protected by the parent allocator mutex.
     VariableSizeAllocationsManager::Allocation m_Subregion;
 
-    const Uint32 m_Offset;
+    // The list of all suballocations of the parent allocator.
+    BufferSuballocationImpl* m_pPrev = nullptr;
+    BufferSuballocationImpl* m_pNext = nullptr;
+
+    // Index of the pending defragmentation move.
+    Uint32 m_PendingMove = ~0u;
+
+    // The offset is changed by the defragmentation.
+    std::atomic<Uint32> m_Offset;
+
     const Uint32 m_Size;
+    const Uint32 m_Alignment;
 
     RefCntAutoPtr<IObject> m_pUserData;
 };
@@ -171,6 +188,7 @@ public:
     ~BufferSuballocatorImpl()
     {
         VERIFY_EXPR(m_AllocationCount.load() == 0);
+        VERIFY_EXPR(m_pSuballocations == nullptr);
     }
 
     virtual IBuffer* Update(IRenderDevice* pDevice, IDeviceContext* pContext) override final
@@ -217,73 +235,231 @@ public:
 
         DEV_CHECK_ERR(*ppSuballocation == nullptr, "Overwriting reference to existing object may cause memory leaks");
 
-        VariableSizeAllocationsManager::Allocation Subregion;
         {
             std::lock_guard<std::mutex> Lock{m_MgrMtx};
 
+            SyncMgrSize();
+            VariableSizeAllocationsManager::Allocation Subregion = AllocateSubregion(Size, Alignment);
+            if (Subregion.IsValid())
+                CreateSuballocation(Size, Alignment, std::move(Subregion), ppSuballocation);
+            UpdateUsageStats();
+        }
+
+        if (*ppSuballocation != nullptr)
+            m_AllocationCount.fetch_add(1);
+    }
+
+    virtual Uint32 AllocateBatch(Uint32                 NumSuballocations,
+                                 const Uint32*          pSizes,
+                                 Uint32                 Alignment,
+                                 IBufferSuballocation** ppSuballocations) override final
+    {
+        if (!VerifyBatchArgs(NumSuballocations, pSizes, Alignment, ppSuballocations))
+            return 0;
+
+        Uint32 NumAllocated = 0;
+        {
+            std::lock_guard<std::mutex> Lock{m_MgrMtx};
+
+            SyncMgrSize();
+            for (Uint32 i = 0; i < NumSuballocations; ++i)
             {
-                // After the resize, the actual buffer size may be larger due to alignment
-                // requirements (for sparse buffers, the size is aligned by the memory page size).
-                const auto BufferSize = m_BufferSize.load();
-                const auto MgrSize    = m_Mgr.GetMaxSize();
-                if (BufferSize > MgrSize)
+                DEV_CHECK_ERR(ppSuballocations[i] == nullptr, "Overwriting reference to existing object may cause memory leaks");
+                VariableSizeAllocationsManager::Allocation Subregion = AllocateSubregion(pSizes[i], Alignment);
+                if (Subregion.IsValid())
                 {
-                    m_Mgr.Extend(StaticCast<size_t>(BufferSize - MgrSize));
-                    VERIFY_EXPR(m_Mgr.GetMaxSize() == BufferSize);
-                    m_MgrSize.store(m_Mgr.GetMaxSize());
+                    CreateSuballocation(pSizes[i], Alignment, std::move(Subregion), &ppSuballocations[i]);
+                    ++NumAllocated;
                 }
             }
+            UpdateUsageStats();
+        }
+        m_AllocationCount.fetch_add(static_cast<Int32>(NumAllocated));
 
-            Subregion = m_Mgr.Allocate(Size, Alignment);
+        return NumAllocated;
+    }
 
-            while (!Subregion.IsValid() && (m_MaxSize == 0 || m_MaxSize > m_Mgr.GetMaxSize()))
-            {
-                size_t ExtraSize = m_ExpansionSize != 0 ?
-                    std::max(m_ExpansionSize, AlignUp(Size, Alignment)) :
-                    m_Mgr.GetMaxSize();
+    virtual Uint32 AllocateBatch(Uint32                     NumSuballocations,
+                                 const Uint32*              pSizes,
+                                 Uint32                     Alignment,
+                                 BufferSuballocationHandle* pHandles) override final
+    {
+        if (!VerifyBatchArgs(NumSuballocations, pSizes, Alignment, pHandles))
+            return 0;
 
-                if (m_MaxSize != 0)
-                    ExtraSize = std::min(ExtraSize, StaticCast<size_t>(m_MaxSize) - m_Mgr.GetMaxSize());
+        Uint32 NumAllocated = 0;
+        {
+            std::lock_guard<std::mutex> Lock{m_MgrMtx};
 
-                m_Mgr.Extend(ExtraSize);
-                m_MgrSize.store(m_Mgr.GetMaxSize());
+            SyncMgrSize();
+            for (Uint32 i = 0; i < NumSuballocations; ++i)
+            {
+                VariableSizeAllocationsManager::Allocation Subregion = AllocateSubregion(pSizes[i], Alignment);
 
-                Subregion = m_Mgr.Allocate(Size, Alignment);
+                BufferSuballocationHandle& Handle = pHandles[i];
+                Handle                            = {};
+                if (Subregion.IsValid())
+                {
+                    Handle.Offset          = AlignUp(static_cast<Uint32>(Subregion.UnalignedOffset), Alignment);
+                    Handle.Size            = pSizes[i];
+                    Handle.UnalignedOffset = static_cast<Uint32>(Subregion.UnalignedOffset);
+                    Handle.AllocatedSize   = static_cast<Uint32>(Subregion.Size);
+                    ++NumAllocated;
+                }
             }
-
             UpdateUsageStats();
         }
+        m_AllocationCount.fetch_add(static_cast<Int32>(NumAllocated));
+
+        return NumAllocated;
+    }
+
+    virtual void FreeBatch(Uint32                     NumHandles,
+                           BufferSuballocationHandle* pHandles) override final
+    {
+        if (NumHandles == 0)
+            return;
+
+        if (pHandles == nullptr)
+        {
+            UNEXPECTED("pHandles must not be null");
+            return;
+        }
 
-        if (Subregion.IsValid())
+        Int32 NumFreed = 0;
         {
-            // clang-format off
-            BufferSuballocationImpl* pSuballocation{
-                NEW_RC_OBJ(m_SuballocationsAllocator, "BufferSuballocationImpl instance", BufferSuballocationImpl)
-                (
-                    this,
-                    AlignUp(static_cast<Uint32>(Subregion.UnalignedOffset), Alignment),
-                    Size,
-                    std::move(Subregion)
-                )
-            };
-            // clang-format on
-
-            pSuballocation->QueryInterface(IID_BufferSuballocation, reinterpret_cast<IObject**>(ppSuballocation));
-            m_AllocationCount.fetch_add(1);
+            std::lock_guard<std::mutex> Lock{m_MgrMtx};
+            for (Uint32 i = 0; i < NumHandles; ++i)
+            {
+                BufferSuballocationHandle& Handle = pHandles[i];
+                if (Handle.IsValid())
+                {
+                    m_Mgr.Free(Handle.UnalignedOffset, Handle.AllocatedSize);
+                    ++NumFreed;
+                }
+                Handle = {};
+            }
+            UpdateUsageStats();
         }
+        m_AllocationCount.fetch_add(-NumFreed);
     }
 
-    void Free(VariableSizeAllocationsManager::Allocation&& Subregion)
+    void Free(BufferSuballocationImpl& Suballocation)
     {
         std::lock_guard<std::mutex> Lock{m_MgrMtx};
-        m_Mgr.Free(std::move(Subregion));
+        if (Suballocation.m_PendingMove != ~0u)
+        {
+            // Release the destination region of the move that will never be committed
+            PendingMove& Move = m_PendingMoves[Suballocation.m_PendingMove];
+            VERIFY_EXPR(Move.pSuballocation == &Suballocation);
+            DefragmentationPlanner::CancelMove(m_Mgr, Move.Move);
+            Move.pSuballocation = nullptr;
+        }
+        m_Mgr.Free(std::move(Suballocation.m_Subregion));
+
+        // Remove the suballocation from the list
+        if (Suballocation.m_pPrev != nullptr)
+            Suballocation.m_pPrev->m_pNext = Suballocation.m_pNext;
+        else
+            m_pSuballocations = Suballocation.m_pNext;
+        if (Suballocation.m_pNext != nullptr)
+            Suballocation.m_pNext->m_pPrev = Suballocation.m_pPrev;
+
         m_AllocationCount.fetch_add(-1);
         UpdateUsageStats();
     }
 
+    virtual void PlanDefragmentation(const BufferSuballocatorDefragmentationAttribs& Attribs,
+                                     BufferSuballocatorDefragmentationPlan&          Plan) override final
+    {
+        Plan = {};
+
+        std::lock_guard<std::mutex> Lock{m_MgrMtx};
+
+        CancelPendingMoves();
+
+        std::vector<BufferSuballocationImpl*>               Suballocations;
+        std::vector<DefragmentationPlanner::AllocationDesc> Allocations;
+        for (BufferSuballocationImpl* pSuballoc = m_pSuballocations; pSuballoc != nullptr; pSuballoc = pSuballoc->m_pNext)
+        {
+            Suballocations.push_back(pSuballoc);
+            Allocations.push_back({pSuballoc->m_Subregion, pSuballoc->m_Alignment});
+        }
+
+        DefragmentationPlanner::Limits Limits;
+        Limits.MaxBytesToMove = StaticCast<size_t>(std::min(Attribs.MaxBytesToMove, Uint64{m_Mgr.GetMaxSize()}));
+        Limits.MaxMoves       = Attribs.MaxMoves;
+
+        DefragmentationPlanner::Plan DefragPlan = DefragmentationPlanner::ComputePlan(m_Mgr, Allocations.data(), static_cast<Uint32>(Allocations.size()), Limits);
+
+        m_PendingMoves.reserve(DefragPlan.Moves.size());
+        m_CopyList.reserve(DefragPlan.Moves.size());
+        for (const DefragmentationPlanner::Move& Move : DefragPlan.Moves)
+        {
+            BufferSuballocationImpl* pSuballoc = Suballocations[Move.AllocationIndex];
+            VERIFY_EXPR(pSuballoc->m_Offset.load() == Move.SrcOffset);
+            pSuballoc->m_PendingMove = static_cast<Uint32>(m_PendingMoves.size());
+            m_PendingMoves.push_back({pSuballoc, Move});
+
+            BufferSuballocatorDefragmentationMove CopyInfo;
+            CopyInfo.SrcOffset = static_cast<Uint32>(Move.SrcOffset);
+            CopyInfo.DstOffset = static_cast<Uint32>(Move.DstOffset);
+            CopyInfo.Size      = pSuballoc->m_Size;
+            m_CopyList.push_back(CopyInfo);
+        }
+        UpdateUsageStats();
+
+        Plan.pMoves                 = m_CopyList.data();
+        Plan.NumMoves               = static_cast<Uint32>(m_CopyList.size());
+        Plan.BytesToMove            = DefragPlan.BytesToMove;
+        Plan.FragmentationBefore    = static_cast<Float32>(DefragPlan.FragmentationBefore);
+        Plan.FragmentationAfter     = static_cast<Float32>(DefragPlan.FragmentationAfter);
+        Plan.MaxFreeChunkSizeBefore = DefragPlan.MaxFreeBlockSizeBefore;
+        Plan.MaxFreeChunkSizeAfter  = DefragPlan.MaxFreeBlockSizeAfter;
+    }
+
+    virtual void CommitDefragmentation(Uint32 FirstMove, Uint32 NumMoves) override final
+    {
+        std::lock_guard<std::mutex> Lock{m_MgrMtx};
+
+        if (FirstMove + NumMoves > m_PendingMoves.size())
+        {
+            UNEXPECTED("Moves [", FirstMove, ", ", FirstMove + NumMoves, ") are out of range: the plan contains only ", m_PendingMoves.size(), " moves.");
+            return;
+        }
+
+        bool Moved = false;
+        for (Uint32 i = FirstMove; i < FirstMove + NumMoves; ++i)
+        {
+            PendingMove& Move = m_PendingMoves[i];
+            if (Move.pSuballocation == nullptr)
+                continue; // The move has been committed or the suballocation has been released
+
+            BufferSuballocationImpl& Suballoc = *Move.pSuballocation;
+            VERIFY_EXPR(Suballoc.m_PendingMove == i && Suballoc.m_Subregion == Move.Move.SrcRegion);
+            Suballoc.m_Subregion   = Move.Move.DstRegion;
+            Suballoc.m_Offset      = static_cast<Uint32>(Move.Move.DstOffset);
+            Suballoc.m_PendingMove = ~0u;
+            DefragmentationPlanner::CommitMove(m_Mgr, Move.Move);
+            Move.pSuballocation = nullptr;
+            Moved               = true;
+        }
+        UpdateUsageStats();
+
+        if (Moved)
+            m_DefragVersion.fetch_add(1);
+    }
+
+    virtual void CancelDefragmentation() override final
+    {
+        std::lock_guard<std::mutex> Lock{m_MgrMtx};
+        CancelPendingMoves();
+        UpdateUsageStats();
+    }
+
     virtual Uint32 GetVersion() const override final
     {
-        return m_Buffer.GetVersion();
+        return m_Buffer.GetVersion() + m_DefragVersion.load();
     }
 
     virtual void GetUsageStats(BufferSuballocatorUsageStats& UsageStats) override final
@@ -296,6 +472,120 @@ public:
     }
 
 private:
+    template <typename OutputType>
+    static bool VerifyBatchArgs(Uint32 NumSuballocations, const Uint32* pSizes, Uint32 Alignment, OutputType* pOutputs)
+    {
+        if (NumSuballocations == 0)
+            return false;
+
+        if (pSizes == nullptr || pOutputs == nullptr)
+        {
+            UNEXPECTED("Sizes and output arrays must not be null");
+            return false;
+        }
+
+        if (!IsPowerOfTwo(Alignment))
+        {
+            UNEXPECTED("Alignment (", Alignment, ") is not a power of two");
+            return false;
+        }
+
+        for (Uint32 i = 0; i < NumSuballocations; ++i)
+        {
+            if (pSizes[i] == 0)
+            {
+                UNEXPECTED("Size of suballocation ", i, " must not be zero");
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Extends the allocations manager to match the actual buffer size.
+    // m_MgrMtx must be locked.
+    void SyncMgrSize()
+    {
+        // After the resize, the actual buffer size may be larger due to alignment
+        // requirements (for sparse buffers, the size is aligned by the memory page size).
+        const auto BufferSize = m_BufferSize.load();
+        const auto MgrSize    = m_Mgr.GetMaxSize();
+        if (BufferSize > MgrSize)
+        {
+            m_Mgr.Extend(StaticCast<size_t>(BufferSize - MgrSize));
+            VERIFY_EXPR(m_Mgr.GetMaxSize() == BufferSize);
+            m_MgrSize.store(m_Mgr.GetMaxSize());
+        }
+    }
+
+    // Allocates the subregion, expanding the manager if necessary.
+    // m_MgrMtx must be locked.
+    VariableSizeAllocationsManager::Allocation AllocateSubregion(Uint32 Size, Uint32 Alignment)
+    {
+        VariableSizeAllocationsManager::Allocation Subregion = m_Mgr.Allocate(Size, Alignment);
+
+        while (!Subregion.IsValid() && (m_MaxSize == 0 || m_MaxSize > m_Mgr.GetMaxSize()))
+        {
+            size_t ExtraSize = m_ExpansionSize != 0 ?
+                std::max(m_ExpansionSize, AlignUp(Size, Alignment)) :
+                m_Mgr.GetMaxSize();
+
+            if (m_MaxSize != 0)
+                ExtraSize = std::min(ExtraSize, StaticCast<size_t>(m_MaxSize) - m_Mgr.GetMaxSize());
+
+            m_Mgr.Extend(ExtraSize);
+            m_MgrSize.store(m_Mgr.GetMaxSize());
+
+            Subregion = m_Mgr.Allocate(Size, Alignment);
+        }
+
+        return Subregion;
+    }
+
+    // Releases the destination regions of the moves that have not been committed.
+    // m_MgrMtx must be locked.
+    void CancelPendingMoves()
+    {
+        for (PendingMove& Move : m_PendingMoves)
+        {
+            if (Move.pSuballocation != nullptr)
+            {
+                DefragmentationPlanner::CancelMove(m_Mgr, Move.Move);
+                Move.pSuballocation->m_PendingMove = ~0u;
+            }
+        }
+        m_PendingMoves.clear();
+        m_CopyList.clear();
+    }
+
+    // Creates the suballocation object and adds it to the list.
+    // m_MgrMtx must be locked.
+    void CreateSuballocation(Uint32                                       Size,
+                             Uint32                                       Alignment,
+                             VariableSizeAllocationsManager::Allocation&& Subregion,
+                             IBufferSuballocation**                       ppSuballocation)
+    {
+        // clang-format off
+        BufferSuballocationImpl* pSuballocation{
+            NEW_RC_OBJ(m_SuballocationsAllocator, "BufferSuballocationImpl instance", BufferSuballocationImpl)
+            (
+                this,
+                AlignUp(static_cast<Uint32>(Subregion.UnalignedOffset), Alignment),
+                Size,
+                Alignment,
+                std::move(Subregion)
+            )
+        };
+        // clang-format on
+
+        pSuballocation->m_pNext = m_pSuballocations;
+        if (m_pSuballocations != nullptr)
+            m_pSuballocations->m_pPrev = pSuballocation;
+        m_pSuballocations = pSuballocation;
+
+        pSuballocation->QueryInterface(IID_BufferSuballocation, reinterpret_cast<IObject**>(ppSuballocation));
+    }
+
     void UpdateUsageStats()
     {
         m_UsedSize.store(m_Mgr.GetUsedSize());
@@ -319,12 +609,27 @@ private:
     std::atomic<Uint64> m_MaxFreeBlockSize{0};
 
     FixedBlockMemoryAllocator m_SuballocationsAllocator;
+
+    // The list of all suballocation objects. Protected by m_MgrMtx.
+    BufferSuballocationImpl* m_pSuballocations = nullptr;
+
+    struct PendingMove
+    {
+        // Null if the move has been committed or the suballocation has been released.
+        BufferSuballocationImpl*     pSuballocation = nullptr;
+        DefragmentationPlanner::Move Move;
+    };
+    // The moves of the current defragmentation plan. Protected by m_MgrMtx.
+    std::vector<PendingMove>                           m_PendingMoves;
+    std::vector<BufferSuballocatorDefragmentationMove> m_CopyList;
+
+    std::atomic<Uint32> m_DefragVersion{0};
 };
 
 
 BufferSuballocationImpl::~BufferSuballocationImpl()
 {
-    m_pParentAllocator->Free(std::move(m_Subregion));
+    m_pParentAllocator->Free(*this);
 }
 
 IBufferSuballocator* BufferSuballocationImpl::GetAllocator()
@@ -25,19 +25,45 @@
  */
 
 #include <unordered_map>
+#include <vector>
+#include <list>
+#include <array>
+#include <mutex>
+#include <shared_mutex>
+#include <atomic>
+#include <algorithm>
+#include <cstring>
 
 #include "RefCntAutoPtr.hpp"
 #include "DataBlobImpl.hpp"
+#include "ProxyDataBlob.hpp"
 #include "ObjectBase.hpp"
 #include "Serializer.hpp"
 #include "BytecodeCache.h"
 #include "XXH128Hasher.hpp"
-#include "DefaultRawMemoryAllocator.hpp"
+#include "Align.hpp"
+#include "Cast.hpp"
 
 namespace Diligent
 {
 
 /// Implementation of IBytecodeCache
+///
+/// The cache data is stored in the following format:
+///
+///     | Header | Index entry 0 | ... | Index entry N-1 | Bytecode 0 | ... | Bytecode N-1 |
+///
+/// Index entries are sorted by the hash, so that the bytecode can be found with a binary
+/// search directly in the loaded data. Load() does not parse or copy the bytecode: it keeps
+/// a reference to the data blob, and GetBytecode() returns proxy blobs that point into it.
+/// If the data blob is backed by a memory-mapped file, only the pages that are actually
+/// accessed are read from the disk.
+///
+/// Bytecode added or removed after the data is loaded is kept in the hash maps that
+/// take precedence over the loaded data. The maps are split into shards protected by
+/// individual mutexes, so that the cache can be used by multiple threads with little
+/// contention. Every shard keeps its entries in the LRU order, which is used to evict
+/// the bytecode when the total size exceeds the budget.
 class BytecodeCacheImpl final : public ObjectBase<IBytecodeCache>
 {
 public:
@@ -46,21 +72,38 @@ public:
     struct BytecodeCacheHeader
     {
         static constexpr Uint32 HeaderMagic   = 0x7ADECACE;
-        static constexpr Uint32 HeaderVersion = 1;
+        static constexpr Uint32 HeaderVersion = 2;
+
+        // Version 1 stored serialized bytecode entries one after another
+        static constexpr Uint32 HeaderVersionV1 = 1;
 
         Uint32 Magic   = HeaderMagic;
         Uint32 Version = HeaderVersion;
 
         Uint64 ElementCount = 0;
+    };
+    static_assert(sizeof(BytecodeCacheHeader) == 16, "BytecodeCacheHeader must not contain padding");
 
-        template <typename SerType>
-        void Serialize(SerType& Stream)
+    struct BytecodeCacheIndexEntry
+    {
+        Uint64 HashLow  = 0;
+        Uint64 HashHigh = 0;
+
+        // Bytecode offset from the beginning of the cache data
+        Uint64 Offset = 0;
+        Uint64 Size   = 0;
+
+        bool operator<(const XXH128Hash& Hash) const
         {
-            Stream(Magic, Version, ElementCount);
+            return HashHigh != Hash.HighPart ? HashHigh < Hash.HighPart : HashLow < Hash.LowPart;
         }
     };
+    static_assert(sizeof(BytecodeCacheIndexEntry) == 32, "BytecodeCacheIndexEntry must not contain padding");
+
+    // Bytecode is aligned so that it can be directly consumed from the loaded data
+    static constexpr size_t BytecodeAlignment = 16;
 
-    struct BytecodeCacheElementHeader
+    struct BytecodeCacheElementHeaderV1
     {
         XXH128Hash Hash     = {};
         size_t     DataSize = 0;
@@ -76,7 +119,8 @@ public:
     BytecodeCacheImpl(IReferenceCounters*            pRefCounters,
                       const BytecodeCacheCreateInfo& CreateInfo) :
         TBase{pRefCounters},
-        m_DeviceType{CreateInfo.DeviceType}
+        m_DeviceType{CreateInfo.DeviceType},
+        m_MaxSize{CreateInfo.MaxSize}
     {
     }
 
@@ -90,32 +134,68 @@ public:
             return false;
         }
 
-        Serializer<SerializerMode::Read> Stream{SerializedData{pDataBlob->GetDataPtr(), pDataBlob->GetSize()}};
+        const size_t DataSize = pDataBlob->GetSize();
+        if (DataSize < sizeof(BytecodeCacheHeader))
+        {
+            LOG_ERROR_MESSAGE("Bytecode cache data is too small");
+            return false;
+        }
 
         BytecodeCacheHeader Header;
-        Header.Serialize(Stream);
+        memcpy(&Header, pDataBlob->GetConstDataPtr(), sizeof(Header));
         if (Header.Magic != BytecodeCacheHeader::HeaderMagic)
         {
             LOG_ERROR_MESSAGE("Incorrect bytecode header magic number");
             return false;
         }
 
+        if (Header.Version == BytecodeCacheHeader::HeaderVersionV1)
+            return LoadV1(pDataBlob);
+
         if (Header.Version != BytecodeCacheHeader::HeaderVersion)
         {
             LOG_ERROR_MESSAGE("Incorrect bytecode header version (", Header.Version, "). ", Uint32{BytecodeCacheHeader::HeaderVersion}, " is expected.");
             return false;
         }
 
-        for (Uint64 ItemID = 0; ItemID < Header.ElementCount; ItemID++)
+        if (Header.ElementCount > (DataSize - sizeof(BytecodeCacheHeader)) / sizeof(BytecodeCacheIndexEntry))
         {
-            BytecodeCacheElementHeader ElementHeader;
-            ElementHeader.Serialize(Stream);
+            LOG_ERROR_MESSAGE("Bytecode cache data is corrupted: the index does not fit into the data");
+            return false;
+        }
 
-            auto pBytecode = DataBlobImpl::Create(ElementHeader.DataSize);
-            Stream.CopyBytes(pBytecode->GetDataPtr(), ElementHeader.DataSize);
-            m_HashMap.emplace(ElementHeader.Hash, pBytecode);
+        RefCntAutoPtr<IDataBlob> pData{pDataBlob};
+        if (AlignUp(pData->GetConstDataPtr(), alignof(BytecodeCacheIndexEntry)) != pData->GetConstDataPtr())
+        {
+            // The index is accessed in place, so the data must be properly aligned
+            pData = DataBlobImpl::Create(DataSize, pDataBlob->GetConstDataPtr());
         }
 
+        {
+            std::unique_lock<std::shared_timed_mutex> Lock{m_LoadedDataMtx};
+
+            if (m_pLoadedData)
+            {
+                // Move the bytecode from the previously loaded data to the hash maps.
+                // Proxy blobs keep the previous data alive.
+                for (size_t i = 0; i < m_LoadedIndexSize; ++i)
+                {
+                    const BytecodeCacheIndexEntry& Entry = m_pLoadedIndex[i];
+                    const XXH128Hash               Hash{Entry.HashLow, Entry.HashHigh};
+                    if (IsValidEntry(Entry) && !IsRemovedLoadedBytecode(Hash))
+                        InsertBytecode(Hash, CreateLoadedBytecodeBlob(Entry), /*Overwrite = */ false);
+                }
+            }
+
+            // Removal markers refer to the previously loaded data and must not hide the new one
+            ClearRemovedBytecodeMarkers();
+
+            m_pLoadedData     = std::move(pData);
+            m_pLoadedIndex    = reinterpret_cast<const BytecodeCacheIndexEntry*>(static_cast<const Uint8*>(m_pLoadedData->GetConstDataPtr()) + sizeof(BytecodeCacheHeader));
+            m_LoadedIndexSize = StaticCast<size_t>(Header.ElementCount);
+        }
+        EvictBytecode();
+
         return true;
     }
 
@@ -123,28 +203,71 @@ public:
     {
         DEV_CHECK_ERR(ppByteCode != nullptr, "ppByteCode must not be null.");
         DEV_CHECK_ERR(*ppByteCode == nullptr, "*ppByteCode is not null. Make sure you are not overwriting reference to an existing object as this may result in memory leaks.");
-        const auto Hash = ComputeHash(ShaderCI);
-        const auto Iter = m_HashMap.find(Hash);
-        if (Iter != m_HashMap.end())
+        const auto Hash  = ComputeHash(ShaderCI);
+        Shard&     Shard = GetShard(Hash);
         {
-            auto pObject = Iter->second;
-            *ppByteCode  = pObject.Detach();
+            std::lock_guard<std::mutex> Lock{Shard.Mtx};
+
+            const auto Iter = Shard.Entries.find(Hash);
+            if (Iter != Shard.Entries.end())
+            {
+                CacheEntry& Entry = Iter->second;
+                // Null entry indicates that loaded bytecode was removed
+                if (Entry.pBytecode)
+                {
+                    Shard.LRU.splice(Shard.LRU.begin(), Shard.LRU, Entry.LRUPos);
+                    Shard.HitCount.fetch_add(1, std::memory_order_relaxed);
+
+                    auto pObject = Entry.pBytecode;
+                    *ppByteCode  = pObject.Detach();
+                }
+                else
+                {
+                    Shard.MissCount.fetch_add(1, std::memory_order_relaxed);
+                }
+                return;
+            }
         }
+
+        {
+            std::shared_lock<std::shared_timed_mutex> Lock{m_LoadedDataMtx};
+            if (const BytecodeCacheIndexEntry* pEntry = FindLoadedBytecode(Hash))
+            {
+                Shard.HitCount.fetch_add(1, std::memory_order_relaxed);
+                *ppByteCode = CreateLoadedBytecodeBlob(*pEntry).Detach();
+                return;
+            }
+        }
+
+        Shard.MissCount.fetch_add(1, std::memory_order_relaxed);
     }
 
     virtual void DILIGENT_CALL_TYPE AddBytecode(const ShaderCreateInfo& ShaderCI, IDataBlob* pByteCode) override final
     {
         DEV_CHECK_ERR(pByteCode != nullptr, "pByteCode must not be null.");
         const auto Hash = ComputeHash(ShaderCI);
-        const auto Iter = m_HashMap.emplace(Hash, pByteCode);
-        if (!Iter.second)
-            Iter.first->second = pByteCode;
+        InsertBytecode(Hash, RefCntAutoPtr<IDataBlob>{pByteCode}, /*Overwrite = */ true);
+        EvictBytecode();
     }
 
     virtual void DILIGENT_CALL_TYPE RemoveBytecode(const ShaderCreateInfo& ShaderCI) override final
     {
         const auto Hash = ComputeHash(ShaderCI);
-        m_HashMap.erase(Hash);
+
+        std::shared_lock<std::shared_timed_mutex> LoadedDataLock{m_LoadedDataMtx};
+
+        Shard&                      Shard = GetShard(Hash);
+        std::lock_guard<std::mutex> Lock{Shard.Mtx};
+
+        auto Iter = Shard.Entries.find(Hash);
+        if (Iter != Shard.Entries.end())
+        {
+            RemoveFromLRU(Shard, Iter->second);
+            Shard.Entries.erase(Iter);
+        }
+
+        if (FindLoadedBytecode(Hash) != nullptr)
+            Shard.Entries.emplace(Hash, CacheEntry{RefCntAutoPtr<IDataBlob>{}, Shard.LRU.end()});
     }
 
     virtual void DILIGENT_CALL_TYPE Store(IDataBlob** ppDataBlob) override final
@@ -152,43 +275,146 @@ public:
         DEV_CHECK_ERR(ppDataBlob != nullptr, "ppDataBlob must not be null.");
         DEV_CHECK_ERR(*ppDataBlob == nullptr, "*ppDataBlob is not null. Make sure you are not overwriting reference to an existing object as this may result in memory leaks.");
 
-        auto WriteData = [&](auto& Stream) //
+        struct StoreEntry
         {
-            BytecodeCacheHeader Header{};
-            Header.ElementCount = m_HashMap.size();
-            Header.Serialize(Stream);
+            XXH128Hash Hash;
 
-            for (auto const& Pair : m_HashMap)
-            {
-                const auto& pBytecode = Pair.second;
+            // Keeps the bytecode alive in case it is evicted while the data is being written
+            RefCntAutoPtr<IDataBlob> pBytecode;
+
+            const void* pData;
+            size_t      Size;
+        };
+        std::vector<StoreEntry> Entries;
 
-                BytecodeCacheElementHeader ElementHeader;
-                ElementHeader.Hash     = Pair.first;
-                ElementHeader.DataSize = pBytecode->GetSize();
-                ElementHeader.Serialize(Stream);
+        std::shared_lock<std::shared_timed_mutex> LoadedDataLock{m_LoadedDataMtx};
 
-                Stream.CopyBytes(pBytecode->GetConstDataPtr(), ElementHeader.DataSize);
+        for (Shard& Shard : m_Shards)
+        {
+            std::lock_guard<std::mutex> Lock{Shard.Mtx};
+            for (const auto& Pair : Shard.Entries)
+            {
+                if (const auto& pBytecode = Pair.second.pBytecode)
+                    Entries.push_back({Pair.first, pBytecode, pBytecode->GetConstDataPtr(), pBytecode->GetSize()});
             }
-        };
+        }
+        for (size_t i = 0; i < m_LoadedIndexSize; ++i)
+        {
+            const BytecodeCacheIndexEntry& Entry = m_pLoadedIndex[i];
+            if (IsValidEntry(Entry))
+                Entries.push_back({XXH128Hash{Entry.HashLow, Entry.HashHigh}, RefCntAutoPtr<IDataBlob>{}, GetLoadedBytecodeData(Entry), StaticCast<size_t>(Entry.Size)});
+        }
 
-        Serializer<SerializerMode::Measure> MeasureStream{};
-        WriteData(MeasureStream);
+        // Stable sort keeps the cached bytecode in front of the loaded one with the same hash
+        std::stable_sort(Entries.begin(), Entries.end(),
+                         [](const StoreEntry& LHS, const StoreEntry& RHS) {
+                             return LHS.Hash.HighPart != RHS.Hash.HighPart ? LHS.Hash.HighPart < RHS.Hash.HighPart : LHS.Hash.LowPart < RHS.Hash.LowPart;
+                         });
+        // Remove the loaded bytecode that was replaced or removed
+        Entries.erase(std::unique(Entries.begin(), Entries.end(),
+                                  [](const StoreEntry& LHS, const StoreEntry& RHS) {
+                                      return LHS.Hash == RHS.Hash;
+                                  }),
+                      Entries.end());
+        Entries.erase(std::remove_if(Entries.begin(), Entries.end(),
+                                     [this](const StoreEntry& Entry) {
+                                         return !Entry.pBytecode && IsRemovedLoadedBytecode(Entry.Hash);
+                                     }),
+                      Entries.end());
+
+        const size_t IndexEnd = sizeof(BytecodeCacheHeader) + sizeof(BytecodeCacheIndexEntry) * Entries.size();
+
+        size_t DataSize = IndexEnd;
+        for (const StoreEntry& Entry : Entries)
+            DataSize = AlignUp(DataSize, BytecodeAlignment) + Entry.Size;
+
+        auto  pDataBlob = DataBlobImpl::Create(DataSize);
+        auto* pData     = static_cast<Uint8*>(pDataBlob->GetDataPtr());
+
+        BytecodeCacheHeader Header{};
+        Header.ElementCount = Entries.size();
+        memcpy(pData, &Header, sizeof(Header));
+
+        auto*  pIndex = reinterpret_cast<BytecodeCacheIndexEntry*>(pData + sizeof(BytecodeCacheHeader));
+        size_t Offset = IndexEnd;
+        for (size_t i = 0; i < Entries.size(); ++i)
+        {
+            const StoreEntry& Entry = Entries[i];
 
-        const auto Memory = MeasureStream.AllocateData(DefaultRawMemoryAllocator::GetAllocator());
+            const size_t AlignedOffset = AlignUp(Offset, BytecodeAlignment);
+            // Zero the padding to make the output deterministic
+            memset(pData + Offset, 0, AlignedOffset - Offset);
+            memcpy(pData + AlignedOffset, Entry.pData, Entry.Size);
 
-        Serializer<SerializerMode::Write> WriteStream{Memory};
-        WriteData(WriteStream);
-        VERIFY_EXPR(WriteStream.IsEnded());
+            pIndex[i] = BytecodeCacheIndexEntry{Entry.Hash.LowPart, Entry.Hash.HighPart, AlignedOffset, Entry.Size};
+            Offset    = AlignedOffset + Entry.Size;
+        }
+        VERIFY_EXPR(Offset == DataSize);
 
-        *ppDataBlob = DataBlobImpl::Create(Memory.Size(), Memory.Ptr()).Detach();
+        *ppDataBlob = pDataBlob.Detach();
     }
 
     virtual void DILIGENT_CALL_TYPE Clear() override final
     {
-        m_HashMap.clear();
+        std::unique_lock<std::shared_timed_mutex> LoadedDataLock{m_LoadedDataMtx};
+        for (Shard& Shard : m_Shards)
+        {
+            std::lock_guard<std::mutex> Lock{Shard.Mtx};
+            m_Size.fetch_sub(Shard.Size.load());
+            Shard.Size.store(0);
+            Shard.Entries.clear();
+            Shard.LRU.clear();
+        }
+        m_pLoadedData.Release();
+        m_pLoadedIndex    = nullptr;
+        m_LoadedIndexSize = 0;
+    }
+
+    virtual void DILIGENT_CALL_TYPE GetStats(BytecodeCacheStats& Stats) override final
+    {
+        Stats = {};
+        for (const Shard& Shard : m_Shards)
+        {
+            Stats.HitCount += Shard.HitCount.load(std::memory_order_relaxed);
+            Stats.MissCount += Shard.MissCount.load(std::memory_order_relaxed);
+            Stats.EvictionCount += Shard.EvictionCount.load(std::memory_order_relaxed);
+        }
+        Stats.Size = m_Size.load();
+
+        std::shared_lock<std::shared_timed_mutex> Lock{m_LoadedDataMtx};
+        Stats.LoadedDataSize = m_pLoadedData ? m_pLoadedData->GetSize() : 0;
     }
 
 private:
+    struct CacheEntry
+    {
+        // Null bytecode indicates that the loaded bytecode was removed
+        RefCntAutoPtr<IDataBlob> pBytecode;
+
+        // Position in the LRU list, or the list end for removed loaded bytecode
+        std::list<XXH128Hash>::iterator LRUPos;
+    };
+
+    struct Shard
+    {
+        std::mutex Mtx;
+
+        std::unordered_map<XXH128Hash, CacheEntry> Entries;
+
+        // Hashes of the bytecode in the most-recently-used first order
+        std::list<XXH128Hash> LRU;
+
+        // The total size of the bytecode in this shard. Modified under the mutex,
+        // but may be read without it.
+        std::atomic<Uint64> Size{0};
+
+        std::atomic<Uint64> HitCount{0};
+        std::atomic<Uint64> MissCount{0};
+        std::atomic<Uint64> EvictionCount{0};
+    };
+
+    static constexpr size_t NumShards = 16;
+
     XXH128Hash ComputeHash(const ShaderCreateInfo& ShaderCI) const
     {
         XXH128State Hasher;
@@ -196,10 +422,178 @@ private:
         return Hasher.Digest();
     }
 
+    Shard& GetShard(const XXH128Hash& Hash)
+    {
+        return m_Shards[Hash.HighPart % NumShards];
+    }
+
+    // Shard mutex must be locked
+    void RemoveFromLRU(Shard& Shard, const CacheEntry& Entry)
+    {
+        if (Entry.LRUPos == Shard.LRU.end())
+            return;
+
+        const Uint64 Size = Entry.pBytecode->GetSize();
+        Shard.Size.fetch_sub(Size);
+        m_Size.fetch_sub(Size);
+        Shard.LRU.erase(Entry.LRUPos);
+    }
+
+    void InsertBytecode(const XXH128Hash& Hash, RefCntAutoPtr<IDataBlob> pBytecode, bool Overwrite)
+    {
+        Shard&                      Shard = GetShard(Hash);
+        std::lock_guard<std::mutex> Lock{Shard.Mtx};
+
+        auto Iter = Shard.Entries.find(Hash);
+        if (Iter != Shard.Entries.end())
+        {
+            // Removal markers never prevent the insertion
+            if (!Overwrite && Iter->second.pBytecode)
+                return;
+            RemoveFromLRU(Shard, Iter->second);
+        }
+        else
+        {
+            Iter = Shard.Entries.emplace(Hash, CacheEntry{}).first;
+        }
+
+        const Uint64 Size = pBytecode->GetSize();
+        Shard.LRU.push_front(Hash);
+        Iter->second.pBytecode = std::move(pBytecode);
+        Iter->second.LRUPos    = Shard.LRU.begin();
+        Shard.Size.fetch_add(Size);
+        m_Size.fetch_add(Size);
+    }
+
+    // Evicts the least recently used bytecode until the total size fits into the budget
+    void EvictBytecode()
+    {
+        if (m_MaxSize == 0)
+            return;
+
+        while (m_Size.load() > m_MaxSize)
+        {
+            // Evict from the largest shard to approximate the global LRU order
+            Shard* pLargestShard = &m_Shards[0];
+            for (Shard& Shard : m_Shards)
+            {
+                if (Shard.Size.load() > pLargestShard->Size.load())
+                    pLargestShard = &Shard;
+            }
+
+            Shard&                      Shard = *pLargestShard;
+            std::lock_guard<std::mutex> Lock{Shard.Mtx};
+            if (Shard.LRU.empty())
+                break;
+
+            while (!Shard.LRU.empty() && m_Size.load() > m_MaxSize)
+            {
+                auto Iter = Shard.Entries.find(Shard.LRU.back());
+                VERIFY_EXPR(Iter != Shard.Entries.end());
+                RemoveFromLRU(Shard, Iter->second);
+                Shard.Entries.erase(Iter);
+                Shard.EvictionCount.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Loads the data in the legacy format by copying all bytecode into the hash maps
+    bool LoadV1(IDataBlob* pDataBlob)
+    {
+        // The data may be read-only, e.g. if it is a memory-mapped file
+        Serializer<SerializerMode::Read> Stream{SerializedData{const_cast<void*>(pDataBlob->GetConstDataPtr()), pDataBlob->GetSize()}};
+
+        BytecodeCacheHeader Header;
+        Stream(Header.Magic, Header.Version, Header.ElementCount);
+
+        for (Uint64 ItemID = 0; ItemID < Header.ElementCount; ItemID++)
+        {
+            BytecodeCacheElementHeaderV1 ElementHeader;
+            ElementHeader.Serialize(Stream);
+
+            auto pBytecode = DataBlobImpl::Create(ElementHeader.DataSize);
+            Stream.CopyBytes(pBytecode->GetDataPtr(), ElementHeader.DataSize);
+            InsertBytecode(ElementHeader.Hash, std::move(pBytecode), /*Overwrite = */ false);
+        }
+        EvictBytecode();
+
+        return true;
+    }
+
+    // m_LoadedDataMtx must be locked
+    const BytecodeCacheIndexEntry* FindLoadedBytecode(const XXH128Hash& Hash) const
+    {
+        const BytecodeCacheIndexEntry* pIndexEnd = m_pLoadedIndex + m_LoadedIndexSize;
+        const BytecodeCacheIndexEntry* pEntry    = std::lower_bound(m_pLoadedIndex, pIndexEnd, Hash);
+        if (pEntry == pIndexEnd || pEntry->HashLow != Hash.LowPart || pEntry->HashHigh != Hash.HighPart)
+            return nullptr;
+
+        if (!IsValidEntry(*pEntry))
+        {
+            LOG_ERROR_MESSAGE("Bytecode cache data is corrupted: bytecode range [", pEntry->Offset, ", ", pEntry->Offset + pEntry->Size,
+                              ") is out of the data bounds (", m_pLoadedData->GetSize(), ")");
+            return nullptr;
+        }
+
+        return pEntry;
+    }
+
+    // m_LoadedDataMtx must be locked
+    bool IsRemovedLoadedBytecode(const XXH128Hash& Hash)
+    {
+        Shard&                      Shard = GetShard(Hash);
+        std::lock_guard<std::mutex> Lock{Shard.Mtx};
+
+        auto Iter = Shard.Entries.find(Hash);
+        return Iter != Shard.Entries.end() && !Iter->second.pBytecode;
+    }
+
+    // m_LoadedDataMtx must be locked exclusively
+    void ClearRemovedBytecodeMarkers()
+    {
+        for (Shard& Shard : m_Shards)
+        {
+            std::lock_guard<std::mutex> Lock{Shard.Mtx};
+            for (auto Iter = Shard.Entries.begin(); Iter != Shard.Entries.end();)
+            {
+                if (!Iter->second.pBytecode)
+                    Iter = Shard.Entries.erase(Iter);
+                else
+                    ++Iter;
+            }
+        }
+    }
+
+    bool IsValidEntry(const BytecodeCacheIndexEntry& Entry) const
+    {
+        const Uint64 DataSize = m_pLoadedData->GetSize();
+        return Entry.Offset <= DataSize && Entry.Size <= DataSize - Entry.Offset;
+    }
+
+    const void* GetLoadedBytecodeData(const BytecodeCacheIndexEntry& Entry) const
+    {
+        return static_cast<const Uint8*>(m_pLoadedData->GetConstDataPtr()) + Entry.Offset;
+    }
+
+    RefCntAutoPtr<IDataBlob> CreateLoadedBytecodeBlob(const BytecodeCacheIndexEntry& Entry) const
+    {
+        return RefCntAutoPtr<IDataBlob>{ProxyDataBlob::Create(GetLoadedBytecodeData(Entry), StaticCast<size_t>(Entry.Size), m_pLoadedData)};
+    }
+
 private:
-    RENDER_DEVICE_TYPE m_DeviceType;
+    const RENDER_DEVICE_TYPE m_DeviceType;
+    const Uint64             m_MaxSize;
+
+    std::array<Shard, NumShards> m_Shards;
+
+    // The total size of the bytecode in all shards
+    std::atomic<Uint64> m_Size{0};
 
-    std::unordered_map<XXH128Hash, RefCntAutoPtr<IDataBlob>> m_HashMap;
+    // Protects the loaded data. Lock order: m_LoadedDataMtx, then shard mutexes.
+    std::shared_timed_mutex        m_LoadedDataMtx;
+    RefCntAutoPtr<IDataBlob>       m_pLoadedData;
+    const BytecodeCacheIndexEntry* m_pLoadedIndex    = nullptr;
+    size_t                         m_LoadedIndexSize = 0;
 };
 
 void CreateBytecodeCache(const BytecodeCacheCreateInfo& CreateInfo,
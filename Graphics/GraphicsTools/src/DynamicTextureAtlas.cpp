@@ -33,6 +33,7 @@
 #include <unordered_map>
 #include <map>
 #include <set>
+#include <tuple>
 
 #include "DynamicAtlasManager.hpp"
 #include "DynamicTextureArray.hpp"
@@ -143,8 +144,8 @@ namespace
 class ThreadSafeAtlasManager
 {
 public:
-    ThreadSafeAtlasManager(const uint2& Dim) noexcept :
-        Mgr{Dim.x, Dim.y}
+    ThreadSafeAtlasManager(const uint2& Dim, DynamicAtlasManager::PackingMode Mode) noexcept :
+        Mgr{Dim.x, Dim.y, Mode}
     {}
 
     // clang-format off
@@ -273,8 +274,9 @@ private:
 
 struct SliceBatch
 {
-    SliceBatch(const uint2 AtlasDim) noexcept :
-        m_AtlasDim{AtlasDim}
+    SliceBatch(const uint2 AtlasDim, DynamicAtlasManager::PackingMode Mode) noexcept :
+        m_AtlasDim{AtlasDim},
+        m_PackingMode{Mode}
     {}
 
     ~SliceBatch()
@@ -318,7 +320,7 @@ struct SliceBatch
         std::lock_guard<std::mutex> Guard{m_Mtx};
 
         VERIFY(m_Slices.find(Slice) == m_Slices.end(), "Slice ", Slice, " already present in the batch.");
-        auto it = m_Slices.emplace(Slice, m_AtlasDim).first;
+        auto it = m_Slices.emplace(std::piecewise_construct, std::forward_as_tuple(Slice), std::forward_as_tuple(m_AtlasDim, m_PackingMode)).first;
         // NB: Lock() atomically increases the use count of the slice while we hold the mutex.
         return it->second.Lock();
     }
@@ -353,7 +355,8 @@ struct SliceBatch
     }
 
 private:
-    const uint2 m_AtlasDim;
+    const uint2                            m_AtlasDim;
+    const DynamicAtlasManager::PackingMode m_PackingMode;
 
     std::mutex m_Mtx;
     // For every alignment, we keep a list of slice managers sorted by the slice index.
@@ -387,6 +390,7 @@ public:
         m_ExtraSliceFactor{clamp(CreateInfo.GrowthFactor, 1.f, 2.f) - 1.f},
         m_MaxSliceCount   {CreateInfo.Desc.Type == RESOURCE_DIM_TEX_2D_ARRAY ? std::min(CreateInfo.MaxSliceCount, Uint32{2048}) : 1},
         m_Silent          {CreateInfo.Silent},
+        m_PackingMode     {CreateInfo.PackingMode == DYNAMIC_TEXTURE_ATLAS_PACKING_MODE_SKYLINE ? DynamicAtlasManager::PackingMode::Skyline : DynamicAtlasManager::PackingMode::Guillotine},
         m_SuballocationsAllocator
         {
             DefaultRawMemoryAllocator::GetAllocator(),
@@ -711,7 +715,12 @@ private:
         // Get the list of slices for this alignment
         auto BatchIt = m_SliceBatchesByAlignment.find(Alignment);
         if (BatchIt == m_SliceBatchesByAlignment.end() && AtlasWidth != 0 && AtlasHeight != 0)
-            BatchIt = m_SliceBatchesByAlignment.emplace(Alignment, uint2{AtlasWidth, AtlasHeight}).first;
+        {
+            BatchIt = m_SliceBatchesByAlignment.emplace(std::piecewise_construct,
+                                                        std::forward_as_tuple(Alignment),
+                                                        std::forward_as_tuple(uint2{AtlasWidth, AtlasHeight}, m_PackingMode))
+                          .first;
+        }
 
         return BatchIt != m_SliceBatchesByAlignment.end() ? &BatchIt->second : nullptr;
     }
@@ -726,6 +735,8 @@ private:
     const Uint32 m_MaxSliceCount;
     const bool   m_Silent;
 
+    const DynamicAtlasManager::PackingMode m_PackingMode;
+
     std::unique_ptr<DynamicTextureArray> m_DynamicTexArray;
     RefCntAutoPtr<ITexture>              m_pTexture;
 
@@ -33,8 +33,10 @@
 #include "GraphicsUtilities.h"
 #include "DebugUtilities.hpp"
 #include "GraphicsAccessories.hpp"
+#include "BCCodec.hpp"
 #include "ColorConversion.h"
 #include "RefCntAutoPtr.hpp"
+#include "MipFilters.hpp"
 
 #define PI_F 3.1415926f
 
@@ -410,12 +412,33 @@ void ComputeMipLevel(const ComputeMipLevelAttribs& Attribs)
     DEV_CHECK_ERR(Attribs.pFineMipData != nullptr, "Fine level data must not be null");
     DEV_CHECK_ERR(Attribs.pCoarseMipData != nullptr, "Coarse level data must not be null");
 
+    if (IsBCCodecSupported(Attribs.Format))
+    {
+        // Block-compressed levels are decoded, filtered and encoded back by ComputeMipChain
+        ComputeMipChainAttribs ChainAttribs;
+        ChainAttribs.Format            = Attribs.Format;
+        ChainAttribs.Width             = Attribs.FineMipWidth;
+        ChainAttribs.Height            = Attribs.FineMipHeight;
+        ChainAttribs.pFineMipData      = Attribs.pFineMipData;
+        ChainAttribs.FineMipStride     = Attribs.FineMipStride;
+        ChainAttribs.NumCoarseMips     = 1;
+        ChainAttribs.ppCoarseMipData   = &Attribs.pCoarseMipData;
+        ChainAttribs.pCoarseMipStrides = &Attribs.CoarseMipStride;
+        ChainAttribs.FilterType        = Attribs.FilterType;
+        ChainAttribs.AlphaCutoff       = Attribs.AlphaCutoff;
+        ComputeMipChain(ChainAttribs);
+        return;
+    }
+
     const auto& FmtAttribs = GetTextureFormatAttribs(Attribs.Format);
 
     VERIFY_EXPR(Attribs.AlphaCutoff >= 0 && Attribs.AlphaCutoff <= 1);
     VERIFY(Attribs.AlphaCutoff == 0 || FmtAttribs.NumComponents == 4 && FmtAttribs.ComponentSize == 1,
            "Alpha remapping is only supported for 4-channel 8-bit textures");
 
+    if (ComputeMipLevelSpecialized(Attribs))
+        return;
+
     switch (FmtAttribs.ComponentType)
     {
         case COMPONENT_TYPE_UNORM_SRGB:
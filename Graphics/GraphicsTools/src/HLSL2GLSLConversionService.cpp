@@ -0,0 +1,245 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "HLSL2GLSLConversionService.hpp"
+
+#include <cstring>
+#include <vector>
+
+#include "HLSL2GLSLConverterImpl.hpp"
+#include "ThreadPool.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+struct HLSL2GLSLConversionService::SourceCacheEntry
+{
+    std::mutex Mtx;
+
+    // Tokenized source that is only used to create copies for conversions
+    RefCntAutoPtr<IHLSL2GLSLConversionStream> pSrcStream;
+
+    // Copies of the source stream that are not currently used by any conversion
+    std::vector<RefCntAutoPtr<IHLSL2GLSLConversionStream>> IdleStreams;
+};
+
+namespace
+{
+
+void HashString(XXH128State& Hasher, const Char* Str, size_t Len = 0)
+{
+    if (Str != nullptr && Len == 0)
+        Len = strlen(Str);
+    // Hash the length to distinguish e.g. {"ab", "c"} from {"a", "bc"}
+    Hasher.Update(Uint64{Len});
+    if (Len > 0)
+        Hasher.UpdateRaw(Str, Len);
+}
+
+XXH128Hash ComputeSourceHash(const HLSL2GLSLConversionService::ConversionAttribs& Attribs)
+{
+    XXH128State Hasher;
+    if (Attribs.HLSLSource != nullptr)
+    {
+        Hasher.Update(Uint8{0});
+        HashString(Hasher, Attribs.HLSLSource, Attribs.NumSymbols);
+    }
+    else
+    {
+        // The source is loaded from the stream factory
+        Hasher.Update(Uint8{1});
+        HashString(Hasher, Attribs.InputFileName);
+    }
+    return Hasher.Digest();
+}
+
+XXH128Hash ComputeResultHash(const XXH128Hash& SourceHash, const HLSL2GLSLConversionService::ConversionAttribs& Attribs)
+{
+    XXH128State Hasher;
+    Hasher.Update(SourceHash.LowPart, SourceHash.HighPart, Attribs.ShaderType,
+                  Attribs.IncludeDefinitions, Attribs.UseInOutLocationQualifiers, Attribs.UseRowMajorMatrices);
+    HashString(Hasher, Attribs.EntryPoint);
+    HashString(Hasher, Attribs.SamplerSuffix);
+    return Hasher.Digest();
+}
+
+} // namespace
+
+HLSL2GLSLConversionService::HLSL2GLSLConversionService(const HLSL2GLSLConversionServiceCreateInfo& CreateInfo) :
+    m_pSourceStreamFactory{CreateInfo.pSourceStreamFactory},
+    m_pThreadPool{CreateInfo.pThreadPool}
+{
+}
+
+HLSL2GLSLConversionService::~HLSL2GLSLConversionService()
+{
+}
+
+std::shared_ptr<HLSL2GLSLConversionService::SourceCacheEntry> HLSL2GLSLConversionService::GetSourceCacheEntry(const XXH128Hash& SourceHash)
+{
+    std::lock_guard<std::mutex> Lock{m_SourcesMtx};
+
+    auto& pEntry = m_Sources[SourceHash];
+    if (!pEntry)
+        pEntry = std::make_shared<SourceCacheEntry>();
+    return pEntry;
+}
+
+RefCntAutoPtr<IDataBlob> HLSL2GLSLConversionService::Convert(const ConversionAttribs& Attribs)
+{
+    m_NumRequests.fetch_add(1);
+
+    if (Attribs.EntryPoint == nullptr)
+    {
+        LOG_ERROR_MESSAGE("Entry point must not be null");
+        m_NumFailures.fetch_add(1);
+        return {};
+    }
+
+    if (Attribs.HLSLSource == nullptr && (Attribs.InputFileName == nullptr || m_pSourceStreamFactory == nullptr))
+    {
+        LOG_ERROR_MESSAGE("Input file name and source stream factory must not be null when HLSL source code is not provided");
+        m_NumFailures.fetch_add(1);
+        return {};
+    }
+
+    const XXH128Hash SourceHash = ComputeSourceHash(Attribs);
+    const XXH128Hash ResultHash = ComputeResultHash(SourceHash, Attribs);
+
+    {
+        std::lock_guard<std::mutex> Lock{m_ResultsMtx};
+
+        auto it = m_Results.find(ResultHash);
+        if (it != m_Results.end())
+        {
+            m_NumCacheHits.fetch_add(1);
+            return it->second;
+        }
+    }
+
+    const HLSL2GLSLConverterImpl& Converter = HLSL2GLSLConverterImpl::GetInstance();
+
+    std::shared_ptr<SourceCacheEntry>         pEntry = GetSourceCacheEntry(SourceHash);
+    RefCntAutoPtr<IHLSL2GLSLConversionStream> pSrcStream;
+    RefCntAutoPtr<IHLSL2GLSLConversionStream> pStream;
+    {
+        // Other threads converting the same source wait here until the source is tokenized
+        std::lock_guard<std::mutex> Lock{pEntry->Mtx};
+
+        if (!pEntry->pSrcStream)
+        {
+            Converter.CreateStream(Attribs.InputFileName, m_pSourceStreamFactory, Attribs.HLSLSource, Attribs.NumSymbols, &pEntry->pSrcStream);
+            if (!pEntry->pSrcStream)
+            {
+                LOG_ERROR_MESSAGE("Failed to create conversion stream for shader '", (Attribs.InputFileName != nullptr ? Attribs.InputFileName : "<unknown>"), "'");
+                m_NumFailures.fetch_add(1);
+                return {};
+            }
+            m_NumSourcesParsed.fetch_add(1);
+        }
+        pSrcStream = pEntry->pSrcStream;
+
+        if (!pEntry->IdleStreams.empty())
+        {
+            pStream = std::move(pEntry->IdleStreams.back());
+            pEntry->IdleStreams.pop_back();
+        }
+    }
+
+    if (!pStream)
+    {
+        // The source stream is never used for conversion, so it can be safely copied by multiple threads
+        Converter.CopyStream(pSrcStream, &pStream);
+        if (!pStream)
+        {
+            m_NumFailures.fetch_add(1);
+            return {};
+        }
+    }
+
+    RefCntAutoPtr<IDataBlob> pGLSLSource;
+    pStream->Convert(Attribs.EntryPoint, Attribs.ShaderType, Attribs.IncludeDefinitions, Attribs.SamplerSuffix,
+                     Attribs.UseInOutLocationQualifiers, Attribs.UseRowMajorMatrices, &pGLSLSource);
+    if (!pGLSLSource)
+    {
+        // The tokens of the stream are left in an undefined state when the conversion fails,
+        // so the stream is not returned to the pool.
+        m_NumFailures.fetch_add(1);
+        return {};
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock{pEntry->Mtx};
+        pEntry->IdleStreams.emplace_back(std::move(pStream));
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock{m_ResultsMtx};
+        // Another thread may have converted the same shader in the meantime
+        return m_Results.emplace(ResultHash, std::move(pGLSLSource)).first->second;
+    }
+}
+
+void HLSL2GLSLConversionService::ConvertBatch(const ConversionAttribs*  pAttribs,
+                                              Uint32                    NumShaders,
+                                              RefCntAutoPtr<IDataBlob>* ppGLSLSource)
+{
+    if (NumShaders == 0)
+        return;
+
+    DEV_CHECK_ERR(pAttribs != nullptr, "pAttribs must not be null");
+    DEV_CHECK_ERR(ppGLSLSource != nullptr, "ppGLSLSource must not be null");
+
+    ParallelFor(m_pThreadPool, 0, NumShaders,
+                [&](Uint32 i) {
+                    ppGLSLSource[i] = Convert(pAttribs[i]);
+                });
+}
+
+void HLSL2GLSLConversionService::Reset()
+{
+    {
+        std::lock_guard<std::mutex> Lock{m_SourcesMtx};
+        m_Sources.clear();
+    }
+    {
+        std::lock_guard<std::mutex> Lock{m_ResultsMtx};
+        m_Results.clear();
+    }
+}
+
+HLSL2GLSLConversionService::Statistics HLSL2GLSLConversionService::GetStatistics() const
+{
+    Statistics Stats;
+    Stats.NumRequests      = m_NumRequests.load();
+    Stats.NumCacheHits     = m_NumCacheHits.load();
+    Stats.NumSourcesParsed = m_NumSourcesParsed.load();
+    Stats.NumFailures      = m_NumFailures.load();
+    return Stats;
+}
+
+} // namespace Diligent
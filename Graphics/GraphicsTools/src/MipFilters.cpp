@@ -0,0 +1,896 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "MipFilters.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
+
+#include "GraphicsAccessories.hpp"
+#include "BCCodec.hpp"
+#include "ColorConversion.h"
+#include "ThreadPool.hpp"
+#include "DebugUtilities.hpp"
+#include "Intrinsics.hpp"
+
+// Half-float conversion and square root instructions are only available on 64-bit ARM
+#if DILIGENT_NEON_ENABLED && (defined(__aarch64__) || defined(_M_ARM64))
+#    define DILIGENT_NEON64_ENABLED 1
+#endif
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Converts a 16-bit float to a 32-bit float.
+inline float HalfToFloat(Uint16 Half)
+{
+    const Uint32 Sign = Uint32{Half & 0x8000u} << 16u;
+    const Uint32 Exp  = (Half >> 10u) & 0x1Fu;
+    const Uint32 Mant = Half & 0x3FFu;
+
+    Uint32 Bits = 0;
+    if (Exp == 0x1Fu)
+    {
+        // Inf or NaN
+        Bits = Sign | 0x7F800000u | (Mant << 13u);
+    }
+    else if (Exp != 0)
+    {
+        // Normal number: rebias the exponent from 15 to 127
+        Bits = Sign | ((Exp + 112u) << 23u) | (Mant << 13u);
+    }
+    else
+    {
+        // Zero or subnormal number: Mant * 2^-24
+        const float Val = static_cast<float>(Mant) * (1.f / 16777216.f);
+        return Sign != 0 ? -Val : Val;
+    }
+
+    float Val;
+    memcpy(&Val, &Bits, sizeof(Val));
+    return Val;
+}
+
+// Converts a 32-bit float to a 16-bit float, rounding to the nearest even value
+// (the same as the hardware conversion).
+inline Uint16 FloatToHalf(float Val)
+{
+    Uint32 Bits;
+    memcpy(&Bits, &Val, sizeof(Bits));
+
+    const Uint32 Sign = (Bits >> 16u) & 0x8000u;
+    const Uint32 Abs  = Bits & 0x7FFFFFFFu;
+
+    if (Abs >= 0x7F800000u)
+    {
+        // Inf or NaN. Keep NaNs quiet.
+        return static_cast<Uint16>(Sign | 0x7C00u | (Abs > 0x7F800000u ? 0x200u | ((Abs >> 13u) & 0x3FFu) : 0u));
+    }
+
+    if (Abs >= 0x477FF000u)
+    {
+        // The value rounds to 65536 or greater
+        return static_cast<Uint16>(Sign | 0x7C00u);
+    }
+
+    if (Abs >= 0x38800000u)
+    {
+        // Normal number: rebias the exponent from 127 to 15. Carry from the mantissa
+        // rounding correctly propagates to the exponent.
+        Uint32       Half = (Abs - 0x38000000u) >> 13u;
+        const Uint32 Rem  = Abs & 0x1FFFu;
+        if (Rem > 0x1000u || (Rem == 0x1000u && (Half & 0x01u) != 0))
+            ++Half;
+        return static_cast<Uint16>(Sign | Half);
+    }
+
+    if (Abs < 0x33000000u)
+    {
+        // The value is not greater than 2^-25 and rounds to zero
+        return static_cast<Uint16>(Sign);
+    }
+
+    // Subnormal number: the result is the value in 2^-24 units
+    const Uint32 Shift    = 126u - (Abs >> 23u);
+    const Uint32 Mant     = (Abs & 0x7FFFFFu) | 0x800000u;
+    Uint32       Half     = Mant >> Shift;
+    const Uint32 Rem      = Mant & ((1u << Shift) - 1u);
+    const Uint32 HalfUnit = 1u << (Shift - 1u);
+    if (Rem > HalfUnit || (Rem == HalfUnit && (Half & 0x01u) != 0))
+        ++Half;
+    return static_cast<Uint16>(Sign | Half);
+}
+
+
+// Loads and stores filter components as 32-bit floats.
+template <typename ComponentType>
+struct ComponentIO;
+
+template <>
+struct ComponentIO<float>
+{
+    static float Load(float Val) { return Val; }
+    static void  Store(float& Dst, float Val) { Dst = Val; }
+
+#if DILIGENT_AVX2_ENABLED
+    static __m256 Load8(const float* pSrc) { return _mm256_loadu_ps(pSrc); }
+    static void   Store8(float* pDst, __m256 Val) { _mm256_storeu_ps(pDst, Val); }
+#endif
+#if DILIGENT_SSE2_ENABLED
+    static __m128 Load4(const float* pSrc) { return _mm_loadu_ps(pSrc); }
+    static void   Store4(float* pDst, __m128 Val) { _mm_storeu_ps(pDst, Val); }
+#elif DILIGENT_NEON_ENABLED
+    static float32x4_t Load4(const float* pSrc) { return vld1q_f32(pSrc); }
+    static void        Store4(float* pDst, float32x4_t Val) { vst1q_f32(pDst, Val); }
+#endif
+};
+
+// 16-bit floats
+template <>
+struct ComponentIO<Uint16>
+{
+    static float Load(Uint16 Val) { return HalfToFloat(Val); }
+    static void  Store(Uint16& Dst, float Val) { Dst = FloatToHalf(Val); }
+
+#if DILIGENT_F16C_ENABLED
+    static __m256 Load8(const Uint16* pSrc) { return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc))); }
+    static void   Store8(Uint16* pDst, __m256 Val) { _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst), _mm256_cvtps_ph(Val, _MM_FROUND_TO_NEAREST_INT)); }
+    static __m128 Load4(const Uint16* pSrc) { return _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pSrc))); }
+    static void   Store4(Uint16* pDst, __m128 Val) { _mm_storel_epi64(reinterpret_cast<__m128i*>(pDst), _mm_cvtps_ph(Val, _MM_FROUND_TO_NEAREST_INT)); }
+#else
+#    if DILIGENT_AVX2_ENABLED
+    static __m256 Load8(const Uint16* pSrc)
+    {
+        alignas(32) float Vals[8];
+        for (size_t i = 0; i < 8; ++i)
+            Vals[i] = HalfToFloat(pSrc[i]);
+        return _mm256_load_ps(Vals);
+    }
+    static void Store8(Uint16* pDst, __m256 Val)
+    {
+        alignas(32) float Vals[8];
+        _mm256_store_ps(Vals, Val);
+        for (size_t i = 0; i < 8; ++i)
+            pDst[i] = FloatToHalf(Vals[i]);
+    }
+#    endif
+#    if DILIGENT_SSE2_ENABLED
+    static __m128 Load4(const Uint16* pSrc)
+    {
+        return _mm_setr_ps(HalfToFloat(pSrc[0]), HalfToFloat(pSrc[1]), HalfToFloat(pSrc[2]), HalfToFloat(pSrc[3]));
+    }
+    static void Store4(Uint16* pDst, __m128 Val)
+    {
+        alignas(16) float Vals[4];
+        _mm_store_ps(Vals, Val);
+        for (size_t i = 0; i < 4; ++i)
+            pDst[i] = FloatToHalf(Vals[i]);
+    }
+#    elif DILIGENT_NEON64_ENABLED
+    static float32x4_t Load4(const Uint16* pSrc) { return vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(pSrc))); }
+    static void        Store4(Uint16* pDst, float32x4_t Val) { vst1_u16(pDst, vreinterpret_u16_f16(vcvt_f16_f32(Val))); }
+#    elif DILIGENT_NEON_ENABLED
+    static float32x4_t Load4(const Uint16* pSrc)
+    {
+        const float Vals[4] = {HalfToFloat(pSrc[0]), HalfToFloat(pSrc[1]), HalfToFloat(pSrc[2]), HalfToFloat(pSrc[3])};
+        return vld1q_f32(Vals);
+    }
+    static void Store4(Uint16* pDst, float32x4_t Val)
+    {
+        float Vals[4];
+        vst1q_f32(Vals, Val);
+        for (size_t i = 0; i < 4; ++i)
+            pDst[i] = FloatToHalf(Vals[i]);
+    }
+#    endif
+#endif
+};
+
+
+// Splits the components of consecutive texels into the components of even and odd texels.
+// The components are processed in SIMD registers of four or eight floats; a and b are
+// the components of two consecutive groups of texels.
+template <Uint32 NumComponents>
+struct TexelShuffle;
+
+template <>
+struct TexelShuffle<1>
+{
+#if DILIGENT_AVX2_ENABLED
+    static void Deinterleave8(__m256 a, __m256 b, __m256& Even, __m256& Odd)
+    {
+        // Even: a0 a2 b0 b2 | a4 a6 b4 b6
+        Even = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        Odd  = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+    static __m256 Reorder8(__m256 v)
+    {
+        // a0 a2 b0 b2 | a4 a6 b4 b6 -> a0 a2 a4 a6 | b0 b2 b4 b6
+        return _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(v), _MM_SHUFFLE(3, 1, 2, 0)));
+    }
+#endif
+#if DILIGENT_SSE2_ENABLED
+    static void Deinterleave4(__m128 a, __m128 b, __m128& Even, __m128& Odd)
+    {
+        Even = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        Odd  = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+#elif DILIGENT_NEON_ENABLED
+    static void Deinterleave4(float32x4_t a, float32x4_t b, float32x4_t& Even, float32x4_t& Odd)
+    {
+        const float32x4x2_t Res = vuzpq_f32(a, b);
+        Even                    = Res.val[0];
+        Odd                     = Res.val[1];
+    }
+#endif
+};
+
+template <>
+struct TexelShuffle<2>
+{
+#if DILIGENT_AVX2_ENABLED
+    static void Deinterleave8(__m256 a, __m256 b, __m256& Even, __m256& Odd)
+    {
+        // Even: a.t0 b.t0 | a.t2 b.t2
+        Even = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 1, 0));
+        Odd  = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 2, 3, 2));
+    }
+    static __m256 Reorder8(__m256 v)
+    {
+        // a.t0 b.t0 | a.t2 b.t2 -> a.t0 a.t2 | b.t0 b.t2
+        return _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(v), _MM_SHUFFLE(3, 1, 2, 0)));
+    }
+#endif
+#if DILIGENT_SSE2_ENABLED
+    static void Deinterleave4(__m128 a, __m128 b, __m128& Even, __m128& Odd)
+    {
+        Even = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 1, 0));
+        Odd  = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 2, 3, 2));
+    }
+#elif DILIGENT_NEON_ENABLED
+    static void Deinterleave4(float32x4_t a, float32x4_t b, float32x4_t& Even, float32x4_t& Odd)
+    {
+        Even = vcombine_f32(vget_low_f32(a), vget_low_f32(b));
+        Odd  = vcombine_f32(vget_high_f32(a), vget_high_f32(b));
+    }
+#endif
+};
+
+template <>
+struct TexelShuffle<4>
+{
+#if DILIGENT_AVX2_ENABLED
+    static void Deinterleave8(__m256 a, __m256 b, __m256& Even, __m256& Odd)
+    {
+        Even = _mm256_permute2f128_ps(a, b, 0x20);
+        Odd  = _mm256_permute2f128_ps(a, b, 0x31);
+    }
+    static __m256 Reorder8(__m256 v)
+    {
+        return v;
+    }
+#endif
+#if DILIGENT_SSE2_ENABLED
+    static void Deinterleave4(__m128 a, __m128 b, __m128& Even, __m128& Odd)
+    {
+        Even = a;
+        Odd  = b;
+    }
+#elif DILIGENT_NEON_ENABLED
+    static void Deinterleave4(float32x4_t a, float32x4_t b, float32x4_t& Even, float32x4_t& Odd)
+    {
+        Even = a;
+        Odd  = b;
+    }
+#endif
+};
+
+
+// Every filter defines the texel size, the scalar function that filters one texel, and
+// the SIMD function that filters as many texels of the coarse row as it can, starting with Col,
+// and returns the first column that has not been processed. The SIMD function is only called
+// when the fine level is at least two texels wide, so it does not need to clamp the columns.
+
+// 2x2 box filter for 4-component 8-bit UNORM and UINT formats
+struct RGBA8Filter
+{
+    static constexpr Uint32 TexelSize = 4;
+
+    static void FilterTexel(const Uint8* p00, const Uint8* p10, const Uint8* p01, const Uint8* p11, Uint8* pDst)
+    {
+        for (Uint32 c = 0; c < 4; ++c)
+            pDst[c] = static_cast<Uint8>((Uint32{p00[c]} + Uint32{p10[c]} + Uint32{p01[c]} + Uint32{p11[c]}) >> 2);
+    }
+
+    static Uint32 FilterSIMD(const Uint8* pRow0, const Uint8* pRow1, Uint8* pDst, Uint32 Col, Uint32 ColEnd)
+    {
+#if DILIGENT_AVX2_ENABLED
+        for (; Col + 8 <= ColEnd; Col += 8)
+        {
+            const __m256i Zero = _mm256_setzero_si256();
+            const __m256i r00  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pRow0 + size_t{Col} * 8));
+            const __m256i r01  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pRow0 + size_t{Col} * 8 + 32));
+            const __m256i r10  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pRow1 + size_t{Col} * 8));
+            const __m256i r11  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pRow1 + size_t{Col} * 8 + 32));
+
+            // Vertical sums in 16-bit lanes, fine texels t0 t1 | t4 t5 and t2 t3 | t6 t7
+            const __m256i s0 = _mm256_add_epi16(_mm256_unpacklo_epi8(r00, Zero), _mm256_unpacklo_epi8(r10, Zero));
+            const __m256i s1 = _mm256_add_epi16(_mm256_unpackhi_epi8(r00, Zero), _mm256_unpackhi_epi8(r10, Zero));
+            const __m256i s2 = _mm256_add_epi16(_mm256_unpacklo_epi8(r01, Zero), _mm256_unpacklo_epi8(r11, Zero));
+            const __m256i s3 = _mm256_add_epi16(_mm256_unpackhi_epi8(r01, Zero), _mm256_unpackhi_epi8(r11, Zero));
+
+            // Horizontal sums, coarse texels c0 c1 | c2 c3 and c4 c5 | c6 c7
+            const __m256i c0 = _mm256_srli_epi16(_mm256_add_epi16(_mm256_unpacklo_epi64(s0, s1), _mm256_unpackhi_epi64(s0, s1)), 2);
+            const __m256i c1 = _mm256_srli_epi16(_mm256_add_epi16(_mm256_unpacklo_epi64(s2, s3), _mm256_unpackhi_epi64(s2, s3)), 2);
+
+            // c0 c1 c4 c5 | c2 c3 c6 c7 -> c0 ... c7
+            const __m256i Res = _mm256_permute4x64_epi64(_mm256_packus_epi16(c0, c1), _MM_SHUFFLE(3, 1, 2, 0));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + size_t{Col} * 4), Res);
+        }
+#endif
+#if DILIGENT_SSE2_ENABLED
+        for (; Col + 4 <= ColEnd; Col += 4)
+        {
+            const __m128i Zero = _mm_setzero_si128();
+            const __m128i r00  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pRow0 + size_t{Col} * 8));
+            const __m128i r01  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pRow0 + size_t{Col} * 8 + 16));
+            const __m128i r10  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pRow1 + size_t{Col} * 8));
+            const __m128i r11  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pRow1 + size_t{Col} * 8 + 16));
+
+            // Vertical sums in 16-bit lanes, two fine texels per register
+            const __m128i s0 = _mm_add_epi16(_mm_unpacklo_epi8(r00, Zero), _mm_unpacklo_epi8(r10, Zero));
+            const __m128i s1 = _mm_add_epi16(_mm_unpackhi_epi8(r00, Zero), _mm_unpackhi_epi8(r10, Zero));
+            const __m128i s2 = _mm_add_epi16(_mm_unpacklo_epi8(r01, Zero), _mm_unpacklo_epi8(r11, Zero));
+            const __m128i s3 = _mm_add_epi16(_mm_unpackhi_epi8(r01, Zero), _mm_unpackhi_epi8(r11, Zero));
+
+            // Horizontal sums, two coarse texels per register
+            const __m128i c0 = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(s0, s1), _mm_unpackhi_epi64(s0, s1)), 2);
+            const __m128i c1 = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(s2, s3), _mm_unpackhi_epi64(s2, s3)), 2);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + size_t{Col} * 4), _mm_packus_epi16(c0, c1));
+        }
+#elif DILIGENT_NEON_ENABLED
+        for (; Col + 4 <= ColEnd; Col += 4)
+        {
+            // Even and odd fine texels
+            const uint32x4x2_t r0 = vld2q_u32(reinterpret_cast<const uint32_t*>(pRow0 + size_t{Col} * 8));
+            const uint32x4x2_t r1 = vld2q_u32(reinterpret_cast<const uint32_t*>(pRow1 + size_t{Col} * 8));
+
+            const uint8x16_t e0 = vreinterpretq_u8_u32(r0.val[0]);
+            const uint8x16_t o0 = vreinterpretq_u8_u32(r0.val[1]);
+            const uint8x16_t e1 = vreinterpretq_u8_u32(r1.val[0]);
+            const uint8x16_t o1 = vreinterpretq_u8_u32(r1.val[1]);
+
+            const uint16x8_t Lo = vaddq_u16(vaddl_u8(vget_low_u8(e0), vget_low_u8(o0)), vaddl_u8(vget_low_u8(e1), vget_low_u8(o1)));
+            const uint16x8_t Hi = vaddq_u16(vaddl_u8(vget_high_u8(e0), vget_high_u8(o0)), vaddl_u8(vget_high_u8(e1), vget_high_u8(o1)));
+            vst1q_u8(pDst + size_t{Col} * 4, vcombine_u8(vshrn_n_u16(Lo, 2), vshrn_n_u16(Hi, 2)));
+        }
+#endif
+        return Col;
+    }
+};
+
+
+// sRGB to linear conversion table that matches FastGammaToLinear()
+const float* GetSRGBToLinearTable()
+{
+    static const std::array<float, 256> Table = []() {
+        std::array<float, 256> Tbl;
+        for (Uint32 i = 0; i < Tbl.size(); ++i)
+            Tbl[i] = FastGammaToLinear(static_cast<float>(i) * (1.f / 255.f));
+        return Tbl;
+    }();
+    return Table.data();
+}
+
+#if DILIGENT_SSE2_ENABLED
+// Vector version of FastLinearToGamma()
+inline __m128 FastLinearToGammaSSE(__m128 x)
+{
+    const __m128 Lo     = _mm_mul_ps(_mm_set1_ps(12.92f), x);
+    const __m128 AbsVal = _mm_andnot_ps(_mm_set1_ps(-0.f), _mm_sub_ps(x, _mm_set1_ps(0.00228f)));
+    const __m128 Hi     = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_set1_ps(1.13005f), _mm_sqrt_ps(AbsVal)), _mm_mul_ps(_mm_set1_ps(0.13448f), x)), _mm_set1_ps(0.005719f));
+    const __m128 IsLo   = _mm_cmplt_ps(x, _mm_set1_ps(0.0031308f));
+    return _mm_or_ps(_mm_and_ps(IsLo, Lo), _mm_andnot_ps(IsLo, Hi));
+}
+#elif DILIGENT_NEON64_ENABLED
+inline float32x4_t FastLinearToGammaNEON(float32x4_t x)
+{
+    const float32x4_t Lo   = vmulq_f32(vdupq_n_f32(12.92f), x);
+    const float32x4_t Hi   = vaddq_f32(vsubq_f32(vmulq_f32(vdupq_n_f32(1.13005f), vsqrtq_f32(vabsq_f32(vsubq_f32(x, vdupq_n_f32(0.00228f))))), vmulq_f32(vdupq_n_f32(0.13448f), x)), vdupq_n_f32(0.005719f));
+    const uint32x4_t  IsLo = vcltq_f32(x, vdupq_n_f32(0.0031308f));
+    return vbslq_f32(IsLo, Lo, Hi);
+}
+#endif
+
+// 2x2 box filter for 4-component 8-bit sRGB formats that averages the texels in linear space
+struct SRGBA8Filter
+{
+    static constexpr Uint32 TexelSize = 4;
+
+    static void FilterTexel(const Uint8* p00, const Uint8* p10, const Uint8* p01, const Uint8* p11, Uint8* pDst)
+    {
+        const float* ToLinear = GetSRGBToLinearTable();
+        for (Uint32 c = 0; c < 4; ++c)
+        {
+            const float LinearAverage = (ToLinear[p00[c]] + ToLinear[p10[c]] + ToLinear[p01[c]] + ToLinear[p11[c]]) * 0.25f;
+
+            // Clamping on both ends is essential because fast SRGB math is imprecise
+            float SRGBAverage = FastLinearToGamma(LinearAverage) * 255.f;
+            SRGBAverage       = std::max(SRGBAverage, 0.f);
+            SRGBAverage       = std::min(SRGBAverage, 255.f);
+            pDst[c]           = static_cast<Uint8>(SRGBAverage);
+        }
+    }
+
+    static Uint32 FilterSIMD(const Uint8* pRow0, const Uint8* pRow1, Uint8* pDst, Uint32 Col, Uint32 ColEnd)
+    {
+#if DILIGENT_SSE2_ENABLED || DILIGENT_NEON64_ENABLED
+        const float* ToLinear = GetSRGBToLinearTable();
+#endif
+
+#if DILIGENT_SSE2_ENABLED
+        auto LoadLinear = [ToLinear](const Uint8* pTexel) {
+            return _mm_setr_ps(ToLinear[pTexel[0]], ToLinear[pTexel[1]], ToLinear[pTexel[2]], ToLinear[pTexel[3]]);
+        };
+        auto FilterTexelSSE = [&](Uint32 c) {
+            const Uint8* p0 = pRow0 + size_t{c} * 8;
+            const Uint8* p1 = pRow1 + size_t{c} * 8;
+
+            const __m128 Sum = _mm_add_ps(_mm_add_ps(_mm_add_ps(LoadLinear(p0), LoadLinear(p0 + 4)), LoadLinear(p1)), LoadLinear(p1 + 4));
+
+            __m128 SRGBAverage = _mm_mul_ps(FastLinearToGammaSSE(_mm_mul_ps(Sum, _mm_set1_ps(0.25f))), _mm_set1_ps(255.f));
+            SRGBAverage        = _mm_min_ps(_mm_max_ps(SRGBAverage, _mm_setzero_ps()), _mm_set1_ps(255.f));
+            return _mm_cvttps_epi32(SRGBAverage);
+        };
+        for (; Col + 4 <= ColEnd; Col += 4)
+        {
+            const __m128i c01 = _mm_packs_epi32(FilterTexelSSE(Col + 0), FilterTexelSSE(Col + 1));
+            const __m128i c23 = _mm_packs_epi32(FilterTexelSSE(Col + 2), FilterTexelSSE(Col + 3));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + size_t{Col} * 4), _mm_packus_epi16(c01, c23));
+        }
+#elif DILIGENT_NEON64_ENABLED
+        auto LoadLinear = [ToLinear](const Uint8* pTexel) {
+            const float Vals[4] = {ToLinear[pTexel[0]], ToLinear[pTexel[1]], ToLinear[pTexel[2]], ToLinear[pTexel[3]]};
+            return vld1q_f32(Vals);
+        };
+        auto FilterTexelNEON = [&](Uint32 c) {
+            const Uint8* p0 = pRow0 + size_t{c} * 8;
+            const Uint8* p1 = pRow1 + size_t{c} * 8;
+
+            const float32x4_t Sum = vaddq_f32(vaddq_f32(vaddq_f32(LoadLinear(p0), LoadLinear(p0 + 4)), LoadLinear(p1)), LoadLinear(p1 + 4));
+
+            float32x4_t SRGBAverage = vmulq_f32(FastLinearToGammaNEON(vmulq_f32(Sum, vdupq_n_f32(0.25f))), vdupq_n_f32(255.f));
+            SRGBAverage             = vminq_f32(vmaxq_f32(SRGBAverage, vdupq_n_f32(0.f)), vdupq_n_f32(255.f));
+            return vmovn_u32(vcvtq_u32_f32(SRGBAverage));
+        };
+        for (; Col + 4 <= ColEnd; Col += 4)
+        {
+            const uint16x8_t c01 = vcombine_u16(FilterTexelNEON(Col + 0), FilterTexelNEON(Col + 1));
+            const uint16x8_t c23 = vcombine_u16(FilterTexelNEON(Col + 2), FilterTexelNEON(Col + 3));
+            vst1q_u8(pDst + size_t{Col} * 4, vcombine_u8(vmovn_u16(c01), vmovn_u16(c23)));
+        }
+#endif
+        return Col;
+    }
+};
+
+
+// 2x2 box filter for 32-bit and 16-bit float formats
+template <Uint32 NumComponents, typename ComponentType>
+struct FloatFilter
+{
+    static constexpr Uint32 TexelSize = NumComponents * sizeof(ComponentType);
+
+    using IO = ComponentIO<ComponentType>;
+
+    static void FilterTexel(const Uint8* p00, const Uint8* p10, const Uint8* p01, const Uint8* p11, Uint8* pDst)
+    {
+        const ComponentType* c00 = reinterpret_cast<const ComponentType*>(p00);
+        const ComponentType* c10 = reinterpret_cast<const ComponentType*>(p10);
+        const ComponentType* c01 = reinterpret_cast<const ComponentType*>(p01);
+        const ComponentType* c11 = reinterpret_cast<const ComponentType*>(p11);
+        ComponentType*       d   = reinterpret_cast<ComponentType*>(pDst);
+        for (Uint32 c = 0; c < NumComponents; ++c)
+            IO::Store(d[c], (IO::Load(c00[c]) + IO::Load(c10[c]) + IO::Load(c01[c]) + IO::Load(c11[c])) * 0.25f);
+    }
+
+    static Uint32 FilterSIMD(const Uint8* pRow0, const Uint8* pRow1, Uint8* pDst, Uint32 Col, Uint32 ColEnd)
+    {
+        const ComponentType* pSrc0 = reinterpret_cast<const ComponentType*>(pRow0);
+        const ComponentType* pSrc1 = reinterpret_cast<const ComponentType*>(pRow1);
+        ComponentType*       pDstC = reinterpret_cast<ComponentType*>(pDst);
+
+        // The components are summed in the same order as by the scalar filter,
+        // so that the results are bit-exact.
+#if DILIGENT_AVX2_ENABLED
+        // Eight coarse components per iteration
+        for (; Col + 8 / NumComponents <= ColEnd; Col += 8 / NumComponents)
+        {
+            const size_t SrcOffset = size_t{Col} * 2 * NumComponents;
+
+            __m256 Even0, Odd0, Even1, Odd1;
+            TexelShuffle<NumComponents>::Deinterleave8(IO::Load8(pSrc0 + SrcOffset), IO::Load8(pSrc0 + SrcOffset + 8), Even0, Odd0);
+            TexelShuffle<NumComponents>::Deinterleave8(IO::Load8(pSrc1 + SrcOffset), IO::Load8(pSrc1 + SrcOffset + 8), Even1, Odd1);
+
+            const __m256 Sum = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(Even0, Odd0), Even1), Odd1);
+            IO::Store8(pDstC + size_t{Col} * NumComponents, TexelShuffle<NumComponents>::Reorder8(_mm256_mul_ps(Sum, _mm256_set1_ps(0.25f))));
+        }
+#endif
+#if DILIGENT_SSE2_ENABLED
+        // Four coarse components per iteration
+        for (; Col + 4 / NumComponents <= ColEnd; Col += 4 / NumComponents)
+        {
+            const size_t SrcOffset = size_t{Col} * 2 * NumComponents;
+
+            __m128 Even0, Odd0, Even1, Odd1;
+            TexelShuffle<NumComponents>::Deinterleave4(IO::Load4(pSrc0 + SrcOffset), IO::Load4(pSrc0 + SrcOffset + 4), Even0, Odd0);
+            TexelShuffle<NumComponents>::Deinterleave4(IO::Load4(pSrc1 + SrcOffset), IO::Load4(pSrc1 + SrcOffset + 4), Even1, Odd1);
+
+            const __m128 Sum = _mm_add_ps(_mm_add_ps(_mm_add_ps(Even0, Odd0), Even1), Odd1);
+            IO::Store4(pDstC + size_t{Col} * NumComponents, _mm_mul_ps(Sum, _mm_set1_ps(0.25f)));
+        }
+#elif DILIGENT_NEON_ENABLED
+        for (; Col + 4 / NumComponents <= ColEnd; Col += 4 / NumComponents)
+        {
+            const size_t SrcOffset = size_t{Col} * 2 * NumComponents;
+
+            float32x4_t Even0, Odd0, Even1, Odd1;
+            TexelShuffle<NumComponents>::Deinterleave4(IO::Load4(pSrc0 + SrcOffset), IO::Load4(pSrc0 + SrcOffset + 4), Even0, Odd0);
+            TexelShuffle<NumComponents>::Deinterleave4(IO::Load4(pSrc1 + SrcOffset), IO::Load4(pSrc1 + SrcOffset + 4), Even1, Odd1);
+
+            const float32x4_t Sum = vaddq_f32(vaddq_f32(vaddq_f32(Even0, Odd0), Even1), Odd1);
+            IO::Store4(pDstC + size_t{Col} * NumComponents, vmulq_f32(Sum, vdupq_n_f32(0.25f)));
+        }
+#else
+        (void)pSrc0;
+        (void)pSrc1;
+        (void)pDstC;
+#endif
+        return Col;
+    }
+};
+
+
+// Filters the coarse texels [ColBegin, ColEnd) of one row.
+//      pRow0, pRow1 - the two fine rows
+//      FineWidth    - the fine level width
+using MipRowFilterType = void (*)(const Uint8* pRow0, const Uint8* pRow1, Uint8* pDstRow, Uint32 FineWidth, Uint32 ColBegin, Uint32 ColEnd);
+
+template <typename FilterType>
+void FilterMipRow(const Uint8* pRow0, const Uint8* pRow1, Uint8* pDstRow, Uint32 FineWidth, Uint32 ColBegin, Uint32 ColEnd)
+{
+    constexpr Uint32 TexelSize = FilterType::TexelSize;
+
+    Uint32 Col = FineWidth > 1 ? FilterType::FilterSIMD(pRow0, pRow1, pDstRow, ColBegin, ColEnd) : ColBegin;
+    for (; Col < ColEnd; ++Col)
+    {
+        const size_t FineCol0 = size_t{Col} * 2;
+        const size_t FineCol1 = std::min(Col * 2 + 1, FineWidth - 1);
+        FilterType::FilterTexel(pRow0 + FineCol0 * TexelSize, pRow0 + FineCol1 * TexelSize,
+                                pRow1 + FineCol0 * TexelSize, pRow1 + FineCol1 * TexelSize,
+                                pDstRow + size_t{Col} * TexelSize);
+    }
+}
+
+// Returns the row filter for the format, or null if the format is not supported by specialized filters.
+MipRowFilterType FindMipRowFilter(const TextureFormatAttribs& FmtAttribs, MIP_FILTER_TYPE FilterType)
+{
+    if (FilterType == MIP_FILTER_TYPE_DEFAULT)
+    {
+        FilterType = FmtAttribs.ComponentType == COMPONENT_TYPE_UINT || FmtAttribs.ComponentType == COMPONENT_TYPE_SINT ?
+            MIP_FILTER_TYPE_MOST_FREQUENT :
+            MIP_FILTER_TYPE_BOX_AVERAGE;
+    }
+    if (FilterType != MIP_FILTER_TYPE_BOX_AVERAGE)
+        return nullptr;
+
+    switch (FmtAttribs.ComponentType)
+    {
+        case COMPONENT_TYPE_UNORM_SRGB:
+            return FmtAttribs.ComponentSize == 1 && FmtAttribs.NumComponents == 4 ? FilterMipRow<SRGBA8Filter> : nullptr;
+
+        case COMPONENT_TYPE_UNORM:
+        case COMPONENT_TYPE_UINT:
+            return FmtAttribs.ComponentSize == 1 && FmtAttribs.NumComponents == 4 ? FilterMipRow<RGBA8Filter> : nullptr;
+
+        case COMPONENT_TYPE_FLOAT:
+            if (FmtAttribs.ComponentSize == 4)
+            {
+                switch (FmtAttribs.NumComponents)
+                {
+                    case 1: return FilterMipRow<FloatFilter<1, float>>;
+                    case 2: return FilterMipRow<FloatFilter<2, float>>;
+                    case 4: return FilterMipRow<FloatFilter<4, float>>;
+                    default: return nullptr;
+                }
+            }
+            else if (FmtAttribs.ComponentSize == 2)
+            {
+                switch (FmtAttribs.NumComponents)
+                {
+                    case 1: return FilterMipRow<FloatFilter<1, Uint16>>;
+                    case 2: return FilterMipRow<FloatFilter<2, Uint16>>;
+                    case 4: return FilterMipRow<FloatFilter<4, Uint16>>;
+                    default: return nullptr;
+                }
+            }
+            return nullptr;
+
+        default:
+            return nullptr;
+    }
+}
+
+// Remaps the alpha channel of the coarse texels [ColBegin, ColEnd) of a 4-component 8-bit row,
+// see RemapAlpha() in GraphicsUtilities.cpp.
+void RemapAlphaRow(Uint8* pRow, Uint32 ColBegin, Uint32 ColEnd, float AlphaCutoff)
+{
+    for (Uint32 Col = ColBegin; Col < ColEnd; ++Col)
+    {
+        Uint8& Alpha = pRow[size_t{Col} * 4 + 3];
+
+        const float AlphaNew = std::min((static_cast<float>(Alpha) + 2.f * (AlphaCutoff * 255.f)) / 3.f, 255.f);
+        Alpha                = std::max(Alpha, static_cast<Uint8>(AlphaNew));
+    }
+}
+
+struct MipLevelInfo
+{
+    Uint8* pData  = nullptr;
+    size_t Stride = 0;
+    Uint32 Width  = 0;
+    Uint32 Height = 0;
+};
+
+class MipChainFilter
+{
+public:
+    MipChainFilter(MipRowFilterType Filter, float AlphaCutoff) :
+        m_Filter{Filter},
+        m_AlphaCutoff{AlphaCutoff}
+    {}
+
+    // Computes the coarse texels [ColBegin, ColEnd) x [RowBegin, RowEnd) of the level
+    void FilterRect(const MipLevelInfo& Fine, const MipLevelInfo& Coarse, Uint32 ColBegin, Uint32 ColEnd, Uint32 RowBegin, Uint32 RowEnd) const
+    {
+        for (Uint32 Row = RowBegin; Row < RowEnd; ++Row)
+        {
+            // Note that for all coarse rows, 2 * Row + 1 < Fine.Height unless the fine level is one texel high
+            const Uint8* pRow0   = Fine.pData + size_t{Row} * 2 * Fine.Stride;
+            const Uint8* pRow1   = Fine.Height > 1 ? pRow0 + Fine.Stride : pRow0;
+            Uint8*       pDstRow = Coarse.pData + size_t{Row} * Coarse.Stride;
+            m_Filter(pRow0, pRow1, pDstRow, Fine.Width, ColBegin, ColEnd);
+            if (m_AlphaCutoff > 0)
+                RemapAlphaRow(pDstRow, ColBegin, ColEnd, m_AlphaCutoff);
+        }
+    }
+
+    // Computes the levels 1 .. NumCoarseLevels of the horizontal band of 2^BandHeightLog2 rows
+    // of level 0. NumCoarseLevels must not exceed BandHeightLog2, so that the band is at least one
+    // row high in every level. Since every coarse row only depends on the fine rows of the same
+    // band, the bands can be processed independently.
+    void FilterBand(const MipLevelInfo* pLevels, Uint32 NumCoarseLevels, Uint32 BandHeightLog2, Uint32 Band) const
+    {
+        VERIFY_EXPR(NumCoarseLevels <= BandHeightLog2);
+        for (Uint32 Level = 1; Level <= NumCoarseLevels; ++Level)
+        {
+            const MipLevelInfo& Coarse = pLevels[Level];
+
+            const Uint32 Shift    = BandHeightLog2 - Level;
+            const Uint32 RowBegin = Band << Shift;
+            const Uint32 RowEnd   = std::min((Band + 1) << Shift, Coarse.Height);
+            FilterRect(pLevels[Level - 1], Coarse, 0, Coarse.Width, RowBegin, RowEnd);
+        }
+    }
+
+private:
+    const MipRowFilterType m_Filter;
+    const float            m_AlphaCutoff;
+};
+
+// Decodes the most detailed level, computes the mip chain of the uncompressed
+// data and encodes every coarse level back to the block-compressed format.
+void ComputeBCMipChain(const ComputeMipChainAttribs& Attribs)
+{
+    const TEXTURE_FORMAT UncompressedFmt = BCFormatToUncompressed(Attribs.Format);
+    DEV_CHECK_ERR(GetTextureFormatAttribs(UncompressedFmt).ComponentType != COMPONENT_TYPE_UNDEFINED,
+                  "Typeless block-compressed formats are not supported");
+    const Uint32 TexelSize = GetTextureFormatAttribs(UncompressedFmt).GetElementSize();
+
+    std::vector<std::vector<Uint8>> Levels(size_t{Attribs.NumCoarseMips} + 1);
+    std::vector<void*>              pCoarseData(Attribs.NumCoarseMips);
+    std::vector<size_t>             CoarseStrides(Attribs.NumCoarseMips);
+
+    Uint32 Width  = Attribs.Width;
+    Uint32 Height = Attribs.Height;
+    Levels[0].resize(size_t{Width} * Height * TexelSize);
+    for (Uint32 i = 0; i < Attribs.NumCoarseMips; ++i)
+    {
+        Width  = std::max(Width / 2, 1u);
+        Height = std::max(Height / 2, 1u);
+        Levels[i + 1].resize(size_t{Width} * Height * TexelSize);
+        pCoarseData[i]   = Levels[i + 1].data();
+        CoarseStrides[i] = size_t{Width} * TexelSize;
+    }
+
+    BCDecodeAttribs DecodeAttribs;
+    DecodeAttribs.Format      = Attribs.Format;
+    DecodeAttribs.Width       = Attribs.Width;
+    DecodeAttribs.Height      = Attribs.Height;
+    DecodeAttribs.pSrcData    = Attribs.pFineMipData;
+    DecodeAttribs.SrcStride   = Attribs.FineMipStride;
+    DecodeAttribs.pDstData    = Levels[0].data();
+    DecodeAttribs.DstStride   = size_t{Attribs.Width} * TexelSize;
+    DecodeAttribs.pThreadPool = Attribs.pThreadPool;
+    DecodeBC(DecodeAttribs);
+
+    ComputeMipChainAttribs UncompressedAttribs = Attribs;
+    UncompressedAttribs.Format                 = UncompressedFmt;
+    UncompressedAttribs.pFineMipData           = Levels[0].data();
+    UncompressedAttribs.FineMipStride          = DecodeAttribs.DstStride;
+    UncompressedAttribs.ppCoarseMipData        = pCoarseData.data();
+    UncompressedAttribs.pCoarseMipStrides      = CoarseStrides.data();
+    ComputeMipChain(UncompressedAttribs);
+
+    Width  = Attribs.Width;
+    Height = Attribs.Height;
+    for (Uint32 i = 0; i < Attribs.NumCoarseMips; ++i)
+    {
+        Width  = std::max(Width / 2, 1u);
+        Height = std::max(Height / 2, 1u);
+
+        BCEncodeAttribs EncodeAttribs;
+        EncodeAttribs.Format      = Attribs.Format;
+        EncodeAttribs.Width       = Width;
+        EncodeAttribs.Height      = Height;
+        EncodeAttribs.pSrcData    = pCoarseData[i];
+        EncodeAttribs.SrcStride   = CoarseStrides[i];
+        EncodeAttribs.pDstData    = Attribs.ppCoarseMipData[i];
+        EncodeAttribs.DstStride   = Attribs.pCoarseMipStrides[i];
+        EncodeAttribs.Quality     = BC_COMPRESSION_QUALITY_NORMAL;
+        EncodeAttribs.pThreadPool = Attribs.pThreadPool;
+        EncodeBC(EncodeAttribs);
+    }
+}
+
+} // namespace
+
+
+bool ComputeMipLevelSpecialized(const ComputeMipLevelAttribs& Attribs)
+{
+    const TextureFormatAttribs& FmtAttribs = GetTextureFormatAttribs(Attribs.Format);
+
+    const MipRowFilterType Filter = FindMipRowFilter(FmtAttribs, Attribs.FilterType);
+    if (Filter == nullptr)
+        return false;
+
+    const MipLevelInfo Fine{const_cast<Uint8*>(static_cast<const Uint8*>(Attribs.pFineMipData)), Attribs.FineMipStride, Attribs.FineMipWidth, Attribs.FineMipHeight};
+    const MipLevelInfo Coarse{static_cast<Uint8*>(Attribs.pCoarseMipData), Attribs.CoarseMipStride, std::max(Fine.Width / 2, 1u), std::max(Fine.Height / 2, 1u)};
+
+    const MipChainFilter ChainFilter{Filter, FmtAttribs.ComponentSize == 1 ? Attribs.AlphaCutoff : 0.f};
+    ChainFilter.FilterRect(Fine, Coarse, 0, Coarse.Width, 0, Coarse.Height);
+
+    return true;
+}
+
+void ComputeMipChain(const ComputeMipChainAttribs& Attribs)
+{
+    DEV_CHECK_ERR(Attribs.Format != TEX_FORMAT_UNKNOWN, "Format must not be unknown");
+    DEV_CHECK_ERR(Attribs.Width != 0, "Width must not be zero");
+    DEV_CHECK_ERR(Attribs.Height != 0, "Height must not be zero");
+    DEV_CHECK_ERR(Attribs.pFineMipData != nullptr, "Fine level data must not be null");
+    DEV_CHECK_ERR(Attribs.NumCoarseMips == 0 || (Attribs.ppCoarseMipData != nullptr && Attribs.pCoarseMipStrides != nullptr),
+                  "Coarse mip data and strides must not be null");
+    DEV_CHECK_ERR(Attribs.NumCoarseMips < ComputeMipLevelsCount(Attribs.Width, Attribs.Height),
+                  "The number of coarse mips (", Attribs.NumCoarseMips, ") exceeds the number of levels in the full mip chain minus one (",
+                  ComputeMipLevelsCount(Attribs.Width, Attribs.Height) - 1, ")");
+
+    if (Attribs.NumCoarseMips == 0)
+        return;
+
+    if (IsBCCodecSupported(Attribs.Format))
+    {
+        ComputeBCMipChain(Attribs);
+        return;
+    }
+
+    std::vector<MipLevelInfo> Levels(size_t{Attribs.NumCoarseMips} + 1);
+    Levels[0] = {const_cast<Uint8*>(static_cast<const Uint8*>(Attribs.pFineMipData)), Attribs.FineMipStride, Attribs.Width, Attribs.Height};
+    for (Uint32 i = 0; i < Attribs.NumCoarseMips; ++i)
+    {
+        DEV_CHECK_ERR(Attribs.ppCoarseMipData[i] != nullptr, "Coarse mip ", i + 1, " data must not be null");
+        Levels[i + 1] = {static_cast<Uint8*>(Attribs.ppCoarseMipData[i]), Attribs.pCoarseMipStrides[i], std::max(Levels[i].Width / 2, 1u), std::max(Levels[i].Height / 2, 1u)};
+    }
+
+    const TextureFormatAttribs& FmtAttribs = GetTextureFormatAttribs(Attribs.Format);
+    if (const MipRowFilterType Filter = FindMipRowFilter(FmtAttribs, Attribs.FilterType))
+    {
+        const MipChainFilter ChainFilter{Filter, FmtAttribs.ComponentSize == 1 ? Attribs.AlphaCutoff : 0.f};
+
+        // Full-width bands keep the memory accesses sequential, while the band height is selected
+        // so that the coarse rows of the band are still in the cache when the next level reads them.
+        constexpr size_t TargetBandSize = size_t{256} << 10u;
+
+        // Every pass computes up to BandHeightLog2 levels from the last level computed by the previous pass
+        for (Uint32 SrcLevel = 0; SrcLevel < Attribs.NumCoarseMips;)
+        {
+            const MipLevelInfo* pLevels  = &Levels[SrcLevel];
+            const size_t        RowSize  = size_t{pLevels[0].Width} * FmtAttribs.GetElementSize();
+            Uint32              BandHeightLog2 = 1;
+            while (BandHeightLog2 < 16 && (RowSize << (BandHeightLog2 + 1)) <= TargetBandSize)
+                ++BandHeightLog2;
+
+            const Uint32 NumCoarseLevels = std::min(BandHeightLog2, Attribs.NumCoarseMips - SrcLevel);
+            const Uint32 NumBands        = ((pLevels[0].Height - 1) >> BandHeightLog2) + 1;
+
+            ParallelFor(Attribs.pThreadPool, 0, NumBands,
+                        [&](Uint32 Band) {
+                            ChainFilter.FilterBand(pLevels, NumCoarseLevels, BandHeightLog2, Band);
+                        });
+
+            SrcLevel += NumCoarseLevels;
+        }
+    }
+    else
+    {
+        // Use the generic filter level by level, processing horizontal bands of rows in parallel.
+        // The band size must be a multiple of four as the most-frequent filter uses the row index
+        // to select between equally frequent values.
+        constexpr Uint32 BandSize = 64;
+        for (Uint32 Level = 1; Level <= Attribs.NumCoarseMips; ++Level)
+        {
+            const MipLevelInfo& Fine     = Levels[Level - 1];
+            const MipLevelInfo& Coarse   = Levels[Level];
+            const Uint32        NumBands = (Coarse.Height + BandSize - 1) / BandSize;
+
+            ParallelFor(Attribs.pThreadPool, 0, NumBands,
+                        [&](Uint32 Band) {
+                            const Uint32 RowBegin = Band * BandSize;
+                            const Uint32 RowEnd   = std::min(RowBegin + BandSize, Coarse.Height);
+
+                            ComputeMipLevelAttribs LevelAttribs;
+                            LevelAttribs.Format          = Attribs.Format;
+                            LevelAttribs.FineMipWidth    = Fine.Width;
+                            LevelAttribs.FineMipHeight   = Fine.Height > 1 ? (RowEnd - RowBegin) * 2 : 1;
+                            LevelAttribs.pFineMipData    = Fine.pData + size_t{RowBegin} * 2 * Fine.Stride;
+                            LevelAttribs.FineMipStride   = Fine.Stride;
+                            LevelAttribs.pCoarseMipData  = Coarse.pData + size_t{RowBegin} * Coarse.Stride;
+                            LevelAttribs.CoarseMipStride = Coarse.Stride;
+                            LevelAttribs.FilterType      = Attribs.FilterType;
+                            LevelAttribs.AlphaCutoff     = Attribs.AlphaCutoff;
+                            ComputeMipLevel(LevelAttribs);
+                        });
+        }
+    }
+}
+
+} // namespace Diligent
@@ -895,6 +895,9 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
         return 0;
     }
 
+    // Shader source files may have been modified since they were last hashed
+    InvalidateShaderSourceHashCache();
+
     Uint32 NumStatesReloaded = 0;
 
     // Reload all shaders first
@@ -29,12 +29,14 @@
 #include <mutex>
 #include <atomic>
 #include <memory>
+#include <vector>
 
 #include "DebugUtilities.hpp"
 #include "ObjectBase.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "DynamicBuffer.hpp"
 #include "VariableSizeAllocationsManager.hpp"
+#include "DefragmentationPlanner.hpp"
 #include "Align.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
 #include "FixedBlockMemoryAllocator.hpp"
@@ -83,7 +85,7 @@ public:
 
     virtual Uint32 GetStartVertex() const override final
     {
-        return m_StartVertex;
+        return m_StartVertex.load();
     }
 
     virtual Uint32 GetVertexCount() const override final
@@ -108,11 +110,23 @@ public:
     }
 
 private:
+    friend class VertexPoolImpl;
+
     RefCntAutoPtr<VertexPoolImpl> m_pParentPool;
 
+    // The members below are protected by the parent pool mutex.
     VariableSizeAllocationsManager::Allocation m_Region;
 
-    const Uint32 m_StartVertex;
+    // The list of all allocations of the parent pool.
+    VertexPoolAllocationImpl* m_pPrev = nullptr;
+    VertexPoolAllocationImpl* m_pNext = nullptr;
+
+    // Index of the pending defragmentation move.
+    Uint32 m_PendingMove = ~0u;
+
+    // The start vertex is changed by the defragmentation.
+    std::atomic<Uint32> m_StartVertex;
+
     const Uint32 m_VertexCount;
 
     RefCntAutoPtr<IObject> m_pUserData;
@@ -207,6 +221,7 @@ public:
     ~VertexPoolImpl()
     {
         VERIFY_EXPR(m_AllocationCount.load() == 0);
+        VERIFY_EXPR(m_pAllocations == nullptr);
     }
 
     virtual IBuffer* Update(Uint32 Index, IRenderDevice* pDevice, IDeviceContext* pContext) override final
@@ -268,81 +283,229 @@ public:
 
         DEV_CHECK_ERR(*ppAllocation == nullptr, "Overwriting reference to existing object may cause memory leaks");
 
-        VariableSizeAllocationsManager::Allocation Region;
         {
             std::lock_guard<std::mutex> Lock{m_MgrMtx};
 
+            SyncMgrSize();
+            VariableSizeAllocationsManager::Allocation Region = AllocateRegion(NumVertices);
+            if (Region.IsValid())
+                CreateAllocation(NumVertices, std::move(Region), ppAllocation);
+            UpdateUsageStats();
+        }
+
+        if (*ppAllocation != nullptr)
+            m_AllocationCount.fetch_add(1);
+    }
+
+    virtual Uint32 AllocateBatch(Uint32                  NumAllocations,
+                                 const Uint32*           pNumVertices,
+                                 IVertexPoolAllocation** ppAllocations) override final
+    {
+        if (!VerifyBatchArgs(NumAllocations, pNumVertices, ppAllocations))
+            return 0;
+
+        Uint32 NumAllocated = 0;
+        {
+            std::lock_guard<std::mutex> Lock{m_MgrMtx};
+
+            SyncMgrSize();
+            for (Uint32 i = 0; i < NumAllocations; ++i)
             {
-                Uint64 ActualCapacity = ~Uint64{0};
-                for (Uint32 i = 0; i < m_Desc.NumElements; ++i)
+                DEV_CHECK_ERR(ppAllocations[i] == nullptr, "Overwriting reference to existing object may cause memory leaks");
+                VariableSizeAllocationsManager::Allocation Region = AllocateRegion(pNumVertices[i]);
+                if (Region.IsValid())
                 {
-                    const auto BufferCapacity = m_BufferSizes[i].load() / m_Elements[i].Size;
-                    ActualCapacity            = std::min(ActualCapacity, BufferCapacity);
+                    CreateAllocation(pNumVertices[i], std::move(Region), &ppAllocations[i]);
+                    ++NumAllocated;
                 }
+            }
+            UpdateUsageStats();
+        }
+        m_AllocationCount.fetch_add(static_cast<Int32>(NumAllocated));
+
+        return NumAllocated;
+    }
+
+    virtual Uint32 AllocateBatch(Uint32                      NumAllocations,
+                                 const Uint32*               pNumVertices,
+                                 VertexPoolAllocationHandle* pHandles) override final
+    {
+        if (!VerifyBatchArgs(NumAllocations, pNumVertices, pHandles))
+            return 0;
+
+        Uint32 NumAllocated = 0;
+        {
+            std::lock_guard<std::mutex> Lock{m_MgrMtx};
 
-                // After the resize, the actual buffer size may be larger due to alignment
-                // requirements (for sparse buffers, the size is aligned by the memory page size).
-                const auto MgrSize = m_Mgr.GetMaxSize();
-                if (ActualCapacity > MgrSize)
+            SyncMgrSize();
+            for (Uint32 i = 0; i < NumAllocations; ++i)
+            {
+                const VariableSizeAllocationsManager::Allocation Region = AllocateRegion(pNumVertices[i]);
+
+                VertexPoolAllocationHandle& Handle = pHandles[i];
+                Handle                             = {};
+                if (Region.IsValid())
                 {
-                    m_Mgr.Extend(StaticCast<size_t>(ActualCapacity - MgrSize));
-                    VERIFY_EXPR(m_Mgr.GetMaxSize() == ActualCapacity);
-                    m_MgrSize.store(m_Mgr.GetMaxSize());
-                    m_Desc.VertexCount = static_cast<Uint32>(ActualCapacity);
+                    // Vertex ranges are not aligned, so the region size is always equal to the vertex count.
+                    VERIFY_EXPR(Region.Size == pNumVertices[i]);
+                    Handle.StartVertex = static_cast<Uint32>(Region.UnalignedOffset);
+                    Handle.VertexCount = pNumVertices[i];
+                    ++NumAllocated;
                 }
             }
+            UpdateUsageStats();
+        }
+        m_AllocationCount.fetch_add(static_cast<Int32>(NumAllocated));
 
-            Region = m_Mgr.Allocate(NumVertices, 1);
+        return NumAllocated;
+    }
 
-            while (!Region.IsValid() && (m_MaxVertexCount == 0 || m_Mgr.GetMaxSize() < m_MaxVertexCount))
+    virtual void FreeBatch(Uint32                      NumHandles,
+                           VertexPoolAllocationHandle* pHandles) override final
+    {
+        if (NumHandles == 0)
+            return;
+
+        if (pHandles == nullptr)
+        {
+            UNEXPECTED("pHandles must not be null");
+            return;
+        }
+
+        Int32 NumFreed = 0;
+        {
+            std::lock_guard<std::mutex> Lock{m_MgrMtx};
+            for (Uint32 i = 0; i < NumHandles; ++i)
             {
-                size_t ExtraSize = m_ExtraVertexCount != 0 ?
-                    std::max(m_ExtraVertexCount, NumVertices) :
-                    m_Mgr.GetMaxSize();
+                VertexPoolAllocationHandle& Handle = pHandles[i];
+                if (Handle.IsValid())
+                {
+                    m_Mgr.Free(Handle.StartVertex, Handle.VertexCount);
+                    ++NumFreed;
+                }
+                Handle = {};
+            }
+            UpdateUsageStats();
+        }
+        m_AllocationCount.fetch_add(-NumFreed);
+    }
+
+    void Free(VertexPoolAllocationImpl& Allocation)
+    {
+        std::lock_guard<std::mutex> Lock{m_MgrMtx};
+        if (Allocation.m_PendingMove != ~0u)
+        {
+            // Release the destination range of the move that will never be committed
+            PendingMove& Move = m_PendingMoves[Allocation.m_PendingMove];
+            VERIFY_EXPR(Move.pAllocation == &Allocation);
+            DefragmentationPlanner::CancelMove(m_Mgr, Move.Move);
+            Move.pAllocation = nullptr;
+        }
+        m_Mgr.Free(std::move(Allocation.m_Region));
 
-                if (m_MaxVertexCount != 0)
-                    ExtraSize = std::min(ExtraSize, size_t{m_MaxVertexCount} - m_Mgr.GetMaxSize());
+        // Remove the allocation from the list
+        if (Allocation.m_pPrev != nullptr)
+            Allocation.m_pPrev->m_pNext = Allocation.m_pNext;
+        else
+            m_pAllocations = Allocation.m_pNext;
+        if (Allocation.m_pNext != nullptr)
+            Allocation.m_pNext->m_pPrev = Allocation.m_pPrev;
 
-                m_Mgr.Extend(ExtraSize);
-                m_MgrSize.store(m_Mgr.GetMaxSize());
-                m_Desc.VertexCount = static_cast<Uint32>(m_Mgr.GetMaxSize());
+        m_AllocationCount.fetch_add(-1);
+        UpdateUsageStats();
+    }
 
-                Region = m_Mgr.Allocate(NumVertices, 1);
-            }
+    virtual void PlanDefragmentation(const VertexPoolDefragmentationAttribs& Attribs,
+                                     VertexPoolDefragmentationPlan&          Plan) override final
+    {
+        Plan = {};
 
-            UpdateUsageStats();
+        std::lock_guard<std::mutex> Lock{m_MgrMtx};
+
+        CancelPendingMoves();
+
+        std::vector<VertexPoolAllocationImpl*>              Allocations;
+        std::vector<DefragmentationPlanner::AllocationDesc> AllocDescs;
+        for (VertexPoolAllocationImpl* pAlloc = m_pAllocations; pAlloc != nullptr; pAlloc = pAlloc->m_pNext)
+        {
+            Allocations.push_back(pAlloc);
+            AllocDescs.push_back({pAlloc->m_Region, 1});
         }
 
-        if (Region.IsValid())
+        DefragmentationPlanner::Limits Limits;
+        Limits.MaxBytesToMove = Attribs.MaxVerticesToMove;
+        Limits.MaxMoves       = Attribs.MaxMoves;
+
+        DefragmentationPlanner::Plan DefragPlan = DefragmentationPlanner::ComputePlan(m_Mgr, AllocDescs.data(), static_cast<Uint32>(AllocDescs.size()), Limits);
+
+        m_PendingMoves.reserve(DefragPlan.Moves.size());
+        m_CopyList.reserve(DefragPlan.Moves.size());
+        for (const DefragmentationPlanner::Move& Move : DefragPlan.Moves)
         {
-            // clang-format off
-            VertexPoolAllocationImpl* pSuballocation{
-                NEW_RC_OBJ(m_AllocationObjAllocator, "VertexPoolAllocationImpl instance", VertexPoolAllocationImpl)
-                (
-                    this,
-                    static_cast<Uint32>(Region.UnalignedOffset),
-                    NumVertices,
-                    std::move(Region)
-                )
-            };
-            // clang-format on
-
-            pSuballocation->QueryInterface(IID_VertexPoolAllocation, reinterpret_cast<IObject**>(ppAllocation));
-            m_AllocationCount.fetch_add(1);
+            VertexPoolAllocationImpl* pAlloc = Allocations[Move.AllocationIndex];
+            VERIFY_EXPR(pAlloc->m_StartVertex.load() == Move.SrcOffset && pAlloc->m_VertexCount == Move.Size);
+            pAlloc->m_PendingMove = static_cast<Uint32>(m_PendingMoves.size());
+            m_PendingMoves.push_back({pAlloc, Move});
+
+            VertexPoolDefragmentationMove CopyInfo;
+            CopyInfo.SrcVertex   = static_cast<Uint32>(Move.SrcOffset);
+            CopyInfo.DstVertex   = static_cast<Uint32>(Move.DstOffset);
+            CopyInfo.VertexCount = pAlloc->m_VertexCount;
+            m_CopyList.push_back(CopyInfo);
         }
+        UpdateUsageStats();
+
+        Plan.pMoves                   = m_CopyList.data();
+        Plan.NumMoves                 = static_cast<Uint32>(m_CopyList.size());
+        Plan.VerticesToMove           = DefragPlan.BytesToMove;
+        Plan.FragmentationBefore      = static_cast<Float32>(DefragPlan.FragmentationBefore);
+        Plan.FragmentationAfter       = static_cast<Float32>(DefragPlan.FragmentationAfter);
+        Plan.MaxFreeVertexCountBefore = DefragPlan.MaxFreeBlockSizeBefore;
+        Plan.MaxFreeVertexCountAfter  = DefragPlan.MaxFreeBlockSizeAfter;
     }
 
-    void Free(VariableSizeAllocationsManager::Allocation&& Region)
+    virtual void CommitDefragmentation(Uint32 FirstMove, Uint32 NumMoves) override final
     {
         std::lock_guard<std::mutex> Lock{m_MgrMtx};
-        m_Mgr.Free(std::move(Region));
-        m_AllocationCount.fetch_add(-1);
+
+        if (FirstMove + NumMoves > m_PendingMoves.size())
+        {
+            UNEXPECTED("Moves [", FirstMove, ", ", FirstMove + NumMoves, ") are out of range: the plan contains only ", m_PendingMoves.size(), " moves.");
+            return;
+        }
+
+        bool Moved = false;
+        for (Uint32 i = FirstMove; i < FirstMove + NumMoves; ++i)
+        {
+            PendingMove& Move = m_PendingMoves[i];
+            if (Move.pAllocation == nullptr)
+                continue; // The move has been committed or the allocation has been released
+
+            VertexPoolAllocationImpl& Alloc = *Move.pAllocation;
+            VERIFY_EXPR(Alloc.m_PendingMove == i && Alloc.m_Region == Move.Move.SrcRegion);
+            Alloc.m_Region      = Move.Move.DstRegion;
+            Alloc.m_StartVertex = static_cast<Uint32>(Move.Move.DstOffset);
+            Alloc.m_PendingMove = ~0u;
+            DefragmentationPlanner::CommitMove(m_Mgr, Move.Move);
+            Move.pAllocation = nullptr;
+            Moved            = true;
+        }
+        UpdateUsageStats();
+
+        if (Moved)
+            m_DefragVersion.fetch_add(1);
+    }
+
+    virtual void CancelDefragmentation() override final
+    {
+        std::lock_guard<std::mutex> Lock{m_MgrMtx};
+        CancelPendingMoves();
         UpdateUsageStats();
     }
 
     virtual Uint32 GetVersion() const override final
     {
-        Uint32 Version = 0;
+        Uint32 Version = m_DefragVersion.load();
         for (const auto& Buffer : m_Buffers)
             Version += Buffer->GetVersion();
         return Version;
@@ -369,6 +532,120 @@ public:
     }
 
 private:
+    template <typename OutputType>
+    static bool VerifyBatchArgs(Uint32 NumAllocations, const Uint32* pNumVertices, OutputType* pOutputs)
+    {
+        if (NumAllocations == 0)
+            return false;
+
+        if (pNumVertices == nullptr || pOutputs == nullptr)
+        {
+            UNEXPECTED("Vertex count and output arrays must not be null");
+            return false;
+        }
+
+        for (Uint32 i = 0; i < NumAllocations; ++i)
+        {
+            if (pNumVertices[i] == 0)
+            {
+                UNEXPECTED("Vertex count of allocation ", i, " must not be zero");
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Extends the allocations manager to match the actual capacity of the buffers.
+    // m_MgrMtx must be locked.
+    void SyncMgrSize()
+    {
+        Uint64 ActualCapacity = ~Uint64{0};
+        for (Uint32 i = 0; i < m_Desc.NumElements; ++i)
+        {
+            const auto BufferCapacity = m_BufferSizes[i].load() / m_Elements[i].Size;
+            ActualCapacity            = std::min(ActualCapacity, BufferCapacity);
+        }
+
+        // After the resize, the actual buffer size may be larger due to alignment
+        // requirements (for sparse buffers, the size is aligned by the memory page size).
+        const auto MgrSize = m_Mgr.GetMaxSize();
+        if (ActualCapacity > MgrSize)
+        {
+            m_Mgr.Extend(StaticCast<size_t>(ActualCapacity - MgrSize));
+            VERIFY_EXPR(m_Mgr.GetMaxSize() == ActualCapacity);
+            m_MgrSize.store(m_Mgr.GetMaxSize());
+            m_Desc.VertexCount = static_cast<Uint32>(ActualCapacity);
+        }
+    }
+
+    // Allocates the vertex range, expanding the pool if necessary.
+    // m_MgrMtx must be locked.
+    VariableSizeAllocationsManager::Allocation AllocateRegion(Uint32 NumVertices)
+    {
+        VariableSizeAllocationsManager::Allocation Region = m_Mgr.Allocate(NumVertices, 1);
+
+        while (!Region.IsValid() && (m_MaxVertexCount == 0 || m_Mgr.GetMaxSize() < m_MaxVertexCount))
+        {
+            size_t ExtraSize = m_ExtraVertexCount != 0 ?
+                std::max(m_ExtraVertexCount, NumVertices) :
+                m_Mgr.GetMaxSize();
+
+            if (m_MaxVertexCount != 0)
+                ExtraSize = std::min(ExtraSize, size_t{m_MaxVertexCount} - m_Mgr.GetMaxSize());
+
+            m_Mgr.Extend(ExtraSize);
+            m_MgrSize.store(m_Mgr.GetMaxSize());
+            m_Desc.VertexCount = static_cast<Uint32>(m_Mgr.GetMaxSize());
+
+            Region = m_Mgr.Allocate(NumVertices, 1);
+        }
+
+        return Region;
+    }
+
+    // Releases the destination ranges of the moves that have not been committed.
+    // m_MgrMtx must be locked.
+    void CancelPendingMoves()
+    {
+        for (PendingMove& Move : m_PendingMoves)
+        {
+            if (Move.pAllocation != nullptr)
+            {
+                DefragmentationPlanner::CancelMove(m_Mgr, Move.Move);
+                Move.pAllocation->m_PendingMove = ~0u;
+            }
+        }
+        m_PendingMoves.clear();
+        m_CopyList.clear();
+    }
+
+    // Creates the allocation object and adds it to the list.
+    // m_MgrMtx must be locked.
+    void CreateAllocation(Uint32                                       NumVertices,
+                          VariableSizeAllocationsManager::Allocation&& Region,
+                          IVertexPoolAllocation**                      ppAllocation)
+    {
+        // clang-format off
+        VertexPoolAllocationImpl* pSuballocation{
+            NEW_RC_OBJ(m_AllocationObjAllocator, "VertexPoolAllocationImpl instance", VertexPoolAllocationImpl)
+            (
+                this,
+                static_cast<Uint32>(Region.UnalignedOffset),
+                NumVertices,
+                std::move(Region)
+            )
+        };
+        // clang-format on
+
+        pSuballocation->m_pNext = m_pAllocations;
+        if (m_pAllocations != nullptr)
+            m_pAllocations->m_pPrev = pSuballocation;
+        m_pAllocations = pSuballocation;
+
+        pSuballocation->QueryInterface(IID_VertexPoolAllocation, reinterpret_cast<IObject**>(ppAllocation));
+    }
+
     void UpdateUsageStats()
     {
         m_AllocatedVertexCount.store(m_Mgr.GetUsedSize());
@@ -406,12 +683,27 @@ private:
     std::atomic<Uint64> m_TotalVertexCount{0};
 
     FixedBlockMemoryAllocator m_AllocationObjAllocator;
+
+    // The list of all allocation objects. Protected by m_MgrMtx.
+    VertexPoolAllocationImpl* m_pAllocations = nullptr;
+
+    struct PendingMove
+    {
+        // Null if the move has been committed or the allocation has been released.
+        VertexPoolAllocationImpl*    pAllocation = nullptr;
+        DefragmentationPlanner::Move Move;
+    };
+    // The moves of the current defragmentation plan. Protected by m_MgrMtx.
+    std::vector<PendingMove>                   m_PendingMoves;
+    std::vector<VertexPoolDefragmentationMove> m_CopyList;
+
+    std::atomic<Uint32> m_DefragVersion{0};
 };
 
 
 VertexPoolAllocationImpl::~VertexPoolAllocationImpl()
 {
-    m_pParentPool->Free(std::move(m_Region));
+    m_pParentPool->Free(*this);
 }
 
 IVertexPool* VertexPoolAllocationImpl::GetPool()
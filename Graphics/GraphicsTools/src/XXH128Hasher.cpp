@@ -26,15 +26,283 @@
 
 #include "XXH128Hasher.hpp"
 
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <memory>
+#include <functional>
+
 #include "xxhash.h"
 
 #include "DebugUtilities.hpp"
 #include "Cast.hpp"
 #include "ShaderToolsCommon.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "DataBlobImpl.hpp"
+#include "HashUtils.hpp"
+#include "DefaultShaderSourceStreamFactory.h"
 
 namespace Diligent
 {
 
+namespace
+{
+
+// Caches content hashes and include lists of shader source files loaded through
+// stream factories, so that hashing a shader does not require reading and hashing
+// all of its include files every time. The cache is disabled by default, see
+// SetShaderSourceHashCacheMaxSize().
+class ShaderSourceHashCache
+{
+public:
+    struct FileInfo
+    {
+        XXH128Hash               Hash;
+        std::vector<std::string> Includes;
+    };
+    using FileInfoPtr = std::shared_ptr<const FileInfo>;
+
+    static ShaderSourceHashCache& Get()
+    {
+        static ShaderSourceHashCache Cache;
+        return Cache;
+    }
+
+    static FileInfoPtr CreateFileInfo(const char* Source, size_t SourceLength)
+    {
+        auto pInfo = std::make_shared<FileInfo>();
+
+        const XXH128_hash_t Hash = XXH3_128bits(Source, SourceLength);
+        pInfo->Hash              = {Hash.low64, Hash.high64};
+
+        if (!FindShaderIncludes(Source, SourceLength, [&](const std::string& Include) { pInfo->Includes.emplace_back(Include); }))
+            return {};
+
+        return pInfo;
+    }
+
+    // Returns null if the file can't be read or parsed.
+    FileInfoPtr GetFileInfo(IShaderSourceInputStreamFactory* pFactory, const std::string& FilePath)
+    {
+        // The generation must be read before the file, so that the file contents
+        // invalidated while the file is being read are not cached.
+        const Uint64 Generation = GetShaderSourceFileCacheGeneration();
+
+        const bool UseCache = m_MaxSize.load() != 0;
+        if (UseCache)
+        {
+            std::lock_guard<std::mutex> Lock{m_Mtx};
+            if (Generation > m_Generation)
+            {
+                // The shader source file cache has been invalidated or a file has been
+                // reloaded since it was modified.
+                ClearEntries();
+                m_Generation = Generation;
+            }
+
+            auto it = m_Entries.find(Key{pFactory, FilePath});
+            if (it != m_Entries.end())
+            {
+                if (it->second.wpFactory.IsValid())
+                {
+                    m_LRU.splice(m_LRU.begin(), m_LRU, it->second.LRUPos);
+                    return it->second.pInfo;
+                }
+
+                // The factory has been destroyed and a new one was created at the same address
+                RemoveEntry(it);
+            }
+        }
+
+        // Read the file without holding the lock
+        RefCntAutoPtr<IFileStream> pSourceStream;
+        pFactory->CreateInputStream(FilePath.c_str(), &pSourceStream);
+        if (!pSourceStream)
+            return {};
+
+        RefCntAutoPtr<DataBlobImpl> pFileData = DataBlobImpl::Create();
+        pSourceStream->ReadBlob(pFileData);
+
+        FileInfoPtr pInfo = CreateFileInfo(pFileData->GetConstDataPtr<char>(), pFileData->GetSize());
+        if (!pInfo || !UseCache)
+            return pInfo;
+
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        if (Generation != m_Generation)
+            return pInfo;
+
+        // If another thread has added the file in the meantime, keep the existing entry
+        auto it = m_Entries.find(Key{pFactory, FilePath});
+        if (it != m_Entries.end() && it->second.wpFactory.IsValid())
+            return it->second.pInfo;
+
+        if (it != m_Entries.end())
+            RemoveEntry(it);
+
+        m_LRU.push_front(Key{pFactory, FilePath});
+        m_Entries.emplace(m_LRU.front(), Entry{RefCntWeakPtr<IShaderSourceInputStreamFactory>{pFactory}, pInfo, m_LRU.begin()});
+        Evict();
+
+        return pInfo;
+    }
+
+    void Invalidate(IShaderSourceInputStreamFactory* pFactory, const char* FilePath)
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        if (pFactory == nullptr)
+        {
+            ClearEntries();
+            return;
+        }
+
+        if (FilePath != nullptr)
+        {
+            auto it = m_Entries.find(Key{pFactory, FilePath});
+            if (it != m_Entries.end())
+                RemoveEntry(it);
+            return;
+        }
+
+        for (auto it = m_Entries.begin(); it != m_Entries.end();)
+        {
+            if (it->first.first == pFactory)
+            {
+                m_LRU.erase(it->second.LRUPos);
+                it = m_Entries.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    void SetMaxSize(size_t MaxSize)
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        m_MaxSize.store(MaxSize);
+        Evict();
+    }
+
+private:
+    using Key = std::pair<IShaderSourceInputStreamFactory*, std::string>;
+
+    struct KeyHasher
+    {
+        size_t operator()(const Key& k) const
+        {
+            return ComputeHash(k.first, k.second);
+        }
+    };
+
+    struct Entry
+    {
+        RefCntWeakPtr<IShaderSourceInputStreamFactory> wpFactory;
+
+        FileInfoPtr pInfo;
+
+        // Position in the LRU list
+        std::list<Key>::iterator LRUPos;
+    };
+    using EntriesMapType = std::unordered_map<Key, Entry, KeyHasher>;
+
+    // Must be called under the mutex
+    void RemoveEntry(EntriesMapType::iterator it)
+    {
+        m_LRU.erase(it->second.LRUPos);
+        m_Entries.erase(it);
+    }
+
+    // Must be called under the mutex
+    void ClearEntries()
+    {
+        m_Entries.clear();
+        m_LRU.clear();
+    }
+
+    // Removes the least recently used entries that exceed the maximum size.
+    // Must be called under the mutex
+    void Evict()
+    {
+        while (m_Entries.size() > m_MaxSize.load())
+        {
+            auto it = m_Entries.find(m_LRU.back());
+            VERIFY_EXPR(it != m_Entries.end());
+            RemoveEntry(it);
+        }
+    }
+
+private:
+    std::mutex m_Mtx;
+
+    EntriesMapType m_Entries;
+
+    // Keys of the entries in the most-recently-used first order
+    std::list<Key> m_LRU;
+
+    // The generation of the shader source file cache the entries were read with,
+    // see GetShaderSourceFileCacheGeneration().
+    Uint64 m_Generation = 0;
+
+    // Maximum number of cached files. Zero disables the cache.
+    std::atomic<size_t> m_MaxSize{0};
+};
+
+// Collects content hashes of the shader source and all its includes in the same
+// depth-first order as ProcessShaderIncludes. Returns false if any file can't be read or parsed.
+bool GetShaderSourceHashes(const ShaderCreateInfo& ShaderCI, std::vector<XXH128Hash>& Hashes)
+{
+    ShaderSourceHashCache& Cache = ShaderSourceHashCache::Get();
+
+    ShaderSourceHashCache::FileInfoPtr pSourceInfo;
+    if (ShaderCI.Source != nullptr)
+    {
+        pSourceInfo = ShaderSourceHashCache::CreateFileInfo(ShaderCI.Source, ShaderCI.SourceLength != 0 ? ShaderCI.SourceLength : strlen(ShaderCI.Source));
+    }
+    else if (ShaderCI.pShaderSourceStreamFactory != nullptr && ShaderCI.FilePath != nullptr)
+    {
+        pSourceInfo = Cache.GetFileInfo(ShaderCI.pShaderSourceStreamFactory, ShaderCI.FilePath);
+    }
+    if (!pSourceInfo)
+        return false;
+
+    std::unordered_set<std::string> Visited;
+
+    std::function<bool(const ShaderSourceHashCache::FileInfo&)> ProcessFile = [&](const ShaderSourceHashCache::FileInfo& Info) {
+        for (const std::string& Include : Info.Includes)
+        {
+            if (!Visited.insert(Include).second)
+                continue;
+
+            if (ShaderCI.pShaderSourceStreamFactory == nullptr)
+                return false;
+
+            ShaderSourceHashCache::FileInfoPtr pIncludeInfo = Cache.GetFileInfo(ShaderCI.pShaderSourceStreamFactory, Include);
+            if (!pIncludeInfo || !ProcessFile(*pIncludeInfo))
+                return false;
+        }
+        Hashes.push_back(Info.Hash);
+        return true;
+    };
+
+    return ProcessFile(*pSourceInfo);
+}
+
+} // namespace
+
+void InvalidateShaderSourceHashCache(IShaderSourceInputStreamFactory* pStreamFactory, const char* FilePath)
+{
+    ShaderSourceHashCache::Get().Invalidate(pStreamFactory, FilePath);
+}
+
+void SetShaderSourceHashCacheMaxSize(size_t MaxNumFiles)
+{
+    ShaderSourceHashCache::Get().SetMaxSize(MaxNumFiles);
+}
+
 XXH128State::XXH128State() :
     m_State{XXH3_createState()}
 {
@@ -79,9 +347,20 @@ void XXH128State::Update(const ShaderCreateInfo& ShaderCI) noexcept
     if (ShaderCI.Source != nullptr || ShaderCI.FilePath != nullptr)
     {
         DEV_CHECK_ERR(ShaderCI.ByteCode == nullptr, "ShaderCI.ByteCode must be null when either Source or FilePath is specified");
-        ProcessShaderIncludes(ShaderCI, [this](const ShaderIncludePreprocessInfo& ProcessInfo) {
-            UpdateStr(ProcessInfo.Source, ProcessInfo.SourceLength);
-        });
+
+        std::vector<XXH128Hash> SourceHashes;
+        if (GetShaderSourceHashes(ShaderCI, SourceHashes))
+        {
+            for (const XXH128Hash& Hash : SourceHashes)
+                Update(Hash.LowPart, Hash.HighPart);
+        }
+        else
+        {
+            // Fall back to hashing the sources directly. This will also report the errors.
+            ProcessShaderIncludes(ShaderCI, [this](const ShaderIncludePreprocessInfo& ProcessInfo) {
+                UpdateStr(ProcessInfo.Source, ProcessInfo.SourceLength);
+            });
+        }
     }
     else if (ShaderCI.ByteCode != nullptr && ShaderCI.ByteCodeSize != 0)
     {
@@ -165,6 +165,18 @@ public:
                       size_t                           NumSymbols,
                       IHLSL2GLSLConversionStream**     ppStream) const;
 
+    /// Creates a copy of the conversion stream
+
+    /// \param [in]  pSrcStream - Conversion stream to copy. The stream must have been
+    ///                           created by CreateStream().
+    /// \param [out] ppStream   - Memory address where pointer to the created stream will be written
+    ///
+    /// \remarks The copy reuses the tokenized source of the original stream, so that the
+    ///          shader source and includes are neither loaded nor tokenized again.
+    ///          The source stream must not be used for conversion while it is being copied.
+    void CopyStream(IHLSL2GLSLConversionStream*  pSrcStream,
+                    IHLSL2GLSLConversionStream** ppStream) const;
+
 private:
     HLSL2GLSLConverterImpl();
 
@@ -250,6 +262,9 @@ private:
                          size_t                           NumSymbols,
                          bool                             bPreserveTokens);
 
+        /// Creates a copy of the stream that preserves tokens.
+        ConversionStream(IReferenceCounters* pRefCounters, const ConversionStream& Src);
+
         String Convert(const Char* EntryPoint,
                        SHADER_TYPE ShaderType,
                        bool        IncludeDefintions,
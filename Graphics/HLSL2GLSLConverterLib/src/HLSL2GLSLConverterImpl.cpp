@@ -1659,9 +1659,11 @@ void HLSL2GLSLConverterImpl::ConversionStream::ProcessTextureDeclaration(TokenLi
 // Finds an HLSL object with the given name in object stack
 const HLSL2GLSLConverterImpl::HLSLObjectInfo* HLSL2GLSLConverterImpl::ConversionStream::FindHLSLObject(const String& Name)
 {
+    // Compute the hash once for all scopes
+    const HashMapStringKey Key{Name.c_str()};
     for (auto ScopeIt = m_Objects.rbegin(); ScopeIt != m_Objects.rend(); ++ScopeIt)
     {
-        auto It = ScopeIt->m.find(Name.c_str());
+        auto It = ScopeIt->m.find(Key);
         if (It != ScopeIt->m.end())
             return &It->second;
     }
@@ -1772,7 +1774,7 @@ bool HLSL2GLSLConverterImpl::ConversionStream::ProcessObjectMethod(TokenListType
     // TestText.Sample( TestText_sampler, float2(0.0, 1.0)  );
     //                                                       ^
     //                                               ArgsListEndToken
-    auto StubIt = m_Converter.m_GLSLStubs.find(FunctionStubHashKey(ObjectType, MethodToken->Literal.c_str(), NumArguments));
+    auto StubIt = m_Converter.m_GLSLStubs.find(FunctionStubHashKey(ObjectType.c_str(), MethodToken->Literal.c_str(), NumArguments));
     if (StubIt == m_Converter.m_GLSLStubs.end())
     {
         LOG_ERROR_MESSAGE("Unable to find function stub for ", IdentifierToken->Literal, ".", MethodToken->Literal, "(", NumArguments, " args). GLSL object type: ", ObjectType);
@@ -4399,7 +4401,12 @@ void HLSL2GLSLConverterImpl::ConversionStream::RemoveSpecialShaderAttributes()
 
 String HLSL2GLSLConverterImpl::ConversionStream::BuildGLSLSource()
 {
+    size_t OutputLength = 0;
+    for (const auto& Token : m_Tokens)
+        OutputLength += Token.Delimiter.length() + Token.Literal.length();
+
     String Output;
+    Output.reserve(OutputLength);
     for (const auto& Token : m_Tokens)
     {
         if ((Token.Type == TokenType::kw_linear ||
@@ -4460,6 +4467,19 @@ HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters*
     m_Tokens = m_Converter.m_HLSLTokenizer.Tokenize(Source);
 }
 
+HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters* pRefCounters, const ConversionStream& Src) :
+    // clang-format off
+    TBase            {pRefCounters       },
+    m_Tokens         {Src.m_Tokens       },
+    m_bPreserveTokens{true               },
+    m_Converter      {Src.m_Converter    },
+    m_InputFileName  {Src.m_InputFileName}
+// clang-format on
+{
+    VERIFY(Src.m_Objects.empty() && Src.m_StructDefinitions.empty() && Src.m_PreprocessorDefinitions.empty(),
+           "The stream is being copied during the conversion");
+}
+
 
 String HLSL2GLSLConverterImpl::Convert(ConversionAttribs& Attribs) const
 {
@@ -4522,6 +4542,24 @@ void HLSL2GLSLConverterImpl::CreateStream(const Char*                      Input
     }
 }
 
+void HLSL2GLSLConverterImpl::CopyStream(IHLSL2GLSLConversionStream*  pSrcStream,
+                                        IHLSL2GLSLConversionStream** ppStream) const
+{
+    DEV_CHECK_ERR(pSrcStream != nullptr, "Source stream must not be null");
+    DEV_CHECK_ERR(ppStream != nullptr, "ppStream must not be null");
+
+    const ConversionStream* pSrc = ClassPtrCast<ConversionStream>(pSrcStream);
+    try
+    {
+        auto* pStream = NEW_RC_OBJ(GetRawAllocator(), "HLSL2GLSLConverterImpl::ConversionStream object instance", ConversionStream)(*pSrc);
+        pStream->QueryInterface(IID_HLSL2GLSLConversionStream, reinterpret_cast<IObject**>(ppStream));
+    }
+    catch (std::runtime_error&)
+    {
+        *ppStream = nullptr;
+    }
+}
+
 void HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryPoint,
                                                        SHADER_TYPE ShaderType,
                                                        bool        IncludeDefintions,
@@ -27,11 +27,11 @@
 #pragma once
 
 #include <unordered_map>
-#include <list>
 
 #include "ParsingTools.hpp"
 #include "HLSLKeywords.h"
 #include "HashUtils.hpp"
+#include "PagedList.hpp"
 
 namespace Diligent
 {
@@ -182,17 +182,24 @@ public:
 
     const HLSLTokenInfo* FindKeyword(const String& Keyword) const
     {
-        auto it = m_Keywords.find(HashMapStringKey{Keyword});
+        auto it = m_Keywords.find(Keyword.c_str());
         return it != m_Keywords.end() ? &it->second : nullptr;
     }
 
-    using TokenListType = std::list<HLSLTokenInfo>;
+    // Tokens are allocated from memory pages rather than individually,
+    // and the converter inserts and erases tokens in place.
+    using TokenListType = PagedList<HLSLTokenInfo>;
     TokenListType Tokenize(const String& Source) const;
 
 private:
+    HLSLTokenType GetTokenType(const std::string::const_iterator& Start, const std::string::const_iterator& End) const;
+
     // HLSL keyword -> token info hash map
     // Example: "Texture2D" -> TokenInfo{TokenType::Texture2D, "Texture2D"}
     std::unordered_map<HashMapStringKey, HLSLTokenInfo> m_Keywords;
+
+    // The length of the longest keyword
+    size_t m_MaxKeywordLength = 0;
 };
 
 } // namespace Parsing
@@ -137,6 +137,11 @@ struct ShaderIncludePreprocessInfo
 /// Includes are processed in a depth-first order such that original source file is processed last.
 bool ProcessShaderIncludes(const ShaderCreateInfo& ShaderCI, std::function<void(const ShaderIncludePreprocessInfo&)> IncludeHandler) noexcept;
 
+/// Finds all include directives in the shader source and calls the IncludeHandler function
+/// for every included file in the order of appearance. Included files are not processed.
+/// Returns false if the source could not be parsed.
+bool FindShaderIncludes(const char* Source, size_t SourceLength, const std::function<void(const std::string& FilePath)>& IncludeHandler) noexcept;
+
 ///  Unrolls all include files into a single file
 std::string UnrollShaderIncludes(const ShaderCreateInfo& ShaderCI) noexcept(false);
 
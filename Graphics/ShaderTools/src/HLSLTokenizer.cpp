@@ -26,6 +26,8 @@
 
 #include "HLSLTokenizer.hpp"
 
+#include <algorithm>
+
 namespace Diligent
 {
 
@@ -38,6 +40,30 @@ HLSLTokenizer::HLSLTokenizer()
 #define DEFINE_KEYWORD(keyword) m_Keywords.insert(std::make_pair(#keyword, HLSLTokenInfo(HLSLTokenType::kw_##keyword, #keyword)));
     ITERATE_HLSL_KEYWORDS(DEFINE_KEYWORD)
 #undef DEFINE_KEYWORD
+
+    for (const auto& Keyword : m_Keywords)
+        m_MaxKeywordLength = std::max(m_MaxKeywordLength, Keyword.second.Literal.length());
+}
+
+HLSLTokenType HLSLTokenizer::GetTokenType(const std::string::const_iterator& Start, const std::string::const_iterator& End) const
+{
+    // Copy the identifier to a stack buffer to look it up without allocating memory
+    char         Identifier[64];
+    const size_t Length = static_cast<size_t>(End - Start);
+    VERIFY(m_MaxKeywordLength < _countof(Identifier), "Identifier buffer is too small");
+    if (Length > m_MaxKeywordLength)
+        return HLSLTokenType::Identifier;
+
+    std::copy(Start, End, Identifier);
+    Identifier[Length] = '\0';
+
+    auto KeywordIt = m_Keywords.find(static_cast<const char*>(Identifier));
+    if (KeywordIt != m_Keywords.end())
+    {
+        VERIFY(KeywordIt->second.Literal == Identifier, "Inconsistent literal");
+        return KeywordIt->second.Type;
+    }
+    return HLSLTokenType::Identifier;
 }
 
 HLSLTokenizer::TokenListType HLSLTokenizer::Tokenize(const String& Source) const
@@ -57,13 +83,7 @@ HLSLTokenizer::TokenListType HLSLTokenizer::Tokenize(const String& Source) const
             },
             [&](const std::string::const_iterator& Start, const std::string::const_iterator& End) //
             {
-                auto KeywordIt = m_Keywords.find(HashMapStringKey{std::string{Start, End}});
-                if (KeywordIt != m_Keywords.end())
-                {
-                    VERIFY(std::string(Start, End) == KeywordIt->second.Literal, "Inconsistent literal");
-                    return KeywordIt->second.Type;
-                }
-                return HLSLTokenType::Identifier;
+                return GetTokenType(Start, End);
             });
     }
     catch (...)
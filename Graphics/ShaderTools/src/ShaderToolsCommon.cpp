@@ -471,6 +471,19 @@ bool ProcessShaderIncludes(const ShaderCreateInfo& ShaderCI, std::function<void(
     }
 }
 
+bool FindShaderIncludes(const char* Source, size_t SourceLength, const std::function<void(const std::string& FilePath)>& IncludeHandler) noexcept
+{
+    if (Source == nullptr)
+        return false;
+
+    return FindIncludes(
+        Source, SourceLength != 0 ? SourceLength : strlen(Source),
+        [&](const std::string& FilePath, size_t /*Start*/, size_t /*End*/) {
+            IncludeHandler(FilePath);
+        },
+        [](const std::string& /*Error*/) {});
+}
+
 static std::string UnrollShaderIncludesImpl(ShaderCreateInfo ShaderCI, std::unordered_set<std::string>& AllIncludes) noexcept(false)
 {
     const auto SourceData = ReadShaderSourceFile(ShaderCI);
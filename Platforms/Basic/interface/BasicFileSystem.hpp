@@ -78,6 +78,55 @@ protected:
 };
 
 
+/// Describes how the memory-mapped file data will be accessed.
+/// The value is passed to the OS as a hint and does not affect correctness.
+enum class EMappedFileAccessHint
+{
+    /// No special treatment.
+    Normal,
+
+    /// The data will be accessed sequentially. The OS may read ahead aggressively
+    /// and release the pages soon after they have been accessed.
+    Sequential,
+
+    /// The data will be accessed in random order. The OS should not read ahead.
+    Random,
+
+    /// The data will be needed soon. The OS may start reading it in the background.
+    WillNeed
+};
+
+/// A file mapped into the process address space.
+
+/// \remarks    The mapping is copy-on-write. Mapped pages are read from the file on first access and are shared with
+///             the OS page cache until they are modified, so mapping a file does not copy its data.
+///             Modifications are private to the mapping and are never written back to the file.
+///
+///             The file must not be truncated while it is mapped. To replace a mapped file,
+///             write the new content to a different file and rename it.
+class BasicMappedFile
+{
+public:
+    BasicMappedFile(const Char* Path);
+    virtual ~BasicMappedFile();
+
+    const String& GetPath() const { return m_Path; }
+
+    const void* GetData() const { return m_pData; }
+    void*       GetData() { return m_pData; }
+    size_t      GetSize() const { return m_Size; }
+
+    /// Changes the expected access pattern of the given range of the mapped data.
+    virtual void Advise(EMappedFileAccessHint Hint, size_t Offset = 0, size_t Size = ~size_t{0}) {}
+
+protected:
+    const String m_Path;
+
+    void*  m_pData = nullptr;
+    size_t m_Size  = 0;
+};
+
+
 enum FILE_DIALOG_FLAGS : Uint32
 {
     FILE_DIALOG_FLAG_NONE = 0x000,
@@ -151,8 +200,26 @@ public:
     static BasicFile* OpenFile(FileOpenAttribs& OpenAttribs);
     static void       ReleaseFile(BasicFile*);
 
+    /// Maps the file into the process address space.
+
+    /// \param [in] strFilePath - Path to the file.
+    /// \param [in] Hint        - Expected access pattern, see Diligent::EMappedFileAccessHint.
+    ///
+    /// \return     Pointer to the mapped file that must be released with ReleaseMappedFile(),
+    ///             or null if the file can't be mapped or memory-mapped files are not supported
+    ///             on this platform. Empty files can't be mapped.
+    static BasicMappedFile* MapFile(const Char* strFilePath, EMappedFileAccessHint Hint = EMappedFileAccessHint::Normal);
+    static void             ReleaseMappedFile(BasicMappedFile*);
+
     static bool FileExists(const Char* strFilePath);
 
+    /// Returns the time of the last modification of the file, or 0 if the file does not exist
+    /// or the modification time can't be queried on this platform.
+    ///
+    /// \remarks    The value is only meaningful for comparison with another value returned
+    ///             by this function for the same file.
+    static Uint64 GetFileModificationTime(const Char* strFilePath);
+
     static void SetWorkingDirectory(const Char* strWorkingDir) { m_strWorkingDirectory = strWorkingDir; }
 
     static const String& GetWorkingDirectory() { return m_strWorkingDirectory; }
@@ -55,6 +55,15 @@ BasicFile::~BasicFile()
 {
 }
 
+BasicMappedFile::BasicMappedFile(const Char* Path) :
+    m_Path{Path != nullptr ? Path : ""}
+{
+}
+
+BasicMappedFile::~BasicMappedFile()
+{
+}
+
 String BasicFile::GetOpenModeStr()
 {
     std::string OpenModeStr;
@@ -82,6 +91,21 @@ BasicFile* BasicFileSystem::OpenFile(FileOpenAttribs& OpenAttribs)
     return nullptr;
 }
 
+BasicMappedFile* BasicFileSystem::MapFile(const Char* strFilePath, EMappedFileAccessHint Hint)
+{
+    return nullptr;
+}
+
+void BasicFileSystem::ReleaseMappedFile(BasicMappedFile* pFile)
+{
+    delete pFile;
+}
+
+Uint64 BasicFileSystem::GetFileModificationTime(const Char* strFilePath)
+{
+    return 0;
+}
+
 void BasicFileSystem::ReleaseFile(BasicFile* pFile)
 {
     if (pFile)
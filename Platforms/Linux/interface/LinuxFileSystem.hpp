@@ -39,14 +39,27 @@ namespace Diligent
 
 using LinuxFile = StandardFile;
 
+class LinuxMappedFile final : public BasicMappedFile
+{
+public:
+    LinuxMappedFile(const Char* Path, void* pData, size_t Size);
+    ~LinuxMappedFile() override;
+
+    void Advise(EMappedFileAccessHint Hint, size_t Offset = 0, size_t Size = ~size_t{0}) override;
+};
+
 struct LinuxFileSystem : public BasicFileSystem
 {
 public:
     static LinuxFile* OpenFile(const FileOpenAttribs& OpenAttribs);
 
+    static LinuxMappedFile* MapFile(const Char* strFilePath, EMappedFileAccessHint Hint = EMappedFileAccessHint::Normal);
+
     static bool FileExists(const Char* strFilePath);
     static bool PathExists(const Char* strPath);
 
+    static Uint64 GetFileModificationTime(const Char* strFilePath);
+
     static bool CreateDirectory(const Char* strPath);
     static bool DeleteDirectory(const Char* strPath);
     static bool IsDirectory(const Char* strPath);
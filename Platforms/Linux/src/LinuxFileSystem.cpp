@@ -29,8 +29,11 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <cstdio>
+#include <cstring>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 #include <ftw.h>
 #include <glob.h>
 #include <mutex>
@@ -60,6 +63,94 @@ LinuxFile* LinuxFileSystem::OpenFile(const FileOpenAttribs& OpenAttribs)
 }
 #endif
 
+namespace
+{
+
+int MappedFileAccessHintToMadvise(EMappedFileAccessHint Hint)
+{
+    switch (Hint)
+    {
+        case EMappedFileAccessHint::Normal: return MADV_NORMAL;
+        case EMappedFileAccessHint::Sequential: return MADV_SEQUENTIAL;
+        case EMappedFileAccessHint::Random: return MADV_RANDOM;
+        case EMappedFileAccessHint::WillNeed: return MADV_WILLNEED;
+        default:
+            UNEXPECTED("Unexpected access hint");
+            return MADV_NORMAL;
+    }
+}
+
+} // namespace
+
+LinuxMappedFile::LinuxMappedFile(const Char* Path, void* pData, size_t Size) :
+    BasicMappedFile{Path}
+{
+    m_pData = pData;
+    m_Size  = Size;
+}
+
+LinuxMappedFile::~LinuxMappedFile()
+{
+    if (m_pData != nullptr)
+    {
+        if (munmap(m_pData, m_Size) != 0)
+            LOG_ERROR_MESSAGE("Failed to unmap file ", m_Path, ": ", strerror(errno));
+    }
+}
+
+void LinuxMappedFile::Advise(EMappedFileAccessHint Hint, size_t Offset, size_t Size)
+{
+    if (m_pData == nullptr || Offset >= m_Size)
+        return;
+
+    // The address passed to madvise must be page-aligned
+    static const size_t PageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+    const size_t AlignedOffset = Offset - Offset % PageSize;
+    const size_t End           = Size < m_Size - Offset ? Offset + Size : m_Size;
+    if (madvise(static_cast<Uint8*>(m_pData) + AlignedOffset, End - AlignedOffset, MappedFileAccessHintToMadvise(Hint)) != 0)
+        LOG_WARNING_MESSAGE("madvise failed for file ", m_Path, ": ", strerror(errno));
+}
+
+LinuxMappedFile* LinuxFileSystem::MapFile(const Char* strFilePath, EMappedFileAccessHint Hint)
+{
+    if (strFilePath == nullptr || strFilePath[0] == '\0')
+    {
+        DEV_ERROR("File path must not be null or empty");
+        return nullptr;
+    }
+
+    std::string Path{strFilePath};
+    CorrectSlashes(Path);
+
+    const int fd = open(Path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return nullptr;
+
+    void*  pData = MAP_FAILED;
+    size_t Size  = 0;
+
+    struct stat StatBuff;
+    if (fstat(fd, &StatBuff) == 0 && S_ISREG(StatBuff.st_mode) && StatBuff.st_size > 0)
+    {
+        Size  = static_cast<size_t>(StatBuff.st_size);
+        // Private writable mapping is copy-on-write: modified pages are never written to the file,
+        // and the file may still be opened for reading only.
+        pData = mmap(nullptr, Size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    }
+    // The mapping keeps a reference to the file, so the descriptor is not needed anymore
+    close(fd);
+
+    if (pData == MAP_FAILED)
+        return nullptr;
+
+    LinuxMappedFile* pFile = new LinuxMappedFile{Path.c_str(), pData, Size};
+    if (Hint != EMappedFileAccessHint::Normal)
+        pFile->Advise(Hint);
+
+    return pFile;
+}
+
 bool LinuxFileSystem::FileExists(const Char* strFilePath)
 {
     std::string path{strFilePath};
@@ -72,6 +163,23 @@ bool LinuxFileSystem::FileExists(const Char* strFilePath)
     return !S_ISDIR(StatBuff.st_mode);
 }
 
+Uint64 LinuxFileSystem::GetFileModificationTime(const Char* strFilePath)
+{
+    std::string path{strFilePath};
+    CorrectSlashes(path);
+
+    struct stat StatBuff;
+    if (stat(path.c_str(), &StatBuff) != 0)
+        return 0;
+
+#if PLATFORM_MACOS || PLATFORM_IOS || PLATFORM_TVOS
+    const timespec& ModTime = StatBuff.st_mtimespec;
+#else
+    const timespec& ModTime = StatBuff.st_mtim;
+#endif
+    return static_cast<Uint64>(ModTime.tv_sec) * 1000000000ull + static_cast<Uint64>(ModTime.tv_nsec);
+}
+
 bool LinuxFileSystem::PathExists(const Char* strPath)
 {
     std::string path{strPath};
@@ -50,6 +50,8 @@ public:
     static bool FileExists(const Char* strFilePath);
     static bool PathExists(const Char* strPath);
 
+    static Uint64 GetFileModificationTime(const Char* strFilePath);
+
     static void SetWorkingDirectory(const Char* strWorkingDir);
 
     static bool CreateDirectory(const Char* strPath);
@@ -122,6 +122,11 @@ public:
         return CALL_WIN_FUNC(GetFileAttributes);
     }
 
+    bool GetFileAttributesEx_(WIN32_FILE_ATTRIBUTE_DATA& AttribData) const
+    {
+        return CALL_WIN_FUNC(GetFileAttributesEx, GetFileExInfoStandard, &AttribData) != FALSE;
+    }
+
     bool SetFileAttributes_(DWORD dwAttributes) const
     {
         return CALL_WIN_FUNC(SetFileAttributes, dwAttributes) != FALSE;
@@ -284,6 +289,17 @@ bool WindowsFileSystem::FileExists(const Char* strFilePath)
     return (FileAttribs & FILE_ATTRIBUTE_DIRECTORY) == 0;
 }
 
+Uint64 WindowsFileSystem::GetFileModificationTime(const Char* strFilePath)
+{
+    const WindowsPathHelper WndPath{strFilePath};
+
+    WIN32_FILE_ATTRIBUTE_DATA AttribData;
+    if (!WndPath.GetFileAttributesEx_(AttribData))
+        return 0;
+
+    return (Uint64{AttribData.ftLastWriteTime.dwHighDateTime} << 32u) | Uint64{AttribData.ftLastWriteTime.dwLowDateTime};
+}
+
 static bool CreateDirectoryImpl(const Char* strPath)
 {
     if (strPath == nullptr || strPath[0] == '\0')
@@ -34,3 +34,16 @@
 #if DILIGENT_AVX2_SUPPORTED && defined(__AVX2__)
 #    define DILIGENT_AVX2_ENABLED 1
 #endif
+
+#if DILIGENT_AVX2_ENABLED && (defined(__F16C__) || defined(_MSC_VER))
+#    define DILIGENT_F16C_ENABLED 1
+#endif
+
+#if DILIGENT_AVX2_SUPPORTED && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#    define DILIGENT_SSE2_ENABLED 1
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || (defined(_MSC_VER) && (defined(_M_ARM) || defined(_M_ARM64)))
+#    include <arm_neon.h>
+#    define DILIGENT_NEON_ENABLED 1
+#endif
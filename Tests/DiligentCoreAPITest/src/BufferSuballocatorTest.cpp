@@ -33,6 +33,7 @@
 
 #include "GPUTestingEnvironment.hpp"
 #include "FastRand.hpp"
+#include "Align.hpp"
 
 #include "gtest/gtest.h"
 
@@ -153,4 +154,207 @@ TEST(BufferSuballocatorTest, Allocate)
     }
 }
 
+void CheckNoOverlap(std::vector<std::pair<Uint32, Uint32>> Ranges)
+{
+    std::sort(Ranges.begin(), Ranges.end());
+    for (size_t i = 1; i < Ranges.size(); ++i)
+        EXPECT_LE(Ranges[i - 1].first + Ranges[i - 1].second, Ranges[i].first);
+}
+
+TEST(BufferSuballocatorTest, AllocateBatch)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    BufferSuballocatorCreateInfo CI;
+    CI.Desc.Name      = "Buffer Suballocator Test";
+    CI.Desc.BindFlags = BIND_VERTEX_BUFFER;
+    CI.Desc.Size      = 1024;
+    CI.MaxSize        = 1u << 20u;
+
+    RefCntAutoPtr<IBufferSuballocator> pAllocator;
+    CreateBufferSuballocator(pDevice, CI, &pAllocator);
+    ASSERT_NE(pAllocator, nullptr);
+
+    constexpr Uint32 NumAllocations = 256;
+    constexpr Uint32 Alignment      = 16;
+
+    std::vector<Uint32> Sizes(NumAllocations);
+    FastRandInt         rnd{0, 4, 256};
+    for (Uint32& Size : Sizes)
+        Size = static_cast<Uint32>(rnd());
+
+    std::vector<IBufferSuballocation*> pSuballocations(NumAllocations);
+    EXPECT_EQ(pAllocator->AllocateBatch(NumAllocations, Sizes.data(), Alignment, pSuballocations.data()), NumAllocations);
+
+    std::vector<BufferSuballocationHandle> Handles(NumAllocations);
+    EXPECT_EQ(pAllocator->AllocateBatch(NumAllocations, Sizes.data(), Alignment, Handles.data()), NumAllocations);
+
+    std::vector<std::pair<Uint32, Uint32>> Ranges;
+    for (Uint32 i = 0; i < NumAllocations; ++i)
+    {
+        ASSERT_NE(pSuballocations[i], nullptr);
+        EXPECT_EQ(pSuballocations[i]->GetSize(), Sizes[i]);
+        EXPECT_EQ(pSuballocations[i]->GetOffset() % Alignment, 0u);
+        EXPECT_EQ(pSuballocations[i]->GetAllocator(), pAllocator.RawPtr());
+        Ranges.emplace_back(pSuballocations[i]->GetOffset(), pSuballocations[i]->GetSize());
+
+        ASSERT_TRUE(Handles[i].IsValid());
+        EXPECT_EQ(Handles[i].Size, Sizes[i]);
+        EXPECT_EQ(Handles[i].Offset % Alignment, 0u);
+        Ranges.emplace_back(Handles[i].Offset, Handles[i].Size);
+    }
+    CheckNoOverlap(std::move(Ranges));
+
+    BufferSuballocatorUsageStats Stats;
+    pAllocator->GetUsageStats(Stats);
+    EXPECT_EQ(Stats.AllocationCount, NumAllocations * 2);
+
+    pAllocator->FreeBatch(NumAllocations, Handles.data());
+    for (const BufferSuballocationHandle& Handle : Handles)
+        EXPECT_FALSE(Handle.IsValid());
+    pAllocator->GetUsageStats(Stats);
+    EXPECT_EQ(Stats.AllocationCount, NumAllocations);
+
+    for (IBufferSuballocation* pSuballoc : pSuballocations)
+        pSuballoc->Release();
+    pAllocator->GetUsageStats(Stats);
+    EXPECT_EQ(Stats.AllocationCount, 0u);
+    EXPECT_EQ(Stats.UsedSize, 0u);
+
+    // Batch that does not fit into the maximum buffer size
+    {
+        CI.Desc.Size = 1024;
+        CI.MaxSize   = 1024;
+        RefCntAutoPtr<IBufferSuballocator> pSmallAllocator;
+        CreateBufferSuballocator(pDevice, CI, &pSmallAllocator);
+        ASSERT_NE(pSmallAllocator, nullptr);
+
+        const std::vector<Uint32>              SmallSizes(20, 64);
+        std::vector<BufferSuballocationHandle> SmallHandles(SmallSizes.size());
+        EXPECT_EQ(pSmallAllocator->AllocateBatch(static_cast<Uint32>(SmallSizes.size()), SmallSizes.data(), Alignment, SmallHandles.data()), 16u);
+        for (size_t i = 0; i < SmallHandles.size(); ++i)
+            EXPECT_EQ(SmallHandles[i].IsValid(), i < 16);
+        pSmallAllocator->FreeBatch(static_cast<Uint32>(SmallHandles.size()), SmallHandles.data());
+
+        pSmallAllocator->GetUsageStats(Stats);
+        EXPECT_EQ(Stats.AllocationCount, 0u);
+        EXPECT_EQ(Stats.UsedSize, 0u);
+    }
+}
+
+TEST(BufferSuballocatorTest, Defragment)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    BufferSuballocatorCreateInfo CI;
+    CI.Desc.Name      = "Buffer Suballocator Test";
+    CI.Desc.BindFlags = BIND_VERTEX_BUFFER;
+    CI.Desc.Size      = 4096;
+
+    RefCntAutoPtr<IBufferSuballocator> pAllocator;
+    CreateBufferSuballocator(pDevice, CI, &pAllocator);
+    ASSERT_NE(pAllocator, nullptr);
+
+    constexpr Uint32 NumAllocations = 64;
+    constexpr Uint32 Alignment      = 16;
+
+    std::vector<RefCntAutoPtr<IBufferSuballocation>> pSuballocations(NumAllocations);
+    for (auto& pSuballoc : pSuballocations)
+    {
+        pAllocator->Allocate(40, Alignment, &pSuballoc);
+        ASSERT_NE(pSuballoc, nullptr);
+    }
+
+    // Pinned region allocated as a handle
+    const Uint32              PinnedSize = 40;
+    BufferSuballocationHandle Pinned;
+    EXPECT_EQ(pAllocator->AllocateBatch(1, &PinnedSize, Alignment, &Pinned), 1u);
+
+    // Release every other suballocation
+    for (size_t i = 0; i < pSuballocations.size(); i += 2)
+        pSuballocations[i].Release();
+
+    BufferSuballocatorUsageStats Stats;
+    pAllocator->GetUsageStats(Stats);
+    const Uint64 UsedSize = Stats.UsedSize;
+    EXPECT_LT(Stats.MaxFreeChunkSize, CI.Desc.Size - UsedSize);
+
+    const Uint32 Version = pAllocator->GetVersion();
+
+    BufferSuballocatorDefragmentationPlan Plan;
+    pAllocator->PlanDefragmentation({}, Plan);
+    ASSERT_GT(Plan.NumMoves, 0u);
+    ASSERT_NE(Plan.pMoves, nullptr);
+    EXPECT_GT(Plan.FragmentationBefore, Plan.FragmentationAfter);
+    EXPECT_LT(Plan.MaxFreeChunkSizeBefore, Plan.MaxFreeChunkSizeAfter);
+    EXPECT_EQ(Plan.MaxFreeChunkSizeBefore, Stats.MaxFreeChunkSize);
+
+    std::vector<std::pair<Uint32, Uint32>> Ranges;
+    for (const auto& pSuballoc : pSuballocations)
+    {
+        if (pSuballoc)
+            Ranges.emplace_back(pSuballoc->GetOffset(), pSuballoc->GetSize());
+    }
+    Ranges.emplace_back(Pinned.Offset, Pinned.Size);
+    for (Uint32 i = 0; i < Plan.NumMoves; ++i)
+    {
+        const auto& Move = Plan.pMoves[i];
+        EXPECT_LT(Move.DstOffset, Move.SrcOffset);
+        EXPECT_EQ(Move.DstOffset % Alignment, 0u);
+        EXPECT_EQ(Move.Size, 40u);
+        EXPECT_NE(Move.SrcOffset, Pinned.Offset);
+        Ranges.emplace_back(Move.DstOffset, Move.Size);
+    }
+    CheckNoOverlap(std::move(Ranges));
+
+    // Commit the first half of the moves
+    pAllocator->CommitDefragmentation(0, Plan.NumMoves / 2);
+    EXPECT_NE(pAllocator->GetVersion(), Version);
+    for (Uint32 i = 0; i < Plan.NumMoves / 2; ++i)
+    {
+        const auto& Move = Plan.pMoves[i];
+        auto        It   = std::find_if(pSuballocations.begin(), pSuballocations.end(), [&Move](const RefCntAutoPtr<IBufferSuballocation>& pSuballoc) {
+            return pSuballoc && pSuballoc->GetOffset() == Move.DstOffset;
+        });
+        EXPECT_NE(It, pSuballocations.end());
+    }
+
+    // Release a suballocation with a pending move and commit the rest
+    if (Plan.NumMoves > 1)
+    {
+        const auto& Move = Plan.pMoves[Plan.NumMoves - 1];
+        for (auto& pSuballoc : pSuballocations)
+        {
+            if (pSuballoc && pSuballoc->GetOffset() == Move.SrcOffset)
+                pSuballoc.Release();
+        }
+    }
+    pAllocator->CommitDefragmentation(Plan.NumMoves / 2, Plan.NumMoves - Plan.NumMoves / 2);
+
+    pAllocator->GetUsageStats(Stats);
+    EXPECT_LE(Stats.UsedSize, UsedSize);
+    EXPECT_GE(Stats.MaxFreeChunkSize, Plan.MaxFreeChunkSizeBefore);
+
+    // Canceled plan releases the reserved regions
+    {
+        const Uint64 UsedSizeBeforePlan = Stats.UsedSize;
+        pAllocator->FreeBatch(1, &Pinned);
+        pAllocator->PlanDefragmentation({}, Plan);
+        pAllocator->CancelDefragmentation();
+        pAllocator->GetUsageStats(Stats);
+        EXPECT_EQ(Stats.UsedSize + AlignUp(PinnedSize, Alignment), UsedSizeBeforePlan);
+    }
+
+    pSuballocations.clear();
+    pAllocator->GetUsageStats(Stats);
+    EXPECT_EQ(Stats.AllocationCount, 0u);
+    EXPECT_EQ(Stats.UsedSize, 0u);
+}
+
 } // namespace
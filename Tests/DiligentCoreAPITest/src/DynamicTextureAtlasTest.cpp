@@ -166,7 +166,7 @@ TEST(DynamicTextureAtlas, CreateArray)
     }
 }
 
-TEST(DynamicTextureAtlas, Allocate)
+void TestAllocate(DYNAMIC_TEXTURE_ATLAS_PACKING_MODE PackingMode)
 {
     auto* const pEnv     = GPUTestingEnvironment::GetInstance();
     auto* const pDevice  = pEnv->GetDevice();
@@ -184,6 +184,7 @@ TEST(DynamicTextureAtlas, Allocate)
     CI.Desc.Width      = 512;
     CI.Desc.Height     = 512;
     CI.Desc.ArraySize  = 1;
+    CI.PackingMode     = PackingMode;
 
     RefCntAutoPtr<IDynamicTextureAtlas> pAtlas;
     CreateDynamicTextureAtlas(pDevice, CI, &pAtlas);
@@ -256,6 +257,16 @@ TEST(DynamicTextureAtlas, Allocate)
     }
 }
 
+TEST(DynamicTextureAtlas, Allocate)
+{
+    TestAllocate(DYNAMIC_TEXTURE_ATLAS_PACKING_MODE_GUILLOTINE);
+}
+
+TEST(DynamicTextureAtlas, Allocate_Skyline)
+{
+    TestAllocate(DYNAMIC_TEXTURE_ATLAS_PACKING_MODE_SKYLINE);
+}
+
 
 // Allocate more regions than the atlas can hold
 TEST(DynamicTextureAtlas, Overflow)
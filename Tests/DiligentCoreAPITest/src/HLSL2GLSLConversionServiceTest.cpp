@@ -0,0 +1,261 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include <cstring>
+
+#include "GPUTestingEnvironment.hpp"
+#include "HLSL2GLSLConverter.h"
+#include "HLSL2GLSLConversionService.hpp"
+#include "ThreadPool.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+using ConversionAttribs = HLSL2GLSLConversionService::ConversionAttribs;
+
+RefCntAutoPtr<IShaderSourceInputStreamFactory> CreateSourceFactory()
+{
+    auto* pEnv = GPUTestingEnvironment::GetInstance();
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pEnv->GetDevice()->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders/HLSL2GLSLConverter", &pShaderSourceFactory);
+    return pShaderSourceFactory;
+}
+
+std::vector<ConversionAttribs> GetTestShaders()
+{
+    struct ShaderInfo
+    {
+        const char* FileName;
+        const char* EntryPoint;
+        SHADER_TYPE Type;
+    };
+    constexpr ShaderInfo Shaders[] = {
+        {"VS_PS.hlsl", "TestVS", SHADER_TYPE_VERTEX},
+        {"VS_PS.hlsl", "TestPS", SHADER_TYPE_PIXEL},
+        {"CS_RWTex1D.hlsl", "TestCS", SHADER_TYPE_COMPUTE},
+        {"CS_RWTex2D_1.hlsl", "TestCS", SHADER_TYPE_COMPUTE},
+        {"CS_RWTex2D_2.hlsl", "TestCS", SHADER_TYPE_COMPUTE},
+        {"CS_RWBuff.hlsl", "TestCS", SHADER_TYPE_COMPUTE},
+        {"GS.hlsl", "main", SHADER_TYPE_GEOMETRY},
+        {"PreprocessorTest.hlsl", "main1", SHADER_TYPE_PIXEL},
+        {"PreprocessorTest.hlsl", "main2", SHADER_TYPE_PIXEL},
+        {"PreprocessorTest.hlsl", "main3", SHADER_TYPE_PIXEL},
+    };
+
+    std::vector<ConversionAttribs> Attribs;
+    for (const ShaderInfo& Shader : Shaders)
+    {
+        ConversionAttribs Attr;
+        Attr.InputFileName = Shader.FileName;
+        Attr.EntryPoint    = Shader.EntryPoint;
+        Attr.ShaderType    = Shader.Type;
+        Attribs.push_back(Attr);
+    }
+    return Attribs;
+}
+
+// Converts the shader without the service
+RefCntAutoPtr<IDataBlob> ConvertDirect(IShaderSourceInputStreamFactory* pFactory, const ConversionAttribs& Attribs)
+{
+    RefCntAutoPtr<IHLSL2GLSLConverter> pConverter;
+    CreateHLSL2GLSLConverter(&pConverter);
+    if (!pConverter)
+        return {};
+
+    RefCntAutoPtr<IHLSL2GLSLConversionStream> pStream;
+    pConverter->CreateStream(Attribs.InputFileName, pFactory, Attribs.HLSLSource, Attribs.NumSymbols, &pStream);
+    if (!pStream)
+        return {};
+
+    RefCntAutoPtr<IDataBlob> pGLSL;
+    pStream->Convert(Attribs.EntryPoint, Attribs.ShaderType, Attribs.IncludeDefinitions, Attribs.SamplerSuffix,
+                     Attribs.UseInOutLocationQualifiers, Attribs.UseRowMajorMatrices, &pGLSL);
+    return pGLSL;
+}
+
+bool BlobsEqual(IDataBlob* pBlob0, IDataBlob* pBlob1)
+{
+    return pBlob0->GetSize() == pBlob1->GetSize() &&
+        memcmp(pBlob0->GetConstDataPtr(), pBlob1->GetConstDataPtr(), pBlob0->GetSize()) == 0;
+}
+
+TEST(HLSL2GLSLConversionServiceTest, Convert)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pFactory = CreateSourceFactory();
+    ASSERT_NE(pFactory, nullptr);
+
+    HLSL2GLSLConversionService Service{{pFactory}};
+
+    const std::vector<ConversionAttribs> Shaders = GetTestShaders();
+
+    std::vector<RefCntAutoPtr<IDataBlob>> Results;
+    for (const ConversionAttribs& Attribs : Shaders)
+    {
+        RefCntAutoPtr<IDataBlob> pRef = ConvertDirect(pFactory, Attribs);
+        ASSERT_NE(pRef, nullptr);
+
+        RefCntAutoPtr<IDataBlob> pGLSL = Service.Convert(Attribs);
+        ASSERT_NE(pGLSL, nullptr) << Attribs.InputFileName << " (" << Attribs.EntryPoint << ")";
+        EXPECT_TRUE(BlobsEqual(pGLSL, pRef)) << Attribs.InputFileName << " (" << Attribs.EntryPoint << ")";
+        Results.emplace_back(std::move(pGLSL));
+    }
+
+    // Every source file must only be tokenized once
+    HLSL2GLSLConversionService::Statistics Stats = Service.GetStatistics();
+    EXPECT_EQ(Stats.NumRequests, Shaders.size());
+    EXPECT_EQ(Stats.NumCacheHits, 0u);
+    EXPECT_EQ(Stats.NumSourcesParsed, 7u);
+    EXPECT_EQ(Stats.NumFailures, 0u);
+
+    for (size_t i = 0; i < Shaders.size(); ++i)
+    {
+        EXPECT_EQ(Service.Convert(Shaders[i]), Results[i]);
+    }
+    Stats = Service.GetStatistics();
+    EXPECT_EQ(Stats.NumCacheHits, Shaders.size());
+
+    // Different conversion attributes must not hit the cache
+    {
+        ConversionAttribs Attribs  = Shaders[0];
+        Attribs.UseRowMajorMatrices = true;
+
+        RefCntAutoPtr<IDataBlob> pGLSL = Service.Convert(Attribs);
+        ASSERT_NE(pGLSL, nullptr);
+        EXPECT_NE(pGLSL, Results[0]);
+        EXPECT_TRUE(BlobsEqual(pGLSL, ConvertDirect(pFactory, Attribs)));
+        EXPECT_EQ(Service.GetStatistics().NumSourcesParsed, 7u);
+    }
+
+    // Source code provided in memory
+    {
+        constexpr char Source[] = "float4 main() : SV_Target { return float4(1.0, 0.0, 0.0, 1.0); }";
+
+        ConversionAttribs Attribs;
+        Attribs.HLSLSource = Source;
+        Attribs.NumSymbols = sizeof(Source) - 1;
+        Attribs.EntryPoint = "main";
+        Attribs.ShaderType = SHADER_TYPE_PIXEL;
+
+        RefCntAutoPtr<IDataBlob> pGLSL = Service.Convert(Attribs);
+        ASSERT_NE(pGLSL, nullptr);
+        EXPECT_TRUE(BlobsEqual(pGLSL, ConvertDirect(pFactory, Attribs)));
+        EXPECT_EQ(Service.Convert(Attribs), pGLSL);
+    }
+
+    // Missing entry point
+    {
+        ConversionAttribs Attribs = Shaders[0];
+        Attribs.EntryPoint        = "MissingEntryPoint";
+
+        TestingEnvironment::ErrorScope ExpectedErrors{"Unable to find shader entry point"};
+        EXPECT_EQ(Service.Convert(Attribs), nullptr);
+        EXPECT_EQ(Service.GetStatistics().NumFailures, 1u);
+    }
+
+    // The stream pool must not be affected by the failed conversion
+    EXPECT_EQ(Service.Convert(Shaders[0]), Results[0]);
+
+    Service.Reset();
+    RefCntAutoPtr<IDataBlob> pGLSL = Service.Convert(Shaders[0]);
+    ASSERT_NE(pGLSL, nullptr);
+    EXPECT_NE(pGLSL, Results[0]);
+    EXPECT_TRUE(BlobsEqual(pGLSL, Results[0]));
+}
+
+TEST(HLSL2GLSLConversionServiceTest, ConvertBatch)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pFactory = CreateSourceFactory();
+    ASSERT_NE(pFactory, nullptr);
+
+    ThreadPoolCreateInfo ThreadPoolCI;
+    ThreadPoolCI.NumThreads = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCI);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    HLSL2GLSLConversionService Service{{pFactory, pThreadPool}};
+
+    const std::vector<ConversionAttribs> Shaders = GetTestShaders();
+
+    std::vector<RefCntAutoPtr<IDataBlob>> RefResults;
+    for (const ConversionAttribs& Attribs : Shaders)
+    {
+        RefResults.emplace_back(ConvertDirect(pFactory, Attribs));
+        ASSERT_NE(RefResults.back(), nullptr);
+    }
+
+    // Every shader is requested multiple times so that the same source is converted
+    // by several threads concurrently
+    constexpr size_t NumCopies = 8;
+
+    std::vector<ConversionAttribs> Batch;
+    for (size_t i = 0; i < NumCopies; ++i)
+    {
+        for (ConversionAttribs Attribs : Shaders)
+        {
+            // Make each copy a unique conversion
+            Attribs.UseRowMajorMatrices        = (i & 0x01) != 0;
+            Attribs.UseInOutLocationQualifiers = (i & 0x02) == 0;
+            Attribs.IncludeDefinitions         = (i & 0x04) != 0;
+            Batch.push_back(Attribs);
+        }
+    }
+
+    std::vector<RefCntAutoPtr<IDataBlob>> Results(Batch.size());
+    Service.ConvertBatch(Batch.data(), static_cast<Uint32>(Batch.size()), Results.data());
+
+    for (size_t i = 0; i < Batch.size(); ++i)
+    {
+        ASSERT_NE(Results[i], nullptr) << Batch[i].InputFileName << " (" << Batch[i].EntryPoint << ")";
+        if (i < Shaders.size())
+            EXPECT_TRUE(BlobsEqual(Results[i], RefResults[i])) << Batch[i].InputFileName << " (" << Batch[i].EntryPoint << ")";
+        else
+            EXPECT_TRUE(BlobsEqual(Results[i], ConvertDirect(pFactory, Batch[i]))) << Batch[i].InputFileName << " (" << Batch[i].EntryPoint << ")";
+    }
+
+    const HLSL2GLSLConversionService::Statistics Stats = Service.GetStatistics();
+    EXPECT_EQ(Stats.NumRequests, Batch.size());
+    EXPECT_EQ(Stats.NumCacheHits, 0u);
+    EXPECT_EQ(Stats.NumSourcesParsed, 7u);
+    EXPECT_EQ(Stats.NumFailures, 0u);
+
+    // Convert the same batch again - all results must come from the cache
+    std::vector<RefCntAutoPtr<IDataBlob>> CachedResults(Batch.size());
+    Service.ConvertBatch(Batch.data(), static_cast<Uint32>(Batch.size()), CachedResults.data());
+    EXPECT_EQ(CachedResults, Results);
+    EXPECT_EQ(Service.GetStatistics().NumCacheHits, Batch.size());
+}
+
+} // namespace
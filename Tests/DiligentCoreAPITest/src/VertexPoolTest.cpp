@@ -183,4 +183,159 @@ TEST(VertexPoolTest, Allocate)
     }
 }
 
+TEST(VertexPoolTest, AllocateBatch)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr VertexPoolElementDesc Elements[] =
+        {
+            VertexPoolElementDesc{16},
+            VertexPoolElementDesc{24, BIND_SHADER_RESOURCE, USAGE_DEFAULT, BUFFER_MODE_STRUCTURED, CPU_ACCESS_NONE},
+        };
+    VertexPoolCreateInfo CI;
+    CI.Desc.Name        = "Test vertex pool";
+    CI.Desc.pElements   = Elements;
+    CI.Desc.NumElements = _countof(Elements);
+    CI.Desc.VertexCount = 128;
+
+    RefCntAutoPtr<IVertexPool> pVtxPool;
+    CreateVertexPool(pDevice, CI, &pVtxPool);
+    ASSERT_NE(pVtxPool, nullptr);
+
+    constexpr Uint32 NumAllocations = 256;
+
+    std::vector<Uint32> VertexCounts(NumAllocations);
+    FastRandInt         rnd{0, 4, 64};
+    for (Uint32& Count : VertexCounts)
+        Count = static_cast<Uint32>(rnd());
+
+    std::vector<IVertexPoolAllocation*> pAllocations(NumAllocations);
+    EXPECT_EQ(pVtxPool->AllocateBatch(NumAllocations, VertexCounts.data(), pAllocations.data()), NumAllocations);
+
+    std::vector<VertexPoolAllocationHandle> Handles(NumAllocations);
+    EXPECT_EQ(pVtxPool->AllocateBatch(NumAllocations, VertexCounts.data(), Handles.data()), NumAllocations);
+
+    std::vector<std::pair<Uint32, Uint32>> Ranges;
+    for (Uint32 i = 0; i < NumAllocations; ++i)
+    {
+        ASSERT_NE(pAllocations[i], nullptr);
+        EXPECT_EQ(pAllocations[i]->GetVertexCount(), VertexCounts[i]);
+        EXPECT_EQ(pAllocations[i]->GetPool(), pVtxPool.RawPtr());
+        Ranges.emplace_back(pAllocations[i]->GetStartVertex(), pAllocations[i]->GetVertexCount());
+
+        ASSERT_TRUE(Handles[i].IsValid());
+        EXPECT_EQ(Handles[i].VertexCount, VertexCounts[i]);
+        Ranges.emplace_back(Handles[i].StartVertex, Handles[i].VertexCount);
+    }
+    std::sort(Ranges.begin(), Ranges.end());
+    for (size_t i = 1; i < Ranges.size(); ++i)
+        EXPECT_LE(Ranges[i - 1].first + Ranges[i - 1].second, Ranges[i].first);
+
+    VertexPoolUsageStats Stats;
+    pVtxPool->GetUsageStats(Stats);
+    EXPECT_EQ(Stats.AllocationCount, NumAllocations * 2);
+    EXPECT_LE(Stats.AllocatedVertexCount, Stats.TotalVertexCount);
+    EXPECT_EQ(pVtxPool->GetDesc().VertexCount, Stats.TotalVertexCount);
+
+    pVtxPool->FreeBatch(NumAllocations, Handles.data());
+    for (const VertexPoolAllocationHandle& Handle : Handles)
+        EXPECT_FALSE(Handle.IsValid());
+    pVtxPool->GetUsageStats(Stats);
+    EXPECT_EQ(Stats.AllocationCount, NumAllocations);
+
+    for (IVertexPoolAllocation* pAlloc : pAllocations)
+        pAlloc->Release();
+    pVtxPool->GetUsageStats(Stats);
+    EXPECT_EQ(Stats.AllocationCount, 0u);
+    EXPECT_EQ(Stats.AllocatedVertexCount, 0u);
+}
+
+TEST(VertexPoolTest, Defragment)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr VertexPoolElementDesc Elements[] =
+        {
+            VertexPoolElementDesc{16},
+            VertexPoolElementDesc{24},
+        };
+    VertexPoolCreateInfo CI;
+    CI.Desc.Name        = "Test vertex pool";
+    CI.Desc.pElements   = Elements;
+    CI.Desc.NumElements = _countof(Elements);
+    CI.Desc.VertexCount = 1024;
+
+    RefCntAutoPtr<IVertexPool> pVtxPool;
+    CreateVertexPool(pDevice, CI, &pVtxPool);
+    ASSERT_NE(pVtxPool, nullptr);
+
+    std::vector<RefCntAutoPtr<IVertexPoolAllocation>> pAllocations(64);
+    for (auto& pAlloc : pAllocations)
+    {
+        pVtxPool->Allocate(8, &pAlloc);
+        ASSERT_NE(pAlloc, nullptr);
+    }
+    for (size_t i = 0; i < pAllocations.size(); i += 3)
+        pAllocations[i].Release();
+
+    VertexPoolUsageStats Stats;
+    pVtxPool->GetUsageStats(Stats);
+    const Uint64 AllocatedVertexCount = Stats.AllocatedVertexCount;
+    const Uint32 Version              = pVtxPool->GetVersion();
+
+    // Limit the number of moves
+    VertexPoolDefragmentationAttribs Attribs;
+    Attribs.MaxMoves = 4;
+
+    VertexPoolDefragmentationPlan Plan;
+    pVtxPool->PlanDefragmentation(Attribs, Plan);
+    EXPECT_EQ(Plan.NumMoves, 4u);
+    EXPECT_GT(Plan.FragmentationBefore, Plan.FragmentationAfter);
+
+    // Recompute the plan without limits. The moves of the previous plan are canceled.
+    pVtxPool->PlanDefragmentation({}, Plan);
+    ASSERT_GT(Plan.NumMoves, 4u);
+    EXPECT_EQ(Plan.FragmentationAfter, 0.f);
+    EXPECT_EQ(Plan.MaxFreeVertexCountAfter, CI.Desc.VertexCount - AllocatedVertexCount);
+
+    Uint64 VerticesToMove = 0;
+    for (Uint32 i = 0; i < Plan.NumMoves; ++i)
+    {
+        EXPECT_LT(Plan.pMoves[i].DstVertex, Plan.pMoves[i].SrcVertex);
+        VerticesToMove += Plan.pMoves[i].VertexCount;
+    }
+    EXPECT_EQ(VerticesToMove, Plan.VerticesToMove);
+
+    pVtxPool->GetUsageStats(Stats);
+    EXPECT_EQ(Stats.AllocatedVertexCount, AllocatedVertexCount + VerticesToMove);
+
+    // Commit the moves one at a time
+    for (Uint32 i = 0; i < Plan.NumMoves; ++i)
+        pVtxPool->CommitDefragmentation(i, 1);
+    EXPECT_NE(pVtxPool->GetVersion(), Version);
+
+    pVtxPool->GetUsageStats(Stats);
+    EXPECT_EQ(Stats.AllocatedVertexCount, AllocatedVertexCount);
+
+    // All live allocations are now packed at the beginning of the pool
+    Uint64 MaxEndVertex = 0;
+    for (const auto& pAlloc : pAllocations)
+    {
+        if (pAlloc)
+            MaxEndVertex = std::max(MaxEndVertex, Uint64{pAlloc->GetStartVertex()} + pAlloc->GetVertexCount());
+    }
+    EXPECT_EQ(MaxEndVertex, AllocatedVertexCount);
+
+    pAllocations.clear();
+    pVtxPool->GetUsageStats(Stats);
+    EXPECT_EQ(Stats.AllocationCount, 0u);
+    EXPECT_EQ(Stats.AllocatedVertexCount, 0u);
+}
+
 } // namespace
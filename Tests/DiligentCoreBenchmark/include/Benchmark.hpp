@@ -0,0 +1,198 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Micro-benchmark harness
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "../../../Primitives/interface/BasicTypes.h"
+
+namespace Diligent
+{
+
+namespace Benchmark
+{
+
+/// Benchmark run settings
+struct RunSettings
+{
+    /// Only the benchmarks whose names contain this string are run.
+    std::string Filter;
+
+    /// The number of measured samples.
+    Uint32 Repetitions = 20;
+
+    /// The minimum duration of one sample, in seconds. The number of iterations
+    /// per sample is selected during the warm-up so that every sample takes at least this long.
+    double MinSampleTime = 0.01;
+
+    /// The minimum warm-up time, in seconds.
+    double WarmupTime = 0.05;
+};
+
+/// Benchmark state passed to the benchmark function
+class State
+{
+public:
+    explicit State(const RunSettings& Settings) :
+        m_Settings{Settings}
+    {}
+
+    /// Measures the body. The function must be called exactly once by every benchmark.
+    /// The code before and after the call is the setup and teardown and is not measured.
+    template <typename BodyType>
+    void Run(BodyType&& Body)
+    {
+        RunIterations([&Body](Uint64 NumIterations) {
+            for (Uint64 i = 0; i < NumIterations; ++i)
+                Body();
+        });
+    }
+
+    /// Sets the number of items processed by one iteration to report the throughput in items per second.
+    void SetItemsPerIteration(Uint64 Items) { m_ItemsPerIteration = Items; }
+
+    /// Sets the number of bytes processed by one iteration to report the throughput in bytes per second.
+    void SetBytesPerIteration(Uint64 Bytes) { m_BytesPerIteration = Bytes; }
+
+    Uint64 GetItemsPerIteration() const { return m_ItemsPerIteration; }
+    Uint64 GetBytesPerIteration() const { return m_BytesPerIteration; }
+    Uint64 GetIterationsPerSample() const { return m_IterationsPerSample; }
+
+    /// Returns the duration of one iteration in every sample, in nanoseconds.
+    const std::vector<double>& GetSamples() const { return m_Samples; }
+
+private:
+    void RunIterations(const std::function<void(Uint64)>& RunBatch);
+
+private:
+    const RunSettings& m_Settings;
+
+    Uint64              m_ItemsPerIteration   = 0;
+    Uint64              m_BytesPerIteration   = 0;
+    Uint64              m_IterationsPerSample = 0;
+    std::vector<double> m_Samples;
+};
+
+using BenchmarkFunction = std::function<void(State&)>;
+
+/// Registers the benchmark. Returns true so that the function can be used to initialize a static variable.
+bool RegisterBenchmark(std::string Name, BenchmarkFunction Func);
+
+/// Returns the names of all registered benchmarks in the alphabetical order.
+std::vector<std::string> GetBenchmarkNames();
+
+
+/// Benchmark result
+struct Result
+{
+    std::string Name;
+
+    Uint32 Repetitions         = 0;
+    Uint64 IterationsPerSample = 0;
+
+    /// Iteration time statistics over all samples, in nanoseconds.
+    double MinNs    = 0;
+    double MeanNs   = 0;
+    double MedianNs = 0;
+    double P90Ns    = 0;
+    double P99Ns    = 0;
+    double MaxNs    = 0;
+    double StdDevNs = 0;
+
+    /// Throughput computed from the median time, or 0 if the benchmark does not report it.
+    double ItemsPerSecond = 0;
+    double BytesPerSecond = 0;
+};
+
+/// Benchmark results and the environment they were collected in
+struct ResultSet
+{
+    std::string Date;
+    std::string BuildType;
+    Uint32      NumCPUs = 0;
+
+    std::vector<Result> Results;
+};
+
+/// Runs the registered benchmarks that match the filter and prints the results to the standard output.
+ResultSet RunBenchmarks(const RunSettings& Settings);
+
+/// Computes the result statistics from the per-iteration sample times, in nanoseconds.
+Result ComputeResult(std::string Name, std::vector<double> Samples, Uint64 IterationsPerSample, Uint64 ItemsPerIteration, Uint64 BytesPerIteration);
+
+/// Writes the results to a JSON file. Returns false if the file could not be written.
+bool WriteResultsJSON(const ResultSet& Results, const char* FilePath);
+
+/// Reads the results from a JSON file written by WriteResultsJSON().
+/// Returns false if the file could not be read or parsed.
+bool ReadResultsJSON(const char* FilePath, ResultSet& Results);
+
+/// Compares the median times of the benchmarks present in both result sets and prints the comparison.
+///
+/// \param [in] Baseline         - Baseline results.
+/// \param [in] Current          - Current results.
+/// \param [in] ThresholdPercent - The benchmarks whose median time increased by more than
+///                                this percentage are reported as regressions.
+/// \return     The number of regressions.
+Uint32 CompareResults(const ResultSet& Baseline, const ResultSet& Current, double ThresholdPercent);
+
+
+namespace Detail
+{
+void UseValue(const void* pValue);
+} // namespace Detail
+
+/// Prevents the compiler from optimizing away the computation of the value.
+template <typename T>
+inline void DoNotOptimize(const T& Value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile(""
+                 :
+                 : "r,m"(Value)
+                 : "memory");
+#else
+    Detail::UseValue(&Value);
+#endif
+}
+
+} // namespace Benchmark
+
+} // namespace Diligent
+
+/// Defines and registers a benchmark function with the given name.
+/// The name should have the form Module.Benchmark, e.g. Common.ComputeHashRaw.
+#define DILIGENT_BENCHMARK(Module, Name)                                                               \
+    static void                        Module##_##Name##_Benchmark(Diligent::Benchmark::State& State); \
+    [[maybe_unused]] static const bool Module##_##Name##_Registered =                                  \
+        Diligent::Benchmark::RegisterBenchmark(#Module "." #Name, Module##_##Name##_Benchmark);        \
+    static void Module##_##Name##_Benchmark(Diligent::Benchmark::State& State)
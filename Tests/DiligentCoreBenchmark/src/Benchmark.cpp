@@ -0,0 +1,247 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <map>
+#include <thread>
+
+#include "Timer.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace Benchmark
+{
+
+namespace
+{
+
+std::map<std::string, BenchmarkFunction>& GetRegistry()
+{
+    static std::map<std::string, BenchmarkFunction> Registry;
+    return Registry;
+}
+
+// Returns the value at the given percentile of the sorted samples, interpolating between the closest ranks
+double GetPercentile(const std::vector<double>& SortedSamples, double Percentile)
+{
+    VERIFY_EXPR(!SortedSamples.empty());
+    const double Rank  = Percentile / 100.0 * static_cast<double>(SortedSamples.size() - 1);
+    const size_t Lower = static_cast<size_t>(std::floor(Rank));
+    const size_t Upper = std::min(Lower + 1, SortedSamples.size() - 1);
+    return SortedSamples[Lower] + (SortedSamples[Upper] - SortedSamples[Lower]) * (Rank - static_cast<double>(Lower));
+}
+
+std::string FormatTime(double Ns)
+{
+    char Buffer[32];
+    if (Ns < 1e3)
+        snprintf(Buffer, sizeof(Buffer), "%.2f ns", Ns);
+    else if (Ns < 1e6)
+        snprintf(Buffer, sizeof(Buffer), "%.2f us", Ns / 1e3);
+    else if (Ns < 1e9)
+        snprintf(Buffer, sizeof(Buffer), "%.2f ms", Ns / 1e6);
+    else
+        snprintf(Buffer, sizeof(Buffer), "%.2f s", Ns / 1e9);
+    return Buffer;
+}
+
+std::string FormatThroughput(const Result& Res)
+{
+    char Buffer[32] = {};
+    if (Res.BytesPerSecond > 0)
+        snprintf(Buffer, sizeof(Buffer), "%.1f MB/s", Res.BytesPerSecond / (1 << 20));
+    else if (Res.ItemsPerSecond > 0)
+        snprintf(Buffer, sizeof(Buffer), "%.2f M/s", Res.ItemsPerSecond / 1e6);
+    return Buffer;
+}
+
+std::string GetCurrentDate()
+{
+    const std::time_t Now = std::time(nullptr);
+    std::tm           Tm  = {};
+#if PLATFORM_WIN32 || PLATFORM_UNIVERSAL_WINDOWS
+    gmtime_s(&Tm, &Now);
+#else
+    gmtime_r(&Now, &Tm);
+#endif
+    char Buffer[32];
+    std::strftime(Buffer, sizeof(Buffer), "%Y-%m-%dT%H:%M:%SZ", &Tm);
+    return Buffer;
+}
+
+} // namespace
+
+
+namespace Detail
+{
+
+const void* volatile g_pSink = nullptr;
+
+void UseValue(const void* pValue)
+{
+    g_pSink = pValue;
+}
+
+} // namespace Detail
+
+
+void State::RunIterations(const std::function<void(Uint64)>& RunBatch)
+{
+    DEV_CHECK_ERR(m_Samples.empty(), "State::Run() must be called only once");
+
+    // Warm up the caches and the branch predictors, and find the number of
+    // iterations that takes at least the minimum sample time.
+    Uint64 NumIterations = 1;
+    Timer  WarmupTimer;
+    for (;;)
+    {
+        Timer BatchTimer;
+        RunBatch(NumIterations);
+        const double BatchTime = BatchTimer.GetElapsedTime();
+        if (BatchTime >= m_Settings.MinSampleTime && WarmupTimer.GetElapsedTime() >= m_Settings.WarmupTime)
+            break;
+
+        if (BatchTime < m_Settings.MinSampleTime)
+        {
+            // Grow the batch geometrically, but not more than 10x at a time to avoid overshooting
+            const double Scale = BatchTime > 0 ? std::min(m_Settings.MinSampleTime * 1.2 / BatchTime, 10.0) : 10.0;
+            NumIterations      = std::max(static_cast<Uint64>(static_cast<double>(NumIterations) * Scale), NumIterations + 1);
+        }
+    }
+    m_IterationsPerSample = NumIterations;
+
+    m_Samples.reserve(m_Settings.Repetitions);
+    for (Uint32 Rep = 0; Rep < m_Settings.Repetitions; ++Rep)
+    {
+        Timer SampleTimer;
+        RunBatch(NumIterations);
+        m_Samples.push_back(SampleTimer.GetElapsedTime() * 1e9 / static_cast<double>(NumIterations));
+    }
+}
+
+
+bool RegisterBenchmark(std::string Name, BenchmarkFunction Func)
+{
+    const bool Inserted = GetRegistry().emplace(std::move(Name), std::move(Func)).second;
+    VERIFY(Inserted, "Benchmark with the same name is already registered");
+    return Inserted;
+}
+
+std::vector<std::string> GetBenchmarkNames()
+{
+    std::vector<std::string> Names;
+    for (const auto& it : GetRegistry())
+        Names.push_back(it.first);
+    return Names;
+}
+
+
+Result ComputeResult(std::string Name, std::vector<double> Samples, Uint64 IterationsPerSample, Uint64 ItemsPerIteration, Uint64 BytesPerIteration)
+{
+    Result Res;
+    Res.Name                = std::move(Name);
+    Res.Repetitions         = static_cast<Uint32>(Samples.size());
+    Res.IterationsPerSample = IterationsPerSample;
+    if (Samples.empty())
+        return Res;
+
+    std::sort(Samples.begin(), Samples.end());
+
+    double Sum = 0;
+    for (double s : Samples)
+        Sum += s;
+    Res.MeanNs = Sum / static_cast<double>(Samples.size());
+
+    double SqDevSum = 0;
+    for (double s : Samples)
+        SqDevSum += (s - Res.MeanNs) * (s - Res.MeanNs);
+    Res.StdDevNs = Samples.size() > 1 ? std::sqrt(SqDevSum / static_cast<double>(Samples.size() - 1)) : 0;
+
+    Res.MinNs    = Samples.front();
+    Res.MaxNs    = Samples.back();
+    Res.MedianNs = GetPercentile(Samples, 50);
+    Res.P90Ns    = GetPercentile(Samples, 90);
+    Res.P99Ns    = GetPercentile(Samples, 99);
+
+    if (Res.MedianNs > 0)
+    {
+        Res.ItemsPerSecond = static_cast<double>(ItemsPerIteration) * 1e9 / Res.MedianNs;
+        Res.BytesPerSecond = static_cast<double>(BytesPerIteration) * 1e9 / Res.MedianNs;
+    }
+
+    return Res;
+}
+
+
+ResultSet RunBenchmarks(const RunSettings& Settings)
+{
+    ResultSet Results;
+    Results.Date = GetCurrentDate();
+#ifdef DILIGENT_DEBUG
+    Results.BuildType = "Debug";
+#else
+    Results.BuildType = "Release";
+#endif
+    Results.NumCPUs = std::thread::hardware_concurrency();
+
+    printf("%-64s %12s %12s %12s %14s\n", "Benchmark", "Median", "P90", "P99", "Throughput");
+    printf("%s\n", std::string(118, '-').c_str());
+    for (const auto& it : GetRegistry())
+    {
+        const std::string& Name = it.first;
+        if (!Settings.Filter.empty() && Name.find(Settings.Filter) == std::string::npos)
+            continue;
+
+        State BenchmarkState{Settings};
+        it.second(BenchmarkState);
+        if (BenchmarkState.GetSamples().empty())
+        {
+            LOG_ERROR_MESSAGE("Benchmark '", Name, "' did not call State::Run()");
+            continue;
+        }
+
+        Result Res = ComputeResult(Name, BenchmarkState.GetSamples(), BenchmarkState.GetIterationsPerSample(),
+                                   BenchmarkState.GetItemsPerIteration(), BenchmarkState.GetBytesPerIteration());
+        printf("%-64s %12s %12s %12s %14s\n", Name.c_str(), FormatTime(Res.MedianNs).c_str(), FormatTime(Res.P90Ns).c_str(),
+               FormatTime(Res.P99Ns).c_str(), FormatThroughput(Res).c_str());
+        fflush(stdout);
+
+        Results.Results.emplace_back(std::move(Res));
+    }
+
+    return Results;
+}
+
+} // namespace Benchmark
+
+} // namespace Diligent
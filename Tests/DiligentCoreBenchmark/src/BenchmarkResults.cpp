@@ -0,0 +1,426 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Benchmark.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+
+#include "ParsingTools.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace Benchmark
+{
+
+namespace
+{
+
+std::string EscapeJSONString(const std::string& Str)
+{
+    std::string Escaped;
+    Escaped.reserve(Str.size());
+    for (char c : Str)
+    {
+        switch (c)
+        {
+            case '"': Escaped += "\\\""; break;
+            case '\\': Escaped += "\\\\"; break;
+            case '\n': Escaped += "\\n"; break;
+            case '\t': Escaped += "\\t"; break;
+            default: Escaped += c;
+        }
+    }
+    return Escaped;
+}
+
+// A minimal JSON value that is sufficient to read the files written by WriteResultsJSON()
+struct JSONValue
+{
+    enum class TYPE
+    {
+        Null,
+        Bool,
+        Number,
+        String,
+        Array,
+        Object
+    };
+    TYPE Type = TYPE::Null;
+
+    double                                         Number = 0;
+    std::string                                    String;
+    std::vector<JSONValue>                         Array;
+    std::vector<std::pair<std::string, JSONValue>> Object;
+
+    const JSONValue* Find(const char* Key) const
+    {
+        for (const auto& Member : Object)
+        {
+            if (Member.first == Key)
+                return &Member.second;
+        }
+        return nullptr;
+    }
+
+    double GetNumber(const char* Key) const
+    {
+        const JSONValue* pValue = Find(Key);
+        return pValue != nullptr && pValue->Type == TYPE::Number ? pValue->Number : 0;
+    }
+
+    std::string GetString(const char* Key) const
+    {
+        const JSONValue* pValue = Find(Key);
+        return pValue != nullptr && pValue->Type == TYPE::String ? pValue->String : std::string{};
+    }
+};
+
+class JSONParser
+{
+public:
+    JSONParser(const std::string& Source) :
+        m_Pos{Source.begin()},
+        m_End{Source.end()}
+    {}
+
+    bool Parse(JSONValue& Value)
+    {
+        if (!ParseValue(Value))
+            return false;
+        m_Pos = Parsing::SkipDelimiters(m_Pos, m_End);
+        return m_Pos == m_End;
+    }
+
+private:
+    bool ParseValue(JSONValue& Value)
+    {
+        m_Pos = Parsing::SkipDelimiters(m_Pos, m_End);
+        if (m_Pos == m_End)
+            return false;
+
+        switch (*m_Pos)
+        {
+            case '{': return ParseObject(Value);
+            case '[': return ParseArray(Value);
+
+            case '"':
+                Value.Type = JSONValue::TYPE::String;
+                return ParseString(Value.String);
+
+            case 't':
+            case 'f':
+            case 'n':
+            {
+                std::string::const_iterator LiteralEnd;
+                Value.Type = *m_Pos == 'n' ? JSONValue::TYPE::Null : JSONValue::TYPE::Bool;
+                if (Parsing::SkipString(m_Pos, m_End, "true", LiteralEnd) ||
+                    Parsing::SkipString(m_Pos, m_End, "false", LiteralEnd) ||
+                    Parsing::SkipString(m_Pos, m_End, "null", LiteralEnd))
+                {
+                    Value.Number = *m_Pos == 't' ? 1 : 0;
+                    m_Pos        = LiteralEnd;
+                    return true;
+                }
+                return false;
+            }
+
+            default:
+            {
+                const auto NumberEnd = Parsing::SkipFloatNumber(m_Pos, m_End);
+                if (NumberEnd == m_Pos)
+                    return false;
+                Value.Type   = JSONValue::TYPE::Number;
+                Value.Number = std::strtod(std::string{m_Pos, NumberEnd}.c_str(), nullptr);
+                m_Pos        = NumberEnd;
+                return true;
+            }
+        }
+    }
+
+    bool ParseString(std::string& Str)
+    {
+        VERIFY_EXPR(*m_Pos == '"');
+        ++m_Pos;
+        while (m_Pos != m_End && *m_Pos != '"')
+        {
+            if (*m_Pos == '\\')
+            {
+                if (++m_Pos == m_End)
+                    return false;
+                switch (*m_Pos)
+                {
+                    case 'n': Str += '\n'; break;
+                    case 't': Str += '\t'; break;
+                    default: Str += *m_Pos;
+                }
+            }
+            else
+            {
+                Str += *m_Pos;
+            }
+            ++m_Pos;
+        }
+        if (m_Pos == m_End)
+            return false;
+        ++m_Pos;
+        return true;
+    }
+
+    bool ParseArray(JSONValue& Value)
+    {
+        Value.Type = JSONValue::TYPE::Array;
+        ++m_Pos;
+        m_Pos = Parsing::SkipDelimiters(m_Pos, m_End);
+        if (m_Pos != m_End && *m_Pos == ']')
+        {
+            ++m_Pos;
+            return true;
+        }
+        for (;;)
+        {
+            Value.Array.emplace_back();
+            if (!ParseValue(Value.Array.back()))
+                return false;
+            m_Pos = Parsing::SkipDelimiters(m_Pos, m_End);
+            if (m_Pos == m_End)
+                return false;
+            if (*m_Pos++ == ']')
+                return true;
+            if (m_Pos[-1] != ',')
+                return false;
+        }
+    }
+
+    bool ParseObject(JSONValue& Value)
+    {
+        Value.Type = JSONValue::TYPE::Object;
+        ++m_Pos;
+        m_Pos = Parsing::SkipDelimiters(m_Pos, m_End);
+        if (m_Pos != m_End && *m_Pos == '}')
+        {
+            ++m_Pos;
+            return true;
+        }
+        for (;;)
+        {
+            m_Pos = Parsing::SkipDelimiters(m_Pos, m_End);
+            if (m_Pos == m_End || *m_Pos != '"')
+                return false;
+
+            Value.Object.emplace_back();
+            if (!ParseString(Value.Object.back().first))
+                return false;
+
+            m_Pos = Parsing::SkipDelimiters(m_Pos, m_End);
+            if (m_Pos == m_End || *m_Pos++ != ':')
+                return false;
+
+            if (!ParseValue(Value.Object.back().second))
+                return false;
+
+            m_Pos = Parsing::SkipDelimiters(m_Pos, m_End);
+            if (m_Pos == m_End)
+                return false;
+            if (*m_Pos++ == '}')
+                return true;
+            if (m_Pos[-1] != ',')
+                return false;
+        }
+    }
+
+private:
+    std::string::const_iterator       m_Pos;
+    const std::string::const_iterator m_End;
+};
+
+} // namespace
+
+
+bool WriteResultsJSON(const ResultSet& Results, const char* FilePath)
+{
+    std::ofstream File{FilePath};
+    if (!File)
+    {
+        LOG_ERROR_MESSAGE("Failed to open file '", FilePath, "' for writing");
+        return false;
+    }
+
+    File.precision(17);
+    File << "{\n"
+         << "  \"date\": \"" << EscapeJSONString(Results.Date) << "\",\n"
+         << "  \"build_type\": \"" << EscapeJSONString(Results.BuildType) << "\",\n"
+         << "  \"num_cpus\": " << Results.NumCPUs << ",\n"
+         << "  \"benchmarks\": [";
+    for (size_t i = 0; i < Results.Results.size(); ++i)
+    {
+        const Result& Res = Results.Results[i];
+        File << (i > 0 ? ",\n" : "\n")
+             << "    {\n"
+             << "      \"name\": \"" << EscapeJSONString(Res.Name) << "\",\n"
+             << "      \"repetitions\": " << Res.Repetitions << ",\n"
+             << "      \"iterations_per_sample\": " << Res.IterationsPerSample << ",\n"
+             << "      \"min_ns\": " << Res.MinNs << ",\n"
+             << "      \"mean_ns\": " << Res.MeanNs << ",\n"
+             << "      \"median_ns\": " << Res.MedianNs << ",\n"
+             << "      \"p90_ns\": " << Res.P90Ns << ",\n"
+             << "      \"p99_ns\": " << Res.P99Ns << ",\n"
+             << "      \"max_ns\": " << Res.MaxNs << ",\n"
+             << "      \"stddev_ns\": " << Res.StdDevNs << ",\n"
+             << "      \"items_per_second\": " << Res.ItemsPerSecond << ",\n"
+             << "      \"bytes_per_second\": " << Res.BytesPerSecond << "\n"
+             << "    }";
+    }
+    File << "\n  ]\n}\n";
+
+    if (!File)
+    {
+        LOG_ERROR_MESSAGE("Failed to write results to file '", FilePath, "'");
+        return false;
+    }
+    return true;
+}
+
+
+bool ReadResultsJSON(const char* FilePath, ResultSet& Results)
+{
+    std::ifstream File{FilePath};
+    if (!File)
+    {
+        LOG_ERROR_MESSAGE("Failed to open file '", FilePath, "'");
+        return false;
+    }
+    std::stringstream Stream;
+    Stream << File.rdbuf();
+    const std::string Source = Stream.str();
+
+    JSONValue Root;
+    if (!JSONParser{Source}.Parse(Root) || Root.Type != JSONValue::TYPE::Object)
+    {
+        LOG_ERROR_MESSAGE("Failed to parse benchmark results file '", FilePath, "'");
+        return false;
+    }
+
+    Results           = {};
+    Results.Date      = Root.GetString("date");
+    Results.BuildType = Root.GetString("build_type");
+    Results.NumCPUs   = static_cast<Uint32>(Root.GetNumber("num_cpus"));
+
+    const JSONValue* pBenchmarks = Root.Find("benchmarks");
+    if (pBenchmarks == nullptr || pBenchmarks->Type != JSONValue::TYPE::Array)
+    {
+        LOG_ERROR_MESSAGE("Benchmark results file '", FilePath, "' does not contain the 'benchmarks' array");
+        return false;
+    }
+
+    for (const JSONValue& Benchmark : pBenchmarks->Array)
+    {
+        if (Benchmark.Type != JSONValue::TYPE::Object)
+            continue;
+
+        Result Res;
+        Res.Name                = Benchmark.GetString("name");
+        Res.Repetitions         = static_cast<Uint32>(Benchmark.GetNumber("repetitions"));
+        Res.IterationsPerSample = static_cast<Uint64>(Benchmark.GetNumber("iterations_per_sample"));
+        Res.MinNs               = Benchmark.GetNumber("min_ns");
+        Res.MeanNs              = Benchmark.GetNumber("mean_ns");
+        Res.MedianNs            = Benchmark.GetNumber("median_ns");
+        Res.P90Ns               = Benchmark.GetNumber("p90_ns");
+        Res.P99Ns               = Benchmark.GetNumber("p99_ns");
+        Res.MaxNs               = Benchmark.GetNumber("max_ns");
+        Res.StdDevNs            = Benchmark.GetNumber("stddev_ns");
+        Res.ItemsPerSecond      = Benchmark.GetNumber("items_per_second");
+        Res.BytesPerSecond      = Benchmark.GetNumber("bytes_per_second");
+        if (!Res.Name.empty())
+            Results.Results.emplace_back(std::move(Res));
+    }
+
+    return true;
+}
+
+
+Uint32 CompareResults(const ResultSet& Baseline, const ResultSet& Current, double ThresholdPercent)
+{
+    if (Baseline.BuildType != Current.BuildType)
+        LOG_WARNING_MESSAGE("Comparing ", Baseline.BuildType, " results with ", Current.BuildType, " results");
+    if (Baseline.NumCPUs != Current.NumCPUs)
+        LOG_WARNING_MESSAGE("Results were collected on machines with different number of CPUs (", Baseline.NumCPUs, " vs ", Current.NumCPUs, ")");
+
+    std::unordered_map<std::string, const Result*> BaselineResults;
+    for (const Result& Res : Baseline.Results)
+        BaselineResults.emplace(Res.Name, &Res);
+
+    printf("%-64s %12s %12s %9s\n", "Benchmark", "Baseline", "Current", "Delta");
+    printf("%s\n", std::string(108, '-').c_str());
+
+    Uint32 NumRegressions = 0;
+    for (const Result& Res : Current.Results)
+    {
+        auto it = BaselineResults.find(Res.Name);
+        if (it == BaselineResults.end())
+        {
+            printf("%-64s %12s %12.1f %9s\n", Res.Name.c_str(), "-", Res.MedianNs, "new");
+            continue;
+        }
+
+        const Result& Base = *it->second;
+        BaselineResults.erase(it);
+
+        const double Delta = Base.MedianNs > 0 ? (Res.MedianNs / Base.MedianNs - 1.0) * 100.0 : 0.0;
+
+        const char* Verdict = "";
+        if (Delta > ThresholdPercent)
+        {
+            Verdict = " REGRESSION";
+            ++NumRegressions;
+        }
+        else if (Delta < -ThresholdPercent)
+        {
+            Verdict = " improvement";
+        }
+        printf("%-64s %12.1f %12.1f %+8.1f%%%s\n", Res.Name.c_str(), Base.MedianNs, Res.MedianNs, Delta, Verdict);
+    }
+
+    // Report the benchmarks that are missing in the current results in the baseline order
+    for (const Result& Base : Baseline.Results)
+    {
+        if (BaselineResults.find(Base.Name) != BaselineResults.end())
+            printf("%-64s %12.1f %12s %9s\n", Base.Name.c_str(), Base.MedianNs, "-", "missing");
+    }
+
+    printf("\nMedian times are in nanoseconds. %u regression(s) above %.1f%% threshold.\n", NumRegressions, ThresholdPercent);
+
+    return NumRegressions;
+}
+
+} // namespace Benchmark
+
+} // namespace Diligent
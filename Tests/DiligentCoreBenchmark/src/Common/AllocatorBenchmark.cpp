@@ -0,0 +1,73 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "FixedBlockMemoryAllocator.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+constexpr size_t BlockSize = 64;
+constexpr Uint32 NumBlocks = 1024;
+
+// Allocates a batch of blocks and releases them in the reverse order, which is the typical pattern
+// of short-lived objects.
+void RunAllocateFree(Benchmark::State& State, IMemoryAllocator& Allocator)
+{
+    std::vector<void*> Blocks(NumBlocks);
+    State.SetItemsPerIteration(NumBlocks);
+    State.Run([&]() {
+        for (void*& pBlock : Blocks)
+            pBlock = Allocator.Allocate(BlockSize, "Benchmark block", __FILE__, __LINE__);
+        Benchmark::DoNotOptimize(Blocks.data());
+        for (auto it = Blocks.rbegin(); it != Blocks.rend(); ++it)
+            Allocator.Free(*it);
+    });
+}
+
+DILIGENT_BENCHMARK(Common, DefaultRawMemoryAllocator)
+{
+    RunAllocateFree(State, DefaultRawMemoryAllocator::GetAllocator());
+}
+
+DILIGENT_BENCHMARK(Common, FixedBlockMemoryAllocator)
+{
+    FixedBlockMemoryAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator(), BlockSize, NumBlocks};
+    RunAllocateFree(State, Allocator);
+}
+
+DILIGENT_BENCHMARK(Common, FixedBlockMemoryAllocatorThreadCache)
+{
+    FixedBlockMemoryAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator(), BlockSize, NumBlocks, 64};
+    RunAllocateFree(State, Allocator);
+}
+
+} // namespace
@@ -0,0 +1,242 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "BVH.hpp"
+#include "ThreadPool.hpp"
+#include "FastRand.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+#ifdef DILIGENT_DEBUG
+constexpr Uint32 GridSize = 64;
+#else
+// About 150000 triangles
+constexpr Uint32 GridSize = 256;
+#endif
+constexpr Uint32 NumRays = 4096;
+
+struct TestMesh
+{
+    std::vector<float3> Vertices;
+    std::vector<Uint32> Indices;
+
+    TriangleMeshBVH::CreateInfo GetBVHCreateInfo() const
+    {
+        TriangleMeshBVH::CreateInfo CI;
+        CI.pVertices    = Vertices.data();
+        CI.NumVertices  = static_cast<Uint32>(Vertices.size());
+        CI.pIndices     = Indices.data();
+        CI.NumTriangles = static_cast<Uint32>(Indices.size() / 3);
+        return CI;
+    }
+};
+
+// Creates a terrain-like height field in the [-1, 1] x [-1, 1] XZ square with
+// randomly placed small triangles above it.
+const TestMesh& GetTestMesh()
+{
+    static const TestMesh Mesh = []() {
+        TestMesh M;
+
+        FastRandFloat Rnd{0, -1, 1};
+        for (Uint32 z = 0; z <= GridSize; ++z)
+        {
+            for (Uint32 x = 0; x <= GridSize; ++x)
+            {
+                const float fx = static_cast<float>(x) / static_cast<float>(GridSize) * 2.f - 1.f;
+                const float fz = static_cast<float>(z) / static_cast<float>(GridSize) * 2.f - 1.f;
+                M.Vertices.emplace_back(fx, 0.1f * std::sin(fx * 7.f) * std::cos(fz * 5.f) + Rnd() * 0.01f, fz);
+            }
+        }
+
+        for (Uint32 z = 0; z < GridSize; ++z)
+        {
+            for (Uint32 x = 0; x < GridSize; ++x)
+            {
+                const Uint32 i00 = z * (GridSize + 1) + x;
+                const Uint32 i10 = i00 + 1;
+                const Uint32 i01 = i00 + GridSize + 1;
+                const Uint32 i11 = i01 + 1;
+                M.Indices.insert(M.Indices.end(), {i00, i01, i10, i10, i01, i11});
+            }
+        }
+
+        for (Uint32 i = 0; i < GridSize * GridSize / 10; ++i)
+        {
+            const float3 Center{Rnd(), Rnd() * 0.5f + 0.6f, Rnd()};
+            const Uint32 FirstVert = static_cast<Uint32>(M.Vertices.size());
+            for (Uint32 v = 0; v < 3; ++v)
+            {
+                M.Vertices.emplace_back(Center + float3{Rnd(), Rnd(), Rnd()} * 0.05f);
+                M.Indices.push_back(FirstVert + v);
+            }
+        }
+        return M;
+    }();
+    return Mesh;
+}
+
+const TriangleMeshBVH& GetTestBVH()
+{
+    static const TriangleMeshBVH Tree{GetTestMesh().GetBVHCreateInfo()};
+    return Tree;
+}
+
+std::vector<TriangleMeshBVH::Ray> GenerateRandomRays()
+{
+    FastRandFloat Rnd{9, -1, 1};
+
+    std::vector<TriangleMeshBVH::Ray> Rays(NumRays);
+    for (TriangleMeshBVH::Ray& R : Rays)
+    {
+        R.Origin    = float3{Rnd() * 1.5f, 1.5f + Rnd() * 0.5f, Rnd() * 1.5f};
+        R.Direction = float3{Rnd() * 0.5f, -1.f, Rnd() * 0.5f};
+    }
+    return Rays;
+}
+
+// Generates coherent rays from a pinhole camera. Rays of every 4x2 pixel block are consecutive.
+std::vector<TriangleMeshBVH::Ray> GeneratePrimaryRays()
+{
+    constexpr Uint32 Width  = 64;
+    constexpr Uint32 Height = NumRays / Width;
+
+    std::vector<TriangleMeshBVH::Ray> Rays;
+    Rays.reserve(NumRays);
+    for (Uint32 by = 0; by < Height; by += 2)
+    {
+        for (Uint32 bx = 0; bx < Width; bx += 4)
+        {
+            for (Uint32 y = by; y < by + 2; ++y)
+            {
+                for (Uint32 x = bx; x < bx + 4; ++x)
+                {
+                    const float u = (static_cast<float>(x) + 0.5f) / static_cast<float>(Width) * 2.f - 1.f;
+                    const float v = (static_cast<float>(y) + 0.5f) / static_cast<float>(Height) * 2.f - 1.f;
+
+                    TriangleMeshBVH::Ray R;
+                    R.Origin    = float3{0, 1.5f, -2.5f};
+                    R.Direction = normalize(float3{u, v * 0.75f - 0.5f, 1.f});
+                    Rays.push_back(R);
+                }
+            }
+        }
+    }
+    return Rays;
+}
+
+DILIGENT_BENCHMARK(Common, BVHBuild)
+{
+    const TriangleMeshBVH::CreateInfo CI = GetTestMesh().GetBVHCreateInfo();
+
+    State.SetItemsPerIteration(CI.NumTriangles);
+    State.Run([&]() {
+        const TriangleMeshBVH Tree{CI};
+        Benchmark::DoNotOptimize(Tree.GetBVH().GetNodes().data());
+    });
+}
+
+DILIGENT_BENCHMARK(Common, BVHBuildThreadPool)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{std::max(std::thread::hardware_concurrency(), 2u) - 1});
+
+    TriangleMeshBVH::CreateInfo CI = GetTestMesh().GetBVHCreateInfo();
+    CI.pThreadPool                 = pThreadPool;
+
+    State.SetItemsPerIteration(CI.NumTriangles);
+    State.Run([&]() {
+        const TriangleMeshBVH Tree{CI};
+        Benchmark::DoNotOptimize(Tree.GetBVH().GetNodes().data());
+    });
+}
+
+void RunCastRay(Benchmark::State& State, const std::vector<TriangleMeshBVH::Ray>& Rays)
+{
+    const TriangleMeshBVH& Tree = GetTestBVH();
+
+    State.SetItemsPerIteration(Rays.size());
+    State.Run([&]() {
+        for (const TriangleMeshBVH::Ray& R : Rays)
+            Benchmark::DoNotOptimize(Tree.CastRay(R));
+    });
+}
+
+void RunCastRays(Benchmark::State& State, const std::vector<TriangleMeshBVH::Ray>& Rays)
+{
+    const TriangleMeshBVH& Tree = GetTestBVH();
+
+    std::vector<TriangleMeshBVH::Hit> Hits(Rays.size());
+    State.SetItemsPerIteration(Rays.size());
+    State.Run([&]() {
+        Tree.CastRays(Rays.data(), static_cast<Uint32>(Rays.size()), Hits.data());
+        Benchmark::DoNotOptimize(Hits.data());
+    });
+}
+
+DILIGENT_BENCHMARK(Common, BVHCastRayRandom)
+{
+    RunCastRay(State, GenerateRandomRays());
+}
+
+DILIGENT_BENCHMARK(Common, BVHCastRaysRandom)
+{
+    RunCastRays(State, GenerateRandomRays());
+}
+
+DILIGENT_BENCHMARK(Common, BVHCastRayPrimary)
+{
+    RunCastRay(State, GeneratePrimaryRays());
+}
+
+DILIGENT_BENCHMARK(Common, BVHCastRaysPrimary)
+{
+    RunCastRays(State, GeneratePrimaryRays());
+}
+
+DILIGENT_BENCHMARK(Common, BVHAnyHitRandom)
+{
+    const TriangleMeshBVH&                  Tree = GetTestBVH();
+    const std::vector<TriangleMeshBVH::Ray> Rays = GenerateRandomRays();
+
+    State.SetItemsPerIteration(Rays.size());
+    State.Run([&]() {
+        Uint32 NumOccluded = 0;
+        for (const TriangleMeshBVH::Ray& R : Rays)
+            NumOccluded += Tree.AnyHit(R) ? 1 : 0;
+        Benchmark::DoNotOptimize(NumOccluded);
+    });
+}
+
+} // namespace
@@ -0,0 +1,135 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "LRUCache.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+constexpr Uint32 NumKeys    = 1024;
+constexpr Uint32 NumLookups = 4096;
+
+// Looks up random keys that all fit into the cache, so that after the warm-up every lookup is a hit.
+template <typename CacheType>
+void RunCacheHits(Benchmark::State& State)
+{
+    CacheType Cache{NumKeys * 2};
+
+    std::vector<Uint32> Keys(NumLookups);
+    Uint32              Seed = 1;
+    for (Uint32& Key : Keys)
+    {
+        Seed = Seed * 1664525u + 1013904223u;
+        Key  = (Seed >> 8) % NumKeys;
+    }
+
+    State.SetItemsPerIteration(NumLookups);
+    State.Run([&]() {
+        for (Uint32 Key : Keys)
+        {
+            const Uint32 Value = Cache.Get(Key, [Key](Uint32& Data, size_t& Size) {
+                Data = Key;
+                Size = 1;
+            });
+            Benchmark::DoNotOptimize(Value);
+        }
+    });
+}
+
+DILIGENT_BENCHMARK(Common, LRUCacheHits)
+{
+    RunCacheHits<LRUCache<Uint32, Uint32>>(State);
+}
+
+DILIGENT_BENCHMARK(Common, ShardedLRUCacheHits)
+{
+    RunCacheHits<ShardedLRUCache<Uint32, Uint32>>(State);
+}
+
+// Looks up keys from all hardware threads. The cache holds half of the keys, so the lookups
+// are a mix of hits and misses that evict other entries.
+template <typename CacheType>
+void RunCacheContention(Benchmark::State& State)
+{
+    const Uint32 NumThreads = std::max(std::thread::hardware_concurrency(), 2u);
+
+    CacheType Cache{NumKeys / 2};
+
+    std::vector<std::vector<Uint32>> Keys(NumThreads);
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        Keys[t].resize(NumLookups);
+        Uint32 Seed = t + 1;
+        for (Uint32& Key : Keys[t])
+        {
+            Seed = Seed * 1664525u + 1013904223u;
+            // Skew the distribution towards lower keys so that most lookups are hits
+            const Uint32 r = (Seed >> 8) % NumKeys;
+            Key            = (r * r) / NumKeys;
+        }
+    }
+
+    std::vector<std::thread> Threads(NumThreads);
+    State.SetItemsPerIteration(NumLookups * NumThreads);
+    State.Run([&]() {
+        for (Uint32 t = 0; t < NumThreads; ++t)
+        {
+            Threads[t] = std::thread{
+                [&Cache, &ThreadKeys = Keys[t]]() {
+                    for (Uint32 Key : ThreadKeys)
+                    {
+                        const Uint32 Value = Cache.Get(Key, [Key](Uint32& Data, size_t& Size) {
+                            Data = Key;
+                            Size = 1;
+                        });
+                        Benchmark::DoNotOptimize(Value);
+                    }
+                }};
+        }
+        for (std::thread& Thread : Threads)
+            Thread.join();
+    });
+}
+
+DILIGENT_BENCHMARK(Common, LRUCacheContention)
+{
+    RunCacheContention<LRUCache<Uint32, Uint32>>(State);
+}
+
+DILIGENT_BENCHMARK(Common, ShardedLRUCacheContention)
+{
+    RunCacheContention<ShardedLRUCache<Uint32, Uint32>>(State);
+}
+
+} // namespace
@@ -0,0 +1,352 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "BasicMathSIMD.hpp"
+#include "AdvancedMath.hpp"
+#include "FastRand.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+constexpr Uint32 NumElements = 4096;
+
+// Generates well-conditioned affine and projective matrices
+std::vector<float4x4> GenerateMatrices()
+{
+    FastRandFloat Rnd{0, -1.f, +1.f};
+
+    std::vector<float4x4> Matrices(NumElements);
+    for (size_t i = 0; i < Matrices.size(); ++i)
+    {
+        const float3 Axis{Rnd(), Rnd(), Rnd() + 2.f};
+
+        float4x4& M = Matrices[i];
+        M           = float4x4::Scale(Rnd() + 2.f, Rnd() + 2.f, Rnd() + 2.f) *
+            float4x4::RotationArbitrary(Axis, Rnd() * PI_F) *
+            float4x4::Translation(Rnd() * 10.f, Rnd() * 10.f, Rnd() * 10.f);
+        if (i % 4 == 3)
+            M = M * float4x4::Projection(PI_F / 4.f, 1.5f, 0.5f, 100.f, false);
+    }
+    return Matrices;
+}
+
+std::vector<float3> GeneratePoints()
+{
+    FastRandFloat Rnd{1, -10.f, +10.f};
+
+    std::vector<float3> Points(NumElements);
+    for (float3& p : Points)
+        p = float3{Rnd(), Rnd(), Rnd()};
+    return Points;
+}
+
+std::vector<QuaternionF> GenerateQuaternions()
+{
+    FastRandFloat Rnd{2, -1.f, +1.f};
+
+    std::vector<QuaternionF> Quaternions(NumElements);
+    for (QuaternionF& q : Quaternions)
+        q = QuaternionF::RotationFromAxisAngle(float3{Rnd(), Rnd(), Rnd() + 2.f}, Rnd() * PI_F);
+    return Quaternions;
+}
+
+DILIGENT_BENCHMARK(Common, MultiplyMatricesScalar)
+{
+    const std::vector<float4x4> Matrices = GenerateMatrices();
+    std::vector<float4x4>       Res(NumElements);
+
+    State.SetItemsPerIteration(NumElements);
+    State.Run([&]() {
+        for (Uint32 i = 0; i < NumElements; ++i)
+            Res[i] = Matrices[i] * Matrices[0];
+        Benchmark::DoNotOptimize(Res.data());
+    });
+}
+
+DILIGENT_BENCHMARK(Common, MultiplyMatrices)
+{
+    const std::vector<float4x4> Matrices = GenerateMatrices();
+    std::vector<float4x4>       Res(NumElements);
+
+    State.SetItemsPerIteration(NumElements);
+    State.Run([&]() {
+        MultiplyMatrices(Matrices.data(), Matrices[0], Res.data(), NumElements);
+        Benchmark::DoNotOptimize(Res.data());
+    });
+}
+
+DILIGENT_BENCHMARK(Common, InvertMatricesScalar)
+{
+    const std::vector<float4x4> Matrices = GenerateMatrices();
+    std::vector<float4x4>       Res(NumElements);
+
+    State.SetItemsPerIteration(NumElements);
+    State.Run([&]() {
+        for (Uint32 i = 0; i < NumElements; ++i)
+            Res[i] = Matrices[i].Inverse();
+        Benchmark::DoNotOptimize(Res.data());
+    });
+}
+
+DILIGENT_BENCHMARK(Common, InvertMatrices)
+{
+    const std::vector<float4x4> Matrices = GenerateMatrices();
+    std::vector<float4x4>       Res(NumElements);
+
+    State.SetItemsPerIteration(NumElements);
+    State.Run([&]() {
+        InvertMatrices(Matrices.data(), Res.data(), NumElements);
+        Benchmark::DoNotOptimize(Res.data());
+    });
+}
+
+DILIGENT_BENCHMARK(Common, TransposeMatricesScalar)
+{
+    const std::vector<float4x4> Matrices = GenerateMatrices();
+    std::vector<float4x4>       Res(NumElements);
+
+    State.SetItemsPerIteration(NumElements);
+    State.Run([&]() {
+        for (Uint32 i = 0; i < NumElements; ++i)
+            Res[i] = Matrices[i].Transpose();
+        Benchmark::DoNotOptimize(Res.data());
+    });
+}
+
+DILIGENT_BENCHMARK(Common, TransposeMatrices)
+{
+    const std::vector<float4x4> Matrices = GenerateMatrices();
+    std::vector<float4x4>       Res(NumElements);
+
+    State.SetItemsPerIteration(NumElements);
+    State.Run([&]() {
+        TransposeMatrices(Matrices.data(), Res.data(), NumElements);
+        Benchmark::DoNotOptimize(Res.data());
+    });
+}
+
+DILIGENT_BENCHMARK(Common, TransformPointsScalar)
+{
+    const float4x4            Mat    = GenerateMatrices()[0];
+    const std::vector<float3> Points = GeneratePoints();
+    std::vector<float3>       Res(NumElements);
+
+    State.SetItemsPerIteration(NumElements);
+    State.Run([&]() {
+        for (Uint32 i = 0; i < NumElements; ++i)
+            Res[i] = Points[i] * Mat;
+        Benchmark::DoNotOptimize(Res.data());
+    });
+}
+
+DILIGENT_BENCHMARK(Common, TransformPoints)
+{
+    const float4x4            Mat    = GenerateMatrices()[0];
+    const std::vector<float3> Points = GeneratePoints();
+    std::vector<float3>       Res(NumElements);
+
+    State.SetItemsPerIteration(NumElements);
+    State.Run([&]() {
+        TransformPoints(Points.data(), Mat, Res.data(), NumElements);
+        Benchmark::DoNotOptimize(Res.data());
+    });
+}
+
+DILIGENT_BENCHMARK(Common, MultiplyQuaternionsScalar)
+{
+    const std::vector<QuaternionF> Quaternions = GenerateQuaternions();
+    std::vector<QuaternionF>       Res(NumElements);
+
+    State.SetItemsPerIteration(NumElements - 1);
+    State.Run([&]() {
+        for (Uint32 i = 0; i + 1 < NumElements; ++i)
+            Res[i] = Quaternions[i] * Quaternions[i + 1];
+        Benchmark::DoNotOptimize(Res.data());
+    });
+}
+
+DILIGENT_BENCHMARK(Common, MultiplyQuaternions)
+{
+    const std::vector<QuaternionF> Quaternions = GenerateQuaternions();
+    std::vector<QuaternionF>       Res(NumElements);
+
+    State.SetItemsPerIteration(NumElements - 1);
+    State.Run([&]() {
+        MultiplyQuaternions(Quaternions.data(), Quaternions.data() + 1, Res.data(), NumElements - 1);
+        Benchmark::DoNotOptimize(Res.data());
+    });
+}
+
+
+constexpr Uint32 NumBoxes = 16384;
+
+ViewFrustum GetTestFrustum()
+{
+    const float4x4 View = float4x4::RotationY(0.5f) * float4x4::RotationX(-0.25f) * float4x4::Translation(1.f, -2.f, 30.f);
+    const float4x4 Proj = float4x4::Projection(PI_F / 3.f, 1.5f, 1.f, 100.f, false);
+
+    ViewFrustum Frustum;
+    ExtractViewFrustumPlanesFromMatrix(View * Proj, Frustum, false);
+    return Frustum;
+}
+
+std::vector<BoundBox> GenerateBoxes()
+{
+    FastRandFloat RndPos{3, -100.f, 100.f};
+    FastRandFloat RndSize{4, 0.f, 10.f};
+
+    std::vector<BoundBox> Boxes(NumBoxes);
+    for (BoundBox& Box : Boxes)
+    {
+        Box.Min = float3{RndPos(), RndPos(), RndPos()};
+        Box.Max = Box.Min + float3{RndSize(), RndSize(), RndSize()};
+    }
+    return Boxes;
+}
+
+std::vector<OrientedBoundingBox> GenerateOrientedBoxes()
+{
+    FastRandFloat RndPos{5, -100.f, 100.f};
+    FastRandFloat RndSize{6, 0.f, 5.f};
+    FastRandFloat RndAngle{7, -PI_F, PI_F};
+
+    std::vector<OrientedBoundingBox> Boxes(NumBoxes);
+    for (OrientedBoundingBox& Box : Boxes)
+    {
+        const float4x4 Rotation = float4x4::RotationX(RndAngle()) * float4x4::RotationY(RndAngle());
+
+        Box.Center = float3{RndPos(), RndPos(), RndPos()};
+        for (int a = 0; a < 3; ++a)
+        {
+            Box.Axes[a]        = float3{Rotation[a][0], Rotation[a][1], Rotation[a][2]};
+            Box.HalfExtents[a] = RndSize();
+        }
+    }
+    return Boxes;
+}
+
+template <typename BoxType>
+void RunBoxVisibilityScalar(Benchmark::State& State, const std::vector<BoxType>& Boxes)
+{
+    const ViewFrustum   Frustum = GetTestFrustum();
+    std::vector<Uint32> VisibleMask((NumBoxes + 31) / 32);
+
+    State.SetItemsPerIteration(NumBoxes);
+    State.Run([&]() {
+        for (Uint32 i = 0; i < NumBoxes; ++i)
+        {
+            if (GetBoxVisibility(Frustum, Boxes[i]) != BoxVisibility::Invisible)
+                VisibleMask[i / 32] |= 1u << (i % 32);
+            else
+                VisibleMask[i / 32] &= ~(1u << (i % 32));
+        }
+        Benchmark::DoNotOptimize(VisibleMask.data());
+    });
+}
+
+DILIGENT_BENCHMARK(Common, GetBoxVisibilityScalar)
+{
+    RunBoxVisibilityScalar(State, GenerateBoxes());
+}
+
+DILIGENT_BENCHMARK(Common, GetBoxVisibilityBatch)
+{
+    const ViewFrustum           Frustum = GetTestFrustum();
+    const std::vector<BoundBox> Boxes   = GenerateBoxes();
+
+    std::vector<float> Coords[6];
+    for (const BoundBox& Box : Boxes)
+    {
+        for (size_t c = 0; c < 3; ++c)
+        {
+            Coords[c].push_back(Box.Min[c]);
+            Coords[3 + c].push_back(Box.Max[c]);
+        }
+    }
+
+    BoundBoxSoA SoA;
+    SoA.MinX = Coords[0].data();
+    SoA.MinY = Coords[1].data();
+    SoA.MinZ = Coords[2].data();
+    SoA.MaxX = Coords[3].data();
+    SoA.MaxY = Coords[4].data();
+    SoA.MaxZ = Coords[5].data();
+
+    std::vector<Uint32> VisibleMask((NumBoxes + 31) / 32);
+    State.SetItemsPerIteration(NumBoxes);
+    State.Run([&]() {
+        Benchmark::DoNotOptimize(GetBoxVisibilityBatch(Frustum, SoA, NumBoxes, VisibleMask.data()));
+    });
+}
+
+DILIGENT_BENCHMARK(Common, GetOrientedBoxVisibilityScalar)
+{
+    RunBoxVisibilityScalar(State, GenerateOrientedBoxes());
+}
+
+DILIGENT_BENCHMARK(Common, GetOrientedBoxVisibilityBatch)
+{
+    const ViewFrustum                      Frustum = GetTestFrustum();
+    const std::vector<OrientedBoundingBox> Boxes   = GenerateOrientedBoxes();
+
+    std::vector<float> Center[3];
+    std::vector<float> Axes[3][3];
+    std::vector<float> HalfExtents[3];
+    for (const OrientedBoundingBox& Box : Boxes)
+    {
+        for (size_t c = 0; c < 3; ++c)
+        {
+            Center[c].push_back(Box.Center[c]);
+            HalfExtents[c].push_back(Box.HalfExtents[c]);
+            for (size_t a = 0; a < 3; ++a)
+                Axes[a][c].push_back(Box.Axes[a][c]);
+        }
+    }
+
+    OrientedBoundingBoxSoA SoA;
+    SoA.CenterX = Center[0].data();
+    SoA.CenterY = Center[1].data();
+    SoA.CenterZ = Center[2].data();
+    for (size_t a = 0; a < 3; ++a)
+    {
+        for (size_t c = 0; c < 3; ++c)
+            SoA.Axes[a][c] = Axes[a][c].data();
+        SoA.HalfExtents[a] = HalfExtents[a].data();
+    }
+
+    std::vector<Uint32> VisibleMask((NumBoxes + 31) / 32);
+    State.SetItemsPerIteration(NumBoxes);
+    State.Run([&]() {
+        Benchmark::DoNotOptimize(GetBoxVisibilityBatch(Frustum, SoA, NumBoxes, VisibleMask.data()));
+    });
+}
+
+} // namespace
@@ -0,0 +1,170 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "ThreadPool.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+RefCntAutoPtr<IThreadPool> CreateBenchmarkThreadPool()
+{
+    return CreateThreadPool(ThreadPoolCreateInfo{std::max(std::thread::hardware_concurrency(), 2u) - 1});
+}
+
+constexpr Uint32 NumParallelForItems = 65536;
+
+void RunParallelFor(Benchmark::State& State, IThreadPool* pThreadPool)
+{
+    std::vector<float> Data(NumParallelForItems, 1.f);
+    State.SetItemsPerIteration(NumParallelForItems);
+    State.Run([&]() {
+        ParallelFor(
+            pThreadPool, 0, NumParallelForItems,
+            [&Data](Uint32 i) {
+                Data[i] = Data[i] * 0.5f + 1.f;
+            },
+            256);
+        Benchmark::DoNotOptimize(Data.data());
+    });
+}
+
+DILIGENT_BENCHMARK(Common, ParallelForSerial)
+{
+    RunParallelFor(State, nullptr);
+}
+
+DILIGENT_BENCHMARK(Common, ParallelFor)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateBenchmarkThreadPool();
+    RunParallelFor(State, pThreadPool);
+}
+
+DILIGENT_BENCHMARK(Common, TaskGroup)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateBenchmarkThreadPool();
+
+    constexpr Uint32 NumTasks = 256;
+    State.SetItemsPerIteration(NumTasks);
+    State.Run([&]() {
+        std::atomic<Uint32> Counter{0};
+
+        TaskGroup Group{pThreadPool};
+        for (Uint32 i = 0; i < NumTasks; ++i)
+        {
+            Group.Run([&Counter]() {
+                Counter.fetch_add(1, std::memory_order_relaxed);
+            });
+        }
+        Group.Wait();
+        Benchmark::DoNotOptimize(Counter);
+    });
+}
+
+DILIGENT_BENCHMARK(Common, EnqueueAsyncWork)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateBenchmarkThreadPool();
+
+    constexpr Uint32 NumTasks = 256;
+    State.SetItemsPerIteration(NumTasks);
+    State.Run([&]() {
+        for (Uint32 i = 0; i < NumTasks; ++i)
+        {
+            EnqueueAsyncWork(pThreadPool, [](Uint32) {
+                return ASYNC_TASK_STATUS_COMPLETE;
+            });
+        }
+        pThreadPool->WaitForAllTasks();
+    });
+}
+
+// Enqueues many small tasks from multiple producer threads and from the worker threads themselves.
+void RunSchedulerContention(Benchmark::State& State, THREAD_POOL_SCHEDULER Scheduler)
+{
+    const Uint32 NumCores     = std::max(std::thread::hardware_concurrency(), 2u);
+    const Uint32 NumThreads   = std::min(NumCores, 16u);
+    const Uint32 NumProducers = std::max(NumThreads / 2u, 1u);
+
+    constexpr Uint32 NumTasksPerProducer = 1024;
+    constexpr Uint32 NumChildTasks       = 2;
+
+    ThreadPoolCreateInfo PoolCI{NumThreads};
+    PoolCI.Scheduler = Scheduler;
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(PoolCI);
+
+    auto Work = [](Uint32 ThreadId) {
+        float f = 0.5;
+        for (size_t k = 0; k < 64; ++k)
+            f = std::sin(f + 1.f);
+        Benchmark::DoNotOptimize(f);
+        return ASYNC_TASK_STATUS_COMPLETE;
+    };
+
+    std::vector<std::thread> Producers(NumProducers);
+    State.SetItemsPerIteration(NumProducers * NumTasksPerProducer * (1 + NumChildTasks));
+    State.Run([&]() {
+        for (std::thread& Producer : Producers)
+        {
+            Producer = std::thread{
+                [&]() {
+                    for (Uint32 i = 0; i < NumTasksPerProducer; ++i)
+                    {
+                        EnqueueAsyncWork(pThreadPool,
+                                         [&, i](Uint32 ThreadId) {
+                                             for (Uint32 c = 0; c < NumChildTasks; ++c)
+                                                 EnqueueAsyncWork(pThreadPool, Work, static_cast<float>(i % 4));
+                                             return Work(ThreadId);
+                                         });
+                    }
+                }};
+        }
+        for (std::thread& Producer : Producers)
+            Producer.join();
+
+        pThreadPool->WaitForAllTasks();
+    });
+}
+
+DILIGENT_BENCHMARK(Common, ThreadPoolContention)
+{
+    RunSchedulerContention(State, THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
+
+DILIGENT_BENCHMARK(Common, ThreadPoolContentionWorkStealing)
+{
+    RunSchedulerContention(State, THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+} // namespace
@@ -0,0 +1,160 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "VariableSizeAllocationsManager.hpp"
+#include "TLSFAllocationsManager.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "FastRand.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+// Allocates a batch of blocks of random sizes and alignments, and releases them in a random order,
+// which is the typical pattern of transient allocations in ring and suballocated buffers.
+template <typename ManagerType>
+void RunAllocationsManager(Benchmark::State& State)
+{
+    using OffsetType = typename ManagerType::OffsetType;
+
+    constexpr OffsetType MaxSize   = OffsetType{1} << 24;
+    constexpr Uint32     NumAllocs = 1024;
+
+    ManagerType Mgr{typename ManagerType::CreateInfo{DefaultRawMemoryAllocator::GetAllocator(), MaxSize, /*DbgDisableDebugValidation = */ true}};
+
+    FastRand Rnd{0};
+
+    struct AllocRequest
+    {
+        OffsetType Size;
+        OffsetType Alignment;
+    };
+    std::vector<AllocRequest> Requests(NumAllocs);
+    for (AllocRequest& Req : Requests)
+    {
+        // Mix small and large sizes to produce fragmentation
+        Req.Size      = (Rnd() & 3) != 0 ? 1 + Rnd() % 256 : 1 + (OffsetType{Rnd()} * 8) % 4096;
+        Req.Alignment = OffsetType{1} << (Rnd() % 9);
+    }
+
+    std::vector<Uint32> FreeOrder(NumAllocs);
+    for (Uint32 i = 0; i < NumAllocs; ++i)
+        FreeOrder[i] = i;
+    for (Uint32 i = NumAllocs - 1; i > 0; --i)
+        std::swap(FreeOrder[i], FreeOrder[Rnd() % (i + 1)]);
+
+    std::vector<typename ManagerType::Allocation> Allocs(NumAllocs);
+
+    State.SetItemsPerIteration(NumAllocs);
+    State.Run([&]() {
+        for (Uint32 i = 0; i < NumAllocs; ++i)
+            Allocs[i] = Mgr.Allocate(Requests[i].Size, Requests[i].Alignment);
+        for (Uint32 i : FreeOrder)
+        {
+            if (Allocs[i].IsValid())
+                Mgr.Free(std::move(Allocs[i]));
+        }
+    });
+}
+
+DILIGENT_BENCHMARK(GraphicsAccessories, VariableSizeAllocationsManager)
+{
+    RunAllocationsManager<VariableSizeAllocationsManager>(State);
+}
+
+DILIGENT_BENCHMARK(GraphicsAccessories, TLSFAllocationsManager)
+{
+    RunAllocationsManager<TLSFAllocationsManager>(State);
+}
+
+// Randomly allocates and releases blocks while keeping up to MaxLiveAllocs blocks alive,
+// which measures the steady state of a long-lived fragmented heap.
+template <typename ManagerType>
+void RunAllocationsManagerChurn(Benchmark::State& State)
+{
+    using OffsetType = typename ManagerType::OffsetType;
+
+    constexpr OffsetType MaxSize       = OffsetType{1} << 21;
+    constexpr size_t     MaxLiveAllocs = 4096;
+    constexpr Uint32     NumOps        = 1024;
+
+    ManagerType Mgr{typename ManagerType::CreateInfo{DefaultRawMemoryAllocator::GetAllocator(), MaxSize, /*DbgDisableDebugValidation = */ true}};
+
+    std::vector<typename ManagerType::Allocation> LiveAllocs;
+    LiveAllocs.reserve(MaxLiveAllocs);
+
+    FastRand Rnd{0};
+
+    auto RunOp = [&]() {
+        const bool DoAllocate = LiveAllocs.size() < MaxLiveAllocs / 2 || (LiveAllocs.size() < MaxLiveAllocs && (Rnd() & 1) != 0);
+        if (DoAllocate)
+        {
+            // Mix small and large sizes to produce fragmentation
+            const OffsetType Size      = (Rnd() & 3) != 0 ? 1 + Rnd() % 256 : 1 + (OffsetType{Rnd()} * 8) % 4096;
+            const OffsetType Alignment = OffsetType{1} << (Rnd() % 9);
+
+            auto Alloc = Mgr.Allocate(Size, Alignment);
+            if (Alloc.IsValid())
+                LiveAllocs.emplace_back(std::move(Alloc));
+        }
+        else
+        {
+            const size_t Idx = Rnd() % LiveAllocs.size();
+            Mgr.Free(std::move(LiveAllocs[Idx]));
+            LiveAllocs[Idx] = std::move(LiveAllocs.back());
+            LiveAllocs.pop_back();
+        }
+    };
+
+    // Fragment the heap before measuring
+    for (size_t i = 0; i < MaxLiveAllocs * 4; ++i)
+        RunOp();
+
+    State.SetItemsPerIteration(NumOps);
+    State.Run([&]() {
+        for (Uint32 i = 0; i < NumOps; ++i)
+            RunOp();
+    });
+
+    for (auto& Alloc : LiveAllocs)
+        Mgr.Free(std::move(Alloc));
+}
+
+DILIGENT_BENCHMARK(GraphicsAccessories, VariableSizeAllocationsManagerChurn)
+{
+    RunAllocationsManagerChurn<VariableSizeAllocationsManager>(State);
+}
+
+DILIGENT_BENCHMARK(GraphicsAccessories, TLSFAllocationsManagerChurn)
+{
+    RunAllocationsManagerChurn<TLSFAllocationsManager>(State);
+}
+
+} // namespace
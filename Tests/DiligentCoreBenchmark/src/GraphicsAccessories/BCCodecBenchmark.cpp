@@ -0,0 +1,172 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "BCCodec.hpp"
+#include "GraphicsAccessories.hpp"
+#include "FastRand.hpp"
+#include "ThreadPool.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+constexpr Uint32 TextureSize = 256;
+
+// Generates a smooth image with some noise, which is closer to real textures than white noise
+std::vector<Uint8> GenerateImage()
+{
+    std::vector<Uint8> Pixels(size_t{TextureSize} * TextureSize * 4);
+
+    FastRandInt Rnd{0, -16, 16};
+    for (Uint32 y = 0; y < TextureSize; ++y)
+    {
+        for (Uint32 x = 0; x < TextureSize; ++x)
+        {
+            Uint8* pPixel = &Pixels[(size_t{y} * TextureSize + x) * 4];
+            for (Uint32 c = 0; c < 4; ++c)
+            {
+                const int Value = static_cast<int>((x * (c + 1) + y * (4 - c)) & 0xFF) + Rnd();
+                pPixel[c]       = static_cast<Uint8>(std::max(std::min(Value, 255), 0));
+            }
+        }
+    }
+    return Pixels;
+}
+
+size_t GetUncompressedStride(TEXTURE_FORMAT BCFormat)
+{
+    return size_t{TextureSize} * GetTextureFormatAttribs(BCFormatToUncompressed(BCFormat)).GetElementSize();
+}
+
+size_t GetBlockStride(TEXTURE_FORMAT BCFormat)
+{
+    return size_t{TextureSize / 4} * GetTextureFormatAttribs(BCFormat).ComponentSize;
+}
+
+const char* GetQualityName(BC_COMPRESSION_QUALITY Quality)
+{
+    switch (Quality)
+    {
+        case BC_COMPRESSION_QUALITY_FAST: return "Fast";
+        case BC_COMPRESSION_QUALITY_NORMAL: return "Normal";
+        case BC_COMPRESSION_QUALITY_HIGH: return "High";
+        default: return "Unknown";
+    }
+}
+
+const bool BCCodecBenchmarksRegistered = []() {
+    for (TEXTURE_FORMAT Fmt : {TEX_FORMAT_BC1_UNORM, TEX_FORMAT_BC3_UNORM, TEX_FORMAT_BC4_UNORM, TEX_FORMAT_BC5_UNORM, TEX_FORMAT_BC7_UNORM})
+    {
+        const std::string FmtName = GetTextureFormatAttribs(Fmt).Name + sizeof("TEX_FORMAT_") - 1;
+        for (BC_COMPRESSION_QUALITY Quality : {BC_COMPRESSION_QUALITY_FAST, BC_COMPRESSION_QUALITY_NORMAL, BC_COMPRESSION_QUALITY_HIGH})
+        {
+            for (bool UseThreadPool : {false, true})
+            {
+                if (UseThreadPool && Quality != BC_COMPRESSION_QUALITY_NORMAL)
+                    continue;
+
+                std::string Name = "GraphicsAccessories.EncodeBC/" + FmtName + "/" + GetQualityName(Quality);
+                if (UseThreadPool)
+                    Name += "/ThreadPool";
+
+                Benchmark::RegisterBenchmark(std::move(Name), [Fmt, Quality, UseThreadPool](Benchmark::State& State) {
+                    RefCntAutoPtr<IThreadPool> pThreadPool;
+                    if (UseThreadPool)
+                        pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{std::max(std::thread::hardware_concurrency(), 2u) - 1});
+
+                    const std::vector<Uint8> Pixels = GenerateImage();
+
+                    const size_t       SrcStride = GetUncompressedStride(Fmt);
+                    const size_t       DstStride = GetBlockStride(Fmt);
+                    std::vector<Uint8> Blocks(DstStride * (TextureSize / 4));
+
+                    BCEncodeAttribs Attribs;
+                    Attribs.Format      = Fmt;
+                    Attribs.Width       = TextureSize;
+                    Attribs.Height      = TextureSize;
+                    Attribs.pSrcData    = Pixels.data();
+                    Attribs.SrcStride   = SrcStride;
+                    Attribs.pDstData    = Blocks.data();
+                    Attribs.DstStride   = DstStride;
+                    Attribs.Quality     = Quality;
+                    Attribs.pThreadPool = pThreadPool;
+
+                    State.SetItemsPerIteration(TextureSize * TextureSize);
+                    State.Run([&]() {
+                        EncodeBC(Attribs);
+                        Benchmark::DoNotOptimize(Blocks.data());
+                    });
+                });
+            }
+        }
+
+        Benchmark::RegisterBenchmark("GraphicsAccessories.DecodeBC/" + FmtName, [Fmt](Benchmark::State& State) {
+            const std::vector<Uint8> Pixels = GenerateImage();
+
+            const size_t       Stride      = GetUncompressedStride(Fmt);
+            const size_t       BlockStride = GetBlockStride(Fmt);
+            std::vector<Uint8> Blocks(BlockStride * (TextureSize / 4));
+
+            BCEncodeAttribs EncodeAttribs;
+            EncodeAttribs.Format    = Fmt;
+            EncodeAttribs.Width     = TextureSize;
+            EncodeAttribs.Height    = TextureSize;
+            EncodeAttribs.pSrcData  = Pixels.data();
+            EncodeAttribs.SrcStride = Stride;
+            EncodeAttribs.pDstData  = Blocks.data();
+            EncodeAttribs.DstStride = BlockStride;
+            EncodeAttribs.Quality   = BC_COMPRESSION_QUALITY_FAST;
+            EncodeBC(EncodeAttribs);
+
+            std::vector<Uint8> Decoded(Stride * TextureSize);
+
+            BCDecodeAttribs Attribs;
+            Attribs.Format    = Fmt;
+            Attribs.Width     = TextureSize;
+            Attribs.Height    = TextureSize;
+            Attribs.pSrcData  = Blocks.data();
+            Attribs.SrcStride = BlockStride;
+            Attribs.pDstData  = Decoded.data();
+            Attribs.DstStride = Stride;
+
+            State.SetItemsPerIteration(TextureSize * TextureSize);
+            State.Run([&]() {
+                DecodeBC(Attribs);
+                Benchmark::DoNotOptimize(Decoded.data());
+            });
+        });
+    }
+    return true;
+}();
+
+} // namespace
@@ -0,0 +1,162 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "DynamicAtlasManager.hpp"
+#include "FastRand.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+constexpr Uint32 AtlasSize = 1024;
+
+struct SizeDistribution
+{
+    const char* Name;
+    int         MinWidth;
+    int         MaxWidth;
+    int         MinHeight;
+    int         MaxHeight;
+};
+
+constexpr SizeDistribution Distributions[] = {
+    {"Glyphs", 2, 24, 8, 32},
+    {"Sprites", 8, 96, 8, 96},
+};
+
+// Fills the empty atlas until the first allocation fails
+void RunFill(Benchmark::State& State, DynamicAtlasManager::PackingMode Mode, const SizeDistribution& Dist)
+{
+    // Pre-generate the sizes so that every iteration allocates the same sequence
+    std::vector<std::pair<Uint32, Uint32>> Sizes;
+    {
+        FastRandInt RndW{0, Dist.MinWidth, Dist.MaxWidth};
+        FastRandInt RndH{1, Dist.MinHeight, Dist.MaxHeight};
+        for (Uint32 Area = 0; Area < AtlasSize * AtlasSize * 2;)
+        {
+            Sizes.emplace_back(static_cast<Uint32>(RndW()), static_cast<Uint32>(RndH()));
+            Area += Sizes.back().first * Sizes.back().second;
+        }
+    }
+
+    std::vector<DynamicAtlasManager::Region> Regions;
+    Regions.reserve(Sizes.size());
+
+    Uint64 NumAllocations = 0;
+    State.Run([&]() {
+        DynamicAtlasManager Mgr{AtlasSize, AtlasSize, Mode};
+        for (const auto& Size : Sizes)
+        {
+            DynamicAtlasManager::Region R = Mgr.Allocate(Size.first, Size.second);
+            if (R.IsEmpty())
+                break;
+            Regions.push_back(R);
+        }
+        NumAllocations = Regions.size();
+
+        for (DynamicAtlasManager::Region& R : Regions)
+            Mgr.Free(std::move(R));
+        Regions.clear();
+    });
+    State.SetItemsPerIteration(NumAllocations);
+}
+
+// Keeps the atlas full: every iteration releases a random half of the regions and refills the atlas
+void RunChurn(Benchmark::State& State, DynamicAtlasManager::PackingMode Mode, const SizeDistribution& Dist)
+{
+    DynamicAtlasManager Mgr{AtlasSize, AtlasSize, Mode};
+
+    FastRandInt RndW{0, Dist.MinWidth, Dist.MaxWidth};
+    FastRandInt RndH{1, Dist.MinHeight, Dist.MaxHeight};
+    FastRandInt Rnd{2, 0, 1};
+
+    std::vector<DynamicAtlasManager::Region> Regions;
+
+    auto Refill = [&]() {
+        Uint32 NumAllocated = 0;
+        while (true)
+        {
+            DynamicAtlasManager::Region R = Mgr.Allocate(static_cast<Uint32>(RndW()), static_cast<Uint32>(RndH()));
+            if (R.IsEmpty())
+                break;
+            Regions.push_back(R);
+            ++NumAllocated;
+        }
+        return NumAllocated;
+    };
+    Refill();
+
+    Uint64 NumAllocations = 0;
+    Uint64 NumIterations  = 0;
+    State.Run([&]() {
+        for (size_t r = 0; r < Regions.size();)
+        {
+            if (Rnd() == 0)
+            {
+                Mgr.Free(std::move(Regions[r]));
+                Regions[r] = Regions.back();
+                Regions.pop_back();
+            }
+            else
+            {
+                ++r;
+            }
+        }
+        NumAllocations += Refill();
+        ++NumIterations;
+    });
+    State.SetItemsPerIteration(NumAllocations / std::max(NumIterations, Uint64{1}));
+
+    for (DynamicAtlasManager::Region& R : Regions)
+        Mgr.Free(std::move(R));
+}
+
+const bool DynamicAtlasManagerBenchmarksRegistered = []() {
+    for (const SizeDistribution& Dist : Distributions)
+    {
+        for (DynamicAtlasManager::PackingMode Mode : {DynamicAtlasManager::PackingMode::Guillotine, DynamicAtlasManager::PackingMode::Skyline})
+        {
+            const std::string Name = std::string{"GraphicsAccessories.DynamicAtlasManager/"} +
+                (Mode == DynamicAtlasManager::PackingMode::Skyline ? "Skyline/" : "Guillotine/") + Dist.Name;
+
+            Benchmark::RegisterBenchmark(Name + "/Fill", [Mode, &Dist](Benchmark::State& State) {
+                RunFill(State, Mode, Dist);
+            });
+            Benchmark::RegisterBenchmark(Name + "/Churn", [Mode, &Dist](Benchmark::State& State) {
+                RunChurn(State, Mode, Dist);
+            });
+        }
+    }
+    return true;
+}();
+
+} // namespace
@@ -0,0 +1,121 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "../../../../Graphics/GraphicsEngine/include/DeviceObjectArchive.hpp"
+#include "../../../../Graphics/GraphicsEngine/include/EngineMemory.h"
+
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+using ResourceType = DeviceObjectArchive::ResourceType;
+using DeviceType   = DeviceObjectArchive::DeviceType;
+
+constexpr Uint32 NumPSOs    = 10000;
+constexpr Uint32 NumShaders = 20000;
+constexpr Uint32 NumLookups = 100;
+
+SerializedData MakeData(Uint32 Value, size_t Size)
+{
+    SerializedData Data{Size, GetRawAllocator()};
+    Uint8*         pData = Data.Ptr<Uint8>();
+    for (size_t i = 0; i < Size; ++i)
+        pData[i] = static_cast<Uint8>(Value + i * 7);
+    return Data;
+}
+
+std::string GetPSOName(Uint32 Idx)
+{
+    return "PSO " + std::to_string(Idx);
+}
+
+// Serializes an archive with NumPSOs pipelines and NumShaders shaders for two devices
+RefCntAutoPtr<IDataBlob> CreateArchiveData()
+{
+    DeviceObjectArchive Archive;
+    for (Uint32 i = 0; i < NumPSOs; ++i)
+    {
+        const ResourceType Type = (i % 3 == 0) ? ResourceType::ComputePipeline : ResourceType::GraphicsPipeline;
+
+        DeviceObjectArchive::ResourceData& ResData = Archive.GetResourceData(Type, GetPSOName(i).c_str());
+
+        ResData.Common = MakeData(i, 64 + i % 16);
+
+        ResData.DeviceSpecific[static_cast<size_t>(DeviceType::Vulkan)]     = MakeData(i + 1, 8);
+        ResData.DeviceSpecific[static_cast<size_t>(DeviceType::Direct3D12)] = MakeData(i + 2, 12);
+    }
+
+    for (Uint32 i = 0; i < NumShaders; ++i)
+    {
+        Archive.GetDeviceShaders(DeviceType::Vulkan).emplace_back(MakeData(i, 256 + i % 32));
+        Archive.GetDeviceShaders(DeviceType::Direct3D12).emplace_back(MakeData(i + 3, 128 + i % 16));
+    }
+
+    RefCntAutoPtr<IDataBlob> pData;
+    Archive.Serialize(&pData);
+    return pData;
+}
+
+// Loads the archive and accesses a few pipelines, which is what an application does at startup
+DILIGENT_BENCHMARK(GraphicsEngine, DeviceObjectArchiveLoad)
+{
+    RefCntAutoPtr<IDataBlob> pData = CreateArchiveData();
+
+    std::vector<std::string> Names;
+    for (Uint32 i = 0; i < NumLookups; ++i)
+    {
+        const Uint32 Idx = (i * 7919) % NumPSOs;
+        if (Idx % 3 != 0)
+            Names.emplace_back(GetPSOName(Idx));
+    }
+
+    State.SetBytesPerIteration(pData->GetSize());
+    State.Run([&]() {
+        DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pData}};
+        for (const std::string& Name : Names)
+            Benchmark::DoNotOptimize(Archive.GetDeviceSpecificData(ResourceType::GraphicsPipeline, Name.c_str(), DeviceType::Vulkan).Ptr());
+    });
+}
+
+// Loads the archive and decodes all resources
+DILIGENT_BENCHMARK(GraphicsEngine, DeviceObjectArchiveLoadAll)
+{
+    RefCntAutoPtr<IDataBlob> pData = CreateArchiveData();
+
+    State.SetBytesPerIteration(pData->GetSize());
+    State.Run([&]() {
+        DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pData}};
+        Benchmark::DoNotOptimize(Archive.GetNamedResources().size());
+    });
+}
+
+} // namespace
@@ -0,0 +1,132 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "../../../../Graphics/GraphicsEngine/include/ResourceNameIndex.hpp"
+#include "../../../../Graphics/GraphicsEngine/include/PipelineResourceSignatureBase.hpp"
+
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+constexpr Uint32 NumResources = 1000;
+
+constexpr SHADER_TYPE PSOStages[] = {SHADER_TYPE_VERTEX, SHADER_TYPE_PIXEL};
+
+// Resources of a large bindless-style signature
+class SignatureResources
+{
+public:
+    SignatureResources()
+    {
+        m_Names.reserve(NumResources);
+        for (Uint32 i = 0; i < NumResources; ++i)
+        {
+            const SHADER_TYPE Stages = (i % 4 == 0) ? SHADER_TYPE_VERTEX : ((i % 4 == 1) ? SHADER_TYPE_PIXEL : SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL);
+            m_Names.emplace_back("g_Resource" + std::to_string(i));
+            m_Resources.emplace_back(Stages, m_Names.back().c_str(), 1u, SHADER_RESOURCE_TYPE_TEXTURE_SRV);
+        }
+    }
+
+    const PipelineResourceDesc* GetData() const { return m_Resources.data(); }
+    Uint32                      GetCount() const { return static_cast<Uint32>(m_Resources.size()); }
+
+    const std::vector<PipelineResourceDesc>& GetResources() const { return m_Resources; }
+
+private:
+    std::vector<std::string>          m_Names;
+    std::vector<PipelineResourceDesc> m_Resources;
+};
+
+// Emulates resource lookups performed by PSO initialization: every shader resource
+// of every stage is looked up in the signature.
+template <typename FindType>
+void RunPSOResourceLookup(Benchmark::State& State, const SignatureResources& Res, FindType&& Find)
+{
+    Uint32 NumLookups = 0;
+    for (SHADER_TYPE Stage : PSOStages)
+    {
+        for (const PipelineResourceDesc& ResDesc : Res.GetResources())
+            NumLookups += (ResDesc.ShaderStages & Stage) != 0 ? 1 : 0;
+    }
+
+    State.SetItemsPerIteration(NumLookups);
+    State.Run([&]() {
+        Uint32 NumFound = 0;
+        for (SHADER_TYPE Stage : PSOStages)
+        {
+            for (const PipelineResourceDesc& ResDesc : Res.GetResources())
+            {
+                if ((ResDesc.ShaderStages & Stage) != 0)
+                    NumFound += Find(Stage, ResDesc.Name) != ResourceNameIndex::InvalidIndex ? 1 : 0;
+            }
+        }
+        Benchmark::DoNotOptimize(NumFound);
+    });
+}
+
+DILIGENT_BENCHMARK(GraphicsEngine, ResourceNameIndexBuild)
+{
+    const SignatureResources Res;
+
+    std::vector<ResourceNameIndex::Entry> Table(ResourceNameIndex::GetTableSize(Res.GetCount()));
+
+    State.SetItemsPerIteration(Res.GetCount());
+    State.Run([&]() {
+        ResourceNameIndex Index;
+        Index.Initialize(Table.data(), Table.size(), Res.GetData(), Res.GetCount());
+        Benchmark::DoNotOptimize(Table.data());
+    });
+}
+
+DILIGENT_BENCHMARK(GraphicsEngine, ResourceNameIndexLookup)
+{
+    const SignatureResources Res;
+
+    std::vector<ResourceNameIndex::Entry> Table(ResourceNameIndex::GetTableSize(Res.GetCount()));
+    ResourceNameIndex                     Index;
+    Index.Initialize(Table.data(), Table.size(), Res.GetData(), Res.GetCount());
+
+    RunPSOResourceLookup(State, Res, [&](SHADER_TYPE Stage, const char* Name) {
+        return Index.Find(Res.GetData(), Res.GetCount(), Stage, Name);
+    });
+}
+
+DILIGENT_BENCHMARK(GraphicsEngine, ResourceNameLinearLookup)
+{
+    const SignatureResources Res;
+
+    RunPSOResourceLookup(State, Res, [&](SHADER_TYPE Stage, const char* Name) {
+        return FindResource(Res.GetData(), Res.GetCount(), Stage, Name);
+    });
+}
+
+} // namespace
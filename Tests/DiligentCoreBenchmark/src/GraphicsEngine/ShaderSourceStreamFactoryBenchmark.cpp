@@ -0,0 +1,129 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "DefaultShaderSourceStreamFactory.h"
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+#include "RefCntAutoPtr.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+constexpr Uint32 NumSearchDirs = 4;
+constexpr Uint32 NumHeaders    = 40;
+
+// Creates the headers in the last of the search directories, so that every uncached
+// request probes all directories, and deletes them when the benchmark is done.
+class ShaderSourceDirectory
+{
+public:
+    ShaderSourceDirectory() :
+        m_Root{"DiligentShaderSourceBenchmark"}
+    {
+        FileSystem::CreateDirectory(m_Root.c_str());
+        for (Uint32 i = 0; i < NumSearchDirs; ++i)
+        {
+            const std::string Dir = m_Root + FileSystem::SlashSymbol + "Dir" + std::to_string(i);
+            FileSystem::CreateDirectory(Dir.c_str());
+            if (!m_SearchDirectories.empty())
+                m_SearchDirectories.push_back(';');
+            m_SearchDirectories += Dir;
+        }
+
+        const std::string HeaderDir = m_Root + FileSystem::SlashSymbol + "Dir" + std::to_string(NumSearchDirs - 1) + FileSystem::SlashSymbol;
+        const std::string Source(4096, '/');
+        for (Uint32 i = 0; i < NumHeaders; ++i)
+        {
+            m_HeaderNames.emplace_back("Header" + std::to_string(i) + ".fxh");
+            const std::string Path = HeaderDir + m_HeaderNames.back();
+            FileWrapper::WriteFile(Path.c_str(), Source.data(), Source.size());
+        }
+    }
+
+    ~ShaderSourceDirectory()
+    {
+        FileSystem::DeleteDirectory(m_Root.c_str());
+    }
+
+    const std::string&              GetSearchDirectories() const { return m_SearchDirectories; }
+    const std::vector<std::string>& GetHeaderNames() const { return m_HeaderNames; }
+
+private:
+    const std::string        m_Root;
+    std::string              m_SearchDirectories;
+    std::vector<std::string> m_HeaderNames;
+};
+
+// Reads all headers, which is what a shader permutation that includes them does.
+void RunReadHeaders(Benchmark::State& State, SHADER_SOURCE_FILE_CACHE_MODE CacheMode)
+{
+    ShaderSourceDirectory Dir;
+
+    DefaultShaderSourceStreamFactoryCreateInfo CreateInfo;
+    CreateInfo.SearchDirectories = Dir.GetSearchDirectories().c_str();
+    CreateInfo.CacheMode         = CacheMode;
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pFactory;
+    CreateDefaultShaderSourceStreamFactory2(CreateInfo, &pFactory);
+
+    std::vector<Uint8> Data;
+    State.SetItemsPerIteration(NumHeaders);
+    State.Run([&]() {
+        for (const std::string& Name : Dir.GetHeaderNames())
+        {
+            RefCntAutoPtr<IFileStream> pStream;
+            pFactory->CreateInputStream(Name.c_str(), &pStream);
+            Data.resize(pStream->GetSize());
+            pStream->Read(Data.data(), Data.size());
+            Benchmark::DoNotOptimize(Data.data());
+        }
+    });
+
+    InvalidateShaderSourceFileCache(nullptr);
+}
+
+DILIGENT_BENCHMARK(GraphicsEngine, ShaderSourceNoCache)
+{
+    RunReadHeaders(State, SHADER_SOURCE_FILE_CACHE_MODE_NONE);
+}
+
+DILIGENT_BENCHMARK(GraphicsEngine, ShaderSourceCacheExplicit)
+{
+    RunReadHeaders(State, SHADER_SOURCE_FILE_CACHE_MODE_EXPLICIT);
+}
+
+DILIGENT_BENCHMARK(GraphicsEngine, ShaderSourceCacheModificationTime)
+{
+    RunReadHeaders(State, SHADER_SOURCE_FILE_CACHE_MODE_MODIFICATION_TIME);
+}
+
+} // namespace
@@ -0,0 +1,83 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "BytecodeCache.h"
+#include "DataBlobImpl.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+constexpr size_t NumShaders   = 4096;
+constexpr size_t BytecodeSize = 32 << 10;
+
+// Loads the cache data and queries every 16th shader, which models the startup working set
+DILIGENT_BENCHMARK(GraphicsTools, BytecodeCacheLoad)
+{
+    std::vector<std::string>      Names(NumShaders);
+    std::vector<ShaderCreateInfo> ShaderCIs(NumShaders);
+    for (size_t i = 0; i < NumShaders; ++i)
+    {
+        Names[i]                     = "Shader" + std::to_string(i);
+        ShaderCIs[i].Desc.ShaderType = SHADER_TYPE_PIXEL;
+        ShaderCIs[i].Desc.Name       = Names[i].c_str();
+        ShaderCIs[i].Source          = Names[i].c_str();
+    }
+
+    RefCntAutoPtr<IDataBlob> pData;
+    {
+        RefCntAutoPtr<IBytecodeCache> pCache;
+        CreateBytecodeCache({RENDER_DEVICE_TYPE_VULKAN}, &pCache);
+        for (size_t i = 0; i < NumShaders; ++i)
+        {
+            RefCntAutoPtr<DataBlobImpl> pBytecode = DataBlobImpl::Create(BytecodeSize);
+            memset(pBytecode->GetDataPtr(), static_cast<int>(i & 0xFF), BytecodeSize);
+            pCache->AddBytecode(ShaderCIs[i], pBytecode);
+        }
+        pCache->Store(&pData);
+    }
+
+    State.SetBytesPerIteration(pData->GetSize());
+    State.Run([&]() {
+        RefCntAutoPtr<IBytecodeCache> pCache;
+        CreateBytecodeCache({RENDER_DEVICE_TYPE_VULKAN}, &pCache);
+        pCache->Load(pData);
+        for (size_t i = 0; i < NumShaders; i += 16)
+        {
+            RefCntAutoPtr<IDataBlob> pBytecode;
+            pCache->GetBytecode(ShaderCIs[i], &pBytecode);
+            Benchmark::DoNotOptimize(pBytecode.RawPtr());
+        }
+    });
+}
+
+} // namespace
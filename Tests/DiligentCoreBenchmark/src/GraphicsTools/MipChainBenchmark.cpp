@@ -0,0 +1,105 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "GraphicsUtilities.h"
+#include "GraphicsAccessories.hpp"
+#include "ThreadPool.hpp"
+#include "FastRand.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+#ifdef DILIGENT_DEBUG
+constexpr Uint32 TextureSize = 256;
+#else
+constexpr Uint32 TextureSize = 1024;
+#endif
+
+void RunComputeMipChain(Benchmark::State& State, TEXTURE_FORMAT Fmt, IThreadPool* pThreadPool)
+{
+    const Uint32 ElementSize = GetTextureFormatAttribs(Fmt).GetElementSize();
+    const Uint32 NumMips     = ComputeMipLevelsCount(TextureSize, TextureSize);
+
+    std::vector<std::vector<Uint8>> Levels(NumMips);
+    std::vector<void*>              pCoarseMips(NumMips - 1);
+    std::vector<size_t>             CoarseStrides(NumMips - 1);
+    for (Uint32 Mip = 0; Mip < NumMips; ++Mip)
+    {
+        const Uint32 MipSize = std::max(TextureSize >> Mip, 1u);
+        Levels[Mip].resize(size_t{MipSize} * MipSize * ElementSize);
+        if (Mip > 0)
+        {
+            pCoarseMips[Mip - 1]   = Levels[Mip].data();
+            CoarseStrides[Mip - 1] = size_t{MipSize} * ElementSize;
+        }
+    }
+
+    FastRandInt Rnd{0, 0, 255};
+    for (Uint8& c : Levels[0])
+        c = static_cast<Uint8>(Rnd());
+
+    ComputeMipChainAttribs Attribs;
+    Attribs.Format            = Fmt;
+    Attribs.Width             = TextureSize;
+    Attribs.Height            = TextureSize;
+    Attribs.pFineMipData      = Levels[0].data();
+    Attribs.FineMipStride     = size_t{TextureSize} * ElementSize;
+    Attribs.NumCoarseMips     = NumMips - 1;
+    Attribs.ppCoarseMipData   = pCoarseMips.data();
+    Attribs.pCoarseMipStrides = CoarseStrides.data();
+    Attribs.pThreadPool       = pThreadPool;
+
+    State.SetBytesPerIteration(Levels[0].size());
+    State.Run([&]() {
+        ComputeMipChain(Attribs);
+        Benchmark::DoNotOptimize(Levels.back().data());
+    });
+}
+
+const bool MipChainBenchmarksRegistered = []() {
+    for (TEXTURE_FORMAT Fmt : {TEX_FORMAT_RGBA8_UNORM, TEX_FORMAT_RGBA8_UNORM_SRGB, TEX_FORMAT_R32_FLOAT})
+    {
+        const std::string FmtName = GetTextureFormatAttribs(Fmt).Name + sizeof("TEX_FORMAT_") - 1;
+        Benchmark::RegisterBenchmark("GraphicsTools.ComputeMipChain/" + FmtName, [Fmt](Benchmark::State& State) {
+            RunComputeMipChain(State, Fmt, nullptr);
+        });
+        Benchmark::RegisterBenchmark("GraphicsTools.ComputeMipChain/" + FmtName + "/ThreadPool", [Fmt](Benchmark::State& State) {
+            RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{std::max(std::thread::hardware_concurrency(), 2u) - 1});
+            RunComputeMipChain(State, Fmt, pThreadPool);
+        });
+    }
+    return true;
+}();
+
+} // namespace
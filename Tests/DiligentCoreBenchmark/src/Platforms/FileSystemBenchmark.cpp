@@ -0,0 +1,119 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+#include "MappedFileDataBlob.hpp"
+#include "RefCntAutoPtr.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+// Creates the file in the working directory and deletes it when the benchmark is done.
+// The file is read during the warm-up, so all benchmarks measure loading from the warm page cache,
+// which is the common case for the render state cache and archives loaded at application start-up.
+class TempFile
+{
+public:
+    explicit TempFile(size_t Size) :
+        m_Path{"DiligentFileSystemBenchmark.bin"}
+    {
+        std::vector<Uint8> Data(Size);
+        for (size_t i = 0; i < Data.size(); ++i)
+            Data[i] = static_cast<Uint8>((i * 7919) >> 3);
+        FileWrapper::WriteFile(m_Path.c_str(), Data.data(), Data.size());
+    }
+
+    ~TempFile()
+    {
+        FileSystem::DeleteFile(m_Path.c_str());
+    }
+
+    const char* GetPath() const { return m_Path.c_str(); }
+
+private:
+    const std::string m_Path;
+};
+
+// Sums one byte per page to make the OS fault in every page of the mapping.
+Uint32 TouchPages(const IDataBlob* pData)
+{
+    const Uint8* pBytes = pData->GetConstDataPtr<Uint8>();
+    const size_t Size   = pData->GetSize();
+
+    Uint32 Sum = 0;
+    for (size_t i = 0; i < Size; i += 4096)
+        Sum += pBytes[i];
+    return Sum;
+}
+
+const bool FileSystemBenchmarksRegistered = []() {
+    for (size_t Size : {64 << 10, 1 << 20, 64 << 20})
+    {
+        const std::string SizeStr = std::to_string(Size);
+
+        Benchmark::RegisterBenchmark("Platforms.ReadWholeFile/" + SizeStr, [Size](Benchmark::State& State) {
+            TempFile File{Size};
+            State.SetBytesPerIteration(Size);
+            State.Run([&]() {
+                RefCntAutoPtr<IDataBlob> pData;
+                FileWrapper::ReadWholeFile(File.GetPath(), &pData);
+                Benchmark::DoNotOptimize(TouchPages(pData));
+            });
+        });
+
+        // Maps the file and touches every page: the cost of page faults without copying the data.
+        Benchmark::RegisterBenchmark("Platforms.MapWholeFile/" + SizeStr, [Size](Benchmark::State& State) {
+            TempFile File{Size};
+            State.SetBytesPerIteration(Size);
+            State.Run([&]() {
+                RefCntAutoPtr<IDataBlob> pData;
+                FileWrapper::MapWholeFile(File.GetPath(), &pData, EMappedFileAccessHint::WillNeed);
+                Benchmark::DoNotOptimize(TouchPages(pData));
+            });
+        });
+
+        // Maps the file without accessing the data: the start-up cost when only a few
+        // objects are requested from a large cache.
+        Benchmark::RegisterBenchmark("Platforms.MapFileOnly/" + SizeStr, [Size](Benchmark::State& State) {
+            TempFile File{Size};
+            State.SetBytesPerIteration(Size);
+            State.Run([&]() {
+                RefCntAutoPtr<MappedFileDataBlob> pData = MappedFileDataBlob::Create(File.GetPath(), EMappedFileAccessHint::Random);
+                Benchmark::DoNotOptimize(pData.RawPtr());
+            });
+        });
+    }
+    return true;
+}();
+
+} // namespace
@@ -0,0 +1,115 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <string>
+
+#include "Benchmark.hpp"
+#include "HLSLTokenizer.hpp"
+#include "ParsingTools.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+// Generates a shader source of roughly the size of a typical material shader
+std::string GenerateShaderSource()
+{
+    std::string Source;
+    for (int i = 0; i < 64; ++i)
+    {
+        const std::string Idx = std::to_string(i);
+        Source += "// Function " + Idx + "\n"
+                                         "Texture2D    g_Texture" +
+            Idx + ";\n"
+                  "SamplerState g_Texture" +
+            Idx + "_sampler;\n"
+                  "cbuffer Constants" +
+            Idx + "\n"
+                  "{\n"
+                  "    float4x4 g_WorldViewProj" +
+            Idx + ";\n"
+                  "    float4   g_Color" +
+            Idx + ";\n"
+                  "};\n"
+                  "/* Samples the texture\n"
+                  "   and applies the color */\n"
+                  "float4 Sample" +
+            Idx + "(in float2 UV : TEXCOORD0, float Bias)\n"
+                  "{\n"
+                  "    float4 Color = g_Texture" +
+            Idx + ".SampleBias(g_Texture" + Idx + "_sampler, UV * 0.5 + 0.25, Bias);\n"
+                                                  "    [unroll] for (int j = 0; j < 4; ++j)\n"
+                                                  "        Color.rgb = saturate(Color.rgb * g_Color" +
+            Idx + ".rgb + float3(1.0e-3, 2.5f, -3.0));\n"
+                  "    return mul(g_WorldViewProj" +
+            Idx + ", Color) / max(Color.a, 0.001);\n"
+                  "}\n\n";
+    }
+    return Source;
+}
+
+DILIGENT_BENCHMARK(ShaderTools, HLSLTokenizer)
+{
+    const Parsing::HLSLTokenizer Tokenizer;
+    const std::string            Source = GenerateShaderSource();
+
+    State.SetBytesPerIteration(Source.size());
+    State.Run([&]() {
+        const auto Tokens = Tokenizer.Tokenize(Source);
+        Benchmark::DoNotOptimize(Tokens.size());
+    });
+}
+
+DILIGENT_BENCHMARK(ShaderTools, SkipDelimitersAndComments)
+{
+    const std::string Source = GenerateShaderSource();
+
+    State.SetBytesPerIteration(Source.size());
+    State.Run([&]() {
+        // Walk the source the way the preprocessors do: skip whitespace and comments, then the next identifier or symbol
+        size_t NumIdentifiers = 0;
+        for (auto Pos = Source.begin(); Pos != Source.end();)
+        {
+            Pos = Parsing::SkipDelimitersAndComments(Pos, Source.end());
+            if (Pos == Source.end())
+                break;
+            const auto IdEnd = Parsing::SkipIdentifier(Pos, Source.end());
+            if (IdEnd != Pos)
+            {
+                ++NumIdentifiers;
+                Pos = IdEnd;
+            }
+            else
+            {
+                ++Pos;
+            }
+        }
+        Benchmark::DoNotOptimize(NumIdentifiers);
+    });
+}
+
+} // namespace
@@ -0,0 +1,148 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+void PrintUsage(const char* ExeName)
+{
+    printf("Usage:\n"
+           "  %s [options]\n"
+           "      Runs the benchmarks.\n\n"
+           "      --filter=<substring>       Only run the benchmarks whose names contain the substring\n"
+           "      --list                     List the benchmarks and exit\n"
+           "      --repetitions=<N>          Number of measured samples (default: 20)\n"
+           "      --min-sample-time=<sec>    Minimum duration of one sample (default: 0.01)\n"
+           "      --warmup-time=<sec>        Minimum warm-up duration (default: 0.05)\n"
+           "      --out=<file.json>          Write the results to the JSON file\n\n"
+           "  %s --compare <baseline.json> <current.json> [--threshold=<percent>]\n"
+           "      Compares two result files and returns a non-zero exit code if any benchmark's\n"
+           "      median time increased by more than the threshold (default: 5%%).\n",
+           ExeName, ExeName);
+}
+
+// Returns the value of the --Name=Value argument, or nullptr if Arg is a different argument
+const char* GetArgValue(const char* Arg, const char* Name)
+{
+    const size_t NameLen = strlen(Name);
+    return strncmp(Arg, Name, NameLen) == 0 && Arg[NameLen] == '=' ? Arg + NameLen + 1 : nullptr;
+}
+
+int Compare(int argc, char** argv)
+{
+    const char* BaselinePath = nullptr;
+    const char* CurrentPath  = nullptr;
+    double      Threshold    = 5;
+    for (int i = 2; i < argc; ++i)
+    {
+        if (const char* Value = GetArgValue(argv[i], "--threshold"))
+            Threshold = atof(Value);
+        else if (BaselinePath == nullptr)
+            BaselinePath = argv[i];
+        else if (CurrentPath == nullptr)
+            CurrentPath = argv[i];
+        else
+        {
+            fprintf(stderr, "Unexpected argument: %s\n", argv[i]);
+            return 2;
+        }
+    }
+    if (BaselinePath == nullptr || CurrentPath == nullptr)
+    {
+        PrintUsage(argv[0]);
+        return 2;
+    }
+
+    Benchmark::ResultSet Baseline, Current;
+    if (!Benchmark::ReadResultsJSON(BaselinePath, Baseline) || !Benchmark::ReadResultsJSON(CurrentPath, Current))
+        return 2;
+
+    return Benchmark::CompareResults(Baseline, Current, Threshold) > 0 ? 1 : 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc > 1 && strcmp(argv[1], "--compare") == 0)
+        return Compare(argc, argv);
+
+    Benchmark::RunSettings Settings;
+    const char*            OutPath = nullptr;
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* Arg = argv[i];
+        if (const char* Filter = GetArgValue(Arg, "--filter"))
+            Settings.Filter = Filter;
+        else if (const char* Reps = GetArgValue(Arg, "--repetitions"))
+            Settings.Repetitions = std::max(atoi(Reps), 1);
+        else if (const char* SampleTime = GetArgValue(Arg, "--min-sample-time"))
+            Settings.MinSampleTime = atof(SampleTime);
+        else if (const char* WarmupTime = GetArgValue(Arg, "--warmup-time"))
+            Settings.WarmupTime = atof(WarmupTime);
+        else if (const char* Out = GetArgValue(Arg, "--out"))
+            OutPath = Out;
+        else if (strcmp(Arg, "--list") == 0)
+        {
+            for (const std::string& Name : Benchmark::GetBenchmarkNames())
+                printf("%s\n", Name.c_str());
+            return 0;
+        }
+        else if (strcmp(Arg, "--help") == 0 || strcmp(Arg, "-h") == 0)
+        {
+            PrintUsage(argv[0]);
+            return 0;
+        }
+        else
+        {
+            fprintf(stderr, "Unknown argument: %s\n\n", Arg);
+            PrintUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    const Benchmark::ResultSet Results = Benchmark::RunBenchmarks(Settings);
+    if (Results.Results.empty())
+    {
+        fprintf(stderr, "No benchmarks match the filter '%s'\n", Settings.Filter.c_str());
+        return 2;
+    }
+
+    if (OutPath != nullptr && !Benchmark::WriteResultsJSON(Results, OutPath))
+        return 2;
+
+    return 0;
+}
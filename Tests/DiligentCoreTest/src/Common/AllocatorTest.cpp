@@ -26,6 +26,10 @@
  */
 
 #include <array>
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include <cstring>
 
 #include "DefaultRawMemoryAllocator.hpp"
 #include "FixedBlockMemoryAllocator.hpp"
@@ -39,12 +43,12 @@ using namespace Diligent;
 namespace
 {
 
-TEST(Common_FixedBlockMemoryAllocator, AllocDealloc)
+void TestAllocDealloc(Uint32 ThreadCacheSize)
 {
     constexpr Uint32 AllocSize             = 32;
     constexpr int    NumAllocationsPerPage = 16;
 
-    FixedBlockMemoryAllocator TestAllocator{DefaultRawMemoryAllocator::GetAllocator(), AllocSize, NumAllocationsPerPage};
+    FixedBlockMemoryAllocator TestAllocator{DefaultRawMemoryAllocator::GetAllocator(), AllocSize, NumAllocationsPerPage, ThreadCacheSize};
 
     void* Allocations[NumAllocationsPerPage][2] = {};
     for (int p = 0; p < 2; ++p)
@@ -84,6 +88,16 @@ TEST(Common_FixedBlockMemoryAllocator, AllocDealloc)
                 TestAllocator.Free(Allocations[i][p]);
 }
 
+TEST(Common_FixedBlockMemoryAllocator, AllocDealloc)
+{
+    TestAllocDealloc(0);
+}
+
+TEST(Common_FixedBlockMemoryAllocator, AllocDealloc_ThreadCache)
+{
+    TestAllocDealloc(4);
+}
+
 TEST(Common_FixedBlockMemoryAllocator, SmallObject)
 {
     constexpr Uint32 AllocSize             = 4;
@@ -124,6 +138,91 @@ TEST(Common_FixedBlockMemoryAllocator, UnalignedSize)
     }
 }
 
+TEST(Common_FixedBlockMemoryAllocator, LargeBlocks)
+{
+    constexpr Uint32 AllocSize             = 1000;
+    constexpr Uint32 NumAllocationsPerPage = 3;
+
+    FixedBlockMemoryAllocator TestAllocator{DefaultRawMemoryAllocator::GetAllocator(), AllocSize, NumAllocationsPerPage};
+
+    std::vector<void*> Allocations(64);
+    for (auto& Ptr : Allocations)
+    {
+        Ptr = TestAllocator.Allocate(AllocSize, "Large block allocation test", __FILE__, __LINE__);
+        ASSERT_NE(Ptr, nullptr);
+        memset(Ptr, 0xFF, AllocSize);
+    }
+
+    std::sort(Allocations.begin(), Allocations.end());
+    for (size_t i = 1; i < Allocations.size(); ++i)
+        EXPECT_GE(reinterpret_cast<Uint8*>(Allocations[i]), reinterpret_cast<Uint8*>(Allocations[i - 1]) + AllocSize);
+
+    for (auto* Ptr : Allocations)
+        TestAllocator.Free(Ptr);
+}
+
+void TestMultithreadedAllocations(Uint32 ThreadCacheSize, Uint32 NumThreads)
+{
+    constexpr Uint32 AllocSize             = 64;
+    constexpr Uint32 NumAllocationsPerPage = 64;
+    constexpr Uint32 NumIterations         = 64;
+    constexpr Uint32 NumAllocations        = 256;
+
+    FixedBlockMemoryAllocator TestAllocator{DefaultRawMemoryAllocator::GetAllocator(), AllocSize, NumAllocationsPerPage, ThreadCacheSize};
+
+    // Blocks are freed by the next thread to test cross-thread deallocations
+    std::vector<std::vector<void*>> Allocations(NumThreads);
+    std::vector<std::thread>        Threads(NumThreads);
+
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        Threads[t] = std::thread{
+            [&, t]() {
+                std::vector<void*> Blocks(NumAllocations);
+                for (Uint32 it = 0; it < NumIterations; ++it)
+                {
+                    for (auto& Ptr : Blocks)
+                    {
+                        Ptr = TestAllocator.Allocate(AllocSize, "Multithreaded allocation test", __FILE__, __LINE__);
+                        *reinterpret_cast<Uint32*>(Ptr) = t;
+                    }
+                    for (void* Ptr : Blocks)
+                        EXPECT_EQ(*reinterpret_cast<Uint32*>(Ptr), t);
+                    // Free blocks in a different order
+                    for (size_t i = 0; i < Blocks.size(); ++i)
+                        TestAllocator.Free(Blocks[(i * 7) % Blocks.size()]);
+                }
+
+                Blocks.resize(NumAllocations / 2);
+                for (auto& Ptr : Blocks)
+                    Ptr = TestAllocator.Allocate(AllocSize, "Multithreaded allocation test", __FILE__, __LINE__);
+                Allocations[t] = std::move(Blocks);
+            }};
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        Threads[t] = std::thread{
+            [&, t]() {
+                for (void* Ptr : Allocations[(t + 1) % NumThreads])
+                    TestAllocator.Free(Ptr);
+            }};
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+}
+
+TEST(Common_FixedBlockMemoryAllocator, Multithreading)
+{
+    for (Uint32 NumThreads : {1u, 2u, 4u, 8u, 16u})
+    {
+        TestMultithreadedAllocations(0, NumThreads);
+        TestMultithreadedAllocations(32, NumThreads);
+    }
+}
+
 TEST(Common_FixedLinearAllocator, EmptyAllocator)
 {
     FixedLinearAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator()};
@@ -0,0 +1,437 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+#include <algorithm>
+
+#include "BVH.hpp"
+#include "ThreadPool.hpp"
+#include "FastRand.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+struct TestMesh
+{
+    std::vector<float3> Vertices;
+    std::vector<Uint32> Indices;
+
+    Uint32 GetNumTriangles() const
+    {
+        return static_cast<Uint32>(Indices.size() / 3);
+    }
+
+    void GetTriangle(Uint32 Tri, float3& V0, float3& V1, float3& V2) const
+    {
+        V0 = Vertices[Indices[Tri * 3 + 0]];
+        V1 = Vertices[Indices[Tri * 3 + 1]];
+        V2 = Vertices[Indices[Tri * 3 + 2]];
+    }
+
+    TriangleMeshBVH::CreateInfo GetBVHCreateInfo() const
+    {
+        TriangleMeshBVH::CreateInfo CI;
+        CI.pVertices    = Vertices.data();
+        CI.NumVertices  = static_cast<Uint32>(Vertices.size());
+        CI.pIndices     = Indices.data();
+        CI.NumTriangles = GetNumTriangles();
+        return CI;
+    }
+};
+
+// Creates a terrain-like height field with GridSize x GridSize cells in the [-1, 1] x [-1, 1] XZ square
+// and adds NumRandomTriangles randomly placed small triangles above it.
+TestMesh CreateTestMesh(Uint32 GridSize, Uint32 NumRandomTriangles)
+{
+    TestMesh Mesh;
+
+    FastRandFloat Rnd{0, -1, 1};
+    for (Uint32 z = 0; z <= GridSize; ++z)
+    {
+        for (Uint32 x = 0; x <= GridSize; ++x)
+        {
+            const float fx = static_cast<float>(x) / static_cast<float>(GridSize) * 2.f - 1.f;
+            const float fz = static_cast<float>(z) / static_cast<float>(GridSize) * 2.f - 1.f;
+            Mesh.Vertices.emplace_back(fx, 0.1f * std::sin(fx * 7.f) * std::cos(fz * 5.f) + Rnd() * 0.01f, fz);
+        }
+    }
+
+    for (Uint32 z = 0; z < GridSize; ++z)
+    {
+        for (Uint32 x = 0; x < GridSize; ++x)
+        {
+            const Uint32 i00 = z * (GridSize + 1) + x;
+            const Uint32 i10 = i00 + 1;
+            const Uint32 i01 = i00 + GridSize + 1;
+            const Uint32 i11 = i01 + 1;
+            Mesh.Indices.insert(Mesh.Indices.end(), {i00, i01, i10, i10, i01, i11});
+        }
+    }
+
+    for (Uint32 i = 0; i < NumRandomTriangles; ++i)
+    {
+        const float3 Center{Rnd(), Rnd() * 0.5f + 0.6f, Rnd()};
+        const Uint32 FirstVert = static_cast<Uint32>(Mesh.Vertices.size());
+        for (Uint32 v = 0; v < 3; ++v)
+        {
+            Mesh.Vertices.emplace_back(Center + float3{Rnd(), Rnd(), Rnd()} * 0.05f);
+            Mesh.Indices.push_back(FirstVert + v);
+        }
+    }
+
+    return Mesh;
+}
+
+std::vector<TriangleMeshBVH::Ray> GenerateRandomRays(Uint32 NumRays, unsigned int Seed, float MaxDistance = +FLT_MAX)
+{
+    FastRandFloat Rnd{Seed, -1, 1};
+
+    std::vector<TriangleMeshBVH::Ray> Rays(NumRays);
+    for (TriangleMeshBVH::Ray& R : Rays)
+    {
+        R.Origin      = float3{Rnd() * 1.5f, 1.5f + Rnd() * 0.5f, Rnd() * 1.5f};
+        R.Direction   = float3{Rnd() * 0.5f, -1.f, Rnd() * 0.5f};
+        R.MaxDistance = MaxDistance;
+    }
+    return Rays;
+}
+
+// Generates coherent rays from a pinhole camera. Rays of every 4x2 pixel block are consecutive.
+std::vector<TriangleMeshBVH::Ray> GeneratePrimaryRays(Uint32 Width, Uint32 Height)
+{
+    std::vector<TriangleMeshBVH::Ray> Rays;
+    Rays.reserve(size_t{Width} * Height);
+    for (Uint32 by = 0; by < Height; by += 2)
+    {
+        for (Uint32 bx = 0; bx < Width; bx += 4)
+        {
+            for (Uint32 y = by; y < by + 2; ++y)
+            {
+                for (Uint32 x = bx; x < bx + 4; ++x)
+                {
+                    const float u = (static_cast<float>(x) + 0.5f) / static_cast<float>(Width) * 2.f - 1.f;
+                    const float v = (static_cast<float>(y) + 0.5f) / static_cast<float>(Height) * 2.f - 1.f;
+
+                    TriangleMeshBVH::Ray R;
+                    R.Origin    = float3{0, 1.5f, -2.5f};
+                    R.Direction = normalize(float3{u, v * 0.75f - 0.5f, 1.f});
+                    Rays.push_back(R);
+                }
+            }
+        }
+    }
+    return Rays;
+}
+
+TriangleMeshBVH::Hit CastRayBruteForce(const TestMesh& Mesh, const TriangleMeshBVH::Ray& R, bool CullBackFace = false)
+{
+    TriangleMeshBVH::Hit Res;
+    Res.Distance = R.MaxDistance;
+    for (Uint32 Tri = 0; Tri < Mesh.GetNumTriangles(); ++Tri)
+    {
+        float3 V0, V1, V2;
+        Mesh.GetTriangle(Tri, V0, V1, V2);
+        const float t = IntersectRayTriangle(V0, V1, V2, R.Origin, R.Direction, CullBackFace);
+        if (t != +FLT_MAX && t >= 0 && (t < Res.Distance || (t == Res.Distance && Tri < Res.TriangleIndex)))
+        {
+            Res.Distance      = t;
+            Res.TriangleIndex = Tri;
+        }
+    }
+    if (!Res)
+        Res.Distance = +FLT_MAX;
+    return Res;
+}
+
+void VerifyBVH(const BVH& Tree, Uint32 NumPrimitives, Uint32 MaxLeafSize)
+{
+    const std::vector<BVH::Node>& Nodes = Tree.GetNodes();
+    ASSERT_FALSE(Nodes.empty());
+    EXPECT_LE(Nodes.size(), size_t{NumPrimitives} * 2 - 1);
+
+    std::vector<Uint32> PrimIndices = Tree.GetPrimitiveIndices();
+    ASSERT_EQ(PrimIndices.size(), NumPrimitives);
+    std::sort(PrimIndices.begin(), PrimIndices.end());
+    for (Uint32 i = 0; i < NumPrimitives; ++i)
+        ASSERT_EQ(PrimIndices[i], i);
+
+    Uint32 NumLeafPrimitives = 0;
+    for (const BVH::Node& N : Nodes)
+    {
+        if (N.IsLeaf())
+        {
+            NumLeafPrimitives += N.NumPrimitives;
+            EXPECT_LE(N.NumPrimitives, MaxLeafSize);
+            continue;
+        }
+
+        ASSERT_LT(N.FirstChildOrPrimitive + 1, Nodes.size());
+        for (Uint32 c = 0; c < 2; ++c)
+        {
+            const BVH::Node& Child = Nodes[N.FirstChildOrPrimitive + c];
+            EXPECT_EQ(Child.Min >= N.Min, float3(1, 1, 1));
+            EXPECT_EQ(Child.Max <= N.Max, float3(1, 1, 1));
+        }
+    }
+    EXPECT_EQ(NumLeafPrimitives, NumPrimitives);
+}
+
+TEST(Common_BVH, Build)
+{
+    const TestMesh Mesh = CreateTestMesh(32, 500);
+
+    TriangleMeshBVH::CreateInfo CI = Mesh.GetBVHCreateInfo();
+    for (Uint32 MaxLeafSize : {1u, 4u, 8u})
+    {
+        CI.MaxLeafSize = MaxLeafSize;
+        const TriangleMeshBVH Tree{CI};
+        EXPECT_EQ(Tree.GetNumTriangles(), Mesh.GetNumTriangles());
+        VerifyBVH(Tree.GetBVH(), Mesh.GetNumTriangles(), MaxLeafSize);
+
+        const BoundBox Bounds = Tree.GetBVH().GetBounds();
+        for (const float3& V : Mesh.Vertices)
+        {
+            EXPECT_EQ(V >= Bounds.Min, float3(1, 1, 1));
+            EXPECT_EQ(V <= Bounds.Max, float3(1, 1, 1));
+        }
+    }
+
+    // Degenerate case: all triangles are the same
+    {
+        const std::vector<float3> Vertices(300, float3{1, 2, 3});
+
+        TriangleMeshBVH::CreateInfo DegenerateCI;
+        DegenerateCI.pVertices    = Vertices.data();
+        DegenerateCI.NumVertices  = static_cast<Uint32>(Vertices.size());
+        DegenerateCI.NumTriangles = DegenerateCI.NumVertices / 3;
+        const TriangleMeshBVH Tree{DegenerateCI};
+        VerifyBVH(Tree.GetBVH(), DegenerateCI.NumTriangles, DegenerateCI.MaxLeafSize);
+    }
+
+    // Empty hierarchy
+    {
+        const TriangleMeshBVH Tree{TriangleMeshBVH::CreateInfo{}};
+        EXPECT_TRUE(Tree.GetBVH().IsEmpty());
+        EXPECT_FALSE(Tree.CastRay({float3{0, 0, 0}, float3{0, 0, 1}}));
+        EXPECT_FALSE(Tree.AnyHit({float3{0, 0, 0}, float3{0, 0, 1}}));
+    }
+}
+
+TEST(Common_BVH, ParallelBuild)
+{
+    const TestMesh Mesh = CreateTestMesh(64, 1000);
+
+    TriangleMeshBVH::CreateInfo CI = Mesh.GetBVHCreateInfo();
+
+    const TriangleMeshBVH SerialTree{CI};
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    CI.pThreadPool                         = pThreadPool;
+
+    BVH::CreateInfo BVHCI;
+    std::vector<BoundBox> Bounds(Mesh.GetNumTriangles());
+    for (Uint32 i = 0; i < Mesh.GetNumTriangles(); ++i)
+    {
+        float3 V0, V1, V2;
+        Mesh.GetTriangle(i, V0, V1, V2);
+        Bounds[i] = BoundBox{(std::min)((std::min)(V0, V1), V2), (std::max)((std::max)(V0, V1), V2)};
+    }
+    BVHCI.pPrimitiveBounds     = Bounds.data();
+    BVHCI.NumPrimitives        = Mesh.GetNumTriangles();
+    BVHCI.MinPrimitivesPerTask = 256;
+
+    const BVH SerialBVH{BVHCI};
+
+    BVHCI.pThreadPool = pThreadPool;
+    const BVH ParallelTree{BVHCI};
+    VerifyBVH(ParallelTree, Mesh.GetNumTriangles(), BVHCI.MaxLeafSize);
+    // Subtrees are the same, only the node order may differ
+    EXPECT_EQ(ParallelTree.GetNodes().size(), SerialBVH.GetNodes().size());
+    EXPECT_EQ(ParallelTree.GetBounds(), SerialBVH.GetBounds());
+
+    for (const TriangleMeshBVH::Ray& R : GenerateRandomRays(256, 1))
+    {
+        Uint32      HitTri = ~0u;
+        const float Dist   = ParallelTree.CastRay(R.Origin, R.Direction, R.MaxDistance, [&](Uint32 Tri) {
+            float3 V0, V1, V2;
+            Mesh.GetTriangle(Tri, V0, V1, V2);
+            return IntersectRayTriangle(V0, V1, V2, R.Origin, R.Direction);
+        },
+                                                &HitTri);
+
+        const TriangleMeshBVH::Hit Ref = SerialTree.CastRay(R);
+        EXPECT_EQ(Dist, Ref.Distance);
+        if (Ref)
+        {
+            float3 V0, V1, V2;
+            Mesh.GetTriangle(HitTri, V0, V1, V2);
+            EXPECT_EQ(IntersectRayTriangle(V0, V1, V2, R.Origin, R.Direction), Dist);
+        }
+    }
+}
+
+TEST(Common_BVH, CastRay)
+{
+    const TestMesh        Mesh = CreateTestMesh(32, 500);
+    const TriangleMeshBVH Tree{Mesh.GetBVHCreateInfo()};
+
+    for (bool CullBackFace : {false, true})
+    {
+        Uint32 NumHits = 0;
+        for (const TriangleMeshBVH::Ray& R : GenerateRandomRays(500, 2))
+        {
+            const TriangleMeshBVH::Hit Hit = Tree.CastRay(R, CullBackFace);
+            const TriangleMeshBVH::Hit Ref = CastRayBruteForce(Mesh, R, CullBackFace);
+            EXPECT_EQ(Hit.TriangleIndex, Ref.TriangleIndex);
+            EXPECT_EQ(Hit.Distance, Ref.Distance);
+            NumHits += Hit ? 1 : 0;
+        }
+        EXPECT_GT(NumHits, 0u);
+    }
+
+    // Limited distance
+    for (const TriangleMeshBVH::Ray& R : GenerateRandomRays(500, 3, 1.f))
+    {
+        const TriangleMeshBVH::Hit Hit = Tree.CastRay(R);
+        const TriangleMeshBVH::Hit Ref = CastRayBruteForce(Mesh, R);
+        EXPECT_EQ(Hit.TriangleIndex, Ref.TriangleIndex);
+        EXPECT_EQ(Hit.Distance, Ref.Distance);
+    }
+
+    // Axis-aligned rays that start on the node boundaries
+    for (Uint32 i = 0; i <= 16; ++i)
+    {
+        const float                t = static_cast<float>(i) / 8.f - 1.f;
+        const TriangleMeshBVH::Ray R{float3{t, 2.f, t}, float3{0, -1, 0}};
+
+        const TriangleMeshBVH::Hit Hit = Tree.CastRay(R);
+        const TriangleMeshBVH::Hit Ref = CastRayBruteForce(Mesh, R);
+        EXPECT_EQ(Hit.TriangleIndex, Ref.TriangleIndex);
+        EXPECT_EQ(Hit.Distance, Ref.Distance);
+    }
+}
+
+TEST(Common_BVH, AnyHit)
+{
+    const TestMesh        Mesh = CreateTestMesh(32, 500);
+    const TriangleMeshBVH Tree{Mesh.GetBVHCreateInfo()};
+
+    for (float MaxDistance : {+FLT_MAX, 1.f, 0.5f})
+    {
+        const std::vector<TriangleMeshBVH::Ray> Rays = GenerateRandomRays(500, 4, MaxDistance);
+
+        std::vector<TriangleMeshBVH::Hit> Hits(Rays.size());
+        std::vector<bool>                 Refs(Rays.size());
+        Uint32                            NumHits = 0;
+        for (size_t i = 0; i < Rays.size(); ++i)
+        {
+            const bool Ref = static_cast<bool>(CastRayBruteForce(Mesh, Rays[i]));
+            EXPECT_EQ(Tree.AnyHit(Rays[i]), Ref);
+            Refs[i] = Ref;
+            NumHits += Ref ? 1 : 0;
+        }
+        EXPECT_GT(NumHits, 0u);
+
+        std::unique_ptr<bool[]> Results{new bool[Rays.size()]};
+        Tree.AnyHits(Rays.data(), static_cast<Uint32>(Rays.size()), Results.get());
+        for (size_t i = 0; i < Rays.size(); ++i)
+            EXPECT_EQ(Results[i], Refs[i]) << "Ray " << i;
+    }
+}
+
+TEST(Common_BVH, CastRays)
+{
+    const TestMesh        Mesh = CreateTestMesh(32, 500);
+    const TriangleMeshBVH Tree{Mesh.GetBVHCreateInfo()};
+
+    auto Test = [&](const std::vector<TriangleMeshBVH::Ray>& Rays, bool CullBackFace) {
+        // Use the number of rays that is not a multiple of the packet size
+        const Uint32 NumRays = static_cast<Uint32>(Rays.size()) - 3;
+
+        std::vector<TriangleMeshBVH::Hit> Hits(NumRays);
+        Tree.CastRays(Rays.data(), NumRays, Hits.data(), CullBackFace);
+        for (Uint32 i = 0; i < NumRays; ++i)
+        {
+            const TriangleMeshBVH::Hit Ref = Tree.CastRay(Rays[i], CullBackFace);
+            EXPECT_EQ(static_cast<bool>(Hits[i]), static_cast<bool>(Ref)) << "Ray " << i;
+            EXPECT_NEAR(Hits[i].Distance, Ref.Distance, Ref ? Ref.Distance * 1e-5f : 0) << "Ray " << i;
+        }
+    };
+
+    Test(GenerateRandomRays(512, 5), false);
+    Test(GenerateRandomRays(512, 6), true);
+    Test(GenerateRandomRays(512, 7, 1.f), false);
+    Test(GeneratePrimaryRays(64, 32), false);
+}
+
+TEST(Common_BVH, QueryBox)
+{
+    const TestMesh        Mesh = CreateTestMesh(32, 500);
+    const TriangleMeshBVH Tree{Mesh.GetBVHCreateInfo()};
+
+    FastRandFloat Rnd{8, -1, 1};
+    for (Uint32 i = 0; i < 64; ++i)
+    {
+        const float3   Center{Rnd(), Rnd() * 0.5f + 0.5f, Rnd()};
+        const float3   Extent = float3{std::abs(Rnd()), std::abs(Rnd()), std::abs(Rnd())} * 0.2f;
+        const BoundBox Box{Center - Extent, Center + Extent};
+
+        std::vector<Uint32> Triangles;
+        Tree.QueryBox(Box, [&](Uint32 Tri) {
+            Triangles.push_back(Tri);
+            return true;
+        });
+        std::sort(Triangles.begin(), Triangles.end());
+
+        std::vector<Uint32> RefTriangles;
+        for (Uint32 Tri = 0; Tri < Mesh.GetNumTriangles(); ++Tri)
+        {
+            float3 V0, V1, V2;
+            Mesh.GetTriangle(Tri, V0, V1, V2);
+            const float3 TriMin = (std::min)((std::min)(V0, V1), V2);
+            const float3 TriMax = (std::max)((std::max)(V0, V1), V2);
+            if (TriMin.x <= Box.Max.x && TriMax.x >= Box.Min.x &&
+                TriMin.y <= Box.Max.y && TriMax.y >= Box.Min.y &&
+                TriMin.z <= Box.Max.z && TriMax.z >= Box.Min.z)
+                RefTriangles.push_back(Tri);
+        }
+        EXPECT_EQ(Triangles, RefTriangles);
+    }
+
+    // Early exit
+    Uint32 NumVisited = 0;
+    Tree.QueryBox(Tree.GetBVH().GetBounds(), [&](Uint32 Tri) {
+        ++NumVisited;
+        return NumVisited < 10;
+    });
+    EXPECT_EQ(NumVisited, 10u);
+}
+
+} // namespace
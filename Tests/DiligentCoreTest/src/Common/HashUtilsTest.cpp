@@ -150,7 +150,7 @@ TEST(Common_HashUtils, HashMapStringKey)
     }
 }
 
-TEST(Common_HashUtils, ComputeHashRaw)
+void TestComputeHashRaw(RawHashMethod Method)
 {
     {
         std::array<Uint8, 16> Data{};
@@ -162,7 +162,7 @@ TEST(Common_HashUtils, ComputeHashRaw)
         {
             for (size_t size = 1; size <= Data.size() - start; ++size)
             {
-                auto Hash = ComputeHashRaw(&Data[start], size);
+                auto Hash = ComputeHashRaw(&Data[start], size, Method);
                 EXPECT_NE(Hash, size_t{0});
                 auto inserted = Hashes.insert(Hash).second;
                 EXPECT_TRUE(inserted) << Hash;
@@ -174,12 +174,12 @@ TEST(Common_HashUtils, ComputeHashRaw)
         std::array<Uint8, 16> RefData = {1, 3, 5, 7, 11, 13, 21, 35, 2, 4, 8, 10, 22, 40, 60, 82};
         for (size_t size = 1; size <= RefData.size(); ++size)
         {
-            auto RefHash = ComputeHashRaw(RefData.data(), size);
+            auto RefHash = ComputeHashRaw(RefData.data(), size, Method);
             for (size_t offset = 0; offset < RefData.size() - size; ++offset)
             {
                 std::array<Uint8, RefData.size()> Data{};
                 std::copy(RefData.begin(), RefData.begin() + size, Data.begin() + offset);
-                auto Hash = ComputeHashRaw(&Data[offset], size);
+                auto Hash = ComputeHashRaw(&Data[offset], size, Method);
                 EXPECT_EQ(RefHash, Hash) << offset << " " << size;
             }
         }
@@ -187,6 +187,24 @@ TEST(Common_HashUtils, ComputeHashRaw)
 }
 
 
+TEST(Common_HashUtils, ComputeHashRaw)
+{
+    TestComputeHashRaw(RawHashMethod::Combine);
+    TestComputeHashRaw(RawHashMethod::XXH3);
+
+    // XXH3 hash must be stable
+    EXPECT_EQ(ComputeXXH3Hash(nullptr, 0), Uint64{0x2D06800538D394C2});
+
+    {
+        std::vector<Uint8> Data(1024);
+        for (size_t i = 0; i < Data.size(); ++i)
+            Data[i] = static_cast<Uint8>(i * 31);
+        EXPECT_EQ(ComputeXXH3Hash(Data.data(), Data.size()), ComputeXXH3Hash(Data.data(), Data.size()));
+        EXPECT_NE(ComputeXXH3Hash(Data.data(), Data.size()), ComputeXXH3Hash(Data.data(), Data.size(), 1));
+        EXPECT_EQ(ComputeHashRaw(Data.data(), Data.size(), RawHashMethod::Combine), ComputeHashRaw(Data.data(), Data.size()));
+    }
+}
+
 template <typename Type>
 class StdHasherTestHelper
 {
@@ -30,8 +30,10 @@
 
 #include <thread>
 #include <functional>
+#include <algorithm>
 
 #include "ThreadSignal.hpp"
+#include "FastRand.hpp"
 
 using namespace Diligent;
 
@@ -43,9 +45,10 @@ struct CacheData
     Uint32 Value = ~0u;
 };
 
-TEST(Common_LRUCache, Get)
+template <typename CacheType>
+void TestGet()
 {
-    LRUCache<int, CacheData> Cache{16};
+    CacheType Cache{16};
 
     constexpr Uint32         NumThreads = 16;
     std::vector<std::thread> Threads(NumThreads);
@@ -81,9 +84,10 @@ TEST(Common_LRUCache, Get)
 }
 
 
-TEST(Common_LRUCache, ReleaseQueue)
+template <typename CacheType>
+void TestReleaseQueue()
 {
-    LRUCache<int, CacheData> Cache{16};
+    CacheType Cache{16};
 
     constexpr Uint32                    NumThreads = 16;
     std::vector<std::thread>            Threads(NumThreads);
@@ -127,9 +131,10 @@ TEST(Common_LRUCache, ReleaseQueue)
 }
 
 
-TEST(Common_LRUCache, Exceptions)
+template <typename CacheType>
+void TestExceptions()
 {
-    LRUCache<int, CacheData> Cache{16};
+    CacheType Cache{16};
 
     constexpr Uint32                    NumThreads = 15; // Use odd number
     std::vector<std::thread>            Threads(NumThreads);
@@ -183,4 +188,124 @@ TEST(Common_LRUCache, Exceptions)
     }
 }
 
+using TestLRUCache        = LRUCache<int, CacheData>;
+using TestShardedLRUCache = ShardedLRUCache<int, CacheData>;
+
+TEST(Common_LRUCache, Get)
+{
+    TestGet<TestLRUCache>();
+}
+
+TEST(Common_LRUCache, ReleaseQueue)
+{
+    TestReleaseQueue<TestLRUCache>();
+}
+
+TEST(Common_LRUCache, Exceptions)
+{
+    TestExceptions<TestLRUCache>();
+}
+
+TEST(Common_ShardedLRUCache, Get)
+{
+    TestGet<TestShardedLRUCache>();
+}
+
+TEST(Common_ShardedLRUCache, ReleaseQueue)
+{
+    TestReleaseQueue<TestShardedLRUCache>();
+}
+
+TEST(Common_ShardedLRUCache, Exceptions)
+{
+    TestExceptions<TestShardedLRUCache>();
+}
+
+TEST(Common_ShardedLRUCache, Eviction)
+{
+    constexpr size_t MaxSize = 16;
+
+    TestShardedLRUCache Cache{MaxSize};
+
+    Uint32 NumInitCalls = 0;
+    auto   GetValue     = [&](int Key) {
+        return Cache.Get(Key,
+                         [&](CacheData& Data, size_t& Size) //
+                         {
+                             Data.Value = static_cast<Uint32>(Key);
+                             Size       = 1;
+                             ++NumInitCalls;
+                         })
+            .Value;
+    };
+
+    for (int i = 0; i < 1024; ++i)
+    {
+        EXPECT_EQ(GetValue(i), static_cast<Uint32>(i));
+        EXPECT_LE(Cache.GetCurrSize(), MaxSize);
+        // The most recently used entry must not be evicted
+        const Uint32 NumCalls = NumInitCalls;
+        EXPECT_EQ(GetValue(i), static_cast<Uint32>(i));
+        EXPECT_EQ(NumInitCalls, NumCalls);
+    }
+    EXPECT_EQ(NumInitCalls, 1024u);
+    EXPECT_EQ(Cache.GetCurrSize(), MaxSize);
+
+    // Reducing the budget evicts the entries on the next access
+    Cache.SetMaxSize(4);
+    GetValue(1023);
+    EXPECT_EQ(Cache.GetCurrSize(), size_t{4});
+}
+
+TEST(Common_ShardedLRUCache, Erase)
+{
+    TestShardedLRUCache Cache{64};
+
+    Uint32 NumInitCalls = 0;
+    auto   GetValue     = [&](int Key) {
+        return Cache.Get(Key,
+                         [&](CacheData& Data, size_t& Size) //
+                         {
+                             Data.Value = static_cast<Uint32>(Key);
+                             Size       = 2;
+                             ++NumInitCalls;
+                         })
+            .Value;
+    };
+
+    for (int i = 0; i < 8; ++i)
+        GetValue(i);
+    EXPECT_EQ(Cache.GetCurrSize(), size_t{16});
+
+    EXPECT_TRUE(Cache.Erase(3));
+    EXPECT_FALSE(Cache.Erase(3));
+    EXPECT_FALSE(Cache.Erase(100));
+    EXPECT_EQ(Cache.GetCurrSize(), size_t{14});
+
+    // The erased entry is initialized again, the others are not
+    EXPECT_EQ(GetValue(3), 3u);
+    EXPECT_EQ(GetValue(4), 4u);
+    EXPECT_EQ(NumInitCalls, 9u);
+    EXPECT_EQ(Cache.GetCurrSize(), size_t{16});
+
+    // Erasing an entry while it is being initialized: the data is returned, but not cached
+    const Uint32 Value = Cache.Get(10,
+                                   [&](CacheData& Data, size_t& Size) //
+                                   {
+                                       EXPECT_TRUE(Cache.Erase(10));
+                                       Data.Value = 10;
+                                       Size       = 2;
+                                   })
+                             .Value;
+    EXPECT_EQ(Value, 10u);
+    EXPECT_EQ(Cache.GetCurrSize(), size_t{16});
+    EXPECT_FALSE(Cache.Erase(10));
+
+    Cache.Clear();
+    EXPECT_EQ(Cache.GetCurrSize(), size_t{0});
+    EXPECT_EQ(GetValue(4), 4u);
+    EXPECT_EQ(NumInitCalls, 10u);
+    EXPECT_EQ(Cache.GetCurrSize(), size_t{2});
+}
+
 } // namespace
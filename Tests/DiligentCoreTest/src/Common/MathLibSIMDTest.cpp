@@ -0,0 +1,265 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+
+#include "BasicMathSIMD.hpp"
+#include "FastRand.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+constexpr float Epsilon = 1e-5f;
+
+#define EXPECT_VECTOR_NEAR(V1, V2, Eps)                                             \
+    do                                                                              \
+    {                                                                               \
+        for (size_t c = 0; c < (V1).GetComponentCount(); ++c)                       \
+            EXPECT_NEAR((V1)[c], (V2)[c], (Eps) * std::max(1.f, std::abs((V2)[c]))) \
+                << "Component " << c;                                               \
+    } while (false)
+
+#define EXPECT_MATRIX_NEAR(M1, M2, Eps)                                                          \
+    do                                                                                           \
+    {                                                                                            \
+        for (int r = 0; r < 4; ++r)                                                              \
+            for (int c = 0; c < 4; ++c)                                                          \
+                EXPECT_NEAR((M1)[r][c], (M2)[r][c], (Eps) * std::max(1.f, std::abs((M2)[r][c]))) \
+                    << "Element [" << r << "][" << c << "]";                                     \
+    } while (false)
+
+// Generates well-conditioned affine and projective matrices
+std::vector<float4x4> GenerateRandomMatrices(size_t Count, unsigned int Seed)
+{
+    FastRandFloat Rnd{Seed, -1.f, +1.f};
+
+    std::vector<float4x4> Matrices(Count);
+    for (size_t i = 0; i < Count; ++i)
+    {
+        const float3 Axis{Rnd(), Rnd(), Rnd() + 2.f};
+
+        float4x4& M = Matrices[i];
+        M           = float4x4::Scale(Rnd() + 2.f, Rnd() + 2.f, Rnd() + 2.f) *
+            float4x4::RotationArbitrary(Axis, Rnd() * PI_F) *
+            float4x4::Translation(Rnd() * 10.f, Rnd() * 10.f, Rnd() * 10.f);
+        if (i % 4 == 3)
+            M = M * float4x4::Projection(PI_F / 4.f, 1.5f, 0.5f, 100.f, false);
+        else if (i % 4 == 2)
+            M._14 = Rnd() * 0.25f; // Non-affine matrix
+    }
+    return Matrices;
+}
+
+std::vector<float4> GenerateRandomVectors(size_t Count, unsigned int Seed)
+{
+    FastRandFloat Rnd{Seed, -10.f, +10.f};
+
+    std::vector<float4> Vectors(Count);
+    for (float4& v : Vectors)
+        v = float4{Rnd(), Rnd(), Rnd(), 1.f + std::abs(Rnd())};
+    return Vectors;
+}
+
+float3 XYZ(const float4& v)
+{
+    return float3{v.x, v.y, v.z};
+}
+
+std::vector<QuaternionF> GenerateRandomQuaternions(size_t Count, unsigned int Seed)
+{
+    FastRandFloat Rnd{Seed, -1.f, +1.f};
+
+    std::vector<QuaternionF> Quaternions(Count);
+    for (QuaternionF& q : Quaternions)
+        q = QuaternionF::RotationFromAxisAngle(float3{Rnd(), Rnd(), Rnd() + 2.f}, Rnd() * PI_F);
+    return Quaternions;
+}
+
+TEST(Common_BasicMathSIMD, Mul)
+{
+    const std::vector<float4x4> Matrices = GenerateRandomMatrices(64, 0);
+    for (size_t i = 0; i + 1 < Matrices.size(); ++i)
+    {
+        const float4x4& M1 = Matrices[i];
+        const float4x4& M2 = Matrices[i + 1];
+        EXPECT_MATRIX_NEAR(SIMDMath::Mul(M1, M2), M1 * M2, Epsilon);
+    }
+
+    EXPECT_EQ(SIMDMath::Mul(Matrices[0], float4x4::Identity()), Matrices[0]);
+    EXPECT_EQ(SIMDMath::Mul(float4x4::Identity(), Matrices[1]), Matrices[1]);
+}
+
+TEST(Common_BasicMathSIMD, Transform)
+{
+    const std::vector<float4x4> Matrices = GenerateRandomMatrices(16, 1);
+    const std::vector<float4>   Vectors  = GenerateRandomVectors(16, 2);
+    for (const float4x4& M : Matrices)
+    {
+        for (const float4& v : Vectors)
+            EXPECT_VECTOR_NEAR(SIMDMath::Transform(v, M), v * M, Epsilon);
+    }
+}
+
+TEST(Common_BasicMathSIMD, Transpose)
+{
+    for (const float4x4& M : GenerateRandomMatrices(16, 3))
+        EXPECT_EQ(SIMDMath::Transpose(M), M.Transpose());
+}
+
+TEST(Common_BasicMathSIMD, Inverse)
+{
+    for (const float4x4& M : GenerateRandomMatrices(64, 4))
+    {
+        const float4x4 Inv = SIMDMath::Inverse(M);
+        EXPECT_MATRIX_NEAR(Inv, M.Inverse(), 1e-4f);
+        EXPECT_MATRIX_NEAR(M * Inv, float4x4::Identity(), 1e-4f);
+    }
+
+    EXPECT_EQ(SIMDMath::Inverse(float4x4::Identity()), float4x4::Identity());
+}
+
+TEST(Common_BasicMathSIMD, QuaternionMul)
+{
+    const std::vector<QuaternionF> Quaternions = GenerateRandomQuaternions(64, 5);
+    for (size_t i = 0; i + 1 < Quaternions.size(); ++i)
+    {
+        const QuaternionF& q1 = Quaternions[i];
+        const QuaternionF& q2 = Quaternions[i + 1];
+        EXPECT_VECTOR_NEAR(SIMDMath::Mul(q1, q2).q, (q1 * q2).q, Epsilon);
+    }
+
+    EXPECT_EQ(SIMDMath::Mul(Quaternions[0], QuaternionF{}), Quaternions[0]);
+}
+
+TEST(Common_BasicMathSIMD, MultiplyMatrices)
+{
+    constexpr Uint32 Count = 37;
+
+    const std::vector<float4x4> Left  = GenerateRandomMatrices(Count, 6);
+    const std::vector<float4x4> Right = GenerateRandomMatrices(Count, 7);
+
+    std::vector<float4x4> Res(Count);
+    MultiplyMatrices(Left.data(), Right.data(), Res.data(), Count);
+    for (Uint32 i = 0; i < Count; ++i)
+        EXPECT_MATRIX_NEAR(Res[i], Left[i] * Right[i], Epsilon);
+
+    MultiplyMatrices(Left.data(), Right[0], Res.data(), Count);
+    for (Uint32 i = 0; i < Count; ++i)
+        EXPECT_MATRIX_NEAR(Res[i], Left[i] * Right[0], Epsilon);
+
+    MultiplyMatrices(Left[0], Right.data(), Res.data(), Count);
+    for (Uint32 i = 0; i < Count; ++i)
+        EXPECT_MATRIX_NEAR(Res[i], Left[0] * Right[i], Epsilon);
+
+    // In-place
+    Res = Left;
+    MultiplyMatrices(Res.data(), Right.data(), Res.data(), Count);
+    for (Uint32 i = 0; i < Count; ++i)
+        EXPECT_MATRIX_NEAR(Res[i], Left[i] * Right[i], Epsilon);
+
+    Res = Right;
+    MultiplyMatrices(Left[1], Res.data(), Res.data(), Count);
+    for (Uint32 i = 0; i < Count; ++i)
+        EXPECT_MATRIX_NEAR(Res[i], Left[1] * Right[i], Epsilon);
+
+    MultiplyMatrices(nullptr, Right[0], nullptr, 0);
+}
+
+TEST(Common_BasicMathSIMD, TransposeAndInvertMatrices)
+{
+    constexpr Uint32 Count = 19;
+
+    const std::vector<float4x4> Matrices = GenerateRandomMatrices(Count, 8);
+
+    std::vector<float4x4> Res(Count);
+    TransposeMatrices(Matrices.data(), Res.data(), Count);
+    for (Uint32 i = 0; i < Count; ++i)
+        EXPECT_EQ(Res[i], Matrices[i].Transpose());
+
+    InvertMatrices(Matrices.data(), Res.data(), Count);
+    for (Uint32 i = 0; i < Count; ++i)
+        EXPECT_MATRIX_NEAR(Res[i], Matrices[i].Inverse(), 1e-4f);
+
+    // In-place
+    Res = Matrices;
+    InvertMatrices(Res.data(), Res.data(), Count);
+    for (Uint32 i = 0; i < Count; ++i)
+        EXPECT_MATRIX_NEAR(Res[i], Matrices[i].Inverse(), 1e-4f);
+}
+
+TEST(Common_BasicMathSIMD, TransformPoints)
+{
+    constexpr Uint32 Count = 41;
+
+    const std::vector<float4x4> Matrices = GenerateRandomMatrices(4, 9);
+    const std::vector<float4>   Points4  = GenerateRandomVectors(Count, 10);
+
+    std::vector<float3> Points3(Count);
+    for (Uint32 i = 0; i < Count; ++i)
+        Points3[i] = XYZ(Points4[i]);
+
+    for (const float4x4& M : Matrices)
+    {
+        std::vector<float4> Res4(Count);
+        TransformPoints(Points4.data(), M, Res4.data(), Count);
+        for (Uint32 i = 0; i < Count; ++i)
+            EXPECT_VECTOR_NEAR(Res4[i], Points4[i] * M, Epsilon);
+
+        std::vector<float3> Res3(Count);
+        TransformPoints(Points3.data(), M, Res3.data(), Count);
+        for (Uint32 i = 0; i < Count; ++i)
+            EXPECT_VECTOR_NEAR(Res3[i], Points3[i] * M, Epsilon);
+
+        TransformVectors(Points3.data(), M, Res3.data(), Count);
+        for (Uint32 i = 0; i < Count; ++i)
+            EXPECT_VECTOR_NEAR(Res3[i], XYZ(float4{Points3[i], 0} * M), Epsilon);
+
+        // In-place
+        Res3 = Points3;
+        TransformPoints(Res3.data(), M, Res3.data(), Count);
+        for (Uint32 i = 0; i < Count; ++i)
+            EXPECT_VECTOR_NEAR(Res3[i], Points3[i] * M, Epsilon);
+    }
+}
+
+TEST(Common_BasicMathSIMD, MultiplyQuaternions)
+{
+    constexpr Uint32 Count = 23;
+
+    const std::vector<QuaternionF> Left  = GenerateRandomQuaternions(Count, 11);
+    const std::vector<QuaternionF> Right = GenerateRandomQuaternions(Count, 12);
+
+    std::vector<QuaternionF> Res(Count);
+    MultiplyQuaternions(Left.data(), Right.data(), Res.data(), Count);
+    for (Uint32 i = 0; i < Count; ++i)
+        EXPECT_VECTOR_NEAR(Res[i].q, (Left[i] * Right[i]).q, Epsilon);
+}
+
+} // namespace
@@ -27,9 +27,11 @@
 
 #include <climits>
 #include <sstream>
+#include <vector>
 
 #include "BasicMath.hpp"
 #include "AdvancedMath.hpp"
+#include "FastRand.hpp"
 
 #include "gtest/gtest.h"
 
@@ -2904,6 +2906,194 @@ TEST(Common_AdvancedMath, GetOrientedBoxVisibilityAgainstPlane)
     }
 }
 
+struct BoundBoxSoAData
+{
+    std::vector<float> Data[6];
+
+    explicit BoundBoxSoAData(const std::vector<BoundBox>& Boxes)
+    {
+        for (const BoundBox& Box : Boxes)
+        {
+            for (size_t c = 0; c < 3; ++c)
+            {
+                Data[c].push_back(Box.Min[c]);
+                Data[3 + c].push_back(Box.Max[c]);
+            }
+        }
+    }
+
+    BoundBoxSoA GetSoA() const
+    {
+        BoundBoxSoA SoA;
+        SoA.MinX = Data[0].data();
+        SoA.MinY = Data[1].data();
+        SoA.MinZ = Data[2].data();
+        SoA.MaxX = Data[3].data();
+        SoA.MaxY = Data[4].data();
+        SoA.MaxZ = Data[5].data();
+        return SoA;
+    }
+};
+
+struct OrientedBoundingBoxSoAData
+{
+    std::vector<float> Center[3];
+    std::vector<float> Axes[3][3];
+    std::vector<float> HalfExtents[3];
+
+    explicit OrientedBoundingBoxSoAData(const std::vector<OrientedBoundingBox>& Boxes)
+    {
+        for (const OrientedBoundingBox& Box : Boxes)
+        {
+            for (size_t c = 0; c < 3; ++c)
+            {
+                Center[c].push_back(Box.Center[c]);
+                HalfExtents[c].push_back(Box.HalfExtents[c]);
+                for (size_t a = 0; a < 3; ++a)
+                    Axes[a][c].push_back(Box.Axes[a][c]);
+            }
+        }
+    }
+
+    OrientedBoundingBoxSoA GetSoA() const
+    {
+        OrientedBoundingBoxSoA SoA;
+        SoA.CenterX = Center[0].data();
+        SoA.CenterY = Center[1].data();
+        SoA.CenterZ = Center[2].data();
+        for (size_t a = 0; a < 3; ++a)
+        {
+            for (size_t c = 0; c < 3; ++c)
+                SoA.Axes[a][c] = Axes[a][c].data();
+            SoA.HalfExtents[a] = HalfExtents[a].data();
+        }
+        return SoA;
+    }
+};
+
+ViewFrustum GetTestFrustum()
+{
+    const float4x4 View = float4x4::RotationY(0.5f) * float4x4::RotationX(-0.25f) * float4x4::Translation(1.f, -2.f, 30.f);
+    const float4x4 Proj = float4x4::Projection(PI_F / 3.f, 1.5f, 1.f, 100.f, false);
+
+    ViewFrustum Frustum;
+    ExtractViewFrustumPlanesFromMatrix(View * Proj, Frustum, false);
+    return Frustum;
+}
+
+std::vector<BoundBox> GenerateRandomBoxes(size_t NumBoxes, float Range)
+{
+    FastRandFloat RndPos{0, -Range, Range};
+    FastRandFloat RndSize{1, 0.f, Range * 0.1f};
+
+    std::vector<BoundBox> Boxes(NumBoxes);
+    for (BoundBox& Box : Boxes)
+    {
+        Box.Min = float3{RndPos(), RndPos(), RndPos()};
+        Box.Max = Box.Min + float3{RndSize(), RndSize(), RndSize()};
+    }
+    return Boxes;
+}
+
+std::vector<OrientedBoundingBox> GenerateRandomOrientedBoxes(size_t NumBoxes, float Range)
+{
+    FastRandFloat RndPos{0, -Range, Range};
+    FastRandFloat RndSize{1, 0.f, Range * 0.05f};
+    FastRandFloat RndAngle{2, -PI_F, PI_F};
+
+    std::vector<OrientedBoundingBox> Boxes(NumBoxes);
+    for (OrientedBoundingBox& Box : Boxes)
+    {
+        const float4x4 Rotation = float4x4::RotationX(RndAngle()) * float4x4::RotationY(RndAngle());
+
+        Box.Center = float3{RndPos(), RndPos(), RndPos()};
+        for (int a = 0; a < 3; ++a)
+        {
+            Box.Axes[a]        = float3{Rotation[a][0], Rotation[a][1], Rotation[a][2]};
+            Box.HalfExtents[a] = RndSize();
+        }
+    }
+    return Boxes;
+}
+
+template <typename BoxType, typename SoADataType>
+void TestBoxVisibilityBatch(const std::vector<BoxType>& Boxes)
+{
+    const ViewFrustum Frustum = GetTestFrustum();
+    const SoADataType SoAData{Boxes};
+
+    const Uint32 NumBoxes = static_cast<Uint32>(Boxes.size());
+    for (FRUSTUM_PLANE_FLAGS PlaneFlags : {FRUSTUM_PLANE_FLAG_FULL_FRUSTUM, FRUSTUM_PLANE_FLAG_OPEN_NEAR, FRUSTUM_PLANE_FLAG_LEFT_PLANE, FRUSTUM_PLANE_FLAG_NONE})
+    {
+        std::vector<Uint32> VisibleMask((NumBoxes + 31) / 32, ~0u);
+        std::vector<Uint32> FullyVisibleMask((NumBoxes + 31) / 32, ~0u);
+
+        const Uint32 NumVisible = GetBoxVisibilityBatch(Frustum, SoAData.GetSoA(), NumBoxes, VisibleMask.data(), FullyVisibleMask.data(), PlaneFlags);
+
+        Uint32 RefNumVisible  = 0;
+        Uint32 NumIntersected = 0;
+        for (Uint32 i = 0; i < NumBoxes; ++i)
+        {
+            const BoxVisibility RefVisibility = GetBoxVisibility(Frustum, Boxes[i], PlaneFlags);
+
+            const bool IsVisible      = (VisibleMask[i / 32] & (1u << (i % 32))) != 0;
+            const bool IsFullyVisible = (FullyVisibleMask[i / 32] & (1u << (i % 32))) != 0;
+            EXPECT_EQ(IsVisible, RefVisibility != BoxVisibility::Invisible) << "Box " << i << ", plane flags " << PlaneFlags;
+            EXPECT_EQ(IsFullyVisible, RefVisibility == BoxVisibility::FullyVisible) << "Box " << i << ", plane flags " << PlaneFlags;
+
+            if (RefVisibility != BoxVisibility::Invisible)
+                ++RefNumVisible;
+            if (RefVisibility == BoxVisibility::Intersecting)
+                ++NumIntersected;
+        }
+        EXPECT_EQ(NumVisible, RefNumVisible);
+        if (PlaneFlags == FRUSTUM_PLANE_FLAG_FULL_FRUSTUM && NumBoxes >= 1000)
+        {
+            // Make sure that the test covers all cases
+            EXPECT_GT(RefNumVisible, 0u);
+            EXPECT_LT(RefNumVisible, NumBoxes);
+            EXPECT_GT(NumIntersected, 0u);
+        }
+
+        // Bits past the last box must be cleared
+        if (NumBoxes % 32 != 0)
+        {
+            EXPECT_EQ(VisibleMask.back() >> (NumBoxes % 32), 0u);
+            EXPECT_EQ(FullyVisibleMask.back() >> (NumBoxes % 32), 0u);
+        }
+
+        // Fully visible mask is optional
+        std::vector<Uint32> VisibleMask2((NumBoxes + 31) / 32);
+        EXPECT_EQ(GetBoxVisibilityBatch(Frustum, SoAData.GetSoA(), NumBoxes, VisibleMask2.data(), nullptr, PlaneFlags), NumVisible);
+        EXPECT_EQ(VisibleMask2, VisibleMask);
+    }
+}
+
+TEST(Common_AdvancedMath, GetBoxVisibilityBatch)
+{
+    for (size_t NumBoxes : {1, 7, 31, 64, 1027})
+    {
+        std::vector<BoundBox> Boxes = GenerateRandomBoxes(NumBoxes, 60.f);
+        if (NumBoxes > 8)
+        {
+            // Degenerate boxes
+            Boxes[5].Max = Boxes[5].Min;
+            Boxes[6]     = {float3{0, 0, 0}, float3{0, 0, 0}};
+        }
+        TestBoxVisibilityBatch<BoundBox, BoundBoxSoAData>(Boxes);
+    }
+
+    TestBoxVisibilityBatch<BoundBox, BoundBoxSoAData>({});
+}
+
+TEST(Common_AdvancedMath, GetOrientedBoxVisibilityBatch)
+{
+    for (size_t NumBoxes : {7, 31, 64, 1027})
+    {
+        TestBoxVisibilityBatch<OrientedBoundingBox, OrientedBoundingBoxSoAData>(GenerateRandomOrientedBoxes(NumBoxes, 60.f));
+    }
+}
+
 TEST(Common_AdvancedMath, GetPointToBoxDistance)
 {
     BoundBox Box{float3{1, 2, 3}, float3{4, 5, 6}};
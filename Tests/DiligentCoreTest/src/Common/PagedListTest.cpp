@@ -0,0 +1,194 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "PagedList.hpp"
+
+#include <string>
+#include <vector>
+#include <list>
+
+#include "gtest/gtest.h"
+
+#include "FastRand.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+template <typename ListType>
+std::vector<int> ToVector(const ListType& List)
+{
+    return std::vector<int>{List.begin(), List.end()};
+}
+
+TEST(Common_PagedList, PushPop)
+{
+    PagedList<int, 4> List;
+    EXPECT_TRUE(List.empty());
+    EXPECT_EQ(List.begin(), List.end());
+
+    List.push_back(1);
+    List.push_back(2);
+    List.push_front(0);
+    EXPECT_EQ(List.size(), size_t{3});
+    EXPECT_EQ(List.front(), 0);
+    EXPECT_EQ(List.back(), 2);
+    EXPECT_EQ(ToVector(List), (std::vector<int>{0, 1, 2}));
+
+    List.pop_front();
+    List.pop_back();
+    EXPECT_EQ(ToVector(List), (std::vector<int>{1}));
+
+    List.pop_back();
+    EXPECT_TRUE(List.empty());
+}
+
+TEST(Common_PagedList, InsertErase)
+{
+    PagedList<int, 4> List;
+    for (int i = 0; i < 10; ++i)
+        List.push_back(i);
+    EXPECT_EQ(List.GetPageCount(), size_t{3});
+
+    auto It = List.begin();
+    std::advance(It, 5);
+    It = List.insert(It, 100);
+    EXPECT_EQ(*It, 100);
+    It = List.erase(It);
+    EXPECT_EQ(*It, 5);
+
+    auto Last = It;
+    std::advance(Last, 3);
+    It = List.erase(It, Last);
+    EXPECT_EQ(*It, 8);
+    EXPECT_EQ(ToVector(List), (std::vector<int>{0, 1, 2, 3, 4, 8, 9}));
+
+    // Erased nodes must be reused
+    for (int i = 0; i < 3; ++i)
+        List.push_front(-1);
+    EXPECT_EQ(List.GetPageCount(), size_t{3});
+
+    List.clear();
+    EXPECT_TRUE(List.empty());
+    EXPECT_EQ(List.GetPageCount(), size_t{3});
+}
+
+TEST(Common_PagedList, PointerStability)
+{
+    PagedList<std::string, 2> List;
+
+    std::vector<const std::string*> Ptrs;
+    for (int i = 0; i < 32; ++i)
+    {
+        List.emplace_back(std::to_string(i));
+        Ptrs.push_back(&List.back());
+    }
+
+    int i = 0;
+    for (const auto& Str : List)
+    {
+        EXPECT_EQ(&Str, Ptrs[i]);
+        EXPECT_EQ(Str, std::to_string(i));
+        ++i;
+    }
+}
+
+TEST(Common_PagedList, CopyMove)
+{
+    PagedList<std::string, 4> List;
+    for (int i = 0; i < 10; ++i)
+        List.emplace_back(std::to_string(i));
+
+    PagedList<std::string, 4> Copy{List};
+    EXPECT_EQ(Copy.size(), List.size());
+    EXPECT_TRUE(std::equal(List.begin(), List.end(), Copy.begin()));
+
+    const std::string* pFront = &List.front();
+    auto               It     = List.begin();
+
+    PagedList<std::string, 4> Moved{std::move(List)};
+    EXPECT_TRUE(List.empty());
+    EXPECT_EQ(List.begin(), List.end());
+    EXPECT_EQ(&Moved.front(), pFront);
+    EXPECT_EQ(It, Moved.begin());
+    EXPECT_EQ(Moved.size(), size_t{10});
+
+    // Iterating backwards from end() must reach the moved head
+    size_t Count = 0;
+    for (auto RevIt = Moved.end(); RevIt != Moved.begin(); --RevIt)
+        ++Count;
+    EXPECT_EQ(Count, size_t{10});
+
+    List = Moved;
+    EXPECT_TRUE(std::equal(List.begin(), List.end(), Moved.begin()));
+
+    Copy.clear();
+    Copy.emplace_back("x");
+    Copy.swap(Moved);
+    EXPECT_EQ(Moved.size(), size_t{1});
+    EXPECT_EQ(Copy.size(), size_t{10});
+    EXPECT_EQ(Moved.front(), "x");
+    EXPECT_EQ(Copy.back(), "9");
+}
+
+TEST(Common_PagedList, Random)
+{
+    FastRandInt Rnd{0, 0, 99};
+
+    PagedList<int, 8> List;
+    std::list<int>    RefList;
+    for (int i = 0; i < 4096; ++i)
+    {
+        const int Op = Rnd();
+        if (Op < 60 || RefList.empty())
+        {
+            size_t Pos = RefList.empty() ? 0 : static_cast<size_t>(Rnd()) % (RefList.size() + 1);
+
+            auto It    = List.begin();
+            auto RefIt = RefList.begin();
+            std::advance(It, Pos);
+            std::advance(RefIt, Pos);
+            List.insert(It, i);
+            RefList.insert(RefIt, i);
+        }
+        else
+        {
+            size_t Pos = static_cast<size_t>(Rnd()) % RefList.size();
+
+            auto It    = List.begin();
+            auto RefIt = RefList.begin();
+            std::advance(It, Pos);
+            std::advance(RefIt, Pos);
+            List.erase(It);
+            RefList.erase(RefIt);
+        }
+        ASSERT_EQ(List.size(), RefList.size());
+    }
+    EXPECT_EQ(ToVector(List), (std::vector<int>{RefList.begin(), RefList.end()}));
+}
+
+} // namespace
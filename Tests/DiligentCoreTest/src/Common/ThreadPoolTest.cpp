@@ -32,6 +32,7 @@
 #include <cmath>
 
 #include "ThreadSignal.hpp"
+#include "FastRand.hpp"
 
 
 using namespace Diligent;
@@ -39,11 +40,12 @@ using namespace Diligent;
 namespace
 {
 
-TEST(Common_ThreadPool, EnqueueTask)
+void TestEnqueueTask(THREAD_POOL_SCHEDULER Scheduler)
 {
     constexpr Uint32     NumThreads = 4;
     constexpr Uint32     NumTasks   = 32;
     ThreadPoolCreateInfo PoolCI{NumThreads};
+    PoolCI.Scheduler = Scheduler;
 
     std::array<std::atomic<bool>, NumThreads> ThreadStarted{};
 
@@ -100,13 +102,23 @@ TEST(Common_ThreadPool, EnqueueTask)
     EXPECT_EQ(NumThreadsFinished.load(), PoolCI.NumThreads);
 }
 
+TEST(Common_ThreadPool, EnqueueTask)
+{
+    TestEnqueueTask(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
 
-TEST(Common_ThreadPool, ProcessTask)
+TEST(Common_ThreadPool, EnqueueTask_WorkStealing)
+{
+    TestEnqueueTask(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+
+void TestProcessTask(THREAD_POOL_SCHEDULER Scheduler)
 {
     constexpr Uint32 NumThreads = 4;
     constexpr Uint32 NumTasks   = 32;
 
-    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{0});
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{0, nullptr, nullptr, Scheduler});
     ASSERT_NE(pThreadPool, nullptr);
 
     std::vector<std::thread> WorkerThreads(NumThreads);
@@ -164,6 +176,16 @@ TEST(Common_ThreadPool, ProcessTask)
     }
 }
 
+TEST(Common_ThreadPool, ProcessTask)
+{
+    TestProcessTask(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPool, ProcessTask_WorkStealing)
+{
+    TestProcessTask(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
 class WaitTask : public AsyncTaskBase
 {
 public:
@@ -197,11 +219,11 @@ public:
     }
 };
 
-TEST(Common_ThreadPool, RemoveTask)
+void TestRemoveTask(THREAD_POOL_SCHEDULER Scheduler)
 {
     constexpr Uint32 NumThreads = 4;
 
-    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads});
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads, nullptr, nullptr, Scheduler});
     ASSERT_NE(pThreadPool, nullptr);
 
     Threading::Signal Signal;
@@ -250,12 +272,22 @@ TEST(Common_ThreadPool, RemoveTask)
     EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
 }
 
+TEST(Common_ThreadPool, RemoveTask)
+{
+    TestRemoveTask(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
 
-TEST(Common_ThreadPool, Reprioritize)
+TEST(Common_ThreadPool, RemoveTask_WorkStealing)
+{
+    TestRemoveTask(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+
+void TestReprioritize(THREAD_POOL_SCHEDULER Scheduler)
 {
     constexpr Uint32 NumThreads = 4;
 
-    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads});
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads, nullptr, nullptr, Scheduler});
     ASSERT_NE(pThreadPool, nullptr);
 
     Threading::Signal Signal;
@@ -298,6 +330,16 @@ TEST(Common_ThreadPool, Reprioritize)
     pThreadPool->WaitForAllTasks();
 }
 
+TEST(Common_ThreadPool, Reprioritize)
+{
+    TestReprioritize(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPool, Reprioritize_WorkStealing)
+{
+    TestReprioritize(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
 
 TEST(Common_ThreadPool, Priorities)
 {
@@ -362,11 +404,11 @@ TEST(Common_ThreadPool, Priorities)
 }
 
 
-TEST(Common_ThreadPool, Prerequisites)
+void TestPrerequisites(THREAD_POOL_SCHEDULER Scheduler)
 {
     for (Uint32 NumThreads : {1, 8})
     {
-        auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads});
+        auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads, nullptr, nullptr, Scheduler});
         ASSERT_NE(pThreadPool, nullptr);
 
         constexpr Uint32               NumTasks = 16;
@@ -414,10 +456,20 @@ TEST(Common_ThreadPool, Prerequisites)
     }
 }
 
+TEST(Common_ThreadPool, Prerequisites)
+{
+    TestPrerequisites(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
 
-TEST(Common_ThreadPool, ReRunTasks)
+TEST(Common_ThreadPool, Prerequisites_WorkStealing)
 {
-    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    TestPrerequisites(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+
+void TestReRunTasks(THREAD_POOL_SCHEDULER Scheduler)
+{
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4, nullptr, nullptr, Scheduler});
     ASSERT_NE(pThreadPool, nullptr);
 
     constexpr Uint32              NumTasks = 32;
@@ -442,4 +494,664 @@ TEST(Common_ThreadPool, ReRunTasks)
         EXPECT_EQ(ReRunCounters[i], 0) << i;
 }
 
+TEST(Common_ThreadPool, ReRunTasks)
+{
+    TestReRunTasks(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPool, ReRunTasks_WorkStealing)
+{
+    TestReRunTasks(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+void TestDependencyGraph(THREAD_POOL_SCHEDULER Scheduler)
+{
+    constexpr Uint32 NumThreads       = 4;
+    constexpr Uint32 NumTasks         = 10000;
+    constexpr Uint32 MaxPrerequisites = 4;
+
+    // Use manually processed threads to count the number of dequeues
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{0, nullptr, nullptr, Scheduler});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    std::atomic<Uint32>      NumProcessTaskCalls{0};
+    std::vector<std::thread> WorkerThreads(NumThreads);
+    for (Uint32 i = 0; i < NumThreads; ++i)
+    {
+        WorkerThreads[i] = std::thread{
+            [&ThreadPool = *pThreadPool, &NumProcessTaskCalls, i] //
+            {
+                while (ThreadPool.ProcessTask(i, true))
+                    NumProcessTaskCalls.fetch_add(1);
+            }};
+    }
+
+    std::vector<std::atomic<bool>>         TaskComplete(NumTasks);
+    std::vector<std::vector<Uint32>>       TaskPrereqs(NumTasks);
+    std::vector<RefCntAutoPtr<IAsyncTask>> Tasks(NumTasks);
+    std::atomic<Uint32>                    NumTasksRun{0};
+    std::atomic<Uint32>                    NumOrderViolations{0};
+
+    FastRand Rnd{0};
+    for (Uint32 task = 0; task < NumTasks; ++task)
+    {
+        // Make every task depend on a few recent tasks to build a deep graph
+        std::vector<IAsyncTask*> Prerequisites;
+        const Uint32             NumPrereqs = task > 0 ? Rnd() % (MaxPrerequisites + 1) : 0;
+        for (Uint32 i = 0; i < NumPrereqs; ++i)
+        {
+            const Uint32 Prereq = task - 1 - Rnd() % std::min(task, 64u);
+            TaskPrereqs[task].push_back(Prereq);
+            Prerequisites.push_back(Tasks[Prereq]);
+        }
+
+        Tasks[task] =
+            EnqueueAsyncWork(
+                pThreadPool,
+                Prerequisites.data(),
+                static_cast<Uint32>(Prerequisites.size()),
+                [task, &TaskComplete, &TaskPrereqs, &NumTasksRun, &NumOrderViolations](Uint32 ThreadId) //
+                {
+                    for (Uint32 Prereq : TaskPrereqs[task])
+                    {
+                        if (!TaskComplete[Prereq].load())
+                            NumOrderViolations.fetch_add(1);
+                    }
+                    TaskComplete[task].store(true);
+                    NumTasksRun.fetch_add(1);
+                    return ASYNC_TASK_STATUS_COMPLETE;
+                },
+                static_cast<float>(Rnd() % 4));
+    }
+
+    pThreadPool->WaitForAllTasks();
+    EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+
+    pThreadPool->StopThreads();
+    for (auto& Thread : WorkerThreads)
+        Thread.join();
+
+    EXPECT_EQ(NumTasksRun.load(), NumTasks);
+    EXPECT_EQ(NumOrderViolations.load(), 0u);
+
+    // Every call to ProcessTask() that does not run a task is a wasted dequeue
+    const Uint32 NumWastedDequeues = NumProcessTaskCalls.load() - NumTasksRun.load();
+    EXPECT_EQ(NumWastedDequeues, 0u);
+    LOG_INFO_MESSAGE(Scheduler == THREAD_POOL_SCHEDULER_PRIORITY_QUEUE ? "Priority queue" : "Work stealing",
+                     " scheduler: ", NumTasks, "-node graph, ", NumWastedDequeues, " wasted dequeues");
+}
+
+TEST(Common_ThreadPool, DependencyGraph)
+{
+    TestDependencyGraph(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPool, DependencyGraph_WorkStealing)
+{
+    TestDependencyGraph(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+
+void TestExternalPrerequisites(THREAD_POOL_SCHEDULER Scheduler)
+{
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{2, nullptr, nullptr, Scheduler});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    // Prerequisites that are not run by the pool
+    RefCntAutoPtr<DummyTask> pExternalTask{MakeNewRCObj<DummyTask>()()};
+    RefCntAutoPtr<DummyTask> pDestroyedTask{MakeNewRCObj<DummyTask>()()};
+
+    std::atomic<bool> Task1Complete{false};
+    std::atomic<bool> Task2Complete{false};
+
+    IAsyncTask* pPrereq1 = pExternalTask;
+    auto        pTask1   = EnqueueAsyncWork(pThreadPool, &pPrereq1, 1,
+                                            [&](Uint32 ThreadId) {
+                                       Task1Complete.store(true);
+                                       return ASYNC_TASK_STATUS_COMPLETE;
+                                   });
+
+    IAsyncTask* pPrereq2 = pDestroyedTask;
+    auto        pTask2   = EnqueueAsyncWork(pThreadPool, &pPrereq2, 1,
+                                            [&](Uint32 ThreadId) {
+                                       Task2Complete.store(true);
+                                       return ASYNC_TASK_STATUS_COMPLETE;
+                                   });
+
+    IAsyncTask* pPrereq3 = pExternalTask;
+    auto        pTask3   = EnqueueAsyncWork(pThreadPool, &pPrereq3, 1,
+                                            [&](Uint32 ThreadId) {
+                                       return ASYNC_TASK_STATUS_COMPLETE;
+                                   });
+
+    EXPECT_EQ(pThreadPool->GetQueueSize(), 3u);
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    EXPECT_FALSE(Task1Complete.load());
+    EXPECT_FALSE(Task2Complete.load());
+
+    // Waiting tasks can be reprioritized and removed
+    pTask3->SetPriority(2);
+    EXPECT_TRUE(pThreadPool->ReprioritizeTask(pTask3));
+    EXPECT_TRUE(pThreadPool->RemoveTask(pTask3));
+    EXPECT_FALSE(pThreadPool->RemoveTask(pTask3));
+    EXPECT_EQ(pThreadPool->GetQueueSize(), 2u);
+
+    // Destroyed prerequisites are considered finished
+    pDestroyedTask.Release();
+    pTask2->WaitForCompletion();
+    EXPECT_TRUE(Task2Complete.load());
+    EXPECT_FALSE(Task1Complete.load());
+
+    pExternalTask->SetStatus(ASYNC_TASK_STATUS_RUNNING);
+    pExternalTask->SetStatus(ASYNC_TASK_STATUS_COMPLETE);
+
+    pThreadPool->WaitForAllTasks();
+    EXPECT_TRUE(Task1Complete.load());
+    EXPECT_EQ(pTask3->GetStatus(), ASYNC_TASK_STATUS_NOT_STARTED);
+    EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+}
+
+TEST(Common_ThreadPool, ExternalPrerequisites)
+{
+    TestExternalPrerequisites(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPool, ExternalPrerequisites_WorkStealing)
+{
+    TestExternalPrerequisites(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+void TestStopWithExternalPrerequisites(THREAD_POOL_SCHEDULER Scheduler)
+{
+    RefCntAutoPtr<DummyTask> pExternalTask{MakeNewRCObj<DummyTask>()()};
+
+    std::atomic<bool> TaskComplete{false};
+
+    // Worker threads must not exit while tasks wait for prerequisites that run elsewhere
+    {
+        auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{2, nullptr, nullptr, Scheduler});
+        ASSERT_NE(pThreadPool, nullptr);
+
+        IAsyncTask* pPrereq = pExternalTask;
+        EnqueueAsyncWork(pThreadPool, &pPrereq, 1,
+                         [&](Uint32 ThreadId) {
+                             TaskComplete.store(true);
+                             return ASYNC_TASK_STATUS_COMPLETE;
+                         });
+
+        std::atomic<bool> Stopped{false};
+        std::thread       StopThread{
+            [&]() {
+                pThreadPool->StopThreads();
+                Stopped.store(true);
+            }};
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        EXPECT_FALSE(Stopped.load());
+        EXPECT_FALSE(TaskComplete.load());
+
+        pExternalTask->SetStatus(ASYNC_TASK_STATUS_RUNNING);
+        pExternalTask->SetStatus(ASYNC_TASK_STATUS_COMPLETE);
+
+        StopThread.join();
+        EXPECT_TRUE(TaskComplete.load());
+    }
+
+    // A thread that processes the tasks of a stopped pool must sleep until the prerequisite is finished
+    {
+        auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{0, nullptr, nullptr, Scheduler});
+        ASSERT_NE(pThreadPool, nullptr);
+
+        pExternalTask = MakeNewRCObj<DummyTask>()();
+        TaskComplete.store(false);
+
+        IAsyncTask* pPrereq = pExternalTask;
+        EnqueueAsyncWork(pThreadPool, &pPrereq, 1,
+                         [&](Uint32 ThreadId) {
+                             TaskComplete.store(true);
+                             return ASYNC_TASK_STATUS_COMPLETE;
+                         });
+        pThreadPool->StopThreads();
+
+        std::atomic<int> NumCalls{0};
+        std::thread      WorkerThread{
+            [&ThreadPool = *pThreadPool, &NumCalls]() {
+                while (ThreadPool.ProcessTask(0, true))
+                    NumCalls.fetch_add(1);
+            }};
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        EXPECT_EQ(NumCalls.load(), 0);
+        EXPECT_FALSE(TaskComplete.load());
+
+        pExternalTask->SetStatus(ASYNC_TASK_STATUS_RUNNING);
+        pExternalTask->SetStatus(ASYNC_TASK_STATUS_COMPLETE);
+
+        WorkerThread.join();
+        EXPECT_TRUE(TaskComplete.load());
+        EXPECT_EQ(NumCalls.load(), 1);
+    }
+}
+
+TEST(Common_ThreadPool, StopWithExternalPrerequisites)
+{
+    TestStopWithExternalPrerequisites(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPool, StopWithExternalPrerequisites_WorkStealing)
+{
+    TestStopWithExternalPrerequisites(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+void TestReusedPrerequisiteAddress(THREAD_POOL_SCHEDULER Scheduler)
+{
+    // The pool has no threads, so the completion of the destroyed prerequisite is not processed
+    // until ProcessTask() is called.
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{0, nullptr, nullptr, Scheduler});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    RefCntAutoPtr<DummyTask> pDestroyedTask{MakeNewRCObj<DummyTask>()()};
+    const IAsyncTask* const  pDestroyedTaskAddr = pDestroyedTask;
+
+    IAsyncTask* pPrereq1 = pDestroyedTask;
+    auto        pTask1   = EnqueueAsyncWork(pThreadPool, &pPrereq1, 1,
+                                            [&](Uint32 ThreadId) {
+                                       return ASYNC_TASK_STATUS_COMPLETE;
+                                   });
+    pDestroyedTask.Release();
+
+    // Try to create a task at the address of the destroyed one
+    std::vector<RefCntAutoPtr<DummyTask>> Tasks;
+    RefCntAutoPtr<DummyTask>              pExternalTask;
+    for (size_t i = 0; i < 1024 && !pExternalTask; ++i)
+    {
+        RefCntAutoPtr<DummyTask> pTask{MakeNewRCObj<DummyTask>()()};
+        if (pTask.RawPtr<IAsyncTask>() == pDestroyedTaskAddr)
+            pExternalTask = std::move(pTask);
+        else
+            Tasks.emplace_back(std::move(pTask));
+    }
+    if (!pExternalTask)
+    {
+        while (pThreadPool->ProcessTask(0, false) && pThreadPool->GetQueueSize() > 0)
+        {
+        }
+        GTEST_SKIP() << "The address of the destroyed task was not reused";
+    }
+
+    IAsyncTask* pPrereq2 = pExternalTask;
+    auto        pTask2   = EnqueueAsyncWork(pThreadPool, &pPrereq2, 1,
+                                            [&](Uint32 ThreadId) {
+                                       return ASYNC_TASK_STATUS_COMPLETE;
+                                   });
+
+    pThreadPool->ProcessTask(0, false);
+    EXPECT_EQ(pTask1->GetStatus(), ASYNC_TASK_STATUS_COMPLETE);
+    EXPECT_EQ(pTask2->GetStatus(), ASYNC_TASK_STATUS_NOT_STARTED);
+
+    // The new task must notify the pool when it is finished
+    pExternalTask->SetStatus(ASYNC_TASK_STATUS_RUNNING);
+    pExternalTask->SetStatus(ASYNC_TASK_STATUS_COMPLETE);
+    pThreadPool->ProcessTask(0, false);
+    EXPECT_EQ(pTask2->GetStatus(), ASYNC_TASK_STATUS_COMPLETE);
+    EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+}
+
+TEST(Common_ThreadPool, ReusedPrerequisiteAddress)
+{
+    TestReusedPrerequisiteAddress(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPool, ReusedPrerequisiteAddress_WorkStealing)
+{
+    TestReusedPrerequisiteAddress(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+TEST(Common_ThreadPool, CompletionCallbacks)
+{
+    int NumCalls = 0;
+
+    RefCntAutoPtr<DummyTask> pTask{MakeNewRCObj<DummyTask>()()};
+    EXPECT_TRUE(pTask->AddCompletionCallback([&]() { ++NumCalls; }));
+    EXPECT_TRUE(pTask->AddCompletionCallback([&]() { ++NumCalls; }));
+
+    pTask->SetStatus(ASYNC_TASK_STATUS_RUNNING);
+    EXPECT_EQ(NumCalls, 0);
+    pTask->SetStatus(ASYNC_TASK_STATUS_COMPLETE);
+    EXPECT_EQ(NumCalls, 2);
+
+    // Callbacks are not registered for finished tasks
+    EXPECT_FALSE(pTask->AddCompletionCallback([&]() { ++NumCalls; }));
+    pTask.Release();
+    EXPECT_EQ(NumCalls, 2);
+
+    // Destroyed tasks invoke the callbacks
+    pTask = MakeNewRCObj<DummyTask>()();
+    EXPECT_TRUE(pTask->AddCompletionCallback([&]() { ++NumCalls; }));
+    pTask.Release();
+    EXPECT_EQ(NumCalls, 3);
+}
+
+TEST(Common_ThreadPool, Priorities_WorkStealing)
+{
+    constexpr Uint32 NumBuckets  = 4;
+    constexpr Uint32 RepeatCount = 10;
+
+    for (Uint32 k = 0; k < RepeatCount; ++k)
+    {
+        ThreadPoolCreateInfo PoolCI{1};
+        PoolCI.Scheduler          = THREAD_POOL_SCHEDULER_WORK_STEALING;
+        PoolCI.NumPriorityBuckets = NumBuckets;
+
+        auto pThreadPool = CreateThreadPool(PoolCI);
+        ASSERT_NE(pThreadPool, nullptr);
+
+        Threading::Signal       Signal;
+        RefCntAutoPtr<WaitTask> pWaitTask{MakeNewRCObj<WaitTask>()(Signal)};
+        pThreadPool->EnqueueTask(pWaitTask);
+        pWaitTask->WaitUntilRunning();
+
+        std::vector<int> CompletionOrder;
+        // Priorities are clamped to the [0, NumBuckets - 1] range
+        const std::array<float, 6> Priorities = {-1.f, 1.5f, 0.f, 3.f, 100.f, 2.f};
+
+        std::array<RefCntAutoPtr<IAsyncTask>, Priorities.size()> Tasks;
+        for (int i = 0; i < static_cast<int>(Tasks.size()); ++i)
+        {
+            Tasks[i] =
+                EnqueueAsyncWork(pThreadPool,
+                                 [&CompletionOrder, i](Uint32 ThreadId) //
+                                 {
+                                     CompletionOrder.push_back(i);
+                                     return ASYNC_TASK_STATUS_COMPLETE;
+                                 });
+            Tasks[i]->SetPriority(Priorities[i]);
+        }
+        pThreadPool->ReprioritizeAllTasks();
+        EXPECT_EQ(pThreadPool->GetQueueSize(), Tasks.size());
+
+        Signal.Trigger(true, 1);
+        pThreadPool->WaitForAllTasks();
+
+        // Tasks 3 and 4 are in the same bucket, so their order is not defined.
+        // The same applies to tasks 0 and 2.
+        ASSERT_EQ(CompletionOrder.size(), Tasks.size());
+        EXPECT_TRUE((CompletionOrder[0] == 3 && CompletionOrder[1] == 4) || (CompletionOrder[0] == 4 && CompletionOrder[1] == 3));
+        EXPECT_EQ(CompletionOrder[2], 5);
+        EXPECT_EQ(CompletionOrder[3], 1);
+        EXPECT_TRUE((CompletionOrder[4] == 0 && CompletionOrder[5] == 2) || (CompletionOrder[4] == 2 && CompletionOrder[5] == 0));
+    }
+}
+
+
+TEST(Common_ThreadPool, NestedTasks_WorkStealing)
+{
+    ThreadPoolCreateInfo PoolCI{4};
+    PoolCI.Scheduler = THREAD_POOL_SCHEDULER_WORK_STEALING;
+
+    auto pThreadPool = CreateThreadPool(PoolCI);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    // Every task spawns child tasks from the worker thread, which go
+    // to the worker's local deque and are stolen by other workers.
+    constexpr Uint32    NumRootTasks = 16;
+    constexpr Uint32    Depth        = 6;
+    std::atomic<Uint32> NumTasksRun{0};
+
+    std::function<void(Uint32)> SpawnTask = [&](Uint32 Level) {
+        EnqueueAsyncWork(pThreadPool,
+                         [&, Level](Uint32 ThreadId) //
+                         {
+                             NumTasksRun.fetch_add(1);
+                             if (Level + 1 < Depth)
+                             {
+                                 SpawnTask(Level + 1);
+                                 SpawnTask(Level + 1);
+                             }
+                             return ASYNC_TASK_STATUS_COMPLETE;
+                         });
+    };
+
+    for (Uint32 i = 0; i < NumRootTasks; ++i)
+        SpawnTask(0);
+
+    pThreadPool->WaitForAllTasks();
+    EXPECT_EQ(NumTasksRun.load(), NumRootTasks * ((1u << Depth) - 1u));
+    EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+    EXPECT_EQ(pThreadPool->GetRunningTaskCount(), 0u);
+}
+
+
+// Checks that every task runs exactly once when many small tasks are enqueued
+// by multiple producer threads and by the worker threads themselves.
+TEST(Common_ThreadPool, SchedulerContention)
+{
+    constexpr Uint32 NumThreads          = 4;
+    constexpr Uint32 NumProducers        = 2;
+    constexpr Uint32 NumTasksPerProducer = 1024;
+    constexpr Uint32 NumChildTasks       = 2;
+
+    for (THREAD_POOL_SCHEDULER Scheduler : {THREAD_POOL_SCHEDULER_PRIORITY_QUEUE, THREAD_POOL_SCHEDULER_WORK_STEALING})
+    {
+        ThreadPoolCreateInfo PoolCI{NumThreads};
+        PoolCI.Scheduler = Scheduler;
+
+        auto pThreadPool = CreateThreadPool(PoolCI);
+        ASSERT_NE(pThreadPool, nullptr);
+
+        std::atomic<Uint32> NumTasksRun{0};
+
+        auto Work = [&NumTasksRun](Uint32 ThreadId) {
+            NumTasksRun.fetch_add(1);
+            return ASYNC_TASK_STATUS_COMPLETE;
+        };
+
+        std::vector<std::thread> Producers(NumProducers);
+        for (auto& Producer : Producers)
+        {
+            Producer = std::thread{
+                [&]() {
+                    for (Uint32 i = 0; i < NumTasksPerProducer; ++i)
+                    {
+                        EnqueueAsyncWork(pThreadPool,
+                                         [&, i](Uint32 ThreadId) {
+                                             for (Uint32 c = 0; c < NumChildTasks; ++c)
+                                                 EnqueueAsyncWork(pThreadPool, Work, static_cast<float>(i % 4));
+                                             return Work(ThreadId);
+                                         });
+                    }
+                }};
+        }
+        for (auto& Producer : Producers)
+            Producer.join();
+
+        pThreadPool->WaitForAllTasks();
+
+        EXPECT_EQ(NumTasksRun.load(), NumProducers * NumTasksPerProducer * (1 + NumChildTasks));
+    }
+}
+
+void TestParallelFor(THREAD_POOL_SCHEDULER Scheduler)
+{
+    constexpr Uint32 NumThreads = 4;
+
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads, nullptr, nullptr, Scheduler});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    for (Uint32 RangeSize : {0u, 1u, 7u, 1000u, 100000u})
+    {
+        for (Uint32 MinChunkSize : {1u, 16u})
+        {
+            constexpr Uint32 Begin = 10;
+
+            std::vector<std::atomic<Uint32>> Counters(RangeSize);
+            ParallelFor(
+                pThreadPool, Begin, Begin + RangeSize,
+                [&Counters](Uint32 Index) {
+                    Counters[Index - Begin].fetch_add(1);
+                },
+                MinChunkSize, 0, NumThreads + 1);
+
+            for (Uint32 i = 0; i < RangeSize; ++i)
+                EXPECT_EQ(Counters[i].load(), 1u) << "Range size: " << RangeSize << "; index: " << i;
+        }
+    }
+
+    std::atomic<Uint32> NumCalls{0};
+    ParallelForRange(
+        pThreadPool, 0, 1024,
+        [&NumCalls](Uint32 RangeBegin, Uint32 RangeEnd) {
+            EXPECT_LT(RangeBegin, RangeEnd);
+            EXPECT_TRUE(RangeEnd - RangeBegin >= 64 || RangeEnd == 1024);
+            NumCalls.fetch_add(1);
+        },
+        64, 0, NumThreads + 1);
+    EXPECT_LE(NumCalls.load(), 1024u / 64u);
+
+    pThreadPool->WaitForAllTasks();
+}
+
+TEST(Common_ThreadPool, ParallelFor)
+{
+    TestParallelFor(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPool, ParallelFor_WorkStealing)
+{
+    TestParallelFor(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+TEST(Common_ThreadPool, ParallelFor_NoPool)
+{
+    std::vector<Uint32> Values(100);
+    ParallelFor(nullptr, 0, static_cast<Uint32>(Values.size()),
+                [&Values](Uint32 Index) {
+                    Values[Index] = Index;
+                });
+    for (Uint32 i = 0; i < Values.size(); ++i)
+        EXPECT_EQ(Values[i], i);
+}
+
+
+void TestNestedParallelFor(THREAD_POOL_SCHEDULER Scheduler)
+{
+    // Nested loops must not deadlock even if all worker threads are busy with the outer loop
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{1, nullptr, nullptr, Scheduler});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    constexpr Uint32 NumOuter = 16;
+    constexpr Uint32 NumInner = 1000;
+
+    std::atomic<Uint32> Sum{0};
+    ParallelFor(
+        pThreadPool, 0, NumOuter,
+        [&](Uint32 i) {
+            ParallelFor(
+                pThreadPool, 0, NumInner,
+                [&Sum](Uint32 j) {
+                    Sum.fetch_add(1);
+                },
+                1, 0, 4);
+        },
+        1, 0, 4);
+    EXPECT_EQ(Sum.load(), NumOuter * NumInner);
+
+    pThreadPool->WaitForAllTasks();
+}
+
+TEST(Common_ThreadPool, NestedParallelFor)
+{
+    TestNestedParallelFor(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPool, NestedParallelFor_WorkStealing)
+{
+    TestNestedParallelFor(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+
+void TestTaskGroup(THREAD_POOL_SCHEDULER Scheduler)
+{
+    constexpr Uint32 NumThreads = 2;
+
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads, nullptr, nullptr, Scheduler});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    // Block all worker threads with unrelated tasks
+    Threading::Signal                               Signal;
+    std::array<RefCntAutoPtr<WaitTask>, NumThreads> WaitTasks;
+    for (auto& Task : WaitTasks)
+    {
+        Task = MakeNewRCObj<WaitTask>()(Signal);
+        pThreadPool->EnqueueTask(Task);
+        Task->WaitUntilRunning();
+    }
+
+    {
+        // The group must be complete even though the pool can't run any of its tasks
+        constexpr Uint32 NumTasks = 64;
+
+        std::atomic<Uint32> NumTasksRun{0};
+        TaskGroup           Group{pThreadPool};
+        for (Uint32 i = 0; i < NumTasks; ++i)
+        {
+            Group.Run([&NumTasksRun, &Group, i]() {
+                // Tasks may add more tasks to the group
+                if (i % 2 == 0)
+                {
+                    Group.Run([&NumTasksRun]() {
+                        NumTasksRun.fetch_add(1);
+                    });
+                }
+                NumTasksRun.fetch_add(1);
+            });
+        }
+        Group.Wait();
+        EXPECT_EQ(NumTasksRun.load(), NumTasks + NumTasks / 2);
+
+        std::atomic<Uint32> Sum{0};
+        ParallelFor(
+            pThreadPool, 0, 100,
+            [&Sum](Uint32) {
+                Sum.fetch_add(1);
+            },
+            1, 0, NumThreads + 1);
+        EXPECT_EQ(Sum.load(), 100u);
+    }
+
+    for (auto& Task : WaitTasks)
+        EXPECT_EQ(Task->GetStatus(), ASYNC_TASK_STATUS_RUNNING);
+
+    Signal.Trigger(true);
+    pThreadPool->WaitForAllTasks();
+
+    {
+        // Group tasks executed by the pool
+        std::atomic<Uint32> NumTasksRun{0};
+        {
+            TaskGroup Group{pThreadPool};
+            for (Uint32 i = 0; i < 256; ++i)
+            {
+                Group.Run([&NumTasksRun]() {
+                    NumTasksRun.fetch_add(1);
+                });
+            }
+            // The destructor waits for all tasks
+        }
+        EXPECT_EQ(NumTasksRun.load(), 256u);
+    }
+
+    pThreadPool->WaitForAllTasks();
+}
+
+TEST(Common_ThreadPool, TaskGroup)
+{
+    TestTaskGroup(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPool, TaskGroup_WorkStealing)
+{
+    TestTaskGroup(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
 } // namespace
@@ -0,0 +1,760 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "BCCodec.hpp"
+#include "GraphicsAccessories.hpp"
+#include "GraphicsUtilities.h"
+#include "FastRand.hpp"
+#include "ThreadPool.hpp"
+
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+constexpr TEXTURE_FORMAT TestFormats[] = {
+    TEX_FORMAT_BC1_UNORM,
+    TEX_FORMAT_BC2_UNORM,
+    TEX_FORMAT_BC3_UNORM,
+    TEX_FORMAT_BC4_UNORM,
+    TEX_FORMAT_BC4_SNORM,
+    TEX_FORMAT_BC5_UNORM,
+    TEX_FORMAT_BC5_SNORM,
+    TEX_FORMAT_BC7_UNORM,
+};
+
+Uint32 GetUncompressedTexelSize(TEXTURE_FORMAT Fmt)
+{
+    return GetTextureFormatAttribs(BCFormatToUncompressed(Fmt)).GetElementSize();
+}
+
+bool IsSignedFormat(TEXTURE_FORMAT Fmt)
+{
+    return GetTextureFormatAttribs(BCFormatToUncompressed(Fmt)).ComponentType == COMPONENT_TYPE_SNORM;
+}
+
+size_t GetBlockRowSize(TEXTURE_FORMAT Fmt, Uint32 Width)
+{
+    return size_t{(Width + 3) / 4} * GetTextureFormatAttribs(Fmt).GetElementSize();
+}
+
+// Generates a test image with smooth gradients, sharp edges and noise
+std::vector<Uint8> GenerateTestImage(TEXTURE_FORMAT Fmt, Uint32 Width, Uint32 Height, bool Opaque = true, unsigned int Seed = 0)
+{
+    const Uint32 TexelSize = GetUncompressedTexelSize(Fmt);
+    const bool   IsSigned  = IsSignedFormat(Fmt);
+
+    FastRandInt Noise{Seed, -6, 6};
+
+    std::vector<Uint8> Data(size_t{Width} * Height * TexelSize);
+    for (Uint32 y = 0; y < Height; ++y)
+    {
+        for (Uint32 x = 0; x < Width; ++x)
+        {
+            const float u = static_cast<float>(x) / static_cast<float>(Width);
+            const float v = static_cast<float>(y) / static_cast<float>(Height);
+
+            const float Circle = (u - 0.5f) * (u - 0.5f) + (v - 0.4f) * (v - 0.4f) < 0.09f ? 1.f : 0.f;
+
+            const float Channels[4] = {
+                0.2f + 0.6f * u + 0.2f * Circle,
+                0.5f + 0.4f * std::sin(v * 9.f + u * 3.f),
+                Circle > 0 ? 0.9f - 0.5f * v : 0.1f + 0.3f * u * v,
+                Opaque ? 1.f : 0.5f + 0.5f * std::cos(u * 7.f) * (1.f - Circle),
+            };
+
+            Uint8* pTexel = &Data[(size_t{y} * Width + x) * TexelSize];
+            for (Uint32 c = 0; c < TexelSize; ++c)
+            {
+                const int Val = (c == 3 && Opaque) ? 255 : static_cast<int>(Channels[c] * 255.f) + Noise();
+                if (IsSigned)
+                    pTexel[c] = static_cast<Uint8>(static_cast<Int8>(std::min(std::max(Val - 128, -127), 127)));
+                else
+                    pTexel[c] = static_cast<Uint8>(std::min(std::max(Val, 0), 255));
+            }
+        }
+    }
+    return Data;
+}
+
+double ComputePSNR(TEXTURE_FORMAT Fmt, const std::vector<Uint8>& Ref, const std::vector<Uint8>& Data)
+{
+    VERIFY_EXPR(Ref.size() == Data.size());
+    const bool IsSigned = IsSignedFormat(Fmt);
+
+    double SqError = 0;
+    for (size_t i = 0; i < Ref.size(); ++i)
+    {
+        const int d = IsSigned ?
+            static_cast<int>(static_cast<Int8>(Ref[i])) - static_cast<int>(static_cast<Int8>(Data[i])) :
+            static_cast<int>(Ref[i]) - static_cast<int>(Data[i]);
+        SqError += d * d;
+    }
+    const double MSE = SqError / static_cast<double>(Ref.size());
+    return MSE > 0 ? 10.0 * std::log10(255.0 * 255.0 / MSE) : 99.0;
+}
+
+std::vector<Uint8> Encode(TEXTURE_FORMAT Fmt, Uint32 Width, Uint32 Height, const std::vector<Uint8>& Src, BC_COMPRESSION_QUALITY Quality, IThreadPool* pThreadPool = nullptr)
+{
+    std::vector<Uint8> Blocks(GetBlockRowSize(Fmt, Width) * ((Height + 3) / 4));
+
+    BCEncodeAttribs Attribs;
+    Attribs.Format      = Fmt;
+    Attribs.Width       = Width;
+    Attribs.Height      = Height;
+    Attribs.pSrcData    = Src.data();
+    Attribs.SrcStride   = size_t{Width} * GetUncompressedTexelSize(Fmt);
+    Attribs.pDstData    = Blocks.data();
+    Attribs.DstStride   = GetBlockRowSize(Fmt, Width);
+    Attribs.Quality     = Quality;
+    Attribs.pThreadPool = pThreadPool;
+    EXPECT_TRUE(EncodeBC(Attribs));
+    return Blocks;
+}
+
+std::vector<Uint8> Decode(TEXTURE_FORMAT Fmt, Uint32 Width, Uint32 Height, const std::vector<Uint8>& Blocks, IThreadPool* pThreadPool = nullptr)
+{
+    std::vector<Uint8> Texels(size_t{Width} * Height * GetUncompressedTexelSize(Fmt));
+
+    BCDecodeAttribs Attribs;
+    Attribs.Format      = Fmt;
+    Attribs.Width       = Width;
+    Attribs.Height      = Height;
+    Attribs.pSrcData    = Blocks.data();
+    Attribs.SrcStride   = GetBlockRowSize(Fmt, Width);
+    Attribs.pDstData    = Texels.data();
+    Attribs.DstStride   = size_t{Width} * GetUncompressedTexelSize(Fmt);
+    Attribs.pThreadPool = pThreadPool;
+    EXPECT_TRUE(DecodeBC(Attribs));
+    return Texels;
+}
+
+std::array<Uint8, 64> DecodeBlock(TEXTURE_FORMAT Fmt, const std::vector<Uint8>& Block)
+{
+    const std::vector<Uint8> Texels = Decode(Fmt, 4, 4, Block);
+
+    std::array<Uint8, 64> Result{};
+    std::copy(Texels.begin(), Texels.end(), Result.begin());
+    return Result;
+}
+
+TEST(GraphicsAccessories_BCCodec, IsBCCodecSupported)
+{
+    for (TEXTURE_FORMAT Fmt : TestFormats)
+        EXPECT_TRUE(IsBCCodecSupported(Fmt)) << GetTextureFormatAttribs(Fmt).Name;
+
+    EXPECT_TRUE(IsBCCodecSupported(TEX_FORMAT_BC1_UNORM_SRGB));
+    EXPECT_TRUE(IsBCCodecSupported(TEX_FORMAT_BC7_TYPELESS));
+    EXPECT_FALSE(IsBCCodecSupported(TEX_FORMAT_BC6H_UF16));
+    EXPECT_FALSE(IsBCCodecSupported(TEX_FORMAT_BC6H_SF16));
+    EXPECT_FALSE(IsBCCodecSupported(TEX_FORMAT_RGBA8_UNORM));
+    EXPECT_FALSE(IsBCCodecSupported(TEX_FORMAT_UNKNOWN));
+
+    const Uint8 Data[64] = {};
+    Uint8       Blocks[16];
+
+    BCEncodeAttribs EncodeAttribs;
+    EncodeAttribs.Format    = TEX_FORMAT_BC6H_UF16;
+    EncodeAttribs.Width     = 4;
+    EncodeAttribs.Height    = 4;
+    EncodeAttribs.pSrcData  = Data;
+    EncodeAttribs.SrcStride = 16;
+    EncodeAttribs.pDstData  = Blocks;
+    EncodeAttribs.DstStride = 16;
+    EXPECT_FALSE(EncodeBC(EncodeAttribs));
+}
+
+TEST(GraphicsAccessories_BCCodec, DecodeBC1)
+{
+    // Four-color mode: color0 = red, color1 = blue
+    {
+        const std::vector<Uint8> Block = {0x00, 0xF8, 0x1F, 0x00, 0xE4, 0xE4, 0xE4, 0xE4};
+        const auto               Texels = DecodeBlock(TEX_FORMAT_BC1_UNORM, Block);
+
+        constexpr Uint8 RefPalette[4][4] = {
+            {255, 0, 0, 255},
+            {0, 0, 255, 255},
+            {170, 0, 85, 255},
+            {85, 0, 170, 255},
+        };
+        for (Uint32 i = 0; i < 16; ++i)
+        {
+            for (Uint32 c = 0; c < 4; ++c)
+                EXPECT_EQ(Texels[i * 4 + c], RefPalette[i % 4][c]) << "Texel " << i << ", channel " << c;
+        }
+    }
+
+    // Three-color mode: color0 = blue, color1 = red, index 3 is transparent black
+    {
+        const std::vector<Uint8> Block = {0x1F, 0x00, 0x00, 0xF8, 0xE4, 0xE4, 0xE4, 0xE4};
+        const auto               Texels = DecodeBlock(TEX_FORMAT_BC1_UNORM, Block);
+
+        constexpr Uint8 RefPalette[4][4] = {
+            {0, 0, 255, 255},
+            {255, 0, 0, 255},
+            {128, 0, 128, 255},
+            {0, 0, 0, 0},
+        };
+        for (Uint32 i = 0; i < 16; ++i)
+        {
+            for (Uint32 c = 0; c < 4; ++c)
+                EXPECT_EQ(Texels[i * 4 + c], RefPalette[i % 4][c]) << "Texel " << i << ", channel " << c;
+        }
+    }
+}
+
+TEST(GraphicsAccessories_BCCodec, DecodeBC4)
+{
+    // Texel i uses index i % 8
+    const Uint8 Indices[6] = {0x88, 0xC6, 0xFA, 0x88, 0xC6, 0xFA};
+
+    // Eight-value mode
+    {
+        const std::vector<Uint8> Block = {200, 100, Indices[0], Indices[1], Indices[2], Indices[3], Indices[4], Indices[5]};
+        const auto               Texels = DecodeBlock(TEX_FORMAT_BC4_UNORM, Block);
+
+        constexpr Uint8 RefPalette[8] = {200, 100, 186, 171, 157, 143, 129, 114};
+        for (Uint32 i = 0; i < 16; ++i)
+            EXPECT_EQ(Texels[i], RefPalette[i % 8]) << "Texel " << i;
+    }
+
+    // Six-value mode
+    {
+        const std::vector<Uint8> Block = {50, 150, Indices[0], Indices[1], Indices[2], Indices[3], Indices[4], Indices[5]};
+        const auto               Texels = DecodeBlock(TEX_FORMAT_BC4_UNORM, Block);
+
+        constexpr Uint8 RefPalette[8] = {50, 150, 70, 90, 110, 130, 0, 255};
+        for (Uint32 i = 0; i < 16; ++i)
+            EXPECT_EQ(Texels[i], RefPalette[i % 8]) << "Texel " << i;
+    }
+
+    // Signed eight-value mode, -128 is decoded as -127
+    {
+        const std::vector<Uint8> Block = {127, 0x80, Indices[0], Indices[1], Indices[2], Indices[3], Indices[4], Indices[5]};
+        const auto               Texels = DecodeBlock(TEX_FORMAT_BC4_SNORM, Block);
+
+        constexpr Int8 RefPalette[8] = {127, -127, 91, 54, 18, -18, -54, -91};
+        for (Uint32 i = 0; i < 16; ++i)
+            EXPECT_EQ(static_cast<Int8>(Texels[i]), RefPalette[i % 8]) << "Texel " << i;
+    }
+}
+
+// Writes BC7 block fields starting from the least significant bit
+class BC7BlockWriter
+{
+public:
+    void Write(Uint32 Value, Uint32 NumBits)
+    {
+        for (Uint32 i = 0; i < NumBits; ++i, ++m_NumBits)
+            m_Block[m_NumBits / 8] |= static_cast<Uint8>(((Value >> i) & 1u) << (m_NumBits % 8));
+    }
+
+    const std::vector<Uint8>& GetBlock() const { return m_Block; }
+    Uint32                    GetNumBits() const { return m_NumBits; }
+
+private:
+    std::vector<Uint8> m_Block   = std::vector<Uint8>(16);
+    Uint32             m_NumBits = 0;
+};
+
+TEST(GraphicsAccessories_BCCodec, DecodeBC7)
+{
+    // Mode 6 block: endpoint 0 is (0, 0, 0, 0), endpoint 1 is (255, 255, 255, 255), texel i uses index i
+    BC7BlockWriter Writer;
+    Writer.Write(1u << 6u, 7);
+    for (Uint32 c = 0; c < 4; ++c)
+    {
+        Writer.Write(0, 7);
+        Writer.Write(127, 7);
+    }
+    Writer.Write(0, 1);
+    Writer.Write(1, 1);
+    for (Uint32 i = 0; i < 16; ++i)
+        Writer.Write(i, i == 0 ? 3 : 4);
+    ASSERT_EQ(Writer.GetNumBits(), 128u);
+
+    const auto Texels = DecodeBlock(TEX_FORMAT_BC7_UNORM, Writer.GetBlock());
+
+    constexpr Uint32 Weights[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const Uint32 RefValue = (Weights[i] * 255 + 32) >> 6;
+        for (Uint32 c = 0; c < 4; ++c)
+            EXPECT_EQ(Texels[i * 4 + c], RefValue) << "Texel " << i << ", channel " << c;
+    }
+
+    // Reserved mode
+    const auto ReservedTexels = DecodeBlock(TEX_FORMAT_BC7_UNORM, std::vector<Uint8>(16));
+    for (Uint8 Val : ReservedTexels)
+        EXPECT_EQ(Val, 0);
+}
+
+// Texel indices used by the subset tests. Anchor texels of partition 0 use indices that fit into one bit less.
+constexpr Uint32 BC7SubsetTestIndices[16] = {0, 1, 2, 3, 4, 5, 6, 7, 7, 6, 5, 4, 3, 2, 1, 0};
+
+TEST(GraphicsAccessories_BCCodec, DecodeBC7TwoSubsets)
+{
+    // Mode 1 block, partition 0: columns 2 and 3 belong to subset 1, anchor texels are 0 and 15
+    constexpr Uint32 Endpoints[2][2][3] = {
+        {{0, 0, 0}, {63, 32, 10}},
+        {{5, 40, 63}, {60, 20, 0}},
+    };
+    constexpr Uint32 PBits[2] = {1, 0};
+
+    BC7BlockWriter Writer;
+    Writer.Write(1u << 1u, 2);
+    Writer.Write(0, 6);
+    for (Uint32 c = 0; c < 3; ++c)
+    {
+        for (Uint32 s = 0; s < 2; ++s)
+        {
+            Writer.Write(Endpoints[s][0][c], 6);
+            Writer.Write(Endpoints[s][1][c], 6);
+        }
+    }
+    for (Uint32 PBit : PBits)
+        Writer.Write(PBit, 1);
+    for (Uint32 i = 0; i < 16; ++i)
+        Writer.Write(BC7SubsetTestIndices[i], (i == 0 || i == 15) ? 2 : 3);
+    ASSERT_EQ(Writer.GetNumBits(), 128u);
+
+    const auto Texels = DecodeBlock(TEX_FORMAT_BC7_UNORM, Writer.GetBlock());
+
+    constexpr Uint8 RefPalettes[2][8][3] = {
+        {{2, 2, 2}, {38, 20, 8}, {73, 38, 13}, {109, 56, 19}, {148, 77, 25}, {184, 95, 31}, {219, 113, 36}, {255, 131, 42}},
+        {{20, 161, 253}, {51, 150, 217}, {82, 138, 182}, {113, 127, 146}, {148, 114, 107}, {179, 103, 71}, {210, 91, 36}, {241, 80, 0}},
+    };
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const Uint32 Subset = (i % 4) / 2;
+        for (Uint32 c = 0; c < 3; ++c)
+            EXPECT_EQ(Texels[i * 4 + c], RefPalettes[Subset][BC7SubsetTestIndices[i]][c]) << "Texel " << i << ", channel " << c;
+        EXPECT_EQ(Texels[i * 4 + 3], 255) << "Texel " << i;
+    }
+}
+
+TEST(GraphicsAccessories_BCCodec, DecodeBC7ThreeSubsets)
+{
+    // Mode 0 block, partition 0, anchor texels are 0, 3 and 15
+    constexpr Uint32 Subsets[16] = {0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 1, 2, 2, 2, 2};
+    constexpr Uint32 Endpoints[3][2][3] = {
+        {{0, 15, 3}, {15, 0, 12}},
+        {{2, 4, 6}, {13, 11, 9}},
+        {{8, 8, 8}, {15, 15, 15}},
+    };
+    constexpr Uint32 PBits[3][2] = {{0, 1}, {1, 0}, {1, 1}};
+
+    BC7BlockWriter Writer;
+    Writer.Write(1, 1);
+    Writer.Write(0, 4);
+    for (Uint32 c = 0; c < 3; ++c)
+    {
+        for (Uint32 s = 0; s < 3; ++s)
+        {
+            Writer.Write(Endpoints[s][0][c], 4);
+            Writer.Write(Endpoints[s][1][c], 4);
+        }
+    }
+    for (Uint32 s = 0; s < 3; ++s)
+    {
+        Writer.Write(PBits[s][0], 1);
+        Writer.Write(PBits[s][1], 1);
+    }
+    for (Uint32 i = 0; i < 16; ++i)
+        Writer.Write(BC7SubsetTestIndices[i], (i == 0 || i == 3 || i == 15) ? 2 : 3);
+    ASSERT_EQ(Writer.GetNumBits(), 128u);
+
+    const auto Texels = DecodeBlock(TEX_FORMAT_BC7_UNORM, Writer.GetBlock());
+
+    constexpr Uint8 RefPalettes[3][8][3] = {
+        {{0, 247, 49}, {36, 213, 71}, {72, 180, 93}, {108, 146, 115}, {147, 109, 140}, {183, 75, 162}, {219, 42, 184}, {255, 8, 206}},
+        {{41, 74, 107}, {65, 89, 113}, {90, 104, 119}, {114, 119, 124}, {141, 136, 131}, {165, 151, 136}, {190, 166, 142}, {214, 181, 148}},
+        {{140, 140, 140}, {156, 156, 156}, {172, 172, 172}, {189, 189, 189}, {206, 206, 206}, {223, 223, 223}, {239, 239, 239}, {255, 255, 255}},
+    };
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        for (Uint32 c = 0; c < 3; ++c)
+            EXPECT_EQ(Texels[i * 4 + c], RefPalettes[Subsets[i]][BC7SubsetTestIndices[i]][c]) << "Texel " << i << ", channel " << c;
+        EXPECT_EQ(Texels[i * 4 + 3], 255) << "Texel " << i;
+    }
+}
+
+TEST(GraphicsAccessories_BCCodec, DecodeBC7Mode4)
+{
+    // Color endpoints are (0, 31, 10) and (31, 0, 20), alpha endpoints are 0 and 63.
+    // Texel i uses 2-bit index i / 4 and 3-bit index i % 8.
+    constexpr Uint8 RefColors2[4][3] = {{0, 255, 82}, {84, 171, 109}, {171, 84, 138}, {255, 0, 165}};
+    constexpr Uint8 RefColors3[8][3] = {{0, 255, 82}, {36, 219, 94}, {72, 183, 105}, {108, 147, 117}, {147, 108, 130}, {183, 72, 142}, {219, 36, 153}, {255, 0, 165}};
+    constexpr Uint8 RefAlpha2[4]     = {0, 84, 171, 255};
+    constexpr Uint8 RefAlpha3[8]     = {0, 36, 72, 108, 147, 183, 219, 255};
+
+    for (Uint32 Rotation = 0; Rotation < 4; ++Rotation)
+    {
+        for (Uint32 IndexSelection = 0; IndexSelection < 2; ++IndexSelection)
+        {
+            BC7BlockWriter Writer;
+            Writer.Write(1u << 4u, 5);
+            Writer.Write(Rotation, 2);
+            Writer.Write(IndexSelection, 1);
+            Writer.Write(0, 5);
+            Writer.Write(31, 5);
+            Writer.Write(31, 5);
+            Writer.Write(0, 5);
+            Writer.Write(10, 5);
+            Writer.Write(20, 5);
+            Writer.Write(0, 6);
+            Writer.Write(63, 6);
+            for (Uint32 i = 0; i < 16; ++i)
+                Writer.Write(i / 4, i == 0 ? 1 : 2);
+            for (Uint32 i = 0; i < 16; ++i)
+                Writer.Write(i % 8, i == 0 ? 2 : 3);
+            ASSERT_EQ(Writer.GetNumBits(), 128u);
+
+            const auto Texels = DecodeBlock(TEX_FORMAT_BC7_UNORM, Writer.GetBlock());
+            for (Uint32 i = 0; i < 16; ++i)
+            {
+                // Index selection 0 uses 2-bit indices for color and 3-bit indices for alpha
+                const Uint8* RefColor = IndexSelection == 0 ? RefColors2[i / 4] : RefColors3[i % 8];
+
+                Uint8 RefTexel[4] = {RefColor[0], RefColor[1], RefColor[2], IndexSelection == 0 ? RefAlpha3[i % 8] : RefAlpha2[i / 4]};
+                // Rotation swaps alpha with red, green or blue
+                if (Rotation != 0)
+                    std::swap(RefTexel[Rotation - 1], RefTexel[3]);
+
+                for (Uint32 c = 0; c < 4; ++c)
+                {
+                    EXPECT_EQ(Texels[i * 4 + c], RefTexel[c])
+                        << "Rotation " << Rotation << ", index selection " << IndexSelection << ", texel " << i << ", channel " << c;
+                }
+            }
+        }
+    }
+}
+
+TEST(GraphicsAccessories_BCCodec, DecodeBC7Mode5)
+{
+    // Color endpoints are (0, 100, 127) and (127, 20, 64), alpha endpoints are 255 and 0.
+    // Texel i uses color index i % 4 and alpha index i / 4.
+    constexpr Uint8 RefColors[4][3] = {{0, 201, 255}, {84, 148, 214}, {171, 93, 170}, {255, 40, 129}};
+    constexpr Uint8 RefAlpha[4]     = {255, 171, 84, 0};
+
+    for (Uint32 Rotation = 0; Rotation < 4; ++Rotation)
+    {
+        BC7BlockWriter Writer;
+        Writer.Write(1u << 5u, 6);
+        Writer.Write(Rotation, 2);
+        Writer.Write(0, 7);
+        Writer.Write(127, 7);
+        Writer.Write(100, 7);
+        Writer.Write(20, 7);
+        Writer.Write(127, 7);
+        Writer.Write(64, 7);
+        Writer.Write(255, 8);
+        Writer.Write(0, 8);
+        for (Uint32 i = 0; i < 16; ++i)
+            Writer.Write(i % 4, i == 0 ? 1 : 2);
+        for (Uint32 i = 0; i < 16; ++i)
+            Writer.Write(i / 4, i == 0 ? 1 : 2);
+        ASSERT_EQ(Writer.GetNumBits(), 128u);
+
+        const auto Texels = DecodeBlock(TEX_FORMAT_BC7_UNORM, Writer.GetBlock());
+        for (Uint32 i = 0; i < 16; ++i)
+        {
+            Uint8 RefTexel[4] = {RefColors[i % 4][0], RefColors[i % 4][1], RefColors[i % 4][2], RefAlpha[i / 4]};
+            if (Rotation != 0)
+                std::swap(RefTexel[Rotation - 1], RefTexel[3]);
+
+            for (Uint32 c = 0; c < 4; ++c)
+                EXPECT_EQ(Texels[i * 4 + c], RefTexel[c]) << "Rotation " << Rotation << ", texel " << i << ", channel " << c;
+        }
+    }
+}
+
+TEST(GraphicsAccessories_BCCodec, RoundTripPSNR)
+{
+    constexpr Uint32 Width  = 128;
+    constexpr Uint32 Height = 96;
+
+    struct TestInfo
+    {
+        TEXTURE_FORMAT Fmt;
+        bool           Opaque;
+        double         MinPSNR[BC_COMPRESSION_QUALITY_COUNT];
+    };
+    constexpr TestInfo Tests[] = {
+        {TEX_FORMAT_BC1_UNORM, true, {35, 37, 37}},
+        {TEX_FORMAT_BC2_UNORM, false, {34, 35, 35}},
+        {TEX_FORMAT_BC3_UNORM, false, {35, 37, 37}},
+        {TEX_FORMAT_BC4_UNORM, true, {48, 49, 50}},
+        {TEX_FORMAT_BC4_SNORM, true, {48, 49, 50}},
+        {TEX_FORMAT_BC5_UNORM, true, {47, 48, 49}},
+        {TEX_FORMAT_BC5_SNORM, true, {47, 48, 49}},
+        {TEX_FORMAT_BC7_UNORM, true, {39, 41, 42}},
+        {TEX_FORMAT_BC7_UNORM, false, {36, 38, 39}},
+    };
+
+    for (const TestInfo& Test : Tests)
+    {
+        const std::vector<Uint8> Src = GenerateTestImage(Test.Fmt, Width, Height, Test.Opaque);
+
+        double PrevPSNR = 0;
+        for (Uint32 Quality = 0; Quality < BC_COMPRESSION_QUALITY_COUNT; ++Quality)
+        {
+            const std::vector<Uint8> Blocks = Encode(Test.Fmt, Width, Height, Src, static_cast<BC_COMPRESSION_QUALITY>(Quality));
+            const std::vector<Uint8> Dst    = Decode(Test.Fmt, Width, Height, Blocks);
+
+            const double PSNR = ComputePSNR(Test.Fmt, Src, Dst);
+            EXPECT_GE(PSNR, Test.MinPSNR[Quality]) << GetTextureFormatAttribs(Test.Fmt).Name << (Test.Opaque ? " opaque" : " translucent") << ", quality " << Quality;
+            // Higher quality must not be noticeably worse
+            EXPECT_GE(PSNR, PrevPSNR - 0.05) << GetTextureFormatAttribs(Test.Fmt).Name << (Test.Opaque ? " opaque" : " translucent") << ", quality " << Quality;
+            PrevPSNR = PSNR;
+        }
+    }
+}
+
+TEST(GraphicsAccessories_BCCodec, ConstantBlocks)
+{
+    FastRandInt Rnd{1, 0, 255};
+    for (TEXTURE_FORMAT Fmt : TestFormats)
+    {
+        const Uint32 TexelSize = GetUncompressedTexelSize(Fmt);
+        const bool   IsSigned  = IsSignedFormat(Fmt);
+        for (Uint32 Quality = 0; Quality < BC_COMPRESSION_QUALITY_COUNT; ++Quality)
+        {
+            for (Uint32 Iter = 0; Iter < 64; ++Iter)
+            {
+                Uint8 Color[4];
+                for (Uint32 c = 0; c < 4; ++c)
+                {
+                    // Signed -128 is not representable
+                    Color[c] = static_cast<Uint8>(IsSigned ? std::max(Rnd(), 1) - 128 : Rnd());
+                }
+                if (Fmt == TEX_FORMAT_BC1_UNORM)
+                    Color[3] = 255;
+
+                std::vector<Uint8> Src(16 * TexelSize);
+                for (size_t i = 0; i < Src.size(); ++i)
+                    Src[i] = Color[i % TexelSize];
+
+                const std::vector<Uint8> Dst = Decode(Fmt, 4, 4, Encode(Fmt, 4, 4, Src, static_cast<BC_COMPRESSION_QUALITY>(Quality)));
+
+                int MaxError = 0;
+                for (size_t i = 0; i < Src.size(); ++i)
+                {
+                    const int d = IsSigned ?
+                        std::abs(static_cast<Int8>(Src[i]) - static_cast<Int8>(Dst[i])) :
+                        std::abs(static_cast<int>(Src[i]) - static_cast<int>(Dst[i]));
+                    MaxError = std::max(MaxError, d);
+                }
+                // BC1 and BC2/BC3 color endpoints are 5:6:5, other formats reproduce constant blocks exactly
+                const bool IsBC1Color = Fmt == TEX_FORMAT_BC1_UNORM || Fmt == TEX_FORMAT_BC2_UNORM || Fmt == TEX_FORMAT_BC3_UNORM;
+                const bool IsBC2Alpha = Fmt == TEX_FORMAT_BC2_UNORM;
+                EXPECT_LE(MaxError, IsBC1Color ? (IsBC2Alpha ? 8 : 1) : 0) << GetTextureFormatAttribs(Fmt).Name << ", quality " << Quality;
+            }
+        }
+    }
+}
+
+TEST(GraphicsAccessories_BCCodec, BC1Alpha)
+{
+    constexpr Uint32 Width  = 16;
+    constexpr Uint32 Height = 16;
+
+    std::vector<Uint8> Src = GenerateTestImage(TEX_FORMAT_BC1_UNORM, Width, Height);
+    for (Uint32 i = 0; i < Width * Height; ++i)
+    {
+        // Make every third texel transparent
+        Src[i * 4 + 3] = (i % 3) == 0 ? static_cast<Uint8>(i % 128) : static_cast<Uint8>(128 + i % 128);
+    }
+
+    for (Uint32 Quality = 0; Quality < BC_COMPRESSION_QUALITY_COUNT; ++Quality)
+    {
+        const std::vector<Uint8> Dst = Decode(TEX_FORMAT_BC1_UNORM, Width, Height, Encode(TEX_FORMAT_BC1_UNORM, Width, Height, Src, static_cast<BC_COMPRESSION_QUALITY>(Quality)));
+        for (Uint32 i = 0; i < Width * Height; ++i)
+        {
+            if (Src[i * 4 + 3] < 128)
+            {
+                for (Uint32 c = 0; c < 4; ++c)
+                    EXPECT_EQ(Dst[i * 4 + c], 0) << "Texel " << i << ", channel " << c;
+            }
+            else
+            {
+                EXPECT_EQ(Dst[i * 4 + 3], 255) << "Texel " << i;
+            }
+        }
+    }
+}
+
+TEST(GraphicsAccessories_BCCodec, UnalignedSize)
+{
+    constexpr Uint8 GuardValue = 0xCD;
+    for (TEXTURE_FORMAT Fmt : TestFormats)
+    {
+        const Uint32 TexelSize = GetUncompressedTexelSize(Fmt);
+        for (Uint32 Size : {1u, 2u, 3u, 5u, 7u, 13u})
+        {
+            const Uint32 Width  = Size;
+            const Uint32 Height = 13 - Size + 1;
+
+            const std::vector<Uint8> Src    = GenerateTestImage(Fmt, Width, Height);
+            const std::vector<Uint8> Blocks = Encode(Fmt, Width, Height, Src, BC_COMPRESSION_QUALITY_NORMAL);
+
+            // Decode to a buffer with a padded stride and check that the padding is not overwritten
+            const size_t       DstStride = size_t{Width} * TexelSize + 3;
+            std::vector<Uint8> Dst(DstStride * Height + 16, GuardValue);
+
+            BCDecodeAttribs Attribs;
+            Attribs.Format    = Fmt;
+            Attribs.Width     = Width;
+            Attribs.Height    = Height;
+            Attribs.pSrcData  = Blocks.data();
+            Attribs.SrcStride = GetBlockRowSize(Fmt, Width);
+            Attribs.pDstData  = Dst.data();
+            Attribs.DstStride = DstStride;
+            EXPECT_TRUE(DecodeBC(Attribs));
+
+            std::vector<Uint8> Texels;
+            for (Uint32 y = 0; y < Height; ++y)
+            {
+                const Uint8* pRow = &Dst[y * DstStride];
+                Texels.insert(Texels.end(), pRow, pRow + Width * TexelSize);
+                for (size_t i = Width * TexelSize; i < DstStride; ++i)
+                    EXPECT_EQ(pRow[i], GuardValue) << GetTextureFormatAttribs(Fmt).Name << ' ' << Width << 'x' << Height;
+            }
+            for (size_t i = DstStride * Height; i < Dst.size(); ++i)
+                EXPECT_EQ(Dst[i], GuardValue) << GetTextureFormatAttribs(Fmt).Name << ' ' << Width << 'x' << Height;
+
+            // The boundary blocks must be encoded as if the texture were padded by replicating the last row and column
+            const Uint32       PaddedWidth  = (Width + 3) & ~3u;
+            const Uint32       PaddedHeight = (Height + 3) & ~3u;
+            std::vector<Uint8> Padded(size_t{PaddedWidth} * PaddedHeight * TexelSize);
+            for (Uint32 y = 0; y < PaddedHeight; ++y)
+            {
+                for (Uint32 x = 0; x < PaddedWidth; ++x)
+                {
+                    const size_t SrcOffset = (size_t{std::min(y, Height - 1)} * Width + std::min(x, Width - 1)) * TexelSize;
+                    std::copy_n(&Src[SrcOffset], TexelSize, &Padded[(size_t{y} * PaddedWidth + x) * TexelSize]);
+                }
+            }
+            EXPECT_EQ(Blocks, Encode(Fmt, PaddedWidth, PaddedHeight, Padded, BC_COMPRESSION_QUALITY_NORMAL)) << GetTextureFormatAttribs(Fmt).Name << ' ' << Width << 'x' << Height;
+
+            const std::vector<Uint8> PaddedTexels = Decode(Fmt, PaddedWidth, PaddedHeight, Blocks);
+            for (Uint32 y = 0; y < Height; ++y)
+            {
+                const size_t Offset = size_t{y} * PaddedWidth * TexelSize;
+                EXPECT_TRUE(std::equal(&Texels[size_t{y} * Width * TexelSize], &Texels[size_t{y} * Width * TexelSize] + Width * TexelSize, &PaddedTexels[Offset]))
+                    << GetTextureFormatAttribs(Fmt).Name << ' ' << Width << 'x' << Height << ", row " << y;
+            }
+        }
+    }
+}
+
+TEST(GraphicsAccessories_BCCodec, Parallel)
+{
+    constexpr Uint32 Width  = 64;
+    constexpr Uint32 Height = 60;
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{3});
+    for (TEXTURE_FORMAT Fmt : TestFormats)
+    {
+        const std::vector<Uint8> Src            = GenerateTestImage(Fmt, Width, Height, false);
+        const std::vector<Uint8> Blocks         = Encode(Fmt, Width, Height, Src, BC_COMPRESSION_QUALITY_NORMAL);
+        const std::vector<Uint8> ParallelBlocks = Encode(Fmt, Width, Height, Src, BC_COMPRESSION_QUALITY_NORMAL, pThreadPool);
+        EXPECT_EQ(Blocks, ParallelBlocks) << GetTextureFormatAttribs(Fmt).Name;
+        EXPECT_EQ(Decode(Fmt, Width, Height, Blocks), Decode(Fmt, Width, Height, Blocks, pThreadPool)) << GetTextureFormatAttribs(Fmt).Name;
+    }
+}
+
+TEST(GraphicsAccessories_BCCodec, ComputeMipChain)
+{
+    constexpr Uint32 Width     = 45;
+    constexpr Uint32 Height    = 30;
+    constexpr Uint32 NumLevels = 6;
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{3});
+    for (TEXTURE_FORMAT Fmt : TestFormats)
+    {
+        const Uint32             TexelSize = GetUncompressedTexelSize(Fmt);
+        const std::vector<Uint8> Blocks    = Encode(Fmt, Width, Height, GenerateTestImage(Fmt, Width, Height, false), BC_COMPRESSION_QUALITY_NORMAL);
+
+        // Reference: decode the fine level, filter the uncompressed data and encode every level
+        std::vector<std::vector<Uint8>> RefLevels(NumLevels);
+        std::vector<std::vector<Uint8>> Levels(NumLevels);
+        std::vector<void*>              ppData;
+        std::vector<size_t>             Strides;
+        std::vector<void*>              ppUncompressedData;
+        std::vector<size_t>             UncompressedStrides;
+        for (Uint32 i = 1; i < NumLevels; ++i)
+        {
+            const Uint32 LevelWidth  = std::max(Width >> i, 1u);
+            const Uint32 LevelHeight = std::max(Height >> i, 1u);
+            RefLevels[i].resize(size_t{LevelWidth} * LevelHeight * TexelSize);
+            ppUncompressedData.push_back(RefLevels[i].data());
+            UncompressedStrides.push_back(size_t{LevelWidth} * TexelSize);
+
+            Levels[i].resize(GetBlockRowSize(Fmt, LevelWidth) * ((LevelHeight + 3) / 4));
+            ppData.push_back(Levels[i].data());
+            Strides.push_back(GetBlockRowSize(Fmt, LevelWidth));
+        }
+        RefLevels[0] = Decode(Fmt, Width, Height, Blocks);
+
+        ComputeMipChainAttribs Attribs;
+        Attribs.Format            = BCFormatToUncompressed(Fmt);
+        Attribs.Width             = Width;
+        Attribs.Height            = Height;
+        Attribs.pFineMipData      = RefLevels[0].data();
+        Attribs.FineMipStride     = size_t{Width} * TexelSize;
+        Attribs.NumCoarseMips     = NumLevels - 1;
+        Attribs.ppCoarseMipData   = ppUncompressedData.data();
+        Attribs.pCoarseMipStrides = UncompressedStrides.data();
+        ComputeMipChain(Attribs);
+        for (Uint32 i = 1; i < NumLevels; ++i)
+            RefLevels[i] = Encode(Fmt, std::max(Width >> i, 1u), std::max(Height >> i, 1u), RefLevels[i], BC_COMPRESSION_QUALITY_NORMAL);
+
+        Attribs.Format            = Fmt;
+        Attribs.pFineMipData      = Blocks.data();
+        Attribs.FineMipStride     = GetBlockRowSize(Fmt, Width);
+        Attribs.ppCoarseMipData   = ppData.data();
+        Attribs.pCoarseMipStrides = Strides.data();
+        Attribs.pThreadPool       = pThreadPool;
+        ComputeMipChain(Attribs);
+        for (Uint32 i = 1; i < NumLevels; ++i)
+            EXPECT_EQ(Levels[i], RefLevels[i]) << GetTextureFormatAttribs(Fmt).Name << ", level " << i;
+
+        std::vector<Uint8> Level1(Levels[1].size());
+        ComputeMipLevel({Fmt, Width, Height, Blocks.data(), GetBlockRowSize(Fmt, Width), Level1.data(), Strides[0]});
+        EXPECT_EQ(Level1, RefLevels[1]) << GetTextureFormatAttribs(Fmt).Name;
+    }
+}
+
+} // namespace
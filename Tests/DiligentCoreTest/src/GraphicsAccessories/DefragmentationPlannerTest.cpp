@@ -0,0 +1,296 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "DefragmentationPlanner.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "FastRand.hpp"
+
+#include <vector>
+#include <algorithm>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+using OffsetType     = DefragmentationPlanner::OffsetType;
+using AllocationDesc = DefragmentationPlanner::AllocationDesc;
+
+// Allocates NumBlocks blocks of BlockSize bytes and releases every other block
+std::vector<AllocationDesc> MakeFragmentedManager(VariableSizeAllocationsManager& Mgr, Uint32 NumBlocks, OffsetType BlockSize)
+{
+    std::vector<VariableSizeAllocationsManager::Allocation> Regions;
+    for (Uint32 i = 0; i < NumBlocks; ++i)
+    {
+        Regions.push_back(Mgr.Allocate(BlockSize, 1));
+        EXPECT_TRUE(Regions.back().IsValid());
+    }
+
+    std::vector<AllocationDesc> Allocations;
+    for (Uint32 i = 0; i < NumBlocks; ++i)
+    {
+        if (i % 2 == 0)
+            Allocations.push_back({Regions[i], 1});
+        else
+            Mgr.Free(std::move(Regions[i]));
+    }
+    return Allocations;
+}
+
+void CommitPlan(VariableSizeAllocationsManager& Mgr, DefragmentationPlanner::Plan& Plan, std::vector<AllocationDesc>& Allocations)
+{
+    for (auto& Move : Plan.Moves)
+    {
+        Allocations[Move.AllocationIndex].Region = Move.DstRegion;
+        DefragmentationPlanner::CommitMove(Mgr, Move);
+    }
+}
+
+TEST(GraphicsAccessories_DefragmentationPlanner, NoFragmentation)
+{
+    VariableSizeAllocationsManager Mgr{256, DefaultRawMemoryAllocator::GetAllocator()};
+
+    std::vector<AllocationDesc> Allocations;
+    for (Uint32 i = 0; i < 4; ++i)
+        Allocations.push_back({Mgr.Allocate(16, 1), 1});
+
+    auto Plan = DefragmentationPlanner::ComputePlan(Mgr, Allocations.data(), static_cast<Uint32>(Allocations.size()));
+    EXPECT_TRUE(Plan.Moves.empty());
+    EXPECT_EQ(Plan.BytesToMove, OffsetType{0});
+    EXPECT_EQ(Plan.FragmentationBefore, 0.0);
+    EXPECT_EQ(Plan.FragmentationAfter, 0.0);
+    EXPECT_EQ(Plan.MaxFreeBlockSizeBefore, OffsetType{256 - 64});
+    EXPECT_EQ(Plan.MaxFreeBlockSizeAfter, OffsetType{256 - 64});
+
+    for (auto& Alloc : Allocations)
+        Mgr.Free(std::move(Alloc.Region));
+}
+
+TEST(GraphicsAccessories_DefragmentationPlanner, Compact)
+{
+    VariableSizeAllocationsManager Mgr{256, DefaultRawMemoryAllocator::GetAllocator()};
+
+    // | A |   | A |   | A |   ...   | A |   |
+    // 0   16  32  48  64  80       224 240 256
+    auto Allocations = MakeFragmentedManager(Mgr, 16, 16);
+    ASSERT_EQ(Allocations.size(), size_t{8});
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{8});
+
+    auto Plan = DefragmentationPlanner::ComputePlan(Mgr, Allocations.data(), static_cast<Uint32>(Allocations.size()));
+    ASSERT_EQ(Plan.Moves.size(), size_t{4});
+    EXPECT_EQ(Plan.BytesToMove, OffsetType{64});
+    EXPECT_DOUBLE_EQ(Plan.FragmentationBefore, 1.0 - 16.0 / 128.0);
+    EXPECT_EQ(Plan.MaxFreeBlockSizeBefore, OffsetType{16});
+    EXPECT_EQ(Plan.FragmentationAfter, 0.0);
+    EXPECT_EQ(Plan.MaxFreeBlockSizeAfter, OffsetType{128});
+
+    // The topmost allocations are moved to the lowest holes
+    for (size_t i = 0; i < Plan.Moves.size(); ++i)
+    {
+        const auto& Move = Plan.Moves[i];
+        EXPECT_EQ(Move.AllocationIndex, 7 - i);
+        EXPECT_EQ(Move.SrcOffset, OffsetType{224 - i * 32});
+        EXPECT_EQ(Move.DstOffset, OffsetType{16 + i * 32});
+        EXPECT_EQ(Move.Size, OffsetType{16});
+    }
+
+    // Destination regions are reserved in the manager
+    EXPECT_EQ(Mgr.GetUsedSize(), size_t{128 + 64});
+
+    CommitPlan(Mgr, Plan, Allocations);
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), size_t{128});
+    EXPECT_EQ(Mgr.GetFragmentation(), Plan.FragmentationAfter);
+
+    // The second plan has nothing to do
+    auto Plan2 = DefragmentationPlanner::ComputePlan(Mgr, Allocations.data(), static_cast<Uint32>(Allocations.size()));
+    EXPECT_TRUE(Plan2.Moves.empty());
+
+    for (auto& Alloc : Allocations)
+        Mgr.Free(std::move(Alloc.Region));
+    EXPECT_EQ(Mgr.GetFreeSize(), size_t{256});
+}
+
+TEST(GraphicsAccessories_DefragmentationPlanner, Alignment)
+{
+    VariableSizeAllocationsManager Mgr{256, DefaultRawMemoryAllocator::GetAllocator()};
+
+    auto a0 = Mgr.Allocate(8, 1);   // [0, 8)
+    auto a1 = Mgr.Allocate(8, 1);   // [8, 16)
+    auto a2 = Mgr.Allocate(88, 1);  // [16, 104)
+    auto a3 = Mgr.Allocate(20, 4);  // [104, 124)
+    auto a4 = Mgr.Allocate(4, 4);   // [124, 128)
+    auto a5 = Mgr.Allocate(32, 32); // [128, 160)
+    EXPECT_EQ(a5.UnalignedOffset, OffsetType{128});
+    Mgr.Free(std::move(a1));
+    Mgr.Free(std::move(a2));
+    Mgr.Free(std::move(a4));
+
+    std::vector<AllocationDesc> Allocations{{a0, 1}, {a3, 4}, {a5, 32}};
+
+    auto Plan = DefragmentationPlanner::ComputePlan(Mgr, Allocations.data(), static_cast<Uint32>(Allocations.size()));
+    ASSERT_EQ(Plan.Moves.size(), size_t{2});
+
+    // The hole [8, 104) holds the 32-byte aligned allocation at offset 32
+    EXPECT_EQ(Plan.Moves[0].AllocationIndex, Uint32{2});
+    EXPECT_EQ(Plan.Moves[0].SrcOffset, OffsetType{128});
+    EXPECT_EQ(Plan.Moves[0].DstOffset, OffsetType{32});
+    EXPECT_EQ(Plan.Moves[0].Size, OffsetType{32});
+    EXPECT_EQ(Plan.Moves[0].DstRegion.UnalignedOffset, OffsetType{8});
+    EXPECT_EQ(Plan.Moves[0].DstRegion.Size, OffsetType{56});
+
+    EXPECT_EQ(Plan.Moves[1].AllocationIndex, Uint32{1});
+    EXPECT_EQ(Plan.Moves[1].SrcOffset, OffsetType{104});
+    EXPECT_EQ(Plan.Moves[1].DstOffset, OffsetType{64});
+    EXPECT_EQ(Plan.Moves[1].Size, OffsetType{20});
+
+    CommitPlan(Mgr, Plan, Allocations);
+    EXPECT_EQ(Mgr.GetFragmentation(), Plan.FragmentationAfter);
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), Plan.MaxFreeBlockSizeAfter);
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), size_t{256 - 84});
+
+    for (auto& Alloc : Allocations)
+        Mgr.Free(std::move(Alloc.Region));
+    EXPECT_EQ(Mgr.GetFreeSize(), size_t{256});
+}
+
+TEST(GraphicsAccessories_DefragmentationPlanner, Limits)
+{
+    VariableSizeAllocationsManager Mgr{256, DefaultRawMemoryAllocator::GetAllocator()};
+
+    auto Allocations = MakeFragmentedManager(Mgr, 16, 16);
+
+    const auto FreeSize      = Mgr.GetFreeSize();
+    const auto Fragmentation = Mgr.GetFragmentation();
+
+    {
+        DefragmentationPlanner::Limits Limits;
+        Limits.MaxMoves = 3;
+
+        auto Plan = DefragmentationPlanner::ComputePlan(Mgr, Allocations.data(), static_cast<Uint32>(Allocations.size()), Limits);
+        EXPECT_EQ(Plan.Moves.size(), size_t{3});
+        EXPECT_GT(Plan.FragmentationAfter, 0.0);
+        EXPECT_LT(Plan.FragmentationAfter, Plan.FragmentationBefore);
+        EXPECT_EQ(Plan.MaxFreeBlockSizeAfter, OffsetType{16 * 7});
+
+        for (auto& Move : Plan.Moves)
+            DefragmentationPlanner::CancelMove(Mgr, Move);
+        EXPECT_EQ(Mgr.GetFreeSize(), FreeSize);
+        EXPECT_EQ(Mgr.GetFragmentation(), Fragmentation);
+    }
+
+    {
+        DefragmentationPlanner::Limits Limits;
+        Limits.MaxBytesToMove = 40;
+
+        auto Plan = DefragmentationPlanner::ComputePlan(Mgr, Allocations.data(), static_cast<Uint32>(Allocations.size()), Limits);
+        EXPECT_EQ(Plan.Moves.size(), size_t{2});
+        EXPECT_EQ(Plan.BytesToMove, OffsetType{32});
+
+        // Commit moves one at a time as if they were spread over several frames
+        auto PendingBytes = Plan.BytesToMove;
+        EXPECT_EQ(Mgr.GetFreeSize(), FreeSize - PendingBytes);
+        for (auto& Move : Plan.Moves)
+        {
+            Allocations[Move.AllocationIndex].Region = Move.DstRegion;
+            DefragmentationPlanner::CommitMove(Mgr, Move);
+            PendingBytes -= Move.Size;
+            EXPECT_EQ(Mgr.GetFreeSize(), FreeSize - PendingBytes);
+        }
+        EXPECT_EQ(Mgr.GetFragmentation(), Plan.FragmentationAfter);
+    }
+
+    for (auto& Alloc : Allocations)
+        Mgr.Free(std::move(Alloc.Region));
+}
+
+TEST(GraphicsAccessories_DefragmentationPlanner, Random)
+{
+    FastRandInt Rnd{0, 1, 64};
+
+    constexpr OffsetType MgrSize = 16384;
+    VariableSizeAllocationsManager Mgr{MgrSize, DefaultRawMemoryAllocator::GetAllocator()};
+
+    for (Uint32 Iter = 0; Iter < 8; ++Iter)
+    {
+        std::vector<AllocationDesc> Allocations;
+        while (true)
+        {
+            const OffsetType Alignment = OffsetType{1} << (Rnd() % 5);
+            const OffsetType Size      = static_cast<OffsetType>(Rnd());
+            auto             Region    = Mgr.Allocate(Size, Alignment);
+            if (!Region.IsValid())
+                break;
+            Allocations.push_back({Region, Alignment});
+        }
+
+        // Release random allocations
+        for (size_t i = 0; i < Allocations.size();)
+        {
+            if (Rnd() % 3 == 0)
+            {
+                Mgr.Free(std::move(Allocations[i].Region));
+                Allocations[i] = Allocations.back();
+                Allocations.pop_back();
+            }
+            else
+            {
+                ++i;
+            }
+        }
+
+        auto Plan = DefragmentationPlanner::ComputePlan(Mgr, Allocations.data(), static_cast<Uint32>(Allocations.size()));
+        EXPECT_FALSE(Plan.Moves.empty());
+        EXPECT_LE(Plan.FragmentationAfter, Plan.FragmentationBefore);
+        EXPECT_GE(Plan.MaxFreeBlockSizeAfter, Plan.MaxFreeBlockSizeBefore);
+
+        // Moves must not overlap each other or live allocations
+        std::vector<std::pair<OffsetType, OffsetType>> Ranges;
+        for (const auto& Alloc : Allocations)
+            Ranges.emplace_back(Alloc.Region.UnalignedOffset, Alloc.Region.UnalignedOffset + Alloc.Region.Size);
+        for (const auto& Move : Plan.Moves)
+        {
+            EXPECT_LT(Move.DstOffset, Move.SrcOffset);
+            EXPECT_EQ(Move.DstOffset % Allocations[Move.AllocationIndex].Alignment, OffsetType{0});
+            Ranges.emplace_back(Move.DstRegion.UnalignedOffset, Move.DstRegion.UnalignedOffset + Move.DstRegion.Size);
+        }
+        std::sort(Ranges.begin(), Ranges.end());
+        for (size_t i = 1; i < Ranges.size(); ++i)
+            EXPECT_LE(Ranges[i - 1].second, Ranges[i].first);
+
+        CommitPlan(Mgr, Plan, Allocations);
+        EXPECT_DOUBLE_EQ(Mgr.GetFragmentation(), Plan.FragmentationAfter);
+        EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), Plan.MaxFreeBlockSizeAfter);
+
+        for (auto& Alloc : Allocations)
+            Mgr.Free(std::move(Alloc.Region));
+        EXPECT_EQ(Mgr.GetFreeSize(), MgrSize);
+    }
+}
+
+} // namespace
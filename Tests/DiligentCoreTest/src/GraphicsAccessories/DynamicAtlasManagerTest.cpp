@@ -33,6 +33,7 @@
 #include "gtest/gtest.h"
 
 #include "FastRand.hpp"
+#include "DebugUtilities.hpp"
 
 using namespace Diligent;
 
@@ -465,4 +466,212 @@ TEST(GraphicsAccessories_DynamicAtlasManager, AllocateRandom)
     }
 }
 
+TEST(GraphicsAccessories_DynamicAtlasManager, Skyline_Allocate)
+{
+    constexpr auto Skyline = DynamicAtlasManager::PackingMode::Skyline;
+    {
+        DynamicAtlasManager Mgr{32, 32, Skyline};
+        EXPECT_EQ(Mgr.GetPackingMode(), Skyline);
+        EXPECT_TRUE(Mgr.IsEmpty());
+        EXPECT_EQ(Mgr.GetFreeRegionCount(), 1U);
+
+        auto R0 = Mgr.Allocate(16, 16);
+        EXPECT_EQ(R0, Region(0, 0, 16, 16));
+        EXPECT_FALSE(Mgr.IsEmpty());
+        EXPECT_EQ(Mgr.GetFreeRegionCount(), 2U);
+        EXPECT_EQ(Mgr.GetTotalFreeArea(), Uint64{32 * 32 - 16 * 16});
+
+        auto R1 = Mgr.Allocate(16, 32);
+        EXPECT_EQ(R1, Region(16, 0, 16, 32));
+        auto R2 = Mgr.Allocate(16, 16);
+        EXPECT_EQ(R2, Region(0, 16, 16, 16));
+        EXPECT_EQ(Mgr.GetFreeRegionCount(), 0U);
+        EXPECT_EQ(Mgr.GetTotalFreeArea(), Uint64{0});
+
+        EXPECT_TRUE(Mgr.Allocate(1, 1).IsEmpty());
+
+        // R1 is below the skyline, so the skyline is lowered
+        Mgr.Free(std::move(R1));
+        EXPECT_EQ(Mgr.GetFreeRegionCount(), 1U);
+        // R0 is covered by R2, so it goes to the free rectangle list
+        Mgr.Free(std::move(R0));
+        EXPECT_EQ(Mgr.GetFreeRegionCount(), 2U);
+
+        // Free rectangles are used first
+        auto R3 = Mgr.Allocate(16, 16);
+        EXPECT_EQ(R3, Region(0, 0, 16, 16));
+        auto R4 = Mgr.Allocate(8, 8);
+        EXPECT_EQ(R4, Region(16, 0, 8, 8));
+
+        Mgr.Free(std::move(R3));
+        //  ___________
+        // |     |     |
+        // | R2  |     |
+        // |_____|     |
+        // |     |__   |
+        // |     |R4|  |
+        // |_____|__|__|
+        Mgr.Free(std::move(R2));
+        // The skyline is lowered twice
+        EXPECT_EQ(Mgr.GetFreeRegionCount(), 3U);
+        EXPECT_EQ(Mgr.GetTotalFreeArea(), Uint64{32 * 32 - 8 * 8});
+
+        // The region rests on R4, and the space below it goes to the free rectangle list
+        auto R5 = Mgr.Allocate(32, 4);
+        EXPECT_EQ(R5, Region(0, 8, 32, 4));
+        EXPECT_EQ(Mgr.GetFreeRegionCount(), 3U);
+        EXPECT_EQ(Mgr.GetTotalFreeArea(), Uint64{32 * 32 - 8 * 8 - 32 * 4});
+
+        Mgr.Free(std::move(R5));
+        EXPECT_EQ(Mgr.GetFreeRegionCount(), 3U);
+        EXPECT_EQ(Mgr.GetTotalFreeArea(), Uint64{32 * 32 - 8 * 8});
+
+        Mgr.Free(std::move(R4));
+        EXPECT_TRUE(Mgr.IsEmpty());
+        EXPECT_EQ(Mgr.GetFreeRegionCount(), 1U);
+        EXPECT_EQ(Mgr.GetTotalFreeArea(), Uint64{32 * 32});
+    }
+
+    {
+        DynamicAtlasManager Mgr0{16, 8, Skyline};
+
+        auto R = Mgr0.Allocate(16, 8);
+
+        DynamicAtlasManager Mgr1{std::move(Mgr0)};
+        Mgr1.Free(std::move(R));
+    }
+}
+
+bool RegionsOverlap(const Region& R0, const Region& R1)
+{
+    return R0.x < R1.x + R1.width && R1.x < R0.x + R0.width &&
+        R0.y < R1.y + R1.height && R1.y < R0.y + R0.height;
+}
+
+TEST(GraphicsAccessories_DynamicAtlasManager, Skyline_AllocateRandom)
+{
+    DynamicAtlasManager Mgr{128, 128, DynamicAtlasManager::PackingMode::Skyline};
+
+    FastRandInt rnd{0, 1, 16};
+
+    std::vector<Region> Regions;
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        for (Uint32 j = 0; j < 64; ++j)
+        {
+            const Uint32 Width  = static_cast<Uint32>(rnd());
+            const Uint32 Height = static_cast<Uint32>(rnd());
+
+            auto R = Mgr.Allocate(Width, Height);
+            if (R.IsEmpty())
+                continue;
+
+            EXPECT_EQ(R.width, Width);
+            EXPECT_EQ(R.height, Height);
+            EXPECT_LE(R.x + R.width, Mgr.GetWidth());
+            EXPECT_LE(R.y + R.height, Mgr.GetHeight());
+            for (const auto& R1 : Regions)
+                EXPECT_FALSE(RegionsOverlap(R, R1)) << R << " overlaps " << R1;
+            Regions.push_back(R);
+        }
+
+        Uint64 AllocatedArea = 0;
+        for (const auto& R : Regions)
+            AllocatedArea += Uint64{R.width} * Uint64{R.height};
+        EXPECT_EQ(Mgr.GetTotalFreeArea() + AllocatedArea, Uint64{128 * 128});
+
+        // Release every other region
+        for (size_t r = 0; r < Regions.size();)
+        {
+            if (rnd() % 2 == 0)
+            {
+                Mgr.Free(std::move(Regions[r]));
+                Regions[r] = Regions.back();
+                Regions.pop_back();
+            }
+            else
+            {
+                ++r;
+            }
+        }
+    }
+
+    for (auto& R : Regions)
+        Mgr.Free(std::move(R));
+    EXPECT_TRUE(Mgr.IsEmpty());
+    EXPECT_EQ(Mgr.GetFreeRegionCount(), 1U);
+}
+
+// Checks that both packing modes fill most of the atlas on glyph-like and sprite-like
+// size distributions, both initially and after churn.
+TEST(GraphicsAccessories_DynamicAtlasManager, PackingEfficiency)
+{
+    struct Distribution
+    {
+        const char* Name;
+        int         MinWidth;
+        int         MaxWidth;
+        int         MinHeight;
+        int         MaxHeight;
+    };
+    constexpr Distribution Distributions[] = {
+        {"glyphs", 2, 24, 8, 32},
+        {"sprites", 8, 96, 8, 96},
+    };
+
+    constexpr Uint32 AtlasSize = 512;
+
+    for (const auto& Dist : Distributions)
+    {
+        for (auto Mode : {DynamicAtlasManager::PackingMode::Guillotine, DynamicAtlasManager::PackingMode::Skyline})
+        {
+            const char* ModeName = Mode == DynamicAtlasManager::PackingMode::Skyline ? "Skyline" : "Guillotine";
+
+            DynamicAtlasManager Mgr{AtlasSize, AtlasSize, Mode};
+            FastRandInt         RndW{0, Dist.MinWidth, Dist.MaxWidth};
+            FastRandInt         RndH{1, Dist.MinHeight, Dist.MaxHeight};
+
+            std::vector<Region> Regions;
+            Uint64              AllocatedArea = 0;
+
+            auto Fill = [&]() {
+                while (true)
+                {
+                    auto R = Mgr.Allocate(static_cast<Uint32>(RndW()), static_cast<Uint32>(RndH()));
+                    if (R.IsEmpty())
+                        break;
+                    AllocatedArea += Uint64{R.width} * Uint64{R.height};
+                    Regions.push_back(R);
+                }
+                return static_cast<double>(AllocatedArea) / (AtlasSize * AtlasSize);
+            };
+
+            // Fill the atlas until the first failure
+            EXPECT_GT(Fill(), 0.5) << ModeName << ", " << Dist.Name;
+
+            // Churn: release half of the regions and refill the atlas
+            FastRandInt Rnd{2, 0, 1};
+            for (size_t r = 0; r < Regions.size();)
+            {
+                if (Rnd() == 0)
+                {
+                    AllocatedArea -= Uint64{Regions[r].width} * Uint64{Regions[r].height};
+                    Mgr.Free(std::move(Regions[r]));
+                    Regions[r] = Regions.back();
+                    Regions.pop_back();
+                }
+                else
+                {
+                    ++r;
+                }
+            }
+            EXPECT_GT(Fill(), 0.5) << ModeName << ", " << Dist.Name << " after churn";
+
+            for (auto& R : Regions)
+                Mgr.Free(std::move(R));
+            EXPECT_TRUE(Mgr.IsEmpty());
+        }
+    }
+}
+
 } // namespace
@@ -26,11 +26,16 @@
  */
 
 #include "GraphicsUtilities.h"
+#include "GraphicsAccessories.hpp"
 #include "FastRand.hpp"
 #include "ColorConversion.h"
+#include "ThreadPool.hpp"
 
 #include <vector>
 #include <array>
+#include <algorithm>
+#include <cmath>
+#include <utility>
 
 #include "gtest/gtest.h"
 
@@ -575,4 +580,311 @@ TEST(GraphicsTools_CalculateMipLevel, sRGB_BOX_AVE)
     EXPECT_TRUE(CoarseData == RefCoarseData);
 }
 
+// Mip levels with tightly packed rows
+struct TestMipChain
+{
+    std::vector<std::vector<Uint8>> Levels;
+    std::vector<Uint32>             Widths;
+    std::vector<Uint32>             Heights;
+
+    TestMipChain(Uint32 Width, Uint32 Height, Uint32 TexelSize, Uint32 NumLevels = 0)
+    {
+        if (NumLevels == 0)
+            NumLevels = ComputeMipLevelsCount(Width, Height);
+        for (Uint32 i = 0; i < NumLevels; ++i)
+        {
+            Widths.push_back(std::max(Width >> i, 1u));
+            Heights.push_back(std::max(Height >> i, 1u));
+            Levels.emplace_back(size_t{Widths.back()} * Heights.back() * TexelSize);
+        }
+    }
+
+    size_t GetStride(Uint32 Level) const
+    {
+        return Levels[Level].size() / Heights[Level];
+    }
+
+    void ComputeChain(TEXTURE_FORMAT Fmt, IThreadPool* pThreadPool, MIP_FILTER_TYPE FilterType = MIP_FILTER_TYPE_DEFAULT, float AlphaCutoff = 0)
+    {
+        std::vector<void*>  ppData;
+        std::vector<size_t> Strides;
+        for (Uint32 i = 1; i < Levels.size(); ++i)
+        {
+            ppData.push_back(Levels[i].data());
+            Strides.push_back(GetStride(i));
+        }
+
+        ComputeMipChainAttribs Attribs;
+        Attribs.Format            = Fmt;
+        Attribs.Width             = Widths[0];
+        Attribs.Height            = Heights[0];
+        Attribs.pFineMipData      = Levels[0].data();
+        Attribs.FineMipStride     = GetStride(0);
+        Attribs.NumCoarseMips     = static_cast<Uint32>(ppData.size());
+        Attribs.ppCoarseMipData   = ppData.data();
+        Attribs.pCoarseMipStrides = Strides.data();
+        Attribs.FilterType        = FilterType;
+        Attribs.AlphaCutoff       = AlphaCutoff;
+        Attribs.pThreadPool       = pThreadPool;
+        ComputeMipChain(Attribs);
+    }
+
+    void ComputeLevels(TEXTURE_FORMAT Fmt, MIP_FILTER_TYPE FilterType = MIP_FILTER_TYPE_DEFAULT, float AlphaCutoff = 0)
+    {
+        for (Uint32 i = 1; i < Levels.size(); ++i)
+        {
+            ComputeMipLevel({Fmt, Widths[i - 1], Heights[i - 1], Levels[i - 1].data(), GetStride(i - 1),
+                             Levels[i].data(), GetStride(i), FilterType, AlphaCutoff});
+        }
+    }
+
+    // Computes the reference coarse level from the fine level with the given 2x2 filter
+    template <typename ComponentType, typename FilterType, typename ResultType = decltype(std::declval<FilterType>()(ComponentType{}, ComponentType{}, ComponentType{}, ComponentType{}))>
+    std::vector<ResultType> ComputeReferenceLevel(Uint32 Level, Uint32 NumComponents, FilterType Filter) const
+    {
+        const Uint32         FineWidth  = Widths[Level - 1];
+        const Uint32         FineHeight = Heights[Level - 1];
+        const ComponentType* pFine      = reinterpret_cast<const ComponentType*>(Levels[Level - 1].data());
+
+        std::vector<ResultType> Coarse(Levels[Level].size() / sizeof(ComponentType));
+        for (Uint32 y = 0; y < Heights[Level]; ++y)
+        {
+            for (Uint32 x = 0; x < Widths[Level]; ++x)
+            {
+                const Uint32 x0 = x * 2;
+                const Uint32 x1 = std::min(x * 2 + 1, FineWidth - 1);
+                const Uint32 y0 = y * 2;
+                const Uint32 y1 = std::min(y * 2 + 1, FineHeight - 1);
+                for (Uint32 c = 0; c < NumComponents; ++c)
+                {
+                    Coarse[(x + y * Widths[Level]) * NumComponents + c] =
+                        Filter(pFine[(x0 + y0 * FineWidth) * NumComponents + c],
+                               pFine[(x1 + y0 * FineWidth) * NumComponents + c],
+                               pFine[(x0 + y1 * FineWidth) * NumComponents + c],
+                               pFine[(x1 + y1 * FineWidth) * NumComponents + c]);
+                }
+            }
+        }
+        return Coarse;
+    }
+
+    template <typename ComponentType, typename FilterType>
+    void Verify(Uint32 NumComponents, FilterType Filter) const
+    {
+        for (Uint32 i = 1; i < Levels.size(); ++i)
+        {
+            const std::vector<ComponentType> Ref = ComputeReferenceLevel<ComponentType>(i, NumComponents, Filter);
+            EXPECT_EQ(memcmp(Ref.data(), Levels[i].data(), Levels[i].size()), 0) << "Level " << i << " (" << Widths[i] << "x" << Heights[i] << ")";
+        }
+    }
+};
+
+// Texture sizes that exercise the SIMD kernels, their scalar tails, the tile boundaries,
+// and one-texel wide and high levels
+constexpr std::array<std::pair<Uint32, Uint32>, 7> MipChainTestSizes = {
+    std::pair<Uint32, Uint32>{1, 1},
+    std::pair<Uint32, Uint32>{1, 37},
+    std::pair<Uint32, Uint32>{45, 1},
+    std::pair<Uint32, Uint32>{16, 16},
+    std::pair<Uint32, Uint32>{131, 7},
+    std::pair<Uint32, Uint32>{256, 256},
+    std::pair<Uint32, Uint32>{301, 267},
+};
+
+RefCntAutoPtr<IThreadPool> CreateMipChainTestThreadPool()
+{
+    return CreateThreadPool(ThreadPoolCreateInfo{3});
+}
+
+TEST(GraphicsTools_ComputeMipChain, RGBA8)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateMipChainTestThreadPool();
+    for (const auto& Size : MipChainTestSizes)
+    {
+        for (IThreadPool* pPool : {static_cast<IThreadPool*>(nullptr), pThreadPool.RawPtr()})
+        {
+            TestMipChain Chain{Size.first, Size.second, 4};
+            FastRandInt  rnd{0, 0, 255};
+            for (Uint8& c : Chain.Levels[0])
+                c = static_cast<Uint8>(rnd());
+
+            Chain.ComputeChain(TEX_FORMAT_RGBA8_UNORM, pPool);
+            Chain.Verify<Uint8>(4, [](Uint8 c00, Uint8 c10, Uint8 c01, Uint8 c11) {
+                return static_cast<Uint8>((c00 + c10 + c01 + c11) / 4);
+            });
+        }
+    }
+}
+
+TEST(GraphicsTools_ComputeMipChain, SRGBA8)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateMipChainTestThreadPool();
+    for (const auto& Size : MipChainTestSizes)
+    {
+        for (IThreadPool* pPool : {static_cast<IThreadPool*>(nullptr), pThreadPool.RawPtr()})
+        {
+            TestMipChain Chain{Size.first, Size.second, 4};
+            FastRandInt  rnd{1, 0, 255};
+            for (Uint8& c : Chain.Levels[0])
+                c = static_cast<Uint8>(rnd());
+
+            Chain.ComputeChain(TEX_FORMAT_RGBA8_UNORM_SRGB, pPool);
+            Chain.Verify<Uint8>(4, [](Uint8 c00, Uint8 c10, Uint8 c01, Uint8 c11) {
+                float fLinearAverage = (FastGammaToLinear(c00 / 255.f) +
+                                        FastGammaToLinear(c10 / 255.f) +
+                                        FastGammaToLinear(c01 / 255.f) +
+                                        FastGammaToLinear(c11 / 255.f)) *
+                    0.25f;
+                float fSRGB = FastLinearToGamma(fLinearAverage) * 255.f;
+                return static_cast<Uint8>(std::min(std::max(fSRGB, 0.f), 255.f));
+            });
+        }
+    }
+}
+
+TEST(GraphicsTools_ComputeMipChain, Float32)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateMipChainTestThreadPool();
+    for (TEXTURE_FORMAT Fmt : {TEX_FORMAT_R32_FLOAT, TEX_FORMAT_RG32_FLOAT, TEX_FORMAT_RGBA32_FLOAT})
+    {
+        const Uint32 NumComponents = GetTextureFormatAttribs(Fmt).NumComponents;
+        for (const auto& Size : MipChainTestSizes)
+        {
+            for (IThreadPool* pPool : {static_cast<IThreadPool*>(nullptr), pThreadPool.RawPtr()})
+            {
+                TestMipChain  Chain{Size.first, Size.second, NumComponents * 4};
+                FastRandFloat rnd{2, -100.f, 100.f};
+                float*        pData = reinterpret_cast<float*>(Chain.Levels[0].data());
+                for (size_t i = 0; i < Chain.Levels[0].size() / sizeof(float); ++i)
+                    pData[i] = rnd();
+
+                Chain.ComputeChain(Fmt, pPool);
+                Chain.Verify<float>(NumComponents, [](float c00, float c10, float c01, float c11) {
+                    return (c00 + c10 + c01 + c11) * 0.25f;
+                });
+            }
+        }
+    }
+}
+
+// Converts a finite 16-bit float to a 32-bit float
+float HalfToFloat(Uint16 Half)
+{
+    const Uint32 Exp  = (Half >> 10u) & 0x1Fu;
+    const Uint32 Mant = Half & 0x3FFu;
+    VERIFY(Exp != 0x1Fu, "Only finite numbers are expected");
+
+    const float Val = Exp != 0 ?
+        std::ldexp(1.f + static_cast<float>(Mant) / 1024.f, static_cast<int>(Exp) - 15) :
+        std::ldexp(static_cast<float>(Mant), -24);
+    return (Half & 0x8000u) != 0 ? -Val : Val;
+}
+
+TEST(GraphicsTools_ComputeMipChain, Float16)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateMipChainTestThreadPool();
+    for (TEXTURE_FORMAT Fmt : {TEX_FORMAT_R16_FLOAT, TEX_FORMAT_RG16_FLOAT, TEX_FORMAT_RGBA16_FLOAT})
+    {
+        const Uint32 NumComponents = GetTextureFormatAttribs(Fmt).NumComponents;
+        for (const auto& Size : MipChainTestSizes)
+        {
+            for (IThreadPool* pPool : {static_cast<IThreadPool*>(nullptr), pThreadPool.RawPtr()})
+            {
+                TestMipChain Chain{Size.first, Size.second, NumComponents * 2};
+
+                // Values in [-4, -0.5] U [0.5, 4] that are multiples of 2^-6, so that the
+                // averages of the first coarse level are exactly representable.
+                FastRand rnd{3};
+                Uint16*     pData = reinterpret_cast<Uint16*>(Chain.Levels[0].data());
+                for (size_t i = 0; i < Chain.Levels[0].size() / sizeof(Uint16); ++i)
+                {
+                    const Uint32 Bits = static_cast<Uint32>(rnd());
+                    pData[i]          = static_cast<Uint16>(((Bits & 0x4000u) << 1u) | ((14u + ((Bits >> 5u) & 0xFFu) % 3u) << 10u) | ((Bits & 0x1Fu) << 5u));
+                }
+
+                Chain.ComputeChain(Fmt, pPool);
+
+                for (Uint32 i = 1; i < Chain.Levels.size(); ++i)
+                {
+                    const std::vector<float> Ref = Chain.ComputeReferenceLevel<Uint16>(i, NumComponents, [](Uint16 c00, Uint16 c10, Uint16 c01, Uint16 c11) {
+                        return (HalfToFloat(c00) + HalfToFloat(c10) + HalfToFloat(c01) + HalfToFloat(c11)) * 0.25f;
+                    });
+                    const Uint16* pLevel = reinterpret_cast<const Uint16*>(Chain.Levels[i].data());
+                    for (size_t c = 0; c < Ref.size(); ++c)
+                    {
+                        if (i == 1)
+                            ASSERT_EQ(HalfToFloat(pLevel[c]), Ref[c]);
+                        else
+                            ASSERT_NEAR(HalfToFloat(pLevel[c]), Ref[c], std::max(std::abs(Ref[c]) / 1024.f, 1.f / 16777216.f));
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Formats without specialized filters must produce the same results as ComputeMipLevel
+TEST(GraphicsTools_ComputeMipChain, MatchesComputeMipLevel)
+{
+    struct TestCase
+    {
+        TEXTURE_FORMAT  Fmt;
+        MIP_FILTER_TYPE FilterType;
+        float           AlphaCutoff;
+    };
+    const TestCase TestCases[] = {
+        {TEX_FORMAT_R8_UNORM, MIP_FILTER_TYPE_DEFAULT, 0},
+        {TEX_FORMAT_RG8_UINT, MIP_FILTER_TYPE_DEFAULT, 0},
+        {TEX_FORMAT_RGBA8_UINT, MIP_FILTER_TYPE_MOST_FREQUENT, 0},
+        {TEX_FORMAT_RGBA8_UINT, MIP_FILTER_TYPE_BOX_AVERAGE, 0},
+        {TEX_FORMAT_RGBA8_UNORM, MIP_FILTER_TYPE_DEFAULT, 0.5f},
+        {TEX_FORMAT_RGBA8_UNORM_SRGB, MIP_FILTER_TYPE_DEFAULT, 0.25f},
+        {TEX_FORMAT_RGBA8_SNORM, MIP_FILTER_TYPE_DEFAULT, 0},
+        {TEX_FORMAT_R16_UNORM, MIP_FILTER_TYPE_DEFAULT, 0},
+        {TEX_FORMAT_RGB32_FLOAT, MIP_FILTER_TYPE_DEFAULT, 0},
+        {TEX_FORMAT_RG16_FLOAT, MIP_FILTER_TYPE_DEFAULT, 0},
+    };
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateMipChainTestThreadPool();
+    for (const TestCase& Test : TestCases)
+    {
+        const Uint32 TexelSize = GetTextureFormatAttribs(Test.Fmt).GetElementSize();
+        for (const auto& Size : MipChainTestSizes)
+        {
+            TestMipChain Chain{Size.first, Size.second, TexelSize};
+            FastRandInt  rnd{4, 0, 255};
+            for (Uint8& c : Chain.Levels[0])
+                c = static_cast<Uint8>(rnd() & (Test.FilterType == MIP_FILTER_TYPE_MOST_FREQUENT ? 0x03 : 0xFF));
+            if (Test.Fmt == TEX_FORMAT_RGB32_FLOAT || Test.Fmt == TEX_FORMAT_RG16_FLOAT)
+            {
+                // Keep the float values finite by clearing the high exponent bits
+                for (size_t i = 0; i < Chain.Levels[0].size(); i += 2)
+                    Chain.Levels[0][i + 1] &= 0x3F;
+            }
+
+            TestMipChain RefChain = Chain;
+            RefChain.ComputeLevels(Test.Fmt, Test.FilterType, Test.AlphaCutoff);
+            Chain.ComputeChain(Test.Fmt, pThreadPool, Test.FilterType, Test.AlphaCutoff);
+            for (Uint32 i = 1; i < Chain.Levels.size(); ++i)
+            {
+                EXPECT_EQ(Chain.Levels[i], RefChain.Levels[i]) << GetTextureFormatAttribs(Test.Fmt).Name << ", level " << i
+                                                               << " (" << Chain.Widths[i] << "x" << Chain.Heights[i] << ")";
+            }
+        }
+    }
+}
+
+TEST(GraphicsTools_ComputeMipChain, PartialChain)
+{
+    TestMipChain Chain{300, 200, 4, 3};
+    FastRandInt  rnd{5, 0, 255};
+    for (Uint8& c : Chain.Levels[0])
+        c = static_cast<Uint8>(rnd());
+
+    TestMipChain RefChain = Chain;
+    RefChain.ComputeLevels(TEX_FORMAT_RGBA8_UNORM);
+    Chain.ComputeChain(TEX_FORMAT_RGBA8_UNORM, nullptr);
+    EXPECT_EQ(Chain.Levels, RefChain.Levels);
+}
+
 } // namespace
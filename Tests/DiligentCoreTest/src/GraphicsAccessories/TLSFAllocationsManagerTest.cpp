@@ -0,0 +1,279 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TLSFAllocationsManager.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "FastRand.hpp"
+
+#include <vector>
+#include <algorithm>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+using OffsetType = TLSFAllocationsManager::OffsetType;
+
+TEST(GraphicsAccessories_TLSFAllocationsManager, AllocateFree)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    TLSFAllocationsManager Mgr(128, Allocator);
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+    EXPECT_EQ(Mgr.GetFreeSize(), size_t{128});
+    EXPECT_EQ(Mgr.GetUsedSize(), size_t{0});
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), size_t{128});
+    EXPECT_EQ(Mgr.GetFragmentation(), 0.0);
+
+    auto a1 = Mgr.Allocate(17, 4);
+    EXPECT_EQ(a1.UnalignedOffset, OffsetType{0});
+    EXPECT_EQ(a1.Size, OffsetType{20});
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+    EXPECT_EQ(Mgr.GetFreeSize(), size_t{128 - 20});
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), size_t{128 - 20});
+
+    auto a2 = Mgr.Allocate(17, 8);
+    EXPECT_EQ(a2.UnalignedOffset, OffsetType{20});
+    EXPECT_EQ(a2.Size, OffsetType{28});
+
+    auto a3 = Mgr.Allocate(8, 1);
+    EXPECT_EQ(a3.UnalignedOffset, OffsetType{48});
+    EXPECT_EQ(a3.Size, OffsetType{8});
+
+    auto a4 = Mgr.Allocate(11, 8);
+    EXPECT_EQ(a4.UnalignedOffset, OffsetType{56});
+    EXPECT_EQ(a4.Size, OffsetType{16});
+
+    auto a5 = Mgr.Allocate(64, 1);
+    EXPECT_FALSE(a5.IsValid());
+
+    a5 = Mgr.Allocate(16, 1);
+    EXPECT_EQ(a5.UnalignedOffset, OffsetType{72});
+
+    auto a6 = Mgr.Allocate(8, 1);
+    EXPECT_EQ(a6.UnalignedOffset, OffsetType{88});
+
+    auto a7 = Mgr.Allocate(16, 1);
+    EXPECT_EQ(a7.UnalignedOffset, OffsetType{96});
+
+    auto a8 = Mgr.Allocate(8, 1);
+    EXPECT_EQ(a8.UnalignedOffset, OffsetType{112});
+
+    auto a9 = Mgr.Allocate(8, 1);
+    EXPECT_EQ(a9.UnalignedOffset, OffsetType{120});
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{0});
+    EXPECT_TRUE(Mgr.IsFull());
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), size_t{0});
+
+    Mgr.Free(std::move(a6));
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+
+    Mgr.Free(a8.UnalignedOffset, a8.Size);
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{2});
+    EXPECT_EQ(Mgr.GetFragmentation(), 0.5);
+
+    Mgr.Free(std::move(a9));
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{2});
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), size_t{16});
+
+    auto a10 = Mgr.Allocate(16, 1);
+    EXPECT_EQ(a10.UnalignedOffset, OffsetType{112});
+    EXPECT_EQ(a10.Size, OffsetType{16});
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+
+    Mgr.Free(std::move(a10));
+    Mgr.Free(std::move(a7));
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+
+    Mgr.Free(std::move(a4));
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{2});
+
+    Mgr.Free(std::move(a2));
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{3});
+
+    Mgr.Free(std::move(a1));
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{3});
+
+    Mgr.Free(std::move(a3));
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{2});
+
+    Mgr.Free(std::move(a5));
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+    EXPECT_TRUE(Mgr.IsEmpty());
+}
+
+TEST(GraphicsAccessories_TLSFAllocationsManager, Extend)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    TLSFAllocationsManager Mgr(128, Allocator);
+
+    auto a1 = Mgr.Allocate(64, 1);
+    EXPECT_EQ(a1.UnalignedOffset, OffsetType{0});
+
+    auto a2 = Mgr.Allocate(128, 1);
+    EXPECT_FALSE(a2.IsValid());
+
+    Mgr.Extend(128);
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+
+    a2 = Mgr.Allocate(128, 1);
+    EXPECT_EQ(a2.UnalignedOffset, OffsetType{64});
+    EXPECT_EQ(a2.Size, OffsetType{128});
+
+    auto a3 = Mgr.Allocate(64, 1);
+    EXPECT_TRUE(Mgr.IsFull());
+
+    Mgr.Extend(32);
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+
+    auto a4 = Mgr.Allocate(32, 1);
+    EXPECT_TRUE(Mgr.IsFull());
+
+    Mgr.Free(std::move(a1));
+    Mgr.Extend(1024);
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{2});
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), size_t{1024});
+
+    auto a5 = Mgr.Allocate(512, 1);
+    EXPECT_EQ(a5.UnalignedOffset, OffsetType{288});
+
+    Mgr.Free(std::move(a4));
+    Mgr.Free(std::move(a2));
+    Mgr.Free(std::move(a5));
+    Mgr.Free(std::move(a3));
+    EXPECT_TRUE(Mgr.IsEmpty());
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+}
+
+TEST(GraphicsAccessories_TLSFAllocationsManager, FreeOrder)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    constexpr size_t NumAllocs = 6;
+
+    size_t ReleaseOrder[NumAllocs];
+    for (size_t a = 0; a < NumAllocs; ++a)
+        ReleaseOrder[a] = a;
+
+    int NumPerms = 0;
+    do
+    {
+        ++NumPerms;
+        TLSFAllocationsManager Mgr(NumAllocs * 4, Allocator);
+
+        TLSFAllocationsManager::Allocation allocs[NumAllocs];
+        for (size_t a = 0; a < NumAllocs; ++a)
+        {
+            allocs[a] = Mgr.Allocate(4, 1);
+            EXPECT_EQ(allocs[a].UnalignedOffset, a * 4);
+            EXPECT_EQ(allocs[a].Size, OffsetType{4});
+        }
+        for (size_t a = 0; a < NumAllocs; ++a)
+        {
+            Mgr.Free(std::move(allocs[ReleaseOrder[a]]));
+        }
+        EXPECT_TRUE(Mgr.IsEmpty());
+        EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+    } while (std::next_permutation(std::begin(ReleaseOrder), std::end(ReleaseOrder)));
+    EXPECT_EQ(NumPerms, 720);
+}
+
+// Performs the same random sequence of allocations and deallocations with the given manager
+// and verifies that live allocations never overlap and are properly aligned.
+template <typename ManagerType>
+void RunRandomAllocations(Uint32 NumIterations)
+{
+    constexpr OffsetType MaxSize       = OffsetType{1} << 21;
+    constexpr OffsetType MaxAllocSize  = 4096;
+    constexpr size_t     MaxLiveAllocs = 4096;
+
+    ManagerType Mgr{typename ManagerType::CreateInfo{DefaultRawMemoryAllocator::GetAllocator(), MaxSize, /*DbgDisableDebugValidation = */ true}};
+
+    struct LiveAllocation
+    {
+        typename ManagerType::Allocation Alloc;
+
+        OffsetType Alignment = 1;
+    };
+    std::vector<LiveAllocation> LiveAllocs;
+    LiveAllocs.reserve(MaxLiveAllocs);
+
+    std::vector<Uint8> Occupancy(MaxSize);
+
+    FastRand Rnd{0};
+
+    for (Uint32 i = 0; i < NumIterations; ++i)
+    {
+        const bool DoAllocate = LiveAllocs.size() < MaxLiveAllocs / 2 || (LiveAllocs.size() < MaxLiveAllocs && (Rnd() & 1) != 0);
+        if (DoAllocate)
+        {
+            // Mix small and large sizes to produce fragmentation
+            const OffsetType Size      = (Rnd() & 3) != 0 ? 1 + Rnd() % 256 : 1 + (OffsetType{Rnd()} * 8) % MaxAllocSize;
+            const OffsetType Alignment = OffsetType{1} << (Rnd() % 9);
+
+            auto Alloc = Mgr.Allocate(Size, Alignment);
+            if (!Alloc.IsValid())
+                continue;
+
+            const OffsetType AlignedOffset = AlignUp(Alloc.UnalignedOffset, Alignment);
+            EXPECT_LE(AlignedOffset + Size, Alloc.UnalignedOffset + Alloc.Size);
+            for (OffsetType o = Alloc.UnalignedOffset; o < Alloc.UnalignedOffset + Alloc.Size; ++o)
+            {
+                ASSERT_EQ(Occupancy[o], 0) << "Allocations overlap at offset " << o;
+                Occupancy[o] = 1;
+            }
+            LiveAllocs.push_back({std::move(Alloc), Alignment});
+        }
+        else
+        {
+            const size_t Idx   = Rnd() % LiveAllocs.size();
+            auto&        Alloc = LiveAllocs[Idx].Alloc;
+            std::fill(Occupancy.begin() + Alloc.UnalignedOffset, Occupancy.begin() + Alloc.UnalignedOffset + Alloc.Size, Uint8{0});
+            Mgr.Free(std::move(Alloc));
+            LiveAllocs[Idx] = std::move(LiveAllocs.back());
+            LiveAllocs.pop_back();
+        }
+    }
+
+    for (auto& Alloc : LiveAllocs)
+        Mgr.Free(std::move(Alloc.Alloc));
+
+    EXPECT_TRUE(Mgr.IsEmpty());
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), MaxSize);
+}
+
+TEST(GraphicsAccessories_TLSFAllocationsManager, RandomAllocations)
+{
+    RunRandomAllocations<TLSFAllocationsManager>(20000);
+    RunRandomAllocations<VariableSizeAllocationsManager>(20000);
+}
+
+} // namespace
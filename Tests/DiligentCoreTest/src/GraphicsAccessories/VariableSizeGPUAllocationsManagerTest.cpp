@@ -249,4 +249,56 @@ TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, Free)
     }
 }
 
+TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, AllocateAt)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    using OffsetType = VariableSizeAllocationsManager::OffsetType;
+
+    VariableSizeAllocationsManager ListMgr(128, Allocator);
+
+    // Split the free block in the middle
+    auto a1 = ListMgr.AllocateAt(32, 16, 1);
+    EXPECT_EQ(a1.UnalignedOffset, OffsetType{32});
+    EXPECT_EQ(a1.Size, OffsetType{16});
+    EXPECT_EQ(ListMgr.GetNumFreeBlocks(), size_t{2});
+    EXPECT_EQ(ListMgr.GetFreeSize(), size_t{128 - 16});
+    EXPECT_EQ(ListMgr.GetMaxFreeBlockSize(), size_t{128 - 48});
+
+    // Allocate at the start of the free block
+    auto a2 = ListMgr.AllocateAt(0, 8, 1);
+    EXPECT_EQ(a2.UnalignedOffset, OffsetType{0});
+    EXPECT_EQ(a2.Size, OffsetType{8});
+    EXPECT_EQ(ListMgr.GetNumFreeBlocks(), size_t{2});
+
+    // Unaligned offset
+    auto a3 = ListMgr.AllocateAt(10, 5, 4);
+    EXPECT_EQ(a3.UnalignedOffset, OffsetType{10});
+    EXPECT_EQ(a3.Size, OffsetType{10});
+    EXPECT_EQ(ListMgr.GetNumFreeBlocks(), size_t{3});
+
+    // Overlapping allocated regions
+    EXPECT_FALSE(ListMgr.AllocateAt(40, 4, 1).IsValid());
+    EXPECT_FALSE(ListMgr.AllocateAt(28, 8, 1).IsValid());
+    EXPECT_FALSE(ListMgr.AllocateAt(120, 16, 1).IsValid());
+
+    // Allocate at the end of the free block
+    auto a4 = ListMgr.AllocateAt(112, 16, 1);
+    EXPECT_EQ(a4.UnalignedOffset, OffsetType{112});
+    EXPECT_EQ(a4.Size, OffsetType{16});
+
+    // Regular allocations must still work
+    auto a5 = ListMgr.Allocate(48, 1);
+    EXPECT_EQ(a5.UnalignedOffset, OffsetType{48});
+    EXPECT_EQ(a5.Size, OffsetType{48});
+
+    ListMgr.Free(std::move(a3));
+    ListMgr.Free(std::move(a1));
+    ListMgr.Free(std::move(a5));
+    ListMgr.Free(std::move(a2));
+    ListMgr.Free(std::move(a4));
+    EXPECT_EQ(ListMgr.GetNumFreeBlocks(), size_t{1});
+    EXPECT_EQ(ListMgr.GetFreeSize(), size_t{128});
+}
+
 } // namespace
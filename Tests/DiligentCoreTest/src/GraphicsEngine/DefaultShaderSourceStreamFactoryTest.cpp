@@ -0,0 +1,198 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+
+#include "DefaultShaderSourceStreamFactory.h"
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "TempDirectory.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+RefCntAutoPtr<IShaderSourceInputStreamFactory> CreateFactory(const std::string& SearchDirectories, SHADER_SOURCE_FILE_CACHE_MODE CacheMode)
+{
+    DefaultShaderSourceStreamFactoryCreateInfo CreateInfo;
+    CreateInfo.SearchDirectories = SearchDirectories.c_str();
+    CreateInfo.CacheMode         = CacheMode;
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pFactory;
+    CreateDefaultShaderSourceStreamFactory2(CreateInfo, &pFactory);
+    return pFactory;
+}
+
+// Returns the file contents, or "<null>" if the stream can't be created.
+std::string ReadSource(IShaderSourceInputStreamFactory* pFactory, const char* Name)
+{
+    RefCntAutoPtr<IFileStream> pStream;
+    pFactory->CreateInputStream2(Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_SILENT, &pStream);
+    if (!pStream)
+        return "<null>";
+
+    std::string Source(pStream->GetSize(), '\0');
+    if (!Source.empty())
+    {
+        EXPECT_TRUE(pStream->Read(&Source[0], Source.size()));
+    }
+    return Source;
+}
+
+void WriteSource(const std::string& Path, const std::string& Source)
+{
+    ASSERT_TRUE(FileWrapper::WriteFile(Path.c_str(), Source.data(), Source.size()));
+}
+
+TEST(GraphicsEngine_DefaultShaderSourceStreamFactory, NoCache)
+{
+    TempDirectory     TmpDir;
+    const std::string Dir = TmpDir.Get() + FileSystem::SlashSymbol;
+
+    WriteSource(Dir + "Shader.hlsl", "Version1");
+
+    auto pFactory = CreateFactory(TmpDir.Get(), SHADER_SOURCE_FILE_CACHE_MODE_NONE);
+    ASSERT_NE(pFactory, nullptr);
+    EXPECT_EQ(ReadSource(pFactory, "Shader.hlsl"), "Version1");
+    EXPECT_EQ(ReadSource(pFactory, "Missing.hlsl"), "<null>");
+
+    WriteSource(Dir + "Shader.hlsl", "Version2");
+    EXPECT_EQ(ReadSource(pFactory, "Shader.hlsl"), "Version2");
+}
+
+TEST(GraphicsEngine_DefaultShaderSourceStreamFactory, ExplicitInvalidation)
+{
+    TempDirectory     TmpDir;
+    const std::string DirA = TmpDir.Get() + FileSystem::SlashSymbol + "A";
+    const std::string DirB = TmpDir.Get() + FileSystem::SlashSymbol + "B";
+    ASSERT_TRUE(FileSystem::CreateDirectory(DirA.c_str()));
+    ASSERT_TRUE(FileSystem::CreateDirectory(DirB.c_str()));
+
+    const std::string PathA = DirA + FileSystem::SlashSymbol + "Common.fxh";
+    const std::string PathB = DirB + FileSystem::SlashSymbol + "Common.fxh";
+    WriteSource(PathB, "B1");
+    WriteSource(DirA + FileSystem::SlashSymbol + "Empty.fxh", "");
+
+    auto pFactory  = CreateFactory(DirA + ";" + DirB, SHADER_SOURCE_FILE_CACHE_MODE_EXPLICIT);
+    auto pFactory2 = CreateFactory(DirA + ";" + DirB, SHADER_SOURCE_FILE_CACHE_MODE_EXPLICIT);
+    ASSERT_NE(pFactory, nullptr);
+    ASSERT_NE(pFactory2, nullptr);
+
+    EXPECT_EQ(ReadSource(pFactory, "Common.fxh"), "B1");
+    EXPECT_EQ(ReadSource(pFactory2, "Common.fxh"), "B1");
+    EXPECT_EQ(ReadSource(pFactory, "Empty.fxh"), "");
+    EXPECT_EQ(ReadSource(pFactory, "Missing.fxh"), "<null>");
+
+    // The contents, the resolved paths and the missing files are cached until invalidated
+    WriteSource(PathB, "B2");
+    WriteSource(PathA, "A1");
+    WriteSource(DirA + FileSystem::SlashSymbol + "Missing.fxh", "Found");
+    EXPECT_EQ(ReadSource(pFactory, "Common.fxh"), "B1");
+    EXPECT_EQ(ReadSource(pFactory, "Missing.fxh"), "<null>");
+    EXPECT_EQ(ReadSource(pFactory2, "Common.fxh"), "B1");
+
+    // Invalidating one file also resets the resolved paths
+    InvalidateShaderSourceFileCache(PathB.c_str());
+    EXPECT_EQ(ReadSource(pFactory, "Common.fxh"), "A1");
+    EXPECT_EQ(ReadSource(pFactory, "Missing.fxh"), "Found");
+    EXPECT_EQ(ReadSource(pFactory2, "Common.fxh"), "A1");
+
+    WriteSource(PathA, "A2");
+    EXPECT_EQ(ReadSource(pFactory, "Common.fxh"), "A1");
+    const Uint64 Generation = GetShaderSourceFileCacheGeneration();
+    InvalidateShaderSourceFileCache(nullptr);
+    EXPECT_GT(GetShaderSourceFileCacheGeneration(), Generation);
+    EXPECT_EQ(ReadSource(pFactory, "Common.fxh"), "A2");
+
+    // Absolute paths
+    EXPECT_EQ(ReadSource(pFactory, PathB.c_str()), "B2");
+}
+
+TEST(GraphicsEngine_DefaultShaderSourceStreamFactory, ModificationTime)
+{
+    TempDirectory     TmpDir;
+    const std::string Path = TmpDir.Get() + FileSystem::SlashSymbol + "Shader.hlsl";
+    WriteSource(Path, "Version1");
+
+    auto pFactory = CreateFactory(TmpDir.Get(), SHADER_SOURCE_FILE_CACHE_MODE_MODIFICATION_TIME);
+    ASSERT_NE(pFactory, nullptr);
+    EXPECT_EQ(ReadSource(pFactory, "Shader.hlsl"), "Version1");
+
+    const Uint64 ModTime = FileSystem::GetFileModificationTime(Path.c_str());
+    if (ModTime == 0)
+        GTEST_SKIP() << "File modification time is not supported on this platform";
+
+    WriteSource(Path, "Version2");
+    // Make sure that the modification time changes even if the file system has a coarse resolution
+    std::filesystem::last_write_time(Path, std::filesystem::last_write_time(Path) + std::chrono::seconds{2});
+    EXPECT_NE(FileSystem::GetFileModificationTime(Path.c_str()), ModTime);
+    const Uint64 Generation = GetShaderSourceFileCacheGeneration();
+    EXPECT_EQ(ReadSource(pFactory, "Shader.hlsl"), "Version2");
+    // Reloading the modified file advances the generation
+    EXPECT_GT(GetShaderSourceFileCacheGeneration(), Generation);
+
+    FileSystem::DeleteFile(Path.c_str());
+    EXPECT_EQ(ReadSource(pFactory, "Shader.hlsl"), "<null>");
+
+    // Files that were not found must be found once they are created
+    WriteSource(Path, "Version3");
+    EXPECT_EQ(ReadSource(pFactory, "Shader.hlsl"), "Version3");
+
+    const std::string NewPath = TmpDir.Get() + FileSystem::SlashSymbol + "NewShader.hlsl";
+    EXPECT_EQ(ReadSource(pFactory, "NewShader.hlsl"), "<null>");
+    WriteSource(NewPath, "NewVersion1");
+    EXPECT_EQ(ReadSource(pFactory, "NewShader.hlsl"), "NewVersion1");
+}
+
+TEST(GraphicsEngine_DefaultShaderSourceStreamFactory, MaxCacheSize)
+{
+    TempDirectory     TmpDir;
+    const std::string Path = TmpDir.Get() + FileSystem::SlashSymbol + "Shader.hlsl";
+    WriteSource(Path, "Version1");
+
+    auto pFactory = CreateFactory(TmpDir.Get(), SHADER_SOURCE_FILE_CACHE_MODE_EXPLICIT);
+    ASSERT_NE(pFactory, nullptr);
+
+    // With zero cache size, the contents are never cached, while the resolved paths still are
+    SetShaderSourceFileCacheMaxSize(0);
+    EXPECT_EQ(ReadSource(pFactory, "Shader.hlsl"), "Version1");
+    WriteSource(Path, "Version2");
+    EXPECT_EQ(ReadSource(pFactory, "Shader.hlsl"), "Version2");
+
+    SetShaderSourceFileCacheMaxSize(size_t{64} << 20);
+    EXPECT_EQ(ReadSource(pFactory, "Shader.hlsl"), "Version2");
+    WriteSource(Path, "Version3");
+    EXPECT_EQ(ReadSource(pFactory, "Shader.hlsl"), "Version2");
+}
+
+} // namespace
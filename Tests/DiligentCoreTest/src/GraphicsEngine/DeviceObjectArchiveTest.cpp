@@ -0,0 +1,211 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "../../../../Graphics/GraphicsEngine/include/DeviceObjectArchive.hpp"
+#include "../../../../Graphics/GraphicsEngine/include/EngineMemory.h"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "DataBlobImpl.hpp"
+#include "TestingEnvironment.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+using ResourceType = DeviceObjectArchive::ResourceType;
+using DeviceType   = DeviceObjectArchive::DeviceType;
+
+SerializedData MakeTestData(Uint32 Value, size_t Size)
+{
+    SerializedData Data{Size, GetRawAllocator()};
+    Uint8*         pData = Data.Ptr<Uint8>();
+    for (size_t i = 0; i < Size; ++i)
+        pData[i] = static_cast<Uint8>(Value + i * 7);
+    return Data;
+}
+
+std::string GetPSOName(Uint32 Idx)
+{
+    return "Test PSO " + std::to_string(Idx);
+}
+
+void InitTestArchive(DeviceObjectArchive& Archive, Uint32 NumPSOs, Uint32 NumShaders)
+{
+    for (Uint32 i = 0; i < NumPSOs; ++i)
+    {
+        const ResourceType Type = (i % 3 == 0) ? ResourceType::ComputePipeline : ResourceType::GraphicsPipeline;
+
+        DeviceObjectArchive::ResourceData& ResData = Archive.GetResourceData(Type, GetPSOName(i).c_str());
+
+        ResData.Common = MakeTestData(i, 64 + i % 16);
+
+        ResData.DeviceSpecific[static_cast<size_t>(DeviceType::Vulkan)]     = MakeTestData(i + 1, 8);
+        ResData.DeviceSpecific[static_cast<size_t>(DeviceType::Direct3D12)] = MakeTestData(i + 2, 12);
+    }
+
+    for (Uint32 i = 0; i < NumShaders; ++i)
+    {
+        Archive.GetDeviceShaders(DeviceType::Vulkan).emplace_back(MakeTestData(i, 256 + i % 32));
+        Archive.GetDeviceShaders(DeviceType::Direct3D12).emplace_back(MakeTestData(i + 3, 128 + i % 16));
+    }
+}
+
+RefCntAutoPtr<IDataBlob> SerializeArchive(const DeviceObjectArchive& Archive)
+{
+    RefCntAutoPtr<IDataBlob> pData;
+    Archive.Serialize(&pData);
+    return pData;
+}
+
+TEST(DeviceObjectArchiveTest, SerializeDeserialize)
+{
+    constexpr Uint32 NumPSOs    = 100;
+    constexpr Uint32 NumShaders = 20;
+
+    DeviceObjectArchive Archive{7};
+    InitTestArchive(Archive, NumPSOs, NumShaders);
+    // Resources with the same name, but different types
+    Archive.GetResourceData(ResourceType::RenderPass, GetPSOName(1).c_str()).Common = MakeTestData(100, 16);
+    // Names that share a prefix
+    Archive.GetResourceData(ResourceType::ResourceSignature, "PRS").Common  = MakeTestData(101, 16);
+    Archive.GetResourceData(ResourceType::ResourceSignature, "PRS1").Common = MakeTestData(102, 16);
+    Archive.GetResourceData(ResourceType::ResourceSignature, "PR").Common   = MakeTestData(103, 16);
+
+    RefCntAutoPtr<IDataBlob> pData = SerializeArchive(Archive);
+    ASSERT_TRUE(pData);
+
+    DeviceObjectArchive Archive2{DeviceObjectArchive::CreateInfo{pData}};
+    EXPECT_EQ(Archive2.GetContentVersion(), 7u);
+
+    for (Uint32 i = NumPSOs; i > 0; --i)
+    {
+        const Uint32       Idx  = i - 1;
+        const ResourceType Type = (Idx % 3 == 0) ? ResourceType::ComputePipeline : ResourceType::GraphicsPipeline;
+        const std::string  Name = GetPSOName(Idx);
+
+        EXPECT_TRUE(Archive2.HasResource(Type, Name.c_str()));
+
+        const auto* pRes = Archive2.FindResource(Type, Name.c_str());
+        ASSERT_NE(pRes, nullptr);
+        EXPECT_STREQ(pRes->first.GetName(), Name.c_str());
+        EXPECT_EQ(pRes->second, Archive.GetResourceData(Type, Name.c_str()));
+
+        EXPECT_EQ(Archive2.GetDeviceSpecificData(Type, Name.c_str(), DeviceType::Vulkan), MakeTestData(Idx + 1, 8));
+        EXPECT_FALSE(Archive2.GetDeviceSpecificData(Type, Name.c_str(), DeviceType::OpenGL));
+    }
+
+    for (const char* Name : {"PR", "PRS", "PRS1"})
+    {
+        const auto* pRes = Archive2.FindResource(ResourceType::ResourceSignature, Name);
+        ASSERT_NE(pRes, nullptr);
+        EXPECT_EQ(pRes->second, Archive.GetResourceData(ResourceType::ResourceSignature, Name));
+    }
+    EXPECT_EQ(Archive2.FindResource(ResourceType::RenderPass, GetPSOName(1).c_str())->second.Common, MakeTestData(100, 16));
+
+    EXPECT_FALSE(Archive2.HasResource(ResourceType::ResourceSignature, "P"));
+    EXPECT_FALSE(Archive2.HasResource(ResourceType::ResourceSignature, "PRS2"));
+    EXPECT_FALSE(Archive2.HasResource(ResourceType::TilePipeline, GetPSOName(1).c_str()));
+    EXPECT_EQ(Archive2.FindResource(ResourceType::GraphicsPipeline, "Missing PSO"), nullptr);
+
+    for (Uint32 i = 0; i < NumShaders; ++i)
+    {
+        EXPECT_EQ(Archive2.GetSerializedShader(DeviceType::Direct3D12, i), MakeTestData(i + 3, 128 + i % 16));
+        EXPECT_EQ(Archive2.GetSerializedShader(DeviceType::Vulkan, i), MakeTestData(i, 256 + i % 32));
+    }
+    EXPECT_FALSE(Archive2.GetSerializedShader(DeviceType::Vulkan, NumShaders));
+    EXPECT_FALSE(Archive2.GetSerializedShader(DeviceType::OpenGL, 0));
+
+    EXPECT_EQ(Archive2.GetNamedResources().size(), Archive.GetNamedResources().size());
+
+    // Serializing the loaded archive must produce the same data
+    RefCntAutoPtr<IDataBlob> pData2 = SerializeArchive(Archive2);
+    ASSERT_TRUE(pData2);
+    ASSERT_EQ(pData->GetSize(), pData2->GetSize());
+    EXPECT_EQ(memcmp(pData->GetConstDataPtr(), pData2->GetConstDataPtr(), pData->GetSize()), 0);
+}
+
+TEST(DeviceObjectArchiveTest, Modify)
+{
+    DeviceObjectArchive Archive;
+    InitTestArchive(Archive, 10, 4);
+
+    DeviceObjectArchive Archive2{DeviceObjectArchive::CreateInfo{SerializeArchive(Archive)}};
+    // Access some resources before modifying the archive
+    EXPECT_NE(Archive2.FindResource(ResourceType::GraphicsPipeline, GetPSOName(2).c_str()), nullptr);
+
+    Archive2.GetResourceData(ResourceType::GraphicsPipeline, "New PSO").Common = MakeTestData(10, 32);
+    Archive2.RemoveDeviceData(DeviceType::Direct3D12);
+
+    DeviceObjectArchive Archive3{DeviceObjectArchive::CreateInfo{SerializeArchive(Archive2)}};
+    EXPECT_EQ(Archive3.GetNamedResources().size(), 11u);
+    EXPECT_EQ(Archive3.FindResource(ResourceType::GraphicsPipeline, "New PSO")->second.Common, MakeTestData(10, 32));
+    EXPECT_EQ(Archive3.GetDeviceSpecificData(ResourceType::GraphicsPipeline, GetPSOName(2).c_str(), DeviceType::Vulkan), MakeTestData(3, 8));
+    EXPECT_FALSE(Archive3.GetDeviceSpecificData(ResourceType::GraphicsPipeline, GetPSOName(2).c_str(), DeviceType::Direct3D12));
+    EXPECT_FALSE(Archive3.GetSerializedShader(DeviceType::Direct3D12, 0));
+    EXPECT_EQ(Archive3.GetSerializedShader(DeviceType::Vulkan, 3), MakeTestData(3, 256 + 3));
+}
+
+TEST(DeviceObjectArchiveTest, CorruptedData)
+{
+    {
+        DeviceObjectArchive Archive;
+        InitTestArchive(Archive, 10, 4);
+
+        RefCntAutoPtr<IDataBlob> pData = SerializeArchive(Archive);
+
+        // Shader data is out of bounds
+        TestingEnvironment::ErrorScope ExpectedErrors{"Shader data is out of the device object archive bounds"};
+
+        RefCntAutoPtr<DataBlobImpl> pTruncatedData = DataBlobImpl::Create(pData->GetSize() - 1, pData->GetConstDataPtr());
+        DeviceObjectArchive         Archive2;
+        EXPECT_FALSE(Archive2.Deserialize(DeviceObjectArchive::CreateInfo{pTruncatedData}));
+    }
+
+    {
+        DeviceObjectArchive Archive;
+        InitTestArchive(Archive, 10, 0);
+
+        RefCntAutoPtr<IDataBlob> pData = SerializeArchive(Archive);
+
+        // Resource data is only validated when it is accessed
+        RefCntAutoPtr<DataBlobImpl> pTruncatedData = DataBlobImpl::Create(pData->GetSize() - 1, pData->GetConstDataPtr());
+        DeviceObjectArchive         Archive2;
+        EXPECT_TRUE(Archive2.Deserialize(DeviceObjectArchive::CreateInfo{pTruncatedData}));
+        EXPECT_NE(Archive2.FindResource(ResourceType::GraphicsPipeline, GetPSOName(1).c_str()), nullptr);
+
+        // The last resource in the directory
+        TestingEnvironment::ErrorScope ExpectedErrors{"Device object archive may be corrupted"};
+        EXPECT_EQ(Archive2.FindResource(ResourceType::ComputePipeline, GetPSOName(9).c_str()), nullptr);
+    }
+}
+
+} // namespace
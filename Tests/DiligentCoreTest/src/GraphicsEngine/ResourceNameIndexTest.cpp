@@ -0,0 +1,164 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "../../../../Graphics/GraphicsEngine/include/ResourceNameIndex.hpp"
+#include "../../../../Graphics/GraphicsEngine/include/PipelineResourceSignatureBase.hpp"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+class TestResources
+{
+public:
+    void Add(SHADER_TYPE Stages, std::string Name)
+    {
+        m_Names.emplace_back(std::move(Name));
+        m_Stages.push_back(Stages);
+    }
+
+    const std::vector<PipelineResourceDesc>& GetResources()
+    {
+        m_Resources.clear();
+        for (size_t i = 0; i < m_Names.size(); ++i)
+            m_Resources.emplace_back(m_Stages[i], m_Names[i].c_str(), 1u, SHADER_RESOURCE_TYPE_TEXTURE_SRV);
+        return m_Resources;
+    }
+
+private:
+    std::vector<std::string>          m_Names;
+    std::vector<SHADER_TYPE>          m_Stages;
+    std::vector<PipelineResourceDesc> m_Resources;
+};
+
+struct IndexedResources
+{
+    explicit IndexedResources(const std::vector<PipelineResourceDesc>& _Resources) :
+        Resources{_Resources},
+        Table(ResourceNameIndex::GetTableSize(static_cast<Uint32>(Resources.size())))
+    {
+        Index.Initialize(Table.data(), Table.size(), Resources.data(), static_cast<Uint32>(Resources.size()));
+    }
+
+    Uint32 Find(SHADER_TYPE Stages, const char* Name) const
+    {
+        return Index.Find(Resources.data(), static_cast<Uint32>(Resources.size()), Stages, Name);
+    }
+
+    Uint32 FindLinear(SHADER_TYPE Stages, const char* Name) const
+    {
+        return FindResource(Resources.data(), static_cast<Uint32>(Resources.size()), Stages, Name);
+    }
+
+    const std::vector<PipelineResourceDesc>& Resources;
+    std::vector<ResourceNameIndex::Entry>    Table;
+    ResourceNameIndex                        Index;
+};
+
+constexpr SHADER_TYPE TestStages[] = {
+    SHADER_TYPE_VERTEX,
+    SHADER_TYPE_PIXEL,
+    SHADER_TYPE_COMPUTE,
+    SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL,
+    SHADER_TYPE_ALL_GRAPHICS,
+};
+
+void TestIndex(TestResources& Res, bool ExpectIndexed)
+{
+    const std::vector<PipelineResourceDesc>& Resources = Res.GetResources();
+
+    IndexedResources Indexed{Resources};
+    EXPECT_EQ(Indexed.Index.IsIndexed(), ExpectIndexed);
+
+    for (const PipelineResourceDesc& ResDesc : Resources)
+    {
+        for (SHADER_TYPE Stages : TestStages)
+        {
+            EXPECT_EQ(Indexed.Find(Stages, ResDesc.Name), Indexed.FindLinear(Stages, ResDesc.Name))
+                << ResDesc.Name << " " << GetShaderStagesString(Stages);
+        }
+    }
+
+    for (SHADER_TYPE Stages : TestStages)
+    {
+        EXPECT_EQ(Indexed.Find(Stages, "Missing"), ResourceNameIndex::InvalidIndex);
+        EXPECT_EQ(Indexed.Find(Stages, "Tex"), ResourceNameIndex::InvalidIndex);
+    }
+}
+
+TEST(ResourceNameIndexTest, Empty)
+{
+    TestResources Res;
+    TestIndex(Res, false);
+    EXPECT_EQ(ResourceNameIndex::GetTableSize(0), size_t{0});
+}
+
+TEST(ResourceNameIndexTest, UniqueNames)
+{
+    for (Uint32 NumRes : {1u, ResourceNameIndex::MinIndexedItems - 1, ResourceNameIndex::MinIndexedItems, 100u, 1000u})
+    {
+        TestResources Res;
+        for (Uint32 i = 0; i < NumRes; ++i)
+            Res.Add(TestStages[i % _countof(TestStages)], "Tex" + std::to_string(i));
+
+        TestIndex(Res, NumRes >= ResourceNameIndex::MinIndexedItems);
+    }
+}
+
+TEST(ResourceNameIndexTest, SameNamesInDifferentStages)
+{
+    TestResources Res;
+    for (Uint32 i = 0; i < 64; ++i)
+    {
+        const std::string Name = "Res" + std::to_string(i % 16);
+        Res.Add(static_cast<SHADER_TYPE>(1u << (i / 16)), Name);
+    }
+    // Add names that only differ in the last character
+    for (Uint32 i = 0; i < 10; ++i)
+        Res.Add(SHADER_TYPE_COMPUTE, "g_Buffer" + std::to_string(i));
+
+    TestIndex(Res, true);
+
+    const std::vector<PipelineResourceDesc>& Resources = Res.GetResources();
+
+    IndexedResources Indexed{Resources};
+    EXPECT_EQ(Indexed.Find(SHADER_TYPE_VERTEX, "Res5"), 5u);
+    EXPECT_EQ(Indexed.Find(SHADER_TYPE_PIXEL, "Res5"), 21u);
+    EXPECT_EQ(Indexed.Find(SHADER_TYPE_GEOMETRY, "Res5"), 37u);
+    EXPECT_EQ(Indexed.Find(SHADER_TYPE_HULL, "Res5"), 53u);
+    EXPECT_EQ(Indexed.Find(SHADER_TYPE_PIXEL | SHADER_TYPE_HULL, "Res5"), 21u);
+    EXPECT_EQ(Indexed.Find(SHADER_TYPE_DOMAIN, "Res5"), ResourceNameIndex::InvalidIndex);
+    EXPECT_EQ(Indexed.Find(SHADER_TYPE_COMPUTE, "g_Buffer7"), 71u);
+    EXPECT_EQ(Indexed.Find(SHADER_TYPE_COMPUTE, "g_Buffer"), ResourceNameIndex::InvalidIndex);
+}
+
+} // namespace
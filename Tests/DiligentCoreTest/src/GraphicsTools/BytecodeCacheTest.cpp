@@ -24,12 +24,21 @@
  *  of the possibility of such damages.
  */
 
+#include <string>
+#include <vector>
+#include <thread>
+
 #include "BytecodeCache.h"
 #include "DataBlobImpl.hpp"
 #include "DefaultShaderSourceStreamFactory.h"
+#include "XXH128Hasher.hpp"
+#include "Serializer.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "TestingEnvironment.hpp"
 #include "gtest/gtest.h"
 
 using namespace Diligent;
+using namespace Diligent::Testing;
 
 namespace
 {
@@ -186,4 +195,319 @@ TEST(BytecodeCacheTest, Include)
     }
 }
 
+TEST(BytecodeCacheTest, ModifyLoaded)
+{
+    RefCntAutoPtr<IBytecodeCache> pCache;
+    CreateBytecodeCache({RENDER_DEVICE_TYPE_VULKAN}, &pCache);
+    ASSERT_NE(pCache, nullptr);
+
+    ShaderCreateInfo ShaderCI[4];
+    std::string      Names[_countof(ShaderCI)];
+    for (size_t i = 0; i < _countof(ShaderCI); ++i)
+    {
+        Names[i]                    = "Shader" + std::to_string(i);
+        ShaderCI[i].Desc.ShaderType = SHADER_TYPE_COMPUTE;
+        ShaderCI[i].Desc.Name       = Names[i].c_str();
+        ShaderCI[i].Source          = Names[i].c_str();
+
+        pCache->AddBytecode(ShaderCI[i], DataBlobImpl::Create(Names[i].length(), Names[i].c_str()));
+    }
+
+    auto CheckBytecode = [&](size_t i, const char* RefData) {
+        RefCntAutoPtr<IDataBlob> pBytecode;
+        pCache->GetBytecode(ShaderCI[i], &pBytecode);
+        if (RefData == nullptr)
+        {
+            EXPECT_EQ(pBytecode, nullptr);
+            return;
+        }
+        ASSERT_NE(pBytecode, nullptr);
+        EXPECT_EQ(std::string(static_cast<const char*>(pBytecode->GetConstDataPtr()), pBytecode->GetSize()), RefData);
+    };
+
+    RefCntAutoPtr<IDataBlob> pData;
+    pCache->Store(&pData);
+    pCache->Clear();
+    ASSERT_TRUE(pCache->Load(pData));
+    pData.Release();
+
+    CheckBytecode(0, "Shader0");
+    CheckBytecode(3, "Shader3");
+
+    // Modify the loaded data
+    pCache->RemoveBytecode(ShaderCI[1]);
+    pCache->AddBytecode(ShaderCI[2], DataBlobImpl::Create(8, "Updated2"));
+    CheckBytecode(1, nullptr);
+    CheckBytecode(2, "Updated2");
+
+    pCache->Store(&pData);
+    pCache->Clear();
+    CheckBytecode(0, nullptr);
+    ASSERT_TRUE(pCache->Load(pData));
+
+    CheckBytecode(0, "Shader0");
+    CheckBytecode(1, nullptr);
+    CheckBytecode(2, "Updated2");
+    CheckBytecode(3, "Shader3");
+
+    // Corrupted data must be rejected
+    {
+        RefCntAutoPtr<IDataBlob> pTruncated = DataBlobImpl::Create(20, pData->GetConstDataPtr());
+        pCache->Clear();
+
+        TestingEnvironment::ErrorScope ExpectedErrors{"Bytecode cache data is corrupted"};
+        EXPECT_FALSE(pCache->Load(pTruncated));
+    }
+}
+
+TEST(BytecodeCacheTest, RemoveAndLoad)
+{
+    RefCntAutoPtr<IBytecodeCache> pCache;
+    CreateBytecodeCache({RENDER_DEVICE_TYPE_VULKAN}, &pCache);
+    ASSERT_NE(pCache, nullptr);
+
+    ShaderCreateInfo ShaderCI[3];
+    std::string      Names[_countof(ShaderCI)];
+    for (size_t i = 0; i < _countof(ShaderCI); ++i)
+    {
+        Names[i]                    = "Shader" + std::to_string(i);
+        ShaderCI[i].Desc.ShaderType = SHADER_TYPE_COMPUTE;
+        ShaderCI[i].Desc.Name       = Names[i].c_str();
+        ShaderCI[i].Source          = Names[i].c_str();
+    }
+
+    auto CheckBytecode = [&](size_t i, bool Expected) {
+        RefCntAutoPtr<IDataBlob> pBytecode;
+        pCache->GetBytecode(ShaderCI[i], &pBytecode);
+        if (!Expected)
+        {
+            EXPECT_EQ(pBytecode, nullptr) << Names[i];
+            return;
+        }
+        ASSERT_NE(pBytecode, nullptr) << Names[i];
+        EXPECT_EQ(std::string(static_cast<const char*>(pBytecode->GetConstDataPtr()), pBytecode->GetSize()), Names[i]);
+    };
+
+    auto StoreShaders = [&](std::initializer_list<size_t> Shaders) {
+        RefCntAutoPtr<IBytecodeCache> pSrcCache;
+        CreateBytecodeCache({RENDER_DEVICE_TYPE_VULKAN}, &pSrcCache);
+        for (size_t i : Shaders)
+            pSrcCache->AddBytecode(ShaderCI[i], DataBlobImpl::Create(Names[i].length(), Names[i].c_str()));
+
+        RefCntAutoPtr<IDataBlob> pData;
+        pSrcCache->Store(&pData);
+        return pData;
+    };
+
+    RefCntAutoPtr<IDataBlob> pData01 = StoreShaders({0, 1});
+    RefCntAutoPtr<IDataBlob> pData2  = StoreShaders({2});
+
+    ASSERT_TRUE(pCache->Load(pData01));
+    pCache->RemoveBytecode(ShaderCI[0]);
+    CheckBytecode(0, false);
+    CheckBytecode(1, true);
+
+    // The removed bytecode must be found in the newly loaded data
+    ASSERT_TRUE(pCache->Load(pData01));
+    CheckBytecode(0, true);
+    CheckBytecode(1, true);
+
+    // The bytecode removed from the previously loaded data must remain removed
+    pCache->RemoveBytecode(ShaderCI[1]);
+    ASSERT_TRUE(pCache->Load(pData2));
+    CheckBytecode(0, true);
+    CheckBytecode(1, false);
+    CheckBytecode(2, true);
+}
+
+// Creates the bytecode cache data in the legacy format where all bytecode is serialized sequentially
+RefCntAutoPtr<IDataBlob> CreateLegacyCacheData(const std::vector<ShaderCreateInfo>& ShaderCIs, const std::vector<RefCntAutoPtr<IDataBlob>>& Bytecodes)
+{
+    auto WriteData = [&](auto& Stream) {
+        Uint32 Magic        = 0x7ADECACE;
+        Uint32 Version      = 1;
+        Uint64 ElementCount = ShaderCIs.size();
+        Stream(Magic, Version, ElementCount);
+        for (size_t i = 0; i < ShaderCIs.size(); ++i)
+        {
+            XXH128State Hasher;
+            Hasher.Update(ShaderCIs[i], RENDER_DEVICE_TYPE_VULKAN);
+            XXH128Hash Hash     = Hasher.Digest();
+            size_t     DataSize = Bytecodes[i]->GetSize();
+            Stream(Hash.LowPart, Hash.HighPart, DataSize);
+            Stream.CopyBytes(Bytecodes[i]->GetConstDataPtr(), DataSize);
+        }
+    };
+
+    Serializer<SerializerMode::Measure> MeasureStream{};
+    WriteData(MeasureStream);
+    const auto Memory = MeasureStream.AllocateData(DefaultRawMemoryAllocator::GetAllocator());
+
+    Serializer<SerializerMode::Write> WriteStream{Memory};
+    WriteData(WriteStream);
+    return RefCntAutoPtr<IDataBlob>{DataBlobImpl::Create(Memory.Size(), Memory.Ptr())};
+}
+
+void TestLoad(size_t NumShaders, size_t BytecodeSize)
+{
+    std::vector<std::string>              Names(NumShaders);
+    std::vector<ShaderCreateInfo>         ShaderCIs(NumShaders);
+    std::vector<RefCntAutoPtr<IDataBlob>> Bytecodes(NumShaders);
+    for (size_t i = 0; i < NumShaders; ++i)
+    {
+        Names[i]                     = "Shader" + std::to_string(i);
+        ShaderCIs[i].Desc.ShaderType = SHADER_TYPE_PIXEL;
+        ShaderCIs[i].Desc.Name       = Names[i].c_str();
+        ShaderCIs[i].Source          = Names[i].c_str();
+
+        Bytecodes[i] = DataBlobImpl::Create(BytecodeSize);
+        memset(Bytecodes[i]->GetDataPtr(), static_cast<int>(i & 0xFF), BytecodeSize);
+    }
+
+    RefCntAutoPtr<IDataBlob> pData;
+    {
+        RefCntAutoPtr<IBytecodeCache> pCache;
+        CreateBytecodeCache({RENDER_DEVICE_TYPE_VULKAN}, &pCache);
+        ASSERT_NE(pCache, nullptr);
+        for (size_t i = 0; i < NumShaders; ++i)
+            pCache->AddBytecode(ShaderCIs[i], Bytecodes[i]);
+        pCache->Store(&pData);
+    }
+    RefCntAutoPtr<IDataBlob> pLegacyData = CreateLegacyCacheData(ShaderCIs, Bytecodes);
+
+    for (IDataBlob* pCacheData : {pLegacyData.RawPtr(), pData.RawPtr()})
+    {
+        RefCntAutoPtr<IBytecodeCache> pCache;
+        CreateBytecodeCache({RENDER_DEVICE_TYPE_VULKAN}, &pCache);
+        ASSERT_NE(pCache, nullptr);
+
+        EXPECT_TRUE(pCache->Load(pCacheData));
+
+        for (size_t i = 0; i < NumShaders; ++i)
+        {
+            RefCntAutoPtr<IDataBlob> pBytecode;
+            pCache->GetBytecode(ShaderCIs[i], &pBytecode);
+            ASSERT_NE(pBytecode, nullptr);
+            ASSERT_EQ(pBytecode->GetSize(), BytecodeSize);
+            EXPECT_EQ(memcmp(pBytecode->GetConstDataPtr(), Bytecodes[i]->GetConstDataPtr(), BytecodeSize), 0);
+        }
+    }
+}
+
+TEST(BytecodeCacheTest, LegacyFormat)
+{
+    TestLoad(64, 100);
+}
+
+TEST(BytecodeCacheTest, Eviction)
+{
+    constexpr size_t BytecodeSize = 1024;
+    constexpr size_t NumShaders   = 64;
+
+    RefCntAutoPtr<IBytecodeCache> pCache;
+    CreateBytecodeCache({RENDER_DEVICE_TYPE_VULKAN, BytecodeSize * NumShaders / 4}, &pCache);
+    ASSERT_NE(pCache, nullptr);
+
+    std::vector<std::string>      Sources(NumShaders);
+    std::vector<ShaderCreateInfo> ShaderCIs(NumShaders);
+    for (size_t i = 0; i < NumShaders; ++i)
+    {
+        Sources[i]                   = "Shader" + std::to_string(i);
+        ShaderCIs[i].Desc.ShaderType = SHADER_TYPE_VERTEX;
+        ShaderCIs[i].Source          = Sources[i].c_str();
+
+        pCache->AddBytecode(ShaderCIs[i], DataBlobImpl::Create(BytecodeSize));
+    }
+
+    BytecodeCacheStats Stats;
+    pCache->GetStats(Stats);
+    EXPECT_LE(Stats.Size, BytecodeSize * NumShaders / 4);
+    EXPECT_EQ(Stats.EvictionCount, NumShaders - Stats.Size / BytecodeSize);
+    EXPECT_EQ(Stats.HitCount, Uint64{0});
+    EXPECT_EQ(Stats.MissCount, Uint64{0});
+
+    // The most recently added bytecode must be in the cache
+    {
+        RefCntAutoPtr<IDataBlob> pBytecode;
+        pCache->GetBytecode(ShaderCIs.back(), &pBytecode);
+        EXPECT_NE(pBytecode, nullptr);
+    }
+
+    size_t NumFound = 0;
+    for (const ShaderCreateInfo& ShaderCI : ShaderCIs)
+    {
+        RefCntAutoPtr<IDataBlob> pBytecode;
+        pCache->GetBytecode(ShaderCI, &pBytecode);
+        if (pBytecode)
+            ++NumFound;
+    }
+    EXPECT_EQ(NumFound, Stats.Size / BytecodeSize);
+
+    pCache->GetStats(Stats);
+    EXPECT_EQ(Stats.HitCount, NumFound + 1);
+    EXPECT_EQ(Stats.MissCount, NumShaders - NumFound);
+
+    pCache->Clear();
+    pCache->GetStats(Stats);
+    EXPECT_EQ(Stats.Size, Uint64{0});
+}
+
+TEST(BytecodeCacheTest, Multithreading)
+{
+    constexpr size_t NumShaders   = 256;
+    constexpr size_t BytecodeSize = 64;
+    constexpr Uint32 NumThreads   = 8;
+
+    RefCntAutoPtr<IBytecodeCache> pCache;
+    CreateBytecodeCache({RENDER_DEVICE_TYPE_VULKAN, BytecodeSize * NumShaders / 2}, &pCache);
+    ASSERT_NE(pCache, nullptr);
+
+    std::vector<std::string>      Sources(NumShaders);
+    std::vector<ShaderCreateInfo> ShaderCIs(NumShaders);
+    for (size_t i = 0; i < NumShaders; ++i)
+    {
+        Sources[i]                   = "Shader" + std::to_string(i);
+        ShaderCIs[i].Desc.ShaderType = SHADER_TYPE_PIXEL;
+        ShaderCIs[i].Source          = Sources[i].c_str();
+    }
+
+    std::vector<std::thread> Threads(NumThreads);
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        Threads[t] = std::thread{
+            [&, t]() {
+                for (size_t i = 0; i < NumShaders; ++i)
+                {
+                    const size_t Idx = (i * 7 + t * 31) % NumShaders;
+
+                    RefCntAutoPtr<IDataBlob> pBytecode;
+                    pCache->GetBytecode(ShaderCIs[Idx], &pBytecode);
+                    if (pBytecode)
+                    {
+                        // Bytecode is filled with the shader index
+                        EXPECT_EQ(*static_cast<const Uint8*>(pBytecode->GetConstDataPtr()), static_cast<Uint8>(Idx));
+                    }
+                    else
+                    {
+                        pBytecode = DataBlobImpl::Create(BytecodeSize);
+                        memset(pBytecode->GetDataPtr(), static_cast<int>(Idx), BytecodeSize);
+                        pCache->AddBytecode(ShaderCIs[Idx], pBytecode);
+                    }
+                    if ((i % 64) == 0 && t == 0)
+                    {
+                        RefCntAutoPtr<IDataBlob> pData;
+                        pCache->Store(&pData);
+                    }
+                }
+            }};
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    BytecodeCacheStats Stats;
+    pCache->GetStats(Stats);
+    EXPECT_EQ(Stats.HitCount + Stats.MissCount, Uint64{NumThreads * NumShaders});
+    EXPECT_LE(Stats.Size, BytecodeSize * NumShaders / 2);
+}
+
 } // namespace
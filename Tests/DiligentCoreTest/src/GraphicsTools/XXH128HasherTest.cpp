@@ -25,6 +25,8 @@
  */
 
 #include "XXH128Hasher.hpp"
+#include "ShaderSourceFactoryUtils.hpp"
+#include "DefaultShaderSourceStreamFactory.h"
 #include "gtest/gtest.h"
 #include <memory>
 #include <unordered_set>
@@ -76,4 +78,99 @@ TEST(XXH128HasherTest, Struct)
     EXPECT_EQ(Hasher1.Digest(), Hasher2.Digest());
 }
 
+XXH128Hash HashShader(IShaderSourceInputStreamFactory* pFactory, const char* FilePath, const char* Source = nullptr)
+{
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.pShaderSourceStreamFactory = pFactory;
+    ShaderCI.FilePath                   = Source == nullptr ? FilePath : nullptr;
+    ShaderCI.Source                     = Source;
+    ShaderCI.EntryPoint                 = "main";
+
+    XXH128State Hasher;
+    Hasher.Update(ShaderCI);
+    return Hasher.Digest();
+}
+
+TEST(XXH128HasherTest, ShaderIncludes)
+{
+    constexpr char MainSrc[] = R"(
+#include "Common.hlsl"
+#include "Utils.hlsl"
+#include "Common.hlsl"
+float4 main() : SV_Target { return Func() + Util(); })";
+
+    constexpr char UtilsSrc[] = R"(
+#include "Common.hlsl"
+float4 Util() { return Func(); })";
+
+    char CommonSrc[] = "float4 Func() { return float4(0.0, 0.0, 0.0, 0.0); }";
+
+    SetShaderSourceHashCacheMaxSize(64);
+
+    auto pFactory1 = CreateMemoryShaderSourceFactory({{"Main.hlsl", MainSrc}, {"Utils.hlsl", UtilsSrc}, {"Common.hlsl", CommonSrc}});
+    auto pFactory2 = CreateMemoryShaderSourceFactory({{"Main.hlsl", MainSrc}, {"Utils.hlsl", UtilsSrc}, {"Common.hlsl", CommonSrc}}, true);
+
+    const XXH128Hash Hash1 = HashShader(pFactory1, "Main.hlsl");
+    EXPECT_EQ(Hash1, HashShader(pFactory1, "Main.hlsl"));
+    EXPECT_EQ(Hash1, HashShader(pFactory2, "Main.hlsl"));
+    EXPECT_EQ(Hash1, HashShader(pFactory1, nullptr, MainSrc));
+    EXPECT_NE(Hash1, HashShader(pFactory1, "Utils.hlsl"));
+
+    // Modify the include file that is referenced by the first factory
+    CommonSrc[24] = '1';
+
+    auto pFactory3 = CreateMemoryShaderSourceFactory({{"Main.hlsl", MainSrc}, {"Utils.hlsl", UtilsSrc}, {"Common.hlsl", CommonSrc}}, true);
+
+    const XXH128Hash Hash2 = HashShader(pFactory3, "Main.hlsl");
+    EXPECT_NE(Hash1, Hash2);
+
+    InvalidateShaderSourceHashCache(pFactory1, "Common.hlsl");
+    EXPECT_EQ(Hash2, HashShader(pFactory1, "Main.hlsl"));
+    EXPECT_EQ(Hash1, HashShader(pFactory2, "Main.hlsl"));
+
+    InvalidateShaderSourceHashCache();
+    EXPECT_EQ(Hash2, HashShader(pFactory1, "Main.hlsl"));
+    EXPECT_EQ(Hash1, HashShader(pFactory2, "Main.hlsl"));
+
+    SetShaderSourceHashCacheMaxSize(0);
+}
+
+TEST(XXH128HasherTest, ShaderSourceHashCache)
+{
+    constexpr char MainSrc[] = R"(
+#include "Common.hlsl"
+#include "Utils.hlsl"
+float4 main() : SV_Target { return Func() + Util(); })";
+
+    constexpr char UtilsSrc[] = "float4 Util() { return float4(0.0, 0.0, 0.0, 0.0); }";
+
+    char CommonSrc[] = "float4 Func() { return float4(0.0, 0.0, 0.0, 0.0); }";
+
+    auto pFactory = CreateMemoryShaderSourceFactory({{"Main.hlsl", MainSrc}, {"Utils.hlsl", UtilsSrc}, {"Common.hlsl", CommonSrc}});
+
+    // The cache is disabled by default
+    const XXH128Hash Hash1 = HashShader(pFactory, "Main.hlsl");
+    CommonSrc[30]          = '1';
+    const XXH128Hash Hash2 = HashShader(pFactory, "Main.hlsl");
+    EXPECT_NE(Hash1, Hash2);
+
+    SetShaderSourceHashCacheMaxSize(64);
+    EXPECT_EQ(Hash2, HashShader(pFactory, "Main.hlsl"));
+    CommonSrc[30] = '0';
+    EXPECT_EQ(Hash2, HashShader(pFactory, "Main.hlsl"));
+
+    // Invalidating the shader source file cache discards the cached hashes
+    InvalidateShaderSourceFileCache(nullptr);
+    EXPECT_EQ(Hash1, HashShader(pFactory, "Main.hlsl"));
+
+    // Only the last file (Utils.hlsl) is kept in the cache
+    SetShaderSourceHashCacheMaxSize(1);
+    CommonSrc[30] = '1';
+    EXPECT_EQ(Hash2, HashShader(pFactory, "Main.hlsl"));
+
+    SetShaderSourceHashCacheMaxSize(0);
+    CommonSrc[30] = '0';
+    EXPECT_EQ(Hash1, HashShader(pFactory, "Main.hlsl"));
+}
+
 } // namespace
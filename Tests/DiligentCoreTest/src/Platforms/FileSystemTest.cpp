@@ -33,9 +33,11 @@
 
 #include "DebugUtilities.hpp"
 #include "TempDirectory.hpp"
+#include "TestingEnvironment.hpp"
 #include "FileWrapper.hpp"
 #include "FastRand.hpp"
 #include "DataBlobImpl.hpp"
+#include "MappedFileDataBlob.hpp"
 
 using namespace Diligent;
 using namespace Diligent::Testing;
@@ -467,6 +469,84 @@ TEST(Platforms_FileSystem, File)
     EXPECT_FALSE(FileSystem::FileExists(FilePath.c_str()));
 }
 
+TEST(Platforms_FileSystem, MapFile)
+{
+    TempDirectory TmpDir;
+    const auto&   TmpDirPath = TmpDir.Get();
+    ASSERT_TRUE(FileSystem::PathExists(TmpDirPath.c_str()));
+
+    // Use the size that is not a multiple of the page size
+    std::vector<Uint8> Data(100003);
+
+    FastRandInt rnd{1, 0, 255};
+    for (auto& Elem : Data)
+        Elem = static_cast<Uint8>(rnd());
+    const auto FilePath = TmpDirPath + FileSystem::SlashSymbol + "MappedFile.bin";
+    ASSERT_TRUE(FileWrapper::WriteFile(FilePath.c_str(), Data.data(), Data.size()));
+
+    RefCntAutoPtr<IDataBlob> pMappedData;
+    ASSERT_TRUE(FileWrapper::MapWholeFile(FilePath.c_str(), &pMappedData, EMappedFileAccessHint::Sequential));
+    ASSERT_TRUE(pMappedData);
+    ASSERT_EQ(pMappedData->GetSize(), Data.size());
+    EXPECT_EQ(memcmp(pMappedData->GetConstDataPtr(), Data.data(), Data.size()), 0);
+    EXPECT_EQ(pMappedData->GetConstDataPtr(Data.size() - 1), &pMappedData->GetConstDataPtr<Uint8>()[Data.size() - 1]);
+
+#if PLATFORM_LINUX || PLATFORM_MACOS || PLATFORM_IOS || PLATFORM_TVOS || PLATFORM_ANDROID
+    {
+        RefCntAutoPtr<MappedFileDataBlob> pMappedBlob = MappedFileDataBlob::Create(FilePath.c_str());
+        ASSERT_TRUE(pMappedBlob) << "Memory-mapped files must be supported on this platform";
+        pMappedBlob->Advise(EMappedFileAccessHint::Random, 4097, 8192);
+        pMappedBlob->Advise(EMappedFileAccessHint::WillNeed);
+        EXPECT_EQ(memcmp(pMappedBlob->GetConstDataPtr(), Data.data(), Data.size()), 0);
+
+        // Writes go to private copies of the pages and never reach the file
+        Uint8* pWritableData = static_cast<Uint8*>(pMappedBlob->GetDataPtr());
+        ASSERT_NE(pWritableData, nullptr);
+        EXPECT_EQ(pWritableData, pMappedBlob->GetConstDataPtr());
+        pWritableData[5000] = static_cast<Uint8>(~Data[5000]);
+        EXPECT_EQ(static_cast<const Uint8*>(pMappedBlob->GetConstDataPtr())[5000], static_cast<Uint8>(~Data[5000]));
+        EXPECT_EQ(pMappedData->GetConstDataPtr<Uint8>()[5000], Data[5000]);
+    }
+
+    // The mapping must remain valid after the file is replaced
+    {
+        const auto  NewFilePath = TmpDirPath + FileSystem::SlashSymbol + "MappedFile.tmp";
+        const Uint8 NewData[]   = {1, 2, 3};
+        ASSERT_TRUE(FileWrapper::WriteFile(NewFilePath.c_str(), NewData, sizeof(NewData)));
+        ASSERT_EQ(std::rename(NewFilePath.c_str(), FilePath.c_str()), 0);
+
+        EXPECT_EQ(memcmp(pMappedData->GetConstDataPtr<Uint8>(11), &Data[11], Data.size() - 11), 0);
+    }
+#endif
+    pMappedData.Release();
+
+    // Empty files can't be mapped and are read instead
+    {
+        const auto EmptyFilePath = TmpDirPath + FileSystem::SlashSymbol + "EmptyFile.bin";
+        {
+            FileWrapper File{EmptyFilePath.c_str(), EFileAccessMode::Overwrite};
+            ASSERT_TRUE(File);
+        }
+        EXPECT_EQ(FileSystem::MapFile(EmptyFilePath.c_str()), nullptr);
+
+        RefCntAutoPtr<IDataBlob> pEmptyData;
+        EXPECT_TRUE(FileWrapper::MapWholeFile(EmptyFilePath.c_str(), &pEmptyData));
+        ASSERT_TRUE(pEmptyData);
+        EXPECT_EQ(pEmptyData->GetSize(), size_t{0});
+    }
+
+    {
+        const auto MissingFilePath = TmpDirPath + FileSystem::SlashSymbol + "MissingFile.bin";
+        EXPECT_EQ(FileSystem::MapFile(MissingFilePath.c_str()), nullptr);
+
+        RefCntAutoPtr<IDataBlob> pMissingData;
+
+        TestingEnvironment::ErrorScope ExpectedErrors{"Failed to open file"};
+        EXPECT_FALSE(FileWrapper::MapWholeFile(MissingFilePath.c_str(), &pMissingData, EMappedFileAccessHint::Normal, /*Silent = */ true));
+        EXPECT_FALSE(pMissingData);
+    }
+}
+
 TEST(Platforms_FileSystem, Directories)
 {
     TempDirectory TmpDir;
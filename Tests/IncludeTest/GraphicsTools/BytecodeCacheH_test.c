@@ -39,4 +39,5 @@ void TestBytecodeCacheCInterface()
     IBytecodeCache_RemoveBytecode(pCache, (ShaderCreateInfo*)NULL);
     IBytecodeCache_Store(pCache, (IDataBlob**)NULL);
     IBytecodeCache_Clear(pCache);
+    IBytecodeCache_GetStats(pCache, (BytecodeCacheStats*)NULL);
 }